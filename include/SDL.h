@@ -69,6 +69,7 @@
 #include "SDL_assert.h"
 #include "SDL_atomic.h"
 #include "SDL_audio.h"
+#include "SDL_capture.h"
 #include "SDL_clipboard.h"
 #include "SDL_cpuinfo.h"
 #include "SDL_endian.h"
@@ -47,9 +47,12 @@ typedef enum
     SDL_BLENDMODE_ADD = 0x00000002,      /**< additive blending
                                               dstRGB = (srcRGB * srcA) + dstRGB
                                               dstA = dstA */
-    SDL_BLENDMODE_MOD = 0x00000004       /**< color modulate
+    SDL_BLENDMODE_MOD = 0x00000004,      /**< color modulate
                                               dstRGB = srcRGB * dstRGB
                                               dstA = dstA */
+    SDL_BLENDMODE_PREMULTIPLIED = 0x00000008 /**< premultiplied alpha blending
+                                              dstRGB = srcRGB + (dstRGB * (1-srcA))
+                                              dstA = srcA + (dstA * (1-srcA)) */
 } SDL_BlendMode;
 
 /* Ends C function definitions when using C++ */
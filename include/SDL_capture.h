@@ -0,0 +1,168 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2014 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+/**
+ * \file SDL_capture.h
+ *
+ * Include file for recording presented frames to a stream
+ *
+ * A frame capture records the frames presented with SDL_UpdateWindowSurface()
+ * or SDL_RenderPresent().  Presenting copies the frame into a queue, and a
+ * writer thread encodes it to the stream, so recording doesn't wait for the
+ * stream unless the queue is full and the capture was asked to.
+ */
+
+#ifndef _SDL_capture_h
+#define _SDL_capture_h
+
+#include "SDL_stdinc.h"
+#include "SDL_render.h"
+#include "SDL_rwops.h"
+#include "SDL_video.h"
+
+#include "begin_code.h"
+/* Set up for C function definitions, even when using C++ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ *  \brief The formats frames can be written in.
+ */
+typedef enum
+{
+    SDL_CAPTURE_RAW,    /**< Packed 24-bit RGB frames, back to back */
+    SDL_CAPTURE_Y4M,    /**< A YUV4MPEG2 stream with 4:2:0 chroma */
+    SDL_CAPTURE_BMP     /**< BMP files, back to back */
+} SDL_CaptureFormat;
+
+/**
+ *  \brief What happens to a frame that is presented while the queue is full.
+ */
+typedef enum
+{
+    SDL_CAPTURE_DROP,   /**< The frame isn't recorded */
+    SDL_CAPTURE_WAIT    /**< Presenting waits for the writer to make room */
+} SDL_CapturePolicy;
+
+struct SDL_FrameCapture;
+typedef struct SDL_FrameCapture SDL_FrameCapture;
+
+/* Function prototypes */
+
+/**
+ *  \brief Create a frame capture writing to a stream.
+ *
+ *  \param dst The stream to write the frames to.  It's written from the
+ *             writer thread and shouldn't be used until the capture is
+ *             closed.
+ *  \param freedst Non-zero to close the stream when the capture is closed,
+ *                 or right away if it can't be created.
+ *  \param format The format to write the frames in.
+ *  \param fps The frame rate written to the header of a Y4M stream, ignored
+ *             for the other formats.
+ *  \param queue_length The number of frames that can wait for the writer.
+ *  \param policy What happens to frames presented while the queue is full.
+ *
+ *  \return The capture, or NULL if there was an error.
+ *
+ *  Raw and Y4M streams have the size of the first frame recorded, frames of
+ *  other sizes are dropped.  The capture records nothing until it's set on a
+ *  window or renderer.
+ *
+ *  \sa SDL_SetWindowCapture()
+ *  \sa SDL_SetRendererCapture()
+ *  \sa SDL_CloseFrameCapture()
+ */
+extern DECLSPEC SDL_FrameCapture * SDLCALL SDL_CreateFrameCapture(SDL_RWops * dst,
+                                                                  int freedst,
+                                                                  SDL_CaptureFormat format,
+                                                                  int fps,
+                                                                  int queue_length,
+                                                                  SDL_CapturePolicy policy);
+
+/**
+ *  \brief Record the frames presented with SDL_UpdateWindowSurface() and
+ *         SDL_UpdateWindowSurfaceRects() on a window.
+ *
+ *  \param window The window to record.
+ *  \param capture The capture to record to, or NULL to stop recording.
+ *
+ *  \return 0 on success, or -1 on error.
+ *
+ *  A capture records a single window or renderer, setting it on another one
+ *  stops the recording of the first.  Only the surface is recorded, frames
+ *  need to be presented in full to be recorded in full.
+ */
+extern DECLSPEC int SDLCALL SDL_SetWindowCapture(SDL_Window * window,
+                                                 SDL_FrameCapture * capture);
+
+/**
+ *  \brief Record the frames presented with SDL_RenderPresent() on a renderer.
+ *
+ *  \param renderer The renderer to record.
+ *  \param capture The capture to record to, or NULL to stop recording.
+ *
+ *  \return 0 on success, or -1 on error.
+ *
+ *  The frames are read back with the renderer's SDL_RenderReadPixels()
+ *  support, renderers without it can't be recorded.  Frames presented while
+ *  a render target is set aren't recorded.
+ */
+extern DECLSPEC int SDLCALL SDL_SetRendererCapture(SDL_Renderer * renderer,
+                                                   SDL_FrameCapture * capture);
+
+/**
+ *  \brief Get the number of frames written and dropped so far.
+ *
+ *  \param capture The capture to query.
+ *  \param written A pointer filled in with the number of frames written to
+ *                 the stream, or NULL.
+ *  \param dropped A pointer filled in with the number of frames that were
+ *                 presented but won't be written, or NULL.
+ *
+ *  Frames still in the queue are in neither count.
+ */
+extern DECLSPEC void SDLCALL SDL_GetFrameCaptureStats(SDL_FrameCapture * capture,
+                                                      Uint32 * written,
+                                                      Uint32 * dropped);
+
+/**
+ *  \brief Write the frames still in the queue and free the capture.
+ *
+ *  \param capture The capture to close.
+ *
+ *  \return 0 on success, or -1 if writing any of the frames failed.
+ *
+ *  The capture stops recording the window or renderer it was set on.
+ */
+extern DECLSPEC int SDLCALL SDL_CloseFrameCapture(SDL_FrameCapture * capture);
+
+
+/* Ends C function definitions when using C++ */
+#ifdef __cplusplus
+}
+#endif
+#include "close_code.h"
+
+#endif /* _SDL_capture_h */
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -64,6 +64,25 @@ extern "C" {
  */
 #define SDL_HINT_FRAMEBUFFER_ACCELERATION   "SDL_FRAMEBUFFER_ACCELERATION"
 
+/**
+ *  \brief  A variable controlling whether an accelerated SDL screen surface
+ *          is presented from a separate thread.
+ *
+ *  This variable can be set to the following values:
+ *    "0"       - SDL_UpdateWindowSurface() uploads the surface and presents
+ *                it before returning
+ *    "1"       - SDL_UpdateWindowSurface() copies the updated areas aside and
+ *                returns, a presenter thread uploads and presents them
+ *
+ *  It only has an effect when the surface is accelerated, see
+ *  SDL_HINT_FRAMEBUFFER_ACCELERATION, and is checked when the renderer for it
+ *  is created.  If frames are updated faster than they can be presented,
+ *  frames that weren't presented yet are combined.  Errors in presenting are
+ *  reported by the next SDL_UpdateWindowSurface() call.  By default the
+ *  surface is presented before returning.
+ */
+#define SDL_HINT_FRAMEBUFFER_THREAD   "SDL_FRAMEBUFFER_THREAD"
+
 /**
  *  \brief  A variable specifying which render driver to use.
  *
@@ -435,6 +454,57 @@ extern "C" {
  */
 #define SDL_HINT_VIDEO_MAC_FULLSCREEN_SPACES    "SDL_VIDEO_MAC_FULLSCREEN_SPACES"
 
+/**
+ *  \brief  A variable controlling how many threads the software pixel routines
+ *          may use for large images, like the conversions done by
+ *          SDL_ConvertPixels() and SDL_ConvertSurface(), or the YUV to RGB
+ *          conversion of YUV textures on the software renderer.
+ *
+ *  This variable can be set to the following values:
+ *    "0"       - Use one thread per CPU core
+ *    "1"       - Do all the work on the calling thread
+ *    "N"       - Use up to N threads, including the calling thread
+ *
+ *  By default all the work is done on the calling thread.  The results are
+ *  the same with any number of threads.
+ */
+#define SDL_HINT_SOFTWARE_THREADS "SDL_SOFTWARE_THREADS"
+
+/**
+ *  \brief  A variable controlling the row alignment of the surfaces SDL
+ *          allocates, like the ones from SDL_CreateRGBSurface() and
+ *          SDL_ConvertSurface().
+ *
+ *  This variable can be set to the following values:
+ *    "0"       - Only surfaces created with SDL_SIMD_ALIGNED are aligned
+ *    "16"      - Align the pitch of every new surface to 16 bytes
+ *    "32"      - Align the pitch of every new surface to 32 bytes
+ *    "64"      - Align the pitch of every new surface to 64 bytes
+ *
+ *  Aligned surfaces start on a 64 byte boundary and have the
+ *  SDL_SIMD_ALIGNED flag set.  By default only surfaces created with
+ *  SDL_SIMD_ALIGNED are aligned, to the SIMD register size of the CPU.
+ */
+#define SDL_HINT_SURFACE_ALIGNMENT "SDL_SURFACE_ALIGNMENT"
+
+/**
+ *  \brief  A variable controlling whether SDL_UpdateWindowSurface() only
+ *          presents the parts of the window surface that were drawn to.
+ *
+ *  This variable can be set to the following values:
+ *    "0"       - SDL_UpdateWindowSurface() presents the whole surface
+ *    "1"       - Blits, fills and software rendering into the window surface
+ *                are recorded, and SDL_UpdateWindowSurface() only presents
+ *                those areas
+ *
+ *  The hint is checked when SDL_GetWindowSurface() creates the surface.
+ *  Pixels written directly aren't seen, lock the surface around such writes
+ *  to have it presented in full, or present them with
+ *  SDL_UpdateWindowSurfaceRects().  By default the whole surface is
+ *  presented.
+ */
+#define SDL_HINT_WINDOW_SURFACE_DAMAGE "SDL_WINDOW_SURFACE_DAMAGE"
+
 
 /**
  *  \brief  An enumeration of hint priorities
@@ -85,6 +85,21 @@ typedef struct SDL_RendererInfo
     int max_texture_height;     /**< The maximimum texture height */
 } SDL_RendererInfo;
 
+/**
+ *  \brief Counters kept by a renderer since it was created.
+ *
+ *  \sa SDL_GetRenderStats()
+ */
+typedef struct SDL_RenderStats
+{
+    Uint32 culled_copies;       /**< Copies outside the viewport and clip rect */
+    Uint32 culled_rects;        /**< Filled rects outside the viewport and clip rect */
+    Uint32 culled_points;       /**< Points outside the viewport and clip rect */
+    Uint32 culled_lines;        /**< Line segments outside the viewport and clip rect */
+    Uint64 unlocked_bytes;      /**< Bytes of streaming textures unlocked */
+    Uint64 uploaded_bytes;      /**< The part of them that was uploaded */
+} SDL_RenderStats;
+
 /**
  *  \brief The access pattern allowed for a texture.
  */
@@ -425,6 +440,26 @@ extern DECLSPEC int SDLCALL SDL_LockTexture(SDL_Texture * texture,
                                             const SDL_Rect * rect,
                                             void **pixels, int *pitch);
 
+/**
+ *  \brief Mark part of a locked texture as changed.
+ *
+ *  \param texture   The texture, which is locked with SDL_LockTexture().
+ *  \param rect      A pointer to the rectangle that changed, in texture
+ *                   coordinates, or NULL for the entire locked area.
+ *
+ *  \return 0 on success, or -1 if the texture is not valid or not locked.
+ *
+ *  If any part of the texture is marked while it is locked, unlocking it
+ *  only uploads the marked parts, merged into a few rectangles, instead of
+ *  the entire locked area.  Changes to the parts that weren't marked may
+ *  not be uploaded.
+ *
+ *  \sa SDL_LockTexture()
+ *  \sa SDL_UnlockTexture()
+ */
+extern DECLSPEC int SDLCALL SDL_MarkTextureDirty(SDL_Texture * texture,
+                                                 const SDL_Rect * rect);
+
 /**
  *  \brief Unlock a texture, uploading the changes to video memory, if needed.
  *
@@ -820,6 +855,25 @@ extern DECLSPEC int SDLCALL SDL_RenderReadPixels(SDL_Renderer * renderer,
  */
 extern DECLSPEC void SDLCALL SDL_RenderPresent(SDL_Renderer * renderer);
 
+/**
+ *  \brief Get the counters a renderer has kept since it was created.
+ *
+ *  \param renderer The renderer to query.
+ *  \param stats    A pointer filled in with the counters.
+ *
+ *  \return 0 on success, or -1 if the renderer is not valid.
+ *
+ *  Draws that fall entirely outside the viewport and clip rect are dropped
+ *  before they reach the driver, and counted as culled.
+ *
+ *  The bytes are counted on renderers that upload a copy of a streaming
+ *  texture when it is unlocked, and for textures converted to a format the
+ *  renderer supports.  If parts of a texture were marked with
+ *  SDL_MarkTextureDirty(), fewer bytes are uploaded than were unlocked.
+ */
+extern DECLSPEC int SDLCALL SDL_GetRenderStats(SDL_Renderer * renderer,
+                                               SDL_RenderStats * stats);
+
 /**
  *  \brief Destroy the specified texture.
  *
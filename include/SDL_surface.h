@@ -53,6 +53,7 @@ extern "C" {
 #define SDL_PREALLOC        0x00000001  /**< Surface uses preallocated memory */
 #define SDL_RLEACCEL        0x00000002  /**< Surface is RLE encoded */
 #define SDL_DONTFREE        0x00000004  /**< Surface is referenced internally */
+#define SDL_SIMD_ALIGNED    0x00000008  /**< Surface uses aligned memory */
 /* @} *//* Surface flags */
 
 /**
@@ -106,7 +107,13 @@ typedef int (*SDL_blit) (struct SDL_Surface * src, SDL_Rect * srcrect,
  *
  *  If the function runs out of memory, it will return NULL.
  *
- *  \param flags The \c flags are obsolete and should be set to 0.
+ *  If \c flags contains ::SDL_SIMD_ALIGNED, the pixels start on a cache line
+ *  and the pitch is a multiple of the SIMD register size (or of the
+ *  ::SDL_HINT_SURFACE_ALIGNMENT value), so the blitters and fills can use
+ *  aligned memory access.  The padding at the end of each row belongs to
+ *  the surface and may be overwritten by SDL.
+ *
+ *  \param flags 0, or ::SDL_SIMD_ALIGNED.
  *  \param width The width in pixels of the surface to create.
  *  \param height The height in pixels of the surface to create.
  *  \param depth The depth in bits of the surface to create.
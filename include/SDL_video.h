@@ -691,6 +691,9 @@ extern DECLSPEC SDL_Surface * SDLCALL SDL_GetWindowSurface(SDL_Window * window);
  *
  *  \return 0 on success, or -1 on error.
  *
+ *  With SDL_HINT_WINDOW_SURFACE_DAMAGE set, only the areas drawn to since
+ *  the last update are copied.
+ *
  *  \sa SDL_GetWindowSurface()
  *  \sa SDL_UpdateWindowSurfaceRects()
  */
@@ -32,6 +32,16 @@ extern void SDL_CalculateAudioSpec(SDL_AudioSpec * spec);
 /* The actual mixing thread function */
 extern int SDLCALL SDL_RunAudio(void *audiop);
 
+/* Convert (num_samples) signed 16/32-bit or float samples to 32-bit float
+   in the byte order of (dst_fmt), using SIMD where available. (dst) may be
+   the same buffer as (src), the conversion expands in place. */
+extern void SDL_ConvertAudioToFloat(float *dst, const void *src, int num_samples,
+                                    SDL_AudioFormat src_fmt, SDL_AudioFormat dst_fmt);
+
+/* Returns a vectorized SDL_AudioFilter for the conversion, or NULL */
+extern SDL_AudioFilter SDL_ChooseAudioFloatCVT(SDL_AudioFormat src_fmt,
+                                               SDL_AudioFormat dst_fmt);
+
 /* this is used internally to access some autogenerated code. */
 typedef struct
 {
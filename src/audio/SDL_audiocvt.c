@@ -842,6 +842,10 @@ SDL_HandTunedTypeCVT(SDL_AudioFormat src_fmt, SDL_AudioFormat dst_fmt)
      *  processor, platform, compiler, or library here.
      */
 
+    if (SDL_AUDIO_ISFLOAT(dst_fmt)) {
+        return SDL_ChooseAudioFloatCVT(src_fmt, dst_fmt);
+    }
+
     return NULL;                /* no specialized converter code available. */
 }
 
@@ -0,0 +1,414 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2014 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "../SDL_internal.h"
+
+/* Vectorized conversion of 16/32-bit integer and float audio to 32-bit float.
+   The results are bit-exact with the converters generated by
+   sdlgenaudiocvt.pl, so these can be swapped in transparently. */
+
+#include "SDL_audio.h"
+#include "SDL_cpuinfo.h"
+#include "SDL_assert.h"
+#include "SDL_audio_c.h"
+
+#if defined(__ARM_NEON__) || defined(__ARM_NEON)
+#include <arm_neon.h>
+#define SDL_AUDIOCVT_NEON 1
+#endif
+
+/* These must match the constants in SDL_audiotypecvt.c */
+#define DIVBY32767 3.05185094759972e-05f
+#define DIVBY2147483647 4.6566128752458e-10f
+
+#if SDL_BYTEORDER == SDL_LIL_ENDIAN
+#define NATIVE_ENDIAN(fmt) (!SDL_AUDIO_ISBIGENDIAN(fmt))
+#else
+#define NATIVE_ENDIAN(fmt) (SDL_AUDIO_ISBIGENDIAN(fmt))
+#endif
+
+/* Scalar version, also used for the tail of the vector loops.
+   Walks back to front so that (dst) may alias (src) when expanding. */
+static void
+SDL_ConvertAudioToFloat_Scalar(float *dst, const Uint8 *src, int num_samples,
+                               SDL_AudioFormat src_fmt, int swap_dst)
+{
+    int i;
+
+    if (SDL_AUDIO_BITSIZE(src_fmt) == 16) {
+        const Uint16 *src16 = ((const Uint16 *) src) + num_samples - 1;
+        const int swap_src = !NATIVE_ENDIAN(src_fmt);
+        dst += num_samples - 1;
+        for (i = num_samples; i; --i, --src16, --dst) {
+            const Sint16 sample = (Sint16) (swap_src ? SDL_Swap16(*src16) : *src16);
+            const float val = ((float) sample) * DIVBY32767;
+            *dst = swap_dst ? SDL_SwapFloat(val) : val;
+        }
+    } else if (SDL_AUDIO_ISFLOAT(src_fmt)) {
+        const Uint32 *src32 = ((const Uint32 *) src) + num_samples - 1;
+        Uint32 *dst32 = ((Uint32 *) dst) + num_samples - 1;
+        const int swap = (!NATIVE_ENDIAN(src_fmt)) != (swap_dst != 0);
+        for (i = num_samples; i; --i, --src32, --dst32) {
+            *dst32 = swap ? SDL_Swap32(*src32) : *src32;
+        }
+    } else {
+        const Uint32 *src32 = ((const Uint32 *) src) + num_samples - 1;
+        const int swap_src = !NATIVE_ENDIAN(src_fmt);
+        dst += num_samples - 1;
+        for (i = num_samples; i; --i, --src32, --dst) {
+            const Sint32 sample = (Sint32) (swap_src ? SDL_Swap32(*src32) : *src32);
+            const float val = ((float) sample) * DIVBY2147483647;
+            *dst = swap_dst ? SDL_SwapFloat(val) : val;
+        }
+    }
+}
+
+/* Each SIMD kernel converts whole blocks of 8 samples, back to front, and
+   returns the number of leading samples it left for the scalar code. */
+
+#ifdef __SSE2__
+static SDL_INLINE __m128i
+SwapVec16_SSE2(__m128i x)
+{
+    return _mm_or_si128(_mm_slli_epi16(x, 8), _mm_srli_epi16(x, 8));
+}
+
+static SDL_INLINE __m128i
+SwapVec32_SSE2(__m128i x)
+{
+    x = _mm_shufflelo_epi16(x, _MM_SHUFFLE(2, 3, 0, 1));
+    x = _mm_shufflehi_epi16(x, _MM_SHUFFLE(2, 3, 0, 1));
+    return SwapVec16_SSE2(x);
+}
+
+static int
+SDL_ConvertAudioToFloat_SSE2(float *dst, const Uint8 *src, int num_samples,
+                             SDL_AudioFormat src_fmt, int swap_dst)
+{
+    const int swap_src = !NATIVE_ENDIAN(src_fmt);
+    int i = num_samples & ~7;
+
+    if (SDL_AUDIO_BITSIZE(src_fmt) == 16) {
+        const __m128 divby = _mm_set1_ps(DIVBY32767);
+        while (i > 0) {
+            __m128i in, lo, hi;
+            __m128 flo, fhi;
+            i -= 8;
+            in = _mm_loadu_si128((const __m128i *) (src + i * 2));
+            if (swap_src) {
+                in = SwapVec16_SSE2(in);
+            }
+            /* sign-extend by placing each sample in the top half */
+            lo = _mm_srai_epi32(_mm_unpacklo_epi16(in, in), 16);
+            hi = _mm_srai_epi32(_mm_unpackhi_epi16(in, in), 16);
+            flo = _mm_mul_ps(_mm_cvtepi32_ps(lo), divby);
+            fhi = _mm_mul_ps(_mm_cvtepi32_ps(hi), divby);
+            if (swap_dst) {
+                flo = _mm_castsi128_ps(SwapVec32_SSE2(_mm_castps_si128(flo)));
+                fhi = _mm_castsi128_ps(SwapVec32_SSE2(_mm_castps_si128(fhi)));
+            }
+            _mm_storeu_ps(dst + i + 4, fhi);
+            _mm_storeu_ps(dst + i, flo);
+        }
+    } else if (SDL_AUDIO_ISFLOAT(src_fmt)) {
+        const int swap = swap_src != (swap_dst != 0);
+        while (i > 0) {
+            __m128i a, b;
+            i -= 8;
+            a = _mm_loadu_si128((const __m128i *) (src + i * 4));
+            b = _mm_loadu_si128((const __m128i *) (src + i * 4 + 16));
+            if (swap) {
+                a = SwapVec32_SSE2(a);
+                b = SwapVec32_SSE2(b);
+            }
+            _mm_storeu_si128((__m128i *) (dst + i), a);
+            _mm_storeu_si128((__m128i *) (dst + i + 4), b);
+        }
+    } else {
+        const __m128 divby = _mm_set1_ps(DIVBY2147483647);
+        while (i > 0) {
+            __m128i a, b;
+            __m128 fa, fb;
+            i -= 8;
+            a = _mm_loadu_si128((const __m128i *) (src + i * 4));
+            b = _mm_loadu_si128((const __m128i *) (src + i * 4 + 16));
+            if (swap_src) {
+                a = SwapVec32_SSE2(a);
+                b = SwapVec32_SSE2(b);
+            }
+            fa = _mm_mul_ps(_mm_cvtepi32_ps(a), divby);
+            fb = _mm_mul_ps(_mm_cvtepi32_ps(b), divby);
+            if (swap_dst) {
+                fa = _mm_castsi128_ps(SwapVec32_SSE2(_mm_castps_si128(fa)));
+                fb = _mm_castsi128_ps(SwapVec32_SSE2(_mm_castps_si128(fb)));
+            }
+            _mm_storeu_ps(dst + i, fa);
+            _mm_storeu_ps(dst + i + 4, fb);
+        }
+    }
+    return 0;
+}
+#endif /* __SSE2__ */
+
+#ifdef SDL_AUDIOCVT_NEON
+static int
+SDL_ConvertAudioToFloat_NEON(float *dst, const Uint8 *src, int num_samples,
+                             SDL_AudioFormat src_fmt, int swap_dst)
+{
+    const int swap_src = !NATIVE_ENDIAN(src_fmt);
+    int i = num_samples & ~7;
+
+    if (SDL_AUDIO_BITSIZE(src_fmt) == 16) {
+        while (i > 0) {
+            int16x8_t in;
+            float32x4_t flo, fhi;
+            i -= 8;
+            in = vld1q_s16((const int16_t *) (src + i * 2));
+            if (swap_src) {
+                in = vreinterpretq_s16_u8(vrev16q_u8(vreinterpretq_u8_s16(in)));
+            }
+            flo = vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(in))), DIVBY32767);
+            fhi = vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(in))), DIVBY32767);
+            if (swap_dst) {
+                flo = vreinterpretq_f32_u8(vrev32q_u8(vreinterpretq_u8_f32(flo)));
+                fhi = vreinterpretq_f32_u8(vrev32q_u8(vreinterpretq_u8_f32(fhi)));
+            }
+            vst1q_f32(dst + i + 4, fhi);
+            vst1q_f32(dst + i, flo);
+        }
+    } else if (SDL_AUDIO_ISFLOAT(src_fmt)) {
+        const int swap = swap_src != (swap_dst != 0);
+        while (i > 0) {
+            uint8x16_t a, b;
+            i -= 8;
+            a = vld1q_u8(src + i * 4);
+            b = vld1q_u8(src + i * 4 + 16);
+            if (swap) {
+                a = vrev32q_u8(a);
+                b = vrev32q_u8(b);
+            }
+            vst1q_u8((Uint8 *) (dst + i), a);
+            vst1q_u8((Uint8 *) (dst + i + 4), b);
+        }
+    } else {
+        while (i > 0) {
+            int32x4_t a, b;
+            float32x4_t fa, fb;
+            i -= 8;
+            a = vld1q_s32((const int32_t *) (src + i * 4));
+            b = vld1q_s32((const int32_t *) (src + i * 4 + 16));
+            if (swap_src) {
+                a = vreinterpretq_s32_u8(vrev32q_u8(vreinterpretq_u8_s32(a)));
+                b = vreinterpretq_s32_u8(vrev32q_u8(vreinterpretq_u8_s32(b)));
+            }
+            fa = vmulq_n_f32(vcvtq_f32_s32(a), DIVBY2147483647);
+            fb = vmulq_n_f32(vcvtq_f32_s32(b), DIVBY2147483647);
+            if (swap_dst) {
+                fa = vreinterpretq_f32_u8(vrev32q_u8(vreinterpretq_u8_f32(fa)));
+                fb = vreinterpretq_f32_u8(vrev32q_u8(vreinterpretq_u8_f32(fb)));
+            }
+            vst1q_f32(dst + i, fa);
+            vst1q_f32(dst + i + 4, fb);
+        }
+    }
+    return 0;
+}
+#endif /* SDL_AUDIOCVT_NEON */
+
+#ifdef __ALTIVEC__
+/* AltiVec has no cheap unaligned access, so this only handles buffers
+   that are 16-byte aligned (the PS3 audio DMA blocks always are). */
+static int
+SDL_ConvertAudioToFloat_AltiVec(float *dst, const Uint8 *src, int num_samples,
+                                SDL_AudioFormat src_fmt, int swap_dst)
+{
+    const vector unsigned char swap16 =
+        (vector unsigned char) { 1, 0, 3, 2, 5, 4, 7, 6,
+                                 9, 8, 11, 10, 13, 12, 15, 14 };
+    const vector unsigned char swap32 =
+        (vector unsigned char) { 3, 2, 1, 0, 7, 6, 5, 4,
+                                 11, 10, 9, 8, 15, 14, 13, 12 };
+    /* adding -0.0f is exact, so vec_madd rounds like a plain multiply */
+    const vector float negzero =
+        (vector float) vec_sl(vec_splat_u32(-1), vec_splat_u32(-1));
+    const int swap_src = !NATIVE_ENDIAN(src_fmt);
+    int i = num_samples & ~7;
+
+    if ((((size_t) dst) | ((size_t) src)) & 15) {
+        return num_samples;
+    }
+
+    if (SDL_AUDIO_BITSIZE(src_fmt) == 16) {
+        const vector float divby = (vector float) { DIVBY32767, DIVBY32767,
+                                                    DIVBY32767, DIVBY32767 };
+        while (i > 0) {
+            vector signed short in;
+            vector float fh, fl;
+            i -= 8;
+            in = vec_ld(i * 2, (const short *) src);
+            if (swap_src) {
+                in = vec_perm(in, in, swap16);
+            }
+            fh = vec_madd(vec_ctf(vec_unpackh(in), 0), divby, negzero);
+            fl = vec_madd(vec_ctf(vec_unpackl(in), 0), divby, negzero);
+            if (swap_dst) {
+                fh = vec_perm(fh, fh, swap32);
+                fl = vec_perm(fl, fl, swap32);
+            }
+            vec_st(fl, (i + 4) * 4, dst);
+            vec_st(fh, i * 4, dst);
+        }
+    } else if (SDL_AUDIO_ISFLOAT(src_fmt)) {
+        const int swap = swap_src != (swap_dst != 0);
+        while (i > 0) {
+            vector unsigned char a, b;
+            i -= 8;
+            a = vec_ld(i * 4, src);
+            b = vec_ld(i * 4 + 16, src);
+            if (swap) {
+                a = vec_perm(a, a, swap32);
+                b = vec_perm(b, b, swap32);
+            }
+            vec_st(a, i * 4, (Uint8 *) dst);
+            vec_st(b, i * 4 + 16, (Uint8 *) dst);
+        }
+    } else {
+        const vector float divby = (vector float) { DIVBY2147483647, DIVBY2147483647,
+                                                    DIVBY2147483647, DIVBY2147483647 };
+        while (i > 0) {
+            vector signed int a, b;
+            vector float fa, fb;
+            i -= 8;
+            a = vec_ld(i * 4, (const int *) src);
+            b = vec_ld(i * 4 + 16, (const int *) src);
+            if (swap_src) {
+                a = vec_perm(a, a, swap32);
+                b = vec_perm(b, b, swap32);
+            }
+            fa = vec_madd(vec_ctf(a, 0), divby, negzero);
+            fb = vec_madd(vec_ctf(b, 0), divby, negzero);
+            if (swap_dst) {
+                fa = vec_perm(fa, fa, swap32);
+                fb = vec_perm(fb, fb, swap32);
+            }
+            vec_st(fa, i * 4, dst);
+            vec_st(fb, i * 4 + 16, dst);
+        }
+    }
+    return 0;
+}
+#endif /* __ALTIVEC__ */
+
+void
+SDL_ConvertAudioToFloat(float *dst, const void *src, int num_samples,
+                        SDL_AudioFormat src_fmt, SDL_AudioFormat dst_fmt)
+{
+    const Uint8 *src8 = (const Uint8 *) src;
+    const int swap_dst = !NATIVE_ENDIAN(dst_fmt);
+    const int tail = num_samples & 7;
+    int head = num_samples - tail;
+
+    SDL_assert(SDL_AUDIO_ISFLOAT(dst_fmt) && SDL_AUDIO_BITSIZE(dst_fmt) == 32);
+    SDL_assert(SDL_AUDIO_BITSIZE(src_fmt) == 16 || SDL_AUDIO_BITSIZE(src_fmt) == 32);
+    SDL_assert(SDL_AUDIO_ISSIGNED(src_fmt));
+
+    /* The tail goes first: we work back to front for in-place expansion. */
+    if (tail) {
+        const int src_offset = head * (SDL_AUDIO_BITSIZE(src_fmt) / 8);
+        SDL_ConvertAudioToFloat_Scalar(dst + head, src8 + src_offset, tail,
+                                       src_fmt, swap_dst);
+    }
+
+#if defined(__SSE2__)
+    if (SDL_HasSSE2()) {
+        head = SDL_ConvertAudioToFloat_SSE2(dst, src8, head, src_fmt, swap_dst);
+    }
+#elif defined(SDL_AUDIOCVT_NEON)
+    head = SDL_ConvertAudioToFloat_NEON(dst, src8, head, src_fmt, swap_dst);
+#elif defined(__ALTIVEC__)
+    if (SDL_HasAltiVec()) {
+        head = SDL_ConvertAudioToFloat_AltiVec(dst, src8, head, src_fmt, swap_dst);
+    }
+#endif
+
+    if (head) {
+        SDL_ConvertAudioToFloat_Scalar(dst, src8, head, src_fmt, swap_dst);
+    }
+}
+
+/* SDL_AudioFilter entry points for SDL_HandTunedTypeCVT() */
+static void SDLCALL
+SDL_Convert_to_F32LSB_SIMD(SDL_AudioCVT * cvt, SDL_AudioFormat format)
+{
+    const int num_samples = cvt->len_cvt / (SDL_AUDIO_BITSIZE(format) / 8);
+
+    SDL_ConvertAudioToFloat((float *) cvt->buf, cvt->buf, num_samples,
+                            format, AUDIO_F32LSB);
+    cvt->len_cvt = num_samples * sizeof (float);
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, AUDIO_F32LSB);
+    }
+}
+
+static void SDLCALL
+SDL_Convert_to_F32MSB_SIMD(SDL_AudioCVT * cvt, SDL_AudioFormat format)
+{
+    const int num_samples = cvt->len_cvt / (SDL_AUDIO_BITSIZE(format) / 8);
+
+    SDL_ConvertAudioToFloat((float *) cvt->buf, cvt->buf, num_samples,
+                            format, AUDIO_F32MSB);
+    cvt->len_cvt = num_samples * sizeof (float);
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, AUDIO_F32MSB);
+    }
+}
+
+SDL_AudioFilter
+SDL_ChooseAudioFloatCVT(SDL_AudioFormat src_fmt, SDL_AudioFormat dst_fmt)
+{
+    SDL_bool have_simd = SDL_FALSE;
+
+#if defined(__SSE2__)
+    have_simd = SDL_HasSSE2();
+#elif defined(SDL_AUDIOCVT_NEON)
+    have_simd = SDL_TRUE;
+#elif defined(__ALTIVEC__)
+    have_simd = SDL_HasAltiVec();
+#endif
+
+    if (!have_simd) {
+        return NULL;  /* the generated scalar converters are just as good. */
+    }
+    if (!SDL_AUDIO_ISSIGNED(src_fmt) || SDL_AUDIO_BITSIZE(src_fmt) < 16) {
+        return NULL;
+    }
+
+    switch (dst_fmt) {
+    case AUDIO_F32LSB:
+        return SDL_Convert_to_F32LSB_SIMD;
+    case AUDIO_F32MSB:
+        return SDL_Convert_to_F32MSB_SIMD;
+    default:
+        break;
+    }
+    return NULL;
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -57,10 +57,17 @@ PSL1GHT_AUD_OpenDevice(_THIS, const char *devname, int iscapture)
     SDL_memset(this->hidden, 0, (sizeof *this->hidden));
 
 
-	// PS3 Libaudio only handles floats
+	// PS3 Libaudio only handles big-endian floats, but 16/32-bit integer
+	// and little-endian float samples are converted in place inside the
+	// DMA block by PlayDevice, so SDL never needs its own convert buffer.
     while ((!valid_datatype) && (test_format)) {
         this->spec.format = test_format;
         switch (test_format) {
+        case AUDIO_S16LSB:
+        case AUDIO_S16MSB:
+        case AUDIO_S32LSB:
+        case AUDIO_S32MSB:
+        case AUDIO_F32LSB:
         case AUDIO_F32MSB:
             valid_datatype = 1;
             break;
@@ -112,11 +119,17 @@ PSL1GHT_AUD_OpenDevice(_THIS, const char *devname, int iscapture)
 
 	_last_filled_buf = _config.numBlocks - 1;
 
+	if (!valid_datatype) {
+		test_format = AUDIO_F32MSB;
+	}
+
+	_block_size = sizeof(float) * AUDIO_BLOCK_SAMPLES * _config.channelCount;
+
 	this->spec.format = test_format;
-	this->spec.size = sizeof(float) * AUDIO_BLOCK_SAMPLES * _config.channelCount;
 	this->spec.freq = 48000;
 	this->spec.samples = AUDIO_BLOCK_SAMPLES;
 	this->spec.channels = _config.channelCount;
+	SDL_CalculateAudioSpec(&this->spec);
 
     return ret == 0;
 }
@@ -124,20 +137,14 @@ PSL1GHT_AUD_OpenDevice(_THIS, const char *devname, int iscapture)
 static void
 PSL1GHT_AUD_PlayDevice(_THIS)
 {
-	deprintf( "PSL1GHT_AUD_PlayDevice(%08X.%08X)\n", SHW64(this));
-	
-	/*
-	while( _config.readIndex == _last_filled_buf) // FIXME this is a mess to remove when queued event will me integrated
-	{
-		deprintf( "\tplaying too fast... waiting a ms\n");
-		//sleep(1);
-	}*/
-    /*TransferSoundData *sound = SDL_malloc(sizeof(TransferSoundData));
-    if (!sound) {
-        SDL_OutOfMemory();
-    }
-
-    playGenericSound(this->hidden->mixbuf, this->hidden->mixlen);*/
+	// The mixer wrote this->spec.format samples at the start of the block,
+	// expand them to big-endian floats in place.
+	if (this->spec.format != AUDIO_F32MSB && _fill_buf) {
+		SDL_ConvertAudioToFloat((float *) _fill_buf, _fill_buf,
+		                        AUDIO_BLOCK_SAMPLES * _config.channelCount,
+		                        this->spec.format, AUDIO_F32MSB);
+	}
+	_fill_buf = NULL;
 }
 
 
@@ -174,7 +181,8 @@ PSL1GHT_AUD_GetDeviceBuf(_THIS)
 	// deprintf( "\tbuffer address (%08X.%08X => %08X.%08X)\n", SHW64(_config.audioDataStart), SHW64(dma_buf));
 
 	_last_filled_buf = filling;
-    return (dma_buf + (filling * this->spec.size));
+	_fill_buf = dma_buf + (filling * _block_size);
+    return _fill_buf;
 }
 
 /* This function waits until it is possible to write a full sound buffer */
@@ -196,7 +204,7 @@ PSL1GHT_AUD_Init(SDL_AudioDriverImpl * impl)
 	deprintf( "PSL1GHT_AUD_Init(%08X.%08X)\n", SHW64(impl));
 	/* Set the function pointers */
 	impl->OpenDevice = PSL1GHT_AUD_OpenDevice;
-	//impl->PlayDevice = PSL1GHT_AUD_PlayDevice;
+	impl->PlayDevice = PSL1GHT_AUD_PlayDevice;
     impl->WaitDevice = ALSA_WaitDevice;
 	impl->CloseDevice = PSL1GHT_AUD_CloseDevice;
 	impl->GetDeviceBuf = PSL1GHT_AUD_GetDeviceBuf;
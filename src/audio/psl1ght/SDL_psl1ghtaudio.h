@@ -38,6 +38,8 @@ struct SDL_PrivateAudioData
 	audioPortConfig config;
 	u32 portNum;
 	u32 last_filled_buf;
+	u32 block_size; // Bytes per DMA block, always F32MSB
+	Uint8 *fill_buf; // DMA block handed out by GetDeviceBuf
 	sys_event_queue_t snd_queue; // Queue identifier
 	u64	snd_queue_key; // Queue Key
 };
@@ -46,6 +48,8 @@ struct SDL_PrivateAudioData
 #define _config this->hidden->config
 #define _portNum this->hidden->portNum
 #define _last_filled_buf this->hidden->last_filled_buf
+#define _block_size this->hidden->block_size
+#define _fill_buf this->hidden->fill_buf
 #define _snd_queue  this->hidden->snd_queue 
 #define _snd_queue_key this->hidden->snd_queue_key
 
@@ -575,3 +575,10 @@
 #define SDL_GetDefaultAssertionHandler SDL_GetDefaultAssertionHandler_REAL
 #define SDL_GetAssertionHandler SDL_GetAssertionHandler_REAL
 #define SDL_DXGIGetOutputInfo SDL_DXGIGetOutputInfo_REAL
+#define SDL_CreateFrameCapture SDL_CreateFrameCapture_REAL
+#define SDL_SetWindowCapture SDL_SetWindowCapture_REAL
+#define SDL_SetRendererCapture SDL_SetRendererCapture_REAL
+#define SDL_GetFrameCaptureStats SDL_GetFrameCaptureStats_REAL
+#define SDL_CloseFrameCapture SDL_CloseFrameCapture_REAL
+#define SDL_MarkTextureDirty SDL_MarkTextureDirty_REAL
+#define SDL_GetRenderStats SDL_GetRenderStats_REAL
@@ -606,3 +606,10 @@ SDL_DYNAPI_PROC(SDL_AssertionHandler,SDL_GetAssertionHandler,(void **a),(a),retu
 #ifdef __WIN32__
 SDL_DYNAPI_PROC(void,SDL_DXGIGetOutputInfo,(int a,int *b, int *c),(a,b,c),)
 #endif
+SDL_DYNAPI_PROC(SDL_FrameCapture*,SDL_CreateFrameCapture,(SDL_RWops *a, int b, SDL_CaptureFormat c, int d, int e, SDL_CapturePolicy f),(a,b,c,d,e,f),return)
+SDL_DYNAPI_PROC(int,SDL_SetWindowCapture,(SDL_Window *a, SDL_FrameCapture *b),(a,b),return)
+SDL_DYNAPI_PROC(int,SDL_SetRendererCapture,(SDL_Renderer *a, SDL_FrameCapture *b),(a,b),return)
+SDL_DYNAPI_PROC(void,SDL_GetFrameCaptureStats,(SDL_FrameCapture *a, Uint32 *b, Uint32 *c),(a,b,c),)
+SDL_DYNAPI_PROC(int,SDL_CloseFrameCapture,(SDL_FrameCapture *a),(a),return)
+SDL_DYNAPI_PROC(int,SDL_MarkTextureDirty,(SDL_Texture *a, const SDL_Rect *b),(a,b),return)
+SDL_DYNAPI_PROC(int,SDL_GetRenderStats,(SDL_Renderer *a, SDL_RenderStats *b),(a,b),return)
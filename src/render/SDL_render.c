@@ -28,6 +28,8 @@
 #include "SDL_render.h"
 #include "SDL_sysrender.h"
 #include "software/SDL_render_sw_c.h"
+#include "../video/SDL_capture_c.h"
+#include "../video/SDL_rect_c.h"
 
 
 #define SDL_WINDOWRENDERDATA    "_SDL_WindowRenderData"
@@ -105,6 +107,54 @@ SDL_GetRenderDriverInfo(int index, SDL_RendererInfo * info)
 #endif
 }
 
+void
+SDL_RenderWindowEvent(SDL_Renderer * renderer, const SDL_WindowEvent * event)
+{
+    if (renderer->WindowEvent) {
+        renderer->WindowEvent(renderer, event);
+    }
+
+    if (event->event == SDL_WINDOWEVENT_SIZE_CHANGED) {
+        if (renderer->logical_w) {
+            UpdateLogicalSize(renderer);
+        } else {
+            /* Window was resized, reset viewport */
+            int w, h;
+
+            if (renderer->GetOutputSize) {
+                renderer->GetOutputSize(renderer, &w, &h);
+            } else {
+                SDL_GetWindowSize(renderer->window, &w, &h);
+            }
+
+            if (renderer->target) {
+                renderer->viewport_backup.x = 0;
+                renderer->viewport_backup.y = 0;
+                renderer->viewport_backup.w = w;
+                renderer->viewport_backup.h = h;
+            } else {
+                renderer->viewport.x = 0;
+                renderer->viewport.y = 0;
+                renderer->viewport.w = w;
+                renderer->viewport.h = h;
+                renderer->UpdateViewport(renderer);
+            }
+        }
+    } else if (event->event == SDL_WINDOWEVENT_HIDDEN) {
+        renderer->hidden = SDL_TRUE;
+    } else if (event->event == SDL_WINDOWEVENT_SHOWN) {
+        if (!(SDL_GetWindowFlags(renderer->window) & SDL_WINDOW_MINIMIZED)) {
+            renderer->hidden = SDL_FALSE;
+        }
+    } else if (event->event == SDL_WINDOWEVENT_MINIMIZED) {
+        renderer->hidden = SDL_TRUE;
+    } else if (event->event == SDL_WINDOWEVENT_RESTORED) {
+        if (!(SDL_GetWindowFlags(renderer->window) & SDL_WINDOW_HIDDEN)) {
+            renderer->hidden = SDL_FALSE;
+        }
+    }
+}
+
 static int
 SDL_RendererEventWatch(void *userdata, SDL_Event *event)
 {
@@ -113,49 +163,7 @@ SDL_RendererEventWatch(void *userdata, SDL_Event *event)
     if (event->type == SDL_WINDOWEVENT) {
         SDL_Window *window = SDL_GetWindowFromID(event->window.windowID);
         if (window == renderer->window) {
-            if (renderer->WindowEvent) {
-                renderer->WindowEvent(renderer, &event->window);
-            }
-
-            if (event->window.event == SDL_WINDOWEVENT_SIZE_CHANGED) {
-                if (renderer->logical_w) {
-                    UpdateLogicalSize(renderer);
-                } else {
-                    /* Window was resized, reset viewport */
-                    int w, h;
-
-                    if (renderer->GetOutputSize) {
-                        renderer->GetOutputSize(renderer, &w, &h);
-                    } else {
-                        SDL_GetWindowSize(renderer->window, &w, &h);
-                    }
-
-                    if (renderer->target) {
-                        renderer->viewport_backup.x = 0;
-                        renderer->viewport_backup.y = 0;
-                        renderer->viewport_backup.w = w;
-                        renderer->viewport_backup.h = h;
-                    } else {
-                        renderer->viewport.x = 0;
-                        renderer->viewport.y = 0;
-                        renderer->viewport.w = w;
-                        renderer->viewport.h = h;
-                        renderer->UpdateViewport(renderer);
-                    }
-                }
-            } else if (event->window.event == SDL_WINDOWEVENT_HIDDEN) {
-                renderer->hidden = SDL_TRUE;
-            } else if (event->window.event == SDL_WINDOWEVENT_SHOWN) {
-                if (!(SDL_GetWindowFlags(window) & SDL_WINDOW_MINIMIZED)) {
-                    renderer->hidden = SDL_FALSE;
-                }
-            } else if (event->window.event == SDL_WINDOWEVENT_MINIMIZED) {
-                renderer->hidden = SDL_TRUE;
-            } else if (event->window.event == SDL_WINDOWEVENT_RESTORED) {
-                if (!(SDL_GetWindowFlags(window) & SDL_WINDOW_HIDDEN)) {
-                    renderer->hidden = SDL_FALSE;
-                }
-            }
+            SDL_RenderWindowEvent(renderer, &event->window);
         }
     } else if (event->type == SDL_MOUSEMOTION) {
         if (renderer->logical_w) {
@@ -186,6 +194,12 @@ SDL_RendererEventWatch(void *userdata, SDL_Event *event)
     return 0;
 }
 
+void
+SDL_DetachRendererEvents(SDL_Renderer * renderer)
+{
+    SDL_DelEventWatch(SDL_RendererEventWatch, renderer);
+}
+
 int
 SDL_CreateWindowAndRenderer(int width, int height, Uint32 window_flags,
                             SDL_Window **window, SDL_Renderer **renderer)
@@ -944,6 +958,7 @@ SDL_LockTexture(SDL_Texture * texture, const SDL_Rect * rect,
 {
     SDL_Renderer *renderer;
     SDL_Rect full_rect;
+    int status;
 
     CHECK_TEXTURE_MAGIC(texture, -1);
 
@@ -960,13 +975,83 @@ SDL_LockTexture(SDL_Texture * texture, const SDL_Rect * rect,
     }
 
     if (texture->yuv) {
-        return SDL_LockTextureYUV(texture, rect, pixels, pitch);
+        status = SDL_LockTextureYUV(texture, rect, pixels, pitch);
     } else if (texture->native) {
-        return SDL_LockTextureNative(texture, rect, pixels, pitch);
+        status = SDL_LockTextureNative(texture, rect, pixels, pitch);
     } else {
         renderer = texture->renderer;
-        return renderer->LockTexture(renderer, texture, rect, pixels, pitch);
+        status = renderer->LockTexture(renderer, texture, rect, pixels, pitch);
+    }
+    if (status == 0) {
+        texture->locked = SDL_TRUE;
+        texture->marked = SDL_FALSE;
+        texture->locked_rect = *rect;
+    }
+    return status;
+}
+
+int
+SDL_MarkTextureDirty(SDL_Texture * texture, const SDL_Rect * rect)
+{
+    SDL_Rect clipped;
+
+    CHECK_TEXTURE_MAGIC(texture, -1);
+
+    if (!texture->locked) {
+        return SDL_SetError("SDL_MarkTextureDirty(): texture must be locked");
+    }
+
+    if (!texture->dirty) {
+        texture->dirty = (SDL_DamageRegion *) SDL_calloc(1, sizeof(*texture->dirty));
+        if (!texture->dirty) {
+            return SDL_OutOfMemory();
+        }
+        texture->dirty->w = texture->w;
+        texture->dirty->h = texture->h;
+    }
+    if (!texture->marked) {
+        texture->dirty->numrects = 0;
+        texture->marked = SDL_TRUE;
+    }
+
+    if (!rect) {
+        rect = &texture->locked_rect;
+    }
+    if (SDL_IntersectRect(rect, &texture->locked_rect, &clipped)) {
+        SDL_AddDamageRect(texture->dirty, &clipped);
     }
+    return 0;
+}
+
+int
+SDL_UploadLockedTexture(SDL_Renderer * renderer, SDL_Texture * texture,
+                        const SDL_Rect * rect, const void *pixels, int pitch)
+{
+    const int bpp = SDL_BYTESPERPIXEL(texture->format);
+    const SDL_Rect *rects = rect;
+    SDL_Rect clipped;
+    int i, numrects = 1;
+
+    renderer->stats.unlocked_bytes += (Uint64)rect->w * rect->h * bpp;
+
+    /* Planar formats are uploaded as a whole */
+    if (texture->marked && !SDL_ISPIXELFORMAT_FOURCC(texture->format)) {
+        rects = texture->dirty->rects;
+        numrects = texture->dirty->numrects;
+    }
+    for (i = 0; i < numrects; ++i) {
+        if (!SDL_IntersectRect(&rects[i], rect, &clipped)) {
+            continue;
+        }
+        renderer->stats.uploaded_bytes += (Uint64)clipped.w * clipped.h * bpp;
+        if (renderer->UpdateTexture(renderer, texture, &clipped,
+                                    (const Uint8 *)pixels +
+                                    clipped.y * pitch + clipped.x * bpp,
+                                    pitch) < 0) {
+            return -1;
+        }
+    }
+    return 0;
 }
 
 static void
@@ -990,25 +1075,51 @@ SDL_UnlockTextureYUV(SDL_Texture * texture)
     SDL_UnlockTexture(native);
 }
 
-static void
-SDL_UnlockTextureNative(SDL_Texture * texture)
+static Uint64
+SDL_UnlockTextureNativeRect(SDL_Texture * texture, const SDL_Rect * rect)
 {
     SDL_Texture *native = texture->native;
     void *native_pixels;
     int native_pitch;
-    const SDL_Rect *rect = &texture->locked_rect;
     const void* pixels = (void *) ((Uint8 *) texture->pixels +
                         rect->y * texture->pitch +
                         rect->x * SDL_BYTESPERPIXEL(texture->format));
     int pitch = texture->pitch;
 
     if (SDL_LockTexture(native, rect, &native_pixels, &native_pitch) < 0) {
-        return;
+        return 0;
     }
     SDL_ConvertPixels(rect->w, rect->h,
                       texture->format, pixels, pitch,
                       native->format, native_pixels, native_pitch);
     SDL_UnlockTexture(native);
+    return (Uint64)rect->w * rect->h * SDL_BYTESPERPIXEL(texture->format);
+}
+
+static void
+SDL_UnlockTextureNative(SDL_Texture * texture)
+{
+    SDL_RenderStats *stats = &texture->renderer->stats;
+    const Uint64 unlocked_bytes = stats->unlocked_bytes;
+    const Uint64 uploaded_bytes = stats->uploaded_bytes;
+    const SDL_Rect *rect = &texture->locked_rect;
+    Uint64 converted = 0;
+    int i;
+
+    /* Only the dirty parts are converted, and so uploaded */
+    if (texture->marked) {
+        for (i = 0; i < texture->dirty->numrects; ++i) {
+            converted += SDL_UnlockTextureNativeRect(texture, &texture->dirty->rects[i]);
+        }
+    } else {
+        converted = SDL_UnlockTextureNativeRect(texture, rect);
+    }
+
+    /* Count the bytes in the texture's own format, not again when the
+       native texture is unlocked */
+    stats->unlocked_bytes = unlocked_bytes +
+        (Uint64)rect->w * rect->h * SDL_BYTESPERPIXEL(texture->format);
+    stats->uploaded_bytes = uploaded_bytes + converted;
 }
 
 void
@@ -1029,6 +1140,8 @@ SDL_UnlockTexture(SDL_Texture * texture)
         renderer = texture->renderer;
         renderer->UnlockTexture(renderer, texture);
     }
+    texture->locked = SDL_FALSE;
+    texture->marked = SDL_FALSE;
 }
 
 SDL_bool
@@ -1352,6 +1465,360 @@ SDL_RenderDrawPoint(SDL_Renderer * renderer, int x, int y)
     return SDL_RenderDrawPoints(renderer, &point, 1);
 }
 
+/* The scratch memory is a stack of blocks, newest first. A new block is
+   added when an allocation doesn't fit, and once everything is released the
+   blocks are folded into a single one big enough for the peak usage.
+ */
+#define SCRATCH_ALIGNMENT   16
+#define SCRATCH_MIN_SIZE    4096
+
+typedef struct SDL_RenderScratchBlock
+{
+    struct SDL_RenderScratchBlock *next;
+    size_t size;
+    size_t used;
+    Uint8 *data;
+} SDL_RenderScratchBlock;
+
+static SDL_RenderScratchBlock *
+SDL_CreateRenderScratchBlock(size_t size)
+{
+    SDL_RenderScratchBlock *block;
+
+    block = (SDL_RenderScratchBlock *) SDL_malloc(sizeof(*block) + SCRATCH_ALIGNMENT - 1 + size);
+    if (!block) {
+        return NULL;
+    }
+    block->next = NULL;
+    block->size = size;
+    block->used = 0;
+    block->data = (Uint8 *) (((uintptr_t) (block + 1) + SCRATCH_ALIGNMENT - 1) & ~(uintptr_t) (SCRATCH_ALIGNMENT - 1));
+    return block;
+}
+
+static void
+SDL_DestroyRenderScratch(SDL_Renderer * renderer)
+{
+    while (renderer->scratch) {
+        SDL_RenderScratchBlock *block = renderer->scratch;
+        renderer->scratch = block->next;
+        SDL_free(block);
+    }
+    renderer->scratch_used = 0;
+}
+
+void *
+SDL_AllocRenderScratch(SDL_Renderer * renderer, int count, size_t size)
+{
+    SDL_RenderScratchBlock *block = renderer->scratch;
+    void *mem;
+
+    if (count < 0 || (size && (size_t) count > (((size_t) -1) - 2 * SCRATCH_ALIGNMENT) / size)) {
+        return NULL;
+    }
+    /* Never hand out an empty allocation, so every pointer lies inside its block */
+    size = (SDL_max(count * size, 1) + SCRATCH_ALIGNMENT - 1) & ~(size_t) (SCRATCH_ALIGNMENT - 1);
+
+    if (!block || block->size - block->used < size) {
+        size_t block_size = SDL_max(size, SCRATCH_MIN_SIZE);
+        if (block) {
+            block_size = SDL_max(block_size, 2 * block->size);
+        }
+        block = SDL_CreateRenderScratchBlock(block_size);
+        if (!block) {
+            return NULL;
+        }
+        block->next = renderer->scratch;
+        renderer->scratch = block;
+    }
+
+    mem = block->data + block->used;
+    block->used += size;
+    renderer->scratch_used += size;
+    if (renderer->scratch_used > renderer->scratch_high_water) {
+        renderer->scratch_high_water = renderer->scratch_used;
+    }
+    return mem;
+}
+
+void
+SDL_FreeRenderScratch(SDL_Renderer * renderer, void *mem)
+{
+    SDL_RenderScratchBlock *block;
+
+    if (!mem) {
+        return;
+    }
+    for (block = renderer->scratch; block; block = block->next) {
+        if ((Uint8 *) mem >= block->data && (Uint8 *) mem < block->data + block->size) {
+            const size_t used = (size_t) ((Uint8 *) mem - block->data);
+            renderer->scratch_used -= block->used - used;
+            block->used = used;
+            break;
+        }
+        renderer->scratch_used -= block->used;
+        block->used = 0;
+    }
+
+    if (renderer->scratch_used == 0 && renderer->scratch && renderer->scratch->next) {
+        SDL_DestroyRenderScratch(renderer);
+        renderer->scratch = SDL_CreateRenderScratchBlock(SDL_max(renderer->scratch_high_water, SCRATCH_MIN_SIZE));
+    }
+}
+
+void
+SDL_GetRenderScratchStats(SDL_Renderer * renderer, size_t *capacity, size_t *high_water)
+{
+    SDL_RenderScratchBlock *block;
+
+    if (capacity) {
+        *capacity = 0;
+        for (block = renderer->scratch; block; block = block->next) {
+            *capacity += block->size;
+        }
+    }
+    if (high_water) {
+        *high_water = renderer->scratch_high_water;
+    }
+}
+
+int
+SDL_GetRenderStats(SDL_Renderer * renderer, SDL_RenderStats * stats)
+{
+    CHECK_RENDERER_MAGIC(renderer, -1);
+
+    if (!stats) {
+        return SDL_InvalidParamError("stats");
+    }
+    *stats = renderer->stats;
+    return 0;
+}
+
+/* Drawing is culled against the viewport and the clip rect before it gets
+   to the driver. The test is done on logical coordinates, with the area
+   widened by a pixel so rounding in the drivers never loses anything.
+ */
+#define CULL_COORD_LIMIT    0x3FFFFFFF
+
+static int
+RenderClampCullCoordinate(double value)
+{
+    if (value < -CULL_COORD_LIMIT) {
+        return -CULL_COORD_LIMIT;
+    }
+    if (value > CULL_COORD_LIMIT) {
+        return CULL_COORD_LIMIT;
+    }
+    return (int)value;
+}
+
+static SDL_bool
+RenderComputeCullRect(SDL_Renderer * renderer, SDL_Rect * cull)
+{
+    const SDL_Rect *clip = &renderer->clip_rect;
+    double x1 = 0.0, y1 = 0.0;
+    double x2 = renderer->viewport.w;
+    double y2 = renderer->viewport.h;
+
+    if (!SDL_RectEmpty(clip)) {
+        /* The drivers treat the clip rect as target coordinates */
+        x1 = SDL_max(x1, clip->x - renderer->viewport.x);
+        y1 = SDL_max(y1, clip->y - renderer->viewport.y);
+        x2 = SDL_min(x2, clip->x + clip->w - renderer->viewport.x);
+        y2 = SDL_min(y2, clip->y + clip->h - renderer->viewport.y);
+    }
+    if (x1 >= x2 || y1 >= y2) {
+        return SDL_FALSE;
+    }
+
+    if (renderer->scale.x <= 0.0f || renderer->scale.y <= 0.0f) {
+        cull->x = cull->y = -CULL_COORD_LIMIT;
+        cull->w = cull->h = 2 * CULL_COORD_LIMIT;
+        return SDL_TRUE;
+    }
+    cull->x = RenderClampCullCoordinate(SDL_floor(x1 / renderer->scale.x) - 1.0);
+    cull->y = RenderClampCullCoordinate(SDL_floor(y1 / renderer->scale.y) - 1.0);
+    cull->w = RenderClampCullCoordinate(SDL_ceil(x2 / renderer->scale.x) + 1.0) - cull->x;
+    cull->h = RenderClampCullCoordinate(SDL_ceil(y2 / renderer->scale.y) + 1.0) - cull->y;
+    return SDL_TRUE;
+}
+
+static SDL_INLINE SDL_bool
+RenderRectEquals(const SDL_Rect * a, const SDL_Rect * b)
+{
+    return (a->x == b->x && a->y == b->y && a->w == b->w && a->h == b->h);
+}
+
+/* Returns NULL if nothing drawn can be visible */
+static const SDL_Rect *
+RenderGetCullRect(SDL_Renderer * renderer)
+{
+    /* The viewport, clip rect and scale are set in many places, so the
+       result is cached by the values it was computed from */
+    if (!RenderRectEquals(&renderer->viewport, &renderer->cull_viewport) ||
+        !RenderRectEquals(&renderer->clip_rect, &renderer->cull_clip_rect) ||
+        renderer->scale.x != renderer->cull_scale.x ||
+        renderer->scale.y != renderer->cull_scale.y) {
+        renderer->cull_visible = RenderComputeCullRect(renderer, &renderer->cull_rect);
+        renderer->cull_viewport = renderer->viewport;
+        renderer->cull_clip_rect = renderer->clip_rect;
+        renderer->cull_scale = renderer->scale;
+    }
+    return renderer->cull_visible ? &renderer->cull_rect : NULL;
+}
+
+/* Returns SDL_TRUE if the box between (x1,y1) and (x2,y2) inclusive is outside the cull rect */
+static SDL_INLINE SDL_bool
+RenderCullBox(const SDL_Rect * cull, Sint64 x1, Sint64 y1, Sint64 x2, Sint64 y2)
+{
+    /* Not short-circuited, as that branches badly on scattered draws */
+    return (SDL_bool) ((x2 < cull->x) | (x1 >= cull->x + cull->w) |
+                       (y2 < cull->y) | (y1 >= cull->y + cull->h));
+}
+
+static SDL_INLINE SDL_bool
+RenderCullRect(const SDL_Rect * cull, const SDL_Rect * rect)
+{
+    const Sint64 x2 = (Sint64)rect->x + rect->w;
+    const Sint64 y2 = (Sint64)rect->y + rect->h;
+
+    return RenderCullBox(cull, SDL_min(rect->x, x2), SDL_min(rect->y, y2),
+                         SDL_max(rect->x, x2), SDL_max(rect->y, y2));
+}
+
+/* Returns SDL_TRUE if 'rect' rotated by 'angle' degrees around 'center', relative to the rect, is outside */
+static SDL_bool
+RenderCullRotatedRect(const SDL_Rect * cull, const SDL_Rect * rect,
+                      const SDL_Point * center, double angle)
+{
+    double radians, c, s;
+    double minx, miny, maxx, maxy;
+    int i;
+
+    if (angle == 0.0) {
+        return RenderCullRect(cull, rect);
+    }
+
+    radians = angle * M_PI / 180.0;
+    c = SDL_cos(radians);
+    s = SDL_sin(radians);
+    minx = miny = maxx = maxy = 0.0;
+    for (i = 0; i < 4; ++i) {
+        const double dx = ((i & 1) ? rect->w : 0) - center->x;
+        const double dy = ((i & 2) ? rect->h : 0) - center->y;
+        const double x = dx * c - dy * s;
+        const double y = dx * s + dy * c;
+
+        if (i == 0 || x < minx) {
+            minx = x;
+        }
+        if (i == 0 || x > maxx) {
+            maxx = x;
+        }
+        if (i == 0 || y < miny) {
+            miny = y;
+        }
+        if (i == 0 || y > maxy) {
+            maxy = y;
+        }
+    }
+    minx += (double)rect->x + center->x;
+    maxx += (double)rect->x + center->x;
+    miny += (double)rect->y + center->y;
+    maxy += (double)rect->y + center->y;
+    return RenderCullBox(cull,
+                         RenderClampCullCoordinate(SDL_floor(minx)),
+                         RenderClampCullCoordinate(SDL_floor(miny)),
+                         RenderClampCullCoordinate(SDL_ceil(maxx)),
+                         RenderClampCullCoordinate(SDL_ceil(maxy)));
+}
+
+/* Returns the points that may be visible, either 'points' itself or a
+   compacted copy in scratch memory that the caller has to free */
+static const SDL_Point *
+RenderCullPoints(SDL_Renderer * renderer, const SDL_Point * points, int *count)
+{
+    SDL_Point *visible;
+    const SDL_Rect *cull;
+    int i, n;
+
+    if ((cull = RenderGetCullRect(renderer)) == NULL) {
+        renderer->stats.culled_points += *count;
+        *count = 0;
+        return points;
+    }
+    for (i = 0; i < *count; ++i) {
+        if (RenderCullBox(cull, points[i].x, points[i].y, points[i].x, points[i].y)) {
+            break;
+        }
+    }
+    if (i == *count) {
+        return points;
+    }
+
+    visible = (SDL_Point *)SDL_AllocRenderScratch(renderer, *count, sizeof(SDL_Point));
+    if (!visible) {
+        /* Let the driver clip them instead */
+        return points;
+    }
+    n = i;
+    SDL_memcpy(visible, points, n * sizeof(SDL_Point));
+    for (++i; i < *count; ++i) {
+        if (!RenderCullBox(cull, points[i].x, points[i].y, points[i].x, points[i].y)) {
+            visible[n++] = points[i];
+        }
+    }
+    renderer->stats.culled_points += *count - n;
+    *count = n;
+    return visible;
+}
+
+/* Returns the rects that may be visible, like RenderCullPoints() */
+static const SDL_Rect *
+RenderCullRects(SDL_Renderer * renderer, const SDL_Rect * rects, int *count)
+{
+    SDL_Rect *visible;
+    const SDL_Rect *cull;
+    int i, n;
+
+    if ((cull = RenderGetCullRect(renderer)) == NULL) {
+        renderer->stats.culled_rects += *count;
+        *count = 0;
+        return rects;
+    }
+    for (i = 0; i < *count; ++i) {
+        if (RenderCullRect(cull, &rects[i])) {
+            break;
+        }
+    }
+    if (i == *count) {
+        return rects;
+    }
+
+    visible = (SDL_Rect *)SDL_AllocRenderScratch(renderer, *count, sizeof(SDL_Rect));
+    if (!visible) {
+        return rects;
+    }
+    n = i;
+    SDL_memcpy(visible, rects, n * sizeof(SDL_Rect));
+    for (++i; i < *count; ++i) {
+        if (!RenderCullRect(cull, &rects[i])) {
+            visible[n++] = rects[i];
+        }
+    }
+    renderer->stats.culled_rects += *count - n;
+    *count = n;
+    return visible;
+}
+
+static void
+RenderFreeCulled(SDL_Renderer * renderer, const void *culled, const void *original)
+{
+    if (culled != original) {
+        SDL_FreeRenderScratch(renderer, (void *)culled);
+    }
+}
+
 static int
 RenderDrawPointsWithRects(SDL_Renderer * renderer,
                      const SDL_Point * points, int count)
@@ -1360,7 +1827,7 @@ RenderDrawPointsWithRects(SDL_Renderer * renderer,
     int i;
     int status;
 
-    frects = SDL_stack_alloc(SDL_FRect, count);
+    frects = SDL_AllocRenderScratch(renderer, count, sizeof(SDL_FRect));
     if (!frects) {
         return SDL_OutOfMemory();
     }
@@ -1373,7 +1840,7 @@ RenderDrawPointsWithRects(SDL_Renderer * renderer,
 
     status = renderer->RenderFillRects(renderer, frects, count);
 
-    SDL_stack_free(frects);
+    SDL_FreeRenderScratch(renderer, frects);
 
     return status;
 }
@@ -1382,6 +1849,7 @@ int
 SDL_RenderDrawPoints(SDL_Renderer * renderer,
                      const SDL_Point * points, int count)
 {
+    const SDL_Point *visible;
     SDL_FPoint *fpoints;
     int i;
     int status;
@@ -1399,22 +1867,31 @@ SDL_RenderDrawPoints(SDL_Renderer * renderer,
         return 0;
     }
 
-    if (renderer->scale.x != 1.0f || renderer->scale.y != 1.0f) {
-        return RenderDrawPointsWithRects(renderer, points, count);
-    }
-
-    fpoints = SDL_stack_alloc(SDL_FPoint, count);
-    if (!fpoints) {
-        return SDL_OutOfMemory();
-    }
-    for (i = 0; i < count; ++i) {
-        fpoints[i].x = points[i].x * renderer->scale.x;
-        fpoints[i].y = points[i].y * renderer->scale.y;
-    }
+    visible = RenderCullPoints(renderer, points, &count);
+    if (count == 0) {
+        status = 0;
+    } else if (renderer->scale.x != 1.0f || renderer->scale.y != 1.0f) {
+        if (renderer->RenderDrawPointsScaled) {
+            status = renderer->RenderDrawPointsScaled(renderer, visible, count);
+        } else {
+            status = RenderDrawPointsWithRects(renderer, visible, count);
+        }
+    } else {
+        fpoints = SDL_AllocRenderScratch(renderer, count, sizeof(SDL_FPoint));
+        if (!fpoints) {
+            status = SDL_OutOfMemory();
+        } else {
+            for (i = 0; i < count; ++i) {
+                fpoints[i].x = visible[i].x * renderer->scale.x;
+                fpoints[i].y = visible[i].y * renderer->scale.y;
+            }
 
-    status = renderer->RenderDrawPoints(renderer, fpoints, count);
+            status = renderer->RenderDrawPoints(renderer, fpoints, count);
 
-    SDL_stack_free(fpoints);
+            SDL_FreeRenderScratch(renderer, fpoints);
+        }
+    }
+    RenderFreeCulled(renderer, visible, points);
 
     return status;
 }
@@ -1441,7 +1918,7 @@ RenderDrawLinesWithRects(SDL_Renderer * renderer,
     int i, nrects;
     int status;
 
-    frects = SDL_stack_alloc(SDL_FRect, count-1);
+    frects = SDL_AllocRenderScratch(renderer, count-1, sizeof(SDL_FRect));
     if (!frects) {
         return SDL_OutOfMemory();
     }
@@ -1479,7 +1956,7 @@ RenderDrawLinesWithRects(SDL_Renderer * renderer,
 
     status += renderer->RenderFillRects(renderer, frects, nrects);
 
-    SDL_stack_free(frects);
+    SDL_FreeRenderScratch(renderer, frects);
 
     if (status < 0) {
         status = -1;
@@ -1487,12 +1964,43 @@ RenderDrawLinesWithRects(SDL_Renderer * renderer,
     return status;
 }
 
+static int
+RenderDrawLinesVisible(SDL_Renderer * renderer,
+                       const SDL_Point * points, int count)
+{
+    SDL_FPoint *fpoints;
+    int i;
+    int status;
+
+    if (renderer->scale.x != 1.0f || renderer->scale.y != 1.0f) {
+        if (renderer->RenderDrawLinesScaled) {
+            return renderer->RenderDrawLinesScaled(renderer, points, count);
+        }
+        return RenderDrawLinesWithRects(renderer, points, count);
+    }
+
+    fpoints = SDL_AllocRenderScratch(renderer, count, sizeof(SDL_FPoint));
+    if (!fpoints) {
+        return SDL_OutOfMemory();
+    }
+    for (i = 0; i < count; ++i) {
+        fpoints[i].x = points[i].x * renderer->scale.x;
+        fpoints[i].y = points[i].y * renderer->scale.y;
+    }
+
+    status = renderer->RenderDrawLines(renderer, fpoints, count);
+
+    SDL_FreeRenderScratch(renderer, fpoints);
+
+    return status;
+}
+
 int
 SDL_RenderDrawLines(SDL_Renderer * renderer,
                     const SDL_Point * points, int count)
 {
-    SDL_FPoint *fpoints;
-    int i;
+    const SDL_Rect *cull;
+    int i, first;
     int status;
 
     CHECK_RENDERER_MAGIC(renderer, -1);
@@ -1508,23 +2016,36 @@ SDL_RenderDrawLines(SDL_Renderer * renderer,
         return 0;
     }
 
-    if (renderer->scale.x != 1.0f || renderer->scale.y != 1.0f) {
-        return RenderDrawLinesWithRects(renderer, points, count);
+    if ((cull = RenderGetCullRect(renderer)) == NULL) {
+        renderer->stats.culled_lines += count - 1;
+        return 0;
     }
 
-    fpoints = SDL_stack_alloc(SDL_FPoint, count);
-    if (!fpoints) {
-        return SDL_OutOfMemory();
+    /* Draw each run of segments that may be visible. Both ends of a culled
+       segment are outside, so splitting there doesn't change the result. */
+    status = 0;
+    first = 0;
+    for (i = 1; i < count; ++i) {
+        if (!RenderCullBox(cull,
+                           SDL_min(points[i-1].x, points[i].x),
+                           SDL_min(points[i-1].y, points[i].y),
+                           SDL_max(points[i-1].x, points[i].x),
+                           SDL_max(points[i-1].y, points[i].y))) {
+            continue;
+        }
+        ++renderer->stats.culled_lines;
+        if (i - 1 > first) {
+            if (RenderDrawLinesVisible(renderer, &points[first], i - first) < 0) {
+                status = -1;
+            }
+        }
+        first = i;
     }
-    for (i = 0; i < count; ++i) {
-        fpoints[i].x = points[i].x * renderer->scale.x;
-        fpoints[i].y = points[i].y * renderer->scale.y;
+    if (count - 1 > first) {
+        if (RenderDrawLinesVisible(renderer, &points[first], count - first) < 0) {
+            status = -1;
+        }
     }
-
-    status = renderer->RenderDrawLines(renderer, fpoints, count);
-
-    SDL_stack_free(fpoints);
-
     return status;
 }
 
@@ -1605,6 +2126,7 @@ int
 SDL_RenderFillRects(SDL_Renderer * renderer,
                     const SDL_Rect * rects, int count)
 {
+    const SDL_Rect *visible;
     SDL_FRect *frects;
     int i;
     int status;
@@ -1622,20 +2144,28 @@ SDL_RenderFillRects(SDL_Renderer * renderer,
         return 0;
     }
 
-    frects = SDL_stack_alloc(SDL_FRect, count);
+    visible = RenderCullRects(renderer, rects, &count);
+    if (count == 0) {
+        RenderFreeCulled(renderer, visible, rects);
+        return 0;
+    }
+
+    frects = SDL_AllocRenderScratch(renderer, count, sizeof(SDL_FRect));
     if (!frects) {
+        RenderFreeCulled(renderer, visible, rects);
         return SDL_OutOfMemory();
     }
     for (i = 0; i < count; ++i) {
-        frects[i].x = rects[i].x * renderer->scale.x;
-        frects[i].y = rects[i].y * renderer->scale.y;
-        frects[i].w = rects[i].w * renderer->scale.x;
-        frects[i].h = rects[i].h * renderer->scale.y;
+        frects[i].x = visible[i].x * renderer->scale.x;
+        frects[i].y = visible[i].y * renderer->scale.y;
+        frects[i].w = visible[i].w * renderer->scale.x;
+        frects[i].h = visible[i].h * renderer->scale.y;
     }
 
     status = renderer->RenderFillRects(renderer, frects, count);
 
-    SDL_stack_free(frects);
+    SDL_FreeRenderScratch(renderer, frects);
+    RenderFreeCulled(renderer, visible, rects);
 
     return status;
 }
@@ -1646,6 +2176,7 @@ SDL_RenderCopy(SDL_Renderer * renderer, SDL_Texture * texture,
 {
     SDL_Rect real_srcrect = { 0, 0, 0, 0 };
     SDL_Rect real_dstrect = { 0, 0, 0, 0 };
+    const SDL_Rect *cull;
     SDL_FRect frect;
 
     CHECK_RENDERER_MAGIC(renderer, -1);
@@ -1665,14 +2196,15 @@ SDL_RenderCopy(SDL_Renderer * renderer, SDL_Texture * texture,
         }
     }
 
-    SDL_RenderGetViewport(renderer, &real_dstrect);
-    real_dstrect.x = 0;
-    real_dstrect.y = 0;
     if (dstrect) {
-        if (!SDL_HasIntersection(dstrect, &real_dstrect)) {
+        if (SDL_RectEmpty(dstrect)) {
             return 0;
         }
         real_dstrect = *dstrect;
+    } else {
+        SDL_RenderGetViewport(renderer, &real_dstrect);
+        real_dstrect.x = 0;
+        real_dstrect.y = 0;
     }
 
     if (texture->native) {
@@ -1684,6 +2216,11 @@ SDL_RenderCopy(SDL_Renderer * renderer, SDL_Texture * texture,
         return 0;
     }
 
+    if ((cull = RenderGetCullRect(renderer)) == NULL || RenderCullRect(cull, &real_dstrect)) {
+        ++renderer->stats.culled_copies;
+        return 0;
+    }
+
     frect.x = real_dstrect.x * renderer->scale.x;
     frect.y = real_dstrect.y * renderer->scale.y;
     frect.w = real_dstrect.w * renderer->scale.x;
@@ -1701,6 +2238,7 @@ SDL_RenderCopyEx(SDL_Renderer * renderer, SDL_Texture * texture,
     SDL_Rect real_srcrect = { 0, 0, 0, 0 };
     SDL_Rect real_dstrect = { 0, 0, 0, 0 };
     SDL_Point real_center;
+    const SDL_Rect *cull;
     SDL_FRect frect;
     SDL_FPoint fcenter;
 
@@ -1724,7 +2262,6 @@ SDL_RenderCopyEx(SDL_Renderer * renderer, SDL_Texture * texture,
         }
     }
 
-    /* We don't intersect the dstrect with the viewport as RenderCopy does because of potential rotation clipping issues... TODO: should we? */
     if (dstrect) {
         real_dstrect = *dstrect;
     } else {
@@ -1743,6 +2280,13 @@ SDL_RenderCopyEx(SDL_Renderer * renderer, SDL_Texture * texture,
         real_center.y = real_dstrect.h/2;
     }
 
+    /* The dstrect is culled by its bounds after rotation */
+    if ((cull = RenderGetCullRect(renderer)) == NULL ||
+        RenderCullRotatedRect(cull, &real_dstrect, &real_center, angle)) {
+        ++renderer->stats.culled_copies;
+        return 0;
+    }
+
     frect.x = real_dstrect.x * renderer->scale.x;
     frect.y = real_dstrect.y * renderer->scale.y;
     frect.w = real_dstrect.w * renderer->scale.x;
@@ -1791,6 +2335,37 @@ SDL_RenderReadPixels(SDL_Renderer * renderer, const SDL_Rect * rect,
                                       format, pixels, pitch);
 }
 
+/* Reads the frame about to be presented into the capture queue */
+static void
+SDL_CaptureRenderer(SDL_Renderer * renderer)
+{
+    SDL_Rect rect;
+    void *pixels;
+    int pitch;
+
+    /* The frame is in the window, not the target */
+    if (renderer->target) {
+        SDL_SubmitCaptureFrame(renderer->capture, SDL_FALSE);
+        return;
+    }
+
+    rect.x = 0;
+    rect.y = 0;
+    if (renderer->GetOutputSize) {
+        renderer->GetOutputSize(renderer, &rect.w, &rect.h);
+    } else {
+        SDL_GetWindowSize(renderer->window, &rect.w, &rect.h);
+    }
+
+    pixels = SDL_AcquireCaptureFrame(renderer->capture, rect.w, rect.h, &pitch);
+    if (!pixels) {
+        return;
+    }
+    SDL_SubmitCaptureFrame(renderer->capture,
+        renderer->RenderReadPixels(renderer, &rect, SDL_CAPTURE_PIXELFORMAT,
+                                   pixels, pitch) == 0);
+}
+
 void
 SDL_RenderPresent(SDL_Renderer * renderer)
 {
@@ -1800,9 +2375,24 @@ SDL_RenderPresent(SDL_Renderer * renderer)
     if (renderer->hidden) {
         return;
     }
+    if (renderer->capture) {
+        SDL_CaptureRenderer(renderer);
+    }
     renderer->RenderPresent(renderer);
 }
 
+int
+SDL_SetRendererCapture(SDL_Renderer * renderer, SDL_FrameCapture * capture)
+{
+    CHECK_RENDERER_MAGIC(renderer, -1);
+
+    if (capture && !renderer->RenderReadPixels) {
+        return SDL_Unsupported();
+    }
+    SDL_AttachFrameCapture(&renderer->capture, capture);
+    return 0;
+}
+
 void
 SDL_DestroyTexture(SDL_Texture * texture)
 {
@@ -1833,6 +2423,7 @@ SDL_DestroyTexture(SDL_Texture * texture)
         SDL_SW_DestroyYUVTexture(texture->yuv);
     }
     SDL_free(texture->pixels);
+    SDL_free(texture->dirty);
 
     renderer->DestroyTexture(renderer, texture);
     SDL_free(texture);
@@ -1844,6 +2435,7 @@ SDL_DestroyRenderer(SDL_Renderer * renderer)
     CHECK_RENDERER_MAGIC(renderer, );
 
     SDL_DelEventWatch(SDL_RendererEventWatch, renderer);
+    SDL_AttachFrameCapture(&renderer->capture, NULL);
 
     /* Free existing textures for this renderer */
     while (renderer->textures) {
@@ -1854,6 +2446,8 @@ SDL_DestroyRenderer(SDL_Renderer * renderer)
         SDL_SetWindowData(renderer->window, SDL_WINDOWRENDERDATA, NULL);
     }
 
+    SDL_DestroyRenderScratch(renderer);
+
     /* It's no longer magical... */
     renderer->magic = NULL;
 
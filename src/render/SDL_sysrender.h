@@ -66,6 +66,11 @@ struct SDL_Texture
     int pitch;
     SDL_Rect locked_rect;
 
+    /* The areas marked with SDL_MarkTextureDirty() while locked */
+    SDL_bool locked;
+    SDL_bool marked;
+    struct SDL_DamageRegion *dirty;
+
     void *driverdata;           /**< Driver specific texture representation */
 
     SDL_Texture *prev;
@@ -107,6 +112,13 @@ struct SDL_Renderer
                             int count);
     int (*RenderFillRects) (SDL_Renderer * renderer, const SDL_FRect * rects,
                             int count);
+    /* Optional, these take logical points and apply the render scale, so
+       every point covers a block of scale.x by scale.y pixels. Lines that
+       aren't horizontal or vertical stay thin between the scaled points. */
+    int (*RenderDrawPointsScaled) (SDL_Renderer * renderer, const SDL_Point * points,
+                                   int count);
+    int (*RenderDrawLinesScaled) (SDL_Renderer * renderer, const SDL_Point * points,
+                                  int count);
     int (*RenderCopy) (SDL_Renderer * renderer, SDL_Texture * texture,
                        const SDL_Rect * srcrect, const SDL_FRect * dstrect);
     int (*RenderCopyEx) (SDL_Renderer * renderer, SDL_Texture * texture,
@@ -154,6 +166,23 @@ struct SDL_Renderer
     Uint8 r, g, b, a;                   /**< Color for drawing operations values */
     SDL_BlendMode blendMode;            /**< The drawing blend mode */
 
+    /* Scratch memory reused for the arrays converted by the drawing functions */
+    struct SDL_RenderScratchBlock *scratch;
+    size_t scratch_used;
+    size_t scratch_high_water;
+
+    SDL_RenderStats stats;
+
+    /* Where presented frames are recorded, if anywhere */
+    struct SDL_FrameCapture *capture;
+
+    /* The area drawing is culled against, and what it was computed from */
+    SDL_Rect cull_rect;
+    SDL_bool cull_visible;
+    SDL_Rect cull_viewport;
+    SDL_Rect cull_clip_rect;
+    SDL_FPoint cull_scale;
+
     void *driverdata;
 };
 
@@ -166,6 +195,28 @@ struct SDL_RenderDriver
     SDL_RendererInfo info;
 };
 
+/* Scratch memory for converting the arrays passed to the drawing functions.
+   Allocations are released in reverse order; freeing one also releases
+   everything allocated after it. Returns NULL if out of memory.
+ */
+extern void *SDL_AllocRenderScratch(SDL_Renderer * renderer, int count, size_t size);
+extern void SDL_FreeRenderScratch(SDL_Renderer * renderer, void *mem);
+extern void SDL_GetRenderScratchStats(SDL_Renderer * renderer, size_t *capacity, size_t *high_water);
+
+/* For drivers that keep a copy of streaming textures and upload it when
+   they're unlocked: uploads 'rect' of the copy at 'pixels', or only the
+   parts of it marked dirty while the texture was locked.
+ */
+extern int SDL_UploadLockedTexture(SDL_Renderer * renderer, SDL_Texture * texture,
+                                   const SDL_Rect * rect, const void *pixels, int pitch);
+
+/* Renderers follow their window through an event watch, which runs on the
+   thread pumping events.  A renderer used from another thread is detached
+   from it and has the window events it needs passed on by that thread.
+ */
+extern void SDL_DetachRendererEvents(SDL_Renderer * renderer);
+extern void SDL_RenderWindowEvent(SDL_Renderer * renderer, const SDL_WindowEvent * event);
+
 #if !SDL_RENDER_DISABLED
 
 #if SDL_VIDEO_RENDER_D3D
@@ -86,7 +86,19 @@
 #include "SDL_video.h"
 #include "SDL_cpuinfo.h"
 #include "SDL_yuv_sw_c.h"
+#include "../thread/SDL_parallel_c.h"
 
+/* Frames converted in bands of at least this many pixels, see
+   SDL_SW_CopyYUVToRGB() */
+#define SDL_YUV_BAND_PIXELS     (128 * 1024)
+
+/* The NEON kernels assume the little endian byte order of packed pixels */
+#if (defined(__ARM_NEON__) || defined(__ARM_NEON)) && SDL_BYTEORDER == SDL_LIL_ENDIAN
+#include <arm_neon.h>
+#define SDL_NEON_YUV    1
+#else
+#define SDL_NEON_YUV    0
+#endif
 
 /* The colorspace conversion functions */
 
@@ -317,6 +329,226 @@ Color32DitherYV12Mod1X(int *colortab, Uint32 * rgb_2_pix,
     }
 }
 
+/*
+ * NV12 and NV21 interleave the chroma samples in one plane, so the
+ * chroma pointers step over pairs and a chroma row is cols bytes.
+ */
+static void
+Color16DitherNV12Mod1X(int *colortab, Uint32 * rgb_2_pix,
+                       unsigned char *lum, unsigned char *cr,
+                       unsigned char *cb, unsigned char *out,
+                       int rows, int cols, int mod)
+{
+    unsigned short *row1;
+    unsigned short *row2;
+    unsigned char *lum2;
+    int x, y;
+    int cr_r;
+    int crb_g;
+    int cb_b;
+    int cols_2 = cols / 2;
+
+    row1 = (unsigned short *) out;
+    row2 = row1 + cols + mod;
+    lum2 = lum + cols;
+
+    mod += cols + mod;
+
+    y = rows / 2;
+    while (y--) {
+        x = cols_2;
+        while (x--) {
+            register int L;
+
+            cr_r = 0 * 768 + 256 + colortab[*cr + 0 * 256];
+            crb_g = 1 * 768 + 256 + colortab[*cr + 1 * 256]
+                + colortab[*cb + 2 * 256];
+            cb_b = 2 * 768 + 256 + colortab[*cb + 3 * 256];
+            cr += 2;
+            cb += 2;
+
+            L = *lum++;
+            *row1++ = (unsigned short) (rgb_2_pix[L + cr_r] |
+                                        rgb_2_pix[L + crb_g] |
+                                        rgb_2_pix[L + cb_b]);
+
+            L = *lum++;
+            *row1++ = (unsigned short) (rgb_2_pix[L + cr_r] |
+                                        rgb_2_pix[L + crb_g] |
+                                        rgb_2_pix[L + cb_b]);
+
+
+            /* Now, do second row.  */
+
+            L = *lum2++;
+            *row2++ = (unsigned short) (rgb_2_pix[L + cr_r] |
+                                        rgb_2_pix[L + crb_g] |
+                                        rgb_2_pix[L + cb_b]);
+
+            L = *lum2++;
+            *row2++ = (unsigned short) (rgb_2_pix[L + cr_r] |
+                                        rgb_2_pix[L + crb_g] |
+                                        rgb_2_pix[L + cb_b]);
+        }
+
+        /*
+         * These values are at the start of the next line, (due
+         * to the ++'s above),but they need to be at the start
+         * of the line after that.
+         */
+        lum += cols;
+        lum2 += cols;
+        row1 += mod;
+        row2 += mod;
+    }
+}
+
+static void
+Color24DitherNV12Mod1X(int *colortab, Uint32 * rgb_2_pix,
+                       unsigned char *lum, unsigned char *cr,
+                       unsigned char *cb, unsigned char *out,
+                       int rows, int cols, int mod)
+{
+    unsigned int value;
+    unsigned char *row1;
+    unsigned char *row2;
+    unsigned char *lum2;
+    int x, y;
+    int cr_r;
+    int crb_g;
+    int cb_b;
+    int cols_2 = cols / 2;
+
+    row1 = out;
+    row2 = row1 + cols * 3 + mod * 3;
+    lum2 = lum + cols;
+
+    mod += cols + mod;
+    mod *= 3;
+
+    y = rows / 2;
+    while (y--) {
+        x = cols_2;
+        while (x--) {
+            register int L;
+
+            cr_r = 0 * 768 + 256 + colortab[*cr + 0 * 256];
+            crb_g = 1 * 768 + 256 + colortab[*cr + 1 * 256]
+                + colortab[*cb + 2 * 256];
+            cb_b = 2 * 768 + 256 + colortab[*cb + 3 * 256];
+            cr += 2;
+            cb += 2;
+
+            L = *lum++;
+            value = (rgb_2_pix[L + cr_r] |
+                     rgb_2_pix[L + crb_g] | rgb_2_pix[L + cb_b]);
+            *row1++ = (value) & 0xFF;
+            *row1++ = (value >> 8) & 0xFF;
+            *row1++ = (value >> 16) & 0xFF;
+
+            L = *lum++;
+            value = (rgb_2_pix[L + cr_r] |
+                     rgb_2_pix[L + crb_g] | rgb_2_pix[L + cb_b]);
+            *row1++ = (value) & 0xFF;
+            *row1++ = (value >> 8) & 0xFF;
+            *row1++ = (value >> 16) & 0xFF;
+
+
+            /* Now, do second row.  */
+
+            L = *lum2++;
+            value = (rgb_2_pix[L + cr_r] |
+                     rgb_2_pix[L + crb_g] | rgb_2_pix[L + cb_b]);
+            *row2++ = (value) & 0xFF;
+            *row2++ = (value >> 8) & 0xFF;
+            *row2++ = (value >> 16) & 0xFF;
+
+            L = *lum2++;
+            value = (rgb_2_pix[L + cr_r] |
+                     rgb_2_pix[L + crb_g] | rgb_2_pix[L + cb_b]);
+            *row2++ = (value) & 0xFF;
+            *row2++ = (value >> 8) & 0xFF;
+            *row2++ = (value >> 16) & 0xFF;
+        }
+
+        /*
+         * These values are at the start of the next line, (due
+         * to the ++'s above),but they need to be at the start
+         * of the line after that.
+         */
+        lum += cols;
+        lum2 += cols;
+        row1 += mod;
+        row2 += mod;
+    }
+}
+
+static void
+Color32DitherNV12Mod1X(int *colortab, Uint32 * rgb_2_pix,
+                       unsigned char *lum, unsigned char *cr,
+                       unsigned char *cb, unsigned char *out,
+                       int rows, int cols, int mod)
+{
+    unsigned int *row1;
+    unsigned int *row2;
+    unsigned char *lum2;
+    int x, y;
+    int cr_r;
+    int crb_g;
+    int cb_b;
+    int cols_2 = cols / 2;
+
+    row1 = (unsigned int *) out;
+    row2 = row1 + cols + mod;
+    lum2 = lum + cols;
+
+    mod += cols + mod;
+
+    y = rows / 2;
+    while (y--) {
+        x = cols_2;
+        while (x--) {
+            register int L;
+
+            cr_r = 0 * 768 + 256 + colortab[*cr + 0 * 256];
+            crb_g = 1 * 768 + 256 + colortab[*cr + 1 * 256]
+                + colortab[*cb + 2 * 256];
+            cb_b = 2 * 768 + 256 + colortab[*cb + 3 * 256];
+            cr += 2;
+            cb += 2;
+
+            L = *lum++;
+            *row1++ = (rgb_2_pix[L + cr_r] |
+                       rgb_2_pix[L + crb_g] | rgb_2_pix[L + cb_b]);
+
+            L = *lum++;
+            *row1++ = (rgb_2_pix[L + cr_r] |
+                       rgb_2_pix[L + crb_g] | rgb_2_pix[L + cb_b]);
+
+
+            /* Now, do second row.  */
+
+            L = *lum2++;
+            *row2++ = (rgb_2_pix[L + cr_r] |
+                       rgb_2_pix[L + crb_g] | rgb_2_pix[L + cb_b]);
+
+            L = *lum2++;
+            *row2++ = (rgb_2_pix[L + cr_r] |
+                       rgb_2_pix[L + crb_g] | rgb_2_pix[L + cb_b]);
+        }
+
+        /*
+         * These values are at the start of the next line, (due
+         * to the ++'s above),but they need to be at the start
+         * of the line after that.
+         */
+        lum += cols;
+        lum2 += cols;
+        row1 += mod;
+        row2 += mod;
+    }
+}
+
 /*
  * In this function I make use of a nasty trick. The tables have the lower
  * 16 bits replicated in the upper 16. This means I can write ints and get
@@ -748,7 +980,7 @@ Color16DitherYUY2Mod2X(int *colortab, Uint32 * rgb_2_pix,
             row++;
 
         }
-        row += next_row;
+        row += next_row + mod / 2;
     }
 }
 
@@ -804,7 +1036,7 @@ Color24DitherYUY2Mod2X(int *colortab, Uint32 * rgb_2_pix,
             row += 2 * 3;
 
         }
-        row += next_row;
+        row += next_row + mod * 3;
     }
 }
 
@@ -821,7 +1053,6 @@ Color32DitherYUY2Mod2X(int *colortab, Uint32 * rgb_2_pix,
     int crb_g;
     int cb_b;
     int cols_2 = cols / 2;
-    mod += mod;
     y = rows;
     while (y--) {
         x = cols_2;
@@ -852,10 +1083,644 @@ Color32DitherYUY2Mod2X(int *colortab, Uint32 * rgb_2_pix,
 
         }
 
-        row += next_row;
+        row += next_row + mod;
     }
 }
 
+/*
+ * The vectorized converters below replace Display1X for 16-bit targets and
+ * for 32-bit targets with 8-bit channels on byte boundaries.  They produce
+ * exactly the pixels of the table driven converters above.
+ *
+ * The chroma tables hold (int)(k * (c - 128)), the product rounded toward
+ * zero.  The kernels take the magnitude of c - 128, multiply it by k in
+ * 16.16 fixed point and put the sign back.  The constants are
+ * (int)(k * 65536), which give the same rounding as the tables for every
+ * magnitude from 0 to 128.  The sums are saturated to 0..255, which is what
+ * the clamped ends of the rgb_2_pix tables do.
+ */
+#define YUV_K_RV    91838       /* 0.419 / 0.299 */
+#define YUV_K_GV    46766       /* 0.299 / 0.419 */
+#define YUV_K_GU    22571       /* 0.114 / 0.331 */
+#define YUV_K_BU    116222      /* 0.587 / 0.331 */
+
+/* Finds the byte of a 32-bit pixel that holds each channel, 3 is alpha */
+static SDL_bool
+YUVGetByteOrder(const SDL_SW_YUVTexture * swdata, int order[4])
+{
+    int i, channel;
+
+    for (i = 0; i < 4; ++i) {
+        order[i] = 3;
+    }
+    for (channel = 0; channel < 3; ++channel) {
+        if (swdata->loss[channel] != 0 || (swdata->shift[channel] % 8) != 0) {
+            return SDL_FALSE;
+        }
+        order[swdata->shift[channel] / 8] = channel;
+    }
+    return SDL_TRUE;
+}
+
+#if defined(__SSE2__) || SDL_NEON_YUV
+
+/* Converts one pixel the way the table driven converters do */
+static SDL_INLINE void
+YUVStorePixel(const SDL_SW_YUVTexture * swdata, Uint8 * out, int bpp,
+              int L, int cr, int cb)
+{
+    const int *colortab = swdata->colortab;
+    const Uint32 *rgb_2_pix = swdata->rgb_2_pix;
+    const int cr_r = 0 * 768 + 256 + colortab[cr + 0 * 256];
+    const int crb_g = 1 * 768 + 256 + colortab[cr + 1 * 256]
+        + colortab[cb + 2 * 256];
+    const int cb_b = 2 * 768 + 256 + colortab[cb + 3 * 256];
+    const Uint32 pixel = (rgb_2_pix[L + cr_r] |
+                          rgb_2_pix[L + crb_g] | rgb_2_pix[L + cb_b]);
+
+    if (bpp == 2) {
+        *(Uint16 *) out = (Uint16) pixel;
+    } else {
+        *(Uint32 *) out = pixel;
+    }
+}
+
+/* The value of the byte that no color channel uses in a 32-bit pixel */
+static Uint8
+YUVGetFillByte(const SDL_SW_YUVTexture * swdata, const int order[4])
+{
+    int i;
+
+    for (i = 0; i < 4; ++i) {
+        if (order[i] == 3) {
+            return (Uint8) (swdata->Amask >> (i * 8));
+        }
+    }
+    return 0;
+}
+
+#ifdef __SSE2__
+
+#define YUV_SET1_U16_SSE2(k) \
+    _mm_set1_epi16((short) ((int) (k) >= 0x8000 ? (int) (k) - 0x10000 : (int) (k)))
+
+typedef struct
+{
+    int bpp;
+    int order[4];
+    __m128i fill;
+    __m128i loss[3];
+    __m128i shift[3];
+    __m128i amask;
+} YUVTargetSSE2;
+
+static void
+YUVSetupTargetSSE2(const SDL_SW_YUVTexture * swdata, YUVTargetSSE2 * target)
+{
+    int i;
+
+    target->bpp = SDL_BYTESPERPIXEL(swdata->target_format);
+    if (target->bpp == 4) {
+        YUVGetByteOrder(swdata, target->order);
+        target->fill = _mm_set1_epi8((char) YUVGetFillByte(swdata, target->order));
+    }
+    for (i = 0; i < 3; ++i) {
+        target->loss[i] = _mm_cvtsi32_si128(swdata->loss[i]);
+        target->shift[i] = _mm_cvtsi32_si128(swdata->shift[i]);
+    }
+    target->amask = YUV_SET1_U16_SSE2(swdata->Amask & 0xFFFF);
+}
+
+/* Computes the red, green and blue offsets of 8 chroma samples */
+static SDL_INLINE void
+YUVChromaSSE2(__m128i cr, __m128i cb, __m128i * r, __m128i * g, __m128i * b)
+{
+    const __m128i c128 = _mm_set1_epi16(128);
+    const __m128i v = _mm_sub_epi16(cr, c128);
+    const __m128i u = _mm_sub_epi16(cb, c128);
+    const __m128i vsign = _mm_srai_epi16(v, 15);
+    const __m128i usign = _mm_srai_epi16(u, 15);
+    const __m128i vabs = _mm_sub_epi16(_mm_xor_si128(v, vsign), vsign);
+    const __m128i uabs = _mm_sub_epi16(_mm_xor_si128(u, usign), usign);
+    __m128i rv, gv, gu, bu;
+
+    /* The factors above 1.0 are applied as 1.0 plus the fraction */
+    rv = _mm_add_epi16(vabs, _mm_mulhi_epu16(vabs,
+                                             YUV_SET1_U16_SSE2(YUV_K_RV - 0x10000)));
+    gv = _mm_mulhi_epu16(vabs, YUV_SET1_U16_SSE2(YUV_K_GV));
+    gu = _mm_mulhi_epu16(uabs, YUV_SET1_U16_SSE2(YUV_K_GU));
+    bu = _mm_add_epi16(uabs, _mm_mulhi_epu16(uabs,
+                                             YUV_SET1_U16_SSE2(YUV_K_BU - 0x10000)));
+
+    *r = _mm_sub_epi16(_mm_xor_si128(rv, vsign), vsign);
+    *g = _mm_add_epi16(_mm_sub_epi16(vsign, _mm_xor_si128(gv, vsign)),
+                       _mm_sub_epi16(usign, _mm_xor_si128(gu, usign)));
+    *b = _mm_sub_epi16(_mm_xor_si128(bu, usign), usign);
+}
+
+/* Adds the offsets to 16 luma samples, each offset covers two pixels */
+static SDL_INLINE void
+YUVPixelsSSE2(__m128i ylo, __m128i yhi, __m128i r, __m128i g, __m128i b,
+              __m128i * R, __m128i * G, __m128i * B)
+{
+    *R = _mm_packus_epi16(_mm_add_epi16(ylo, _mm_unpacklo_epi16(r, r)),
+                          _mm_add_epi16(yhi, _mm_unpackhi_epi16(r, r)));
+    *G = _mm_packus_epi16(_mm_add_epi16(ylo, _mm_unpacklo_epi16(g, g)),
+                          _mm_add_epi16(yhi, _mm_unpackhi_epi16(g, g)));
+    *B = _mm_packus_epi16(_mm_add_epi16(ylo, _mm_unpacklo_epi16(b, b)),
+                          _mm_add_epi16(yhi, _mm_unpackhi_epi16(b, b)));
+}
+
+static SDL_INLINE __m128i
+YUVPack16SSE2(const YUVTargetSSE2 * target, __m128i r, __m128i g, __m128i b)
+{
+    r = _mm_sll_epi16(_mm_srl_epi16(r, target->loss[0]), target->shift[0]);
+    g = _mm_sll_epi16(_mm_srl_epi16(g, target->loss[1]), target->shift[1]);
+    b = _mm_sll_epi16(_mm_srl_epi16(b, target->loss[2]), target->shift[2]);
+    return _mm_or_si128(_mm_or_si128(r, g), _mm_or_si128(b, target->amask));
+}
+
+/* Writes 16 pixels */
+static SDL_INLINE void
+YUVStoreSSE2(const YUVTargetSSE2 * target, Uint8 * out,
+             __m128i R, __m128i G, __m128i B)
+{
+    if (target->bpp == 4) {
+        __m128i channels[4];
+        __m128i p0, p1, p2, p3, lo01, hi01, lo23, hi23;
+
+        channels[0] = R;
+        channels[1] = G;
+        channels[2] = B;
+        channels[3] = target->fill;
+        p0 = channels[target->order[0]];
+        p1 = channels[target->order[1]];
+        p2 = channels[target->order[2]];
+        p3 = channels[target->order[3]];
+        lo01 = _mm_unpacklo_epi8(p0, p1);
+        hi01 = _mm_unpackhi_epi8(p0, p1);
+        lo23 = _mm_unpacklo_epi8(p2, p3);
+        hi23 = _mm_unpackhi_epi8(p2, p3);
+        _mm_storeu_si128((__m128i *) out, _mm_unpacklo_epi16(lo01, lo23));
+        _mm_storeu_si128((__m128i *) (out + 16), _mm_unpackhi_epi16(lo01, lo23));
+        _mm_storeu_si128((__m128i *) (out + 32), _mm_unpacklo_epi16(hi01, hi23));
+        _mm_storeu_si128((__m128i *) (out + 48), _mm_unpackhi_epi16(hi01, hi23));
+    } else {
+        const __m128i zero = _mm_setzero_si128();
+
+        _mm_storeu_si128((__m128i *) out,
+                         YUVPack16SSE2(target, _mm_unpacklo_epi8(R, zero),
+                                       _mm_unpacklo_epi8(G, zero),
+                                       _mm_unpacklo_epi8(B, zero)));
+        _mm_storeu_si128((__m128i *) (out + 16),
+                         YUVPack16SSE2(target, _mm_unpackhi_epi8(R, zero),
+                                       _mm_unpackhi_epi8(G, zero),
+                                       _mm_unpackhi_epi8(B, zero)));
+    }
+}
+
+static void
+ColorDitherYV12SSE2(SDL_SW_YUVTexture * swdata,
+                    const Uint8 * lum, const Uint8 * cr,
+                    const Uint8 * cb, Uint8 * out,
+                    int rows, int cols, int mod)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const int cols_2 = cols / 2;
+    YUVTargetSSE2 target;
+    int pitch;
+    int x, y;
+
+    YUVSetupTargetSSE2(swdata, &target);
+    pitch = (cols + mod) * target.bpp;
+
+    for (y = 0; y < rows / 2; ++y) {
+        const Uint8 *lum1 = lum + (2 * y) * cols;
+        const Uint8 *lum2 = lum1 + cols;
+        const Uint8 *crrow = cr + y * cols_2;
+        const Uint8 *cbrow = cb + y * cols_2;
+        Uint8 *row1 = out + (2 * y) * pitch;
+        Uint8 *row2 = row1 + pitch;
+
+        for (x = 0; x + 16 <= cols_2 * 2; x += 16) {
+            __m128i r, g, b, R, G, B, Y;
+
+            YUVChromaSSE2(_mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *) (crrow + x / 2)), zero),
+                          _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *) (cbrow + x / 2)), zero),
+                          &r, &g, &b);
+
+            Y = _mm_loadu_si128((const __m128i *) (lum1 + x));
+            YUVPixelsSSE2(_mm_unpacklo_epi8(Y, zero), _mm_unpackhi_epi8(Y, zero),
+                          r, g, b, &R, &G, &B);
+            YUVStoreSSE2(&target, row1 + x * target.bpp, R, G, B);
+
+            Y = _mm_loadu_si128((const __m128i *) (lum2 + x));
+            YUVPixelsSSE2(_mm_unpacklo_epi8(Y, zero), _mm_unpackhi_epi8(Y, zero),
+                          r, g, b, &R, &G, &B);
+            YUVStoreSSE2(&target, row2 + x * target.bpp, R, G, B);
+        }
+        for (; x < cols_2 * 2; x += 2) {
+            const int CR = crrow[x / 2];
+            const int CB = cbrow[x / 2];
+
+            YUVStorePixel(swdata, row1 + x * target.bpp, target.bpp, lum1[x], CR, CB);
+            YUVStorePixel(swdata, row1 + (x + 1) * target.bpp, target.bpp, lum1[x + 1], CR, CB);
+            YUVStorePixel(swdata, row2 + x * target.bpp, target.bpp, lum2[x], CR, CB);
+            YUVStorePixel(swdata, row2 + (x + 1) * target.bpp, target.bpp, lum2[x + 1], CR, CB);
+        }
+    }
+}
+
+/* NV12 and NV21, the chroma pointers give the byte order */
+static void
+ColorDitherNV12SSE2(SDL_SW_YUVTexture * swdata,
+                    const Uint8 * lum, const Uint8 * cr,
+                    const Uint8 * cb, Uint8 * out,
+                    int rows, int cols, int mod)
+{
+    const __m128i lowbytes = _mm_set1_epi16(0x00FF);
+    const int cols_2 = cols / 2;
+    const SDL_bool cb_first = (cb < cr);
+    YUVTargetSSE2 target;
+    int pitch;
+    int x, y;
+
+    YUVSetupTargetSSE2(swdata, &target);
+    pitch = (cols + mod) * target.bpp;
+
+    for (y = 0; y < rows / 2; ++y) {
+        const Uint8 *lum1 = lum + (2 * y) * cols;
+        const Uint8 *lum2 = lum1 + cols;
+        const Uint8 *crrow = cr + y * cols;
+        const Uint8 *cbrow = cb + y * cols;
+        const Uint8 *uvrow = cb_first ? cbrow : crrow;
+        Uint8 *row1 = out + (2 * y) * pitch;
+        Uint8 *row2 = row1 + pitch;
+
+        for (x = 0; x + 16 <= cols_2 * 2; x += 16) {
+            __m128i uv, even, odd, r, g, b, R, G, B, Y;
+
+            uv = _mm_loadu_si128((const __m128i *) (uvrow + x));
+            even = _mm_and_si128(uv, lowbytes);
+            odd = _mm_srli_epi16(uv, 8);
+            if (cb_first) {
+                YUVChromaSSE2(odd, even, &r, &g, &b);
+            } else {
+                YUVChromaSSE2(even, odd, &r, &g, &b);
+            }
+
+            Y = _mm_loadu_si128((const __m128i *) (lum1 + x));
+            YUVPixelsSSE2(_mm_unpacklo_epi8(Y, _mm_setzero_si128()),
+                          _mm_unpackhi_epi8(Y, _mm_setzero_si128()),
+                          r, g, b, &R, &G, &B);
+            YUVStoreSSE2(&target, row1 + x * target.bpp, R, G, B);
+
+            Y = _mm_loadu_si128((const __m128i *) (lum2 + x));
+            YUVPixelsSSE2(_mm_unpacklo_epi8(Y, _mm_setzero_si128()),
+                          _mm_unpackhi_epi8(Y, _mm_setzero_si128()),
+                          r, g, b, &R, &G, &B);
+            YUVStoreSSE2(&target, row2 + x * target.bpp, R, G, B);
+        }
+        for (; x < cols_2 * 2; x += 2) {
+            const int CR = crrow[x];
+            const int CB = cbrow[x];
+
+            YUVStorePixel(swdata, row1 + x * target.bpp, target.bpp, lum1[x], CR, CB);
+            YUVStorePixel(swdata, row1 + (x + 1) * target.bpp, target.bpp, lum1[x + 1], CR, CB);
+            YUVStorePixel(swdata, row2 + x * target.bpp, target.bpp, lum2[x], CR, CB);
+            YUVStorePixel(swdata, row2 + (x + 1) * target.bpp, target.bpp, lum2[x + 1], CR, CB);
+        }
+    }
+}
+
+/* YUY2, UYVY and YVYU, the chroma pointers give the byte order */
+static void
+ColorDitherYUY2SSE2(SDL_SW_YUVTexture * swdata,
+                    const Uint8 * lum, const Uint8 * cr,
+                    const Uint8 * cb, Uint8 * out,
+                    int rows, int cols, int mod)
+{
+    const __m128i lowbyte = _mm_set1_epi16(0xFF);
+    const __m128i lowword = _mm_set1_epi32(0xFFFF);
+    const int cols_2 = cols / 2;
+    /* Offsets of luma, and of the first chroma sample of each pair */
+    const int lum_offset = (lum < cb && lum < cr) ? 0 : 1;
+    const __m128i lum_shift = _mm_cvtsi32_si128(lum_offset * 8);
+    const __m128i chroma_shift = _mm_cvtsi32_si128((1 - lum_offset) * 8);
+    const SDL_bool cb_first = (cb < cr) ? SDL_TRUE : SDL_FALSE;
+    const Uint8 *src = lum - lum_offset;
+    YUVTargetSSE2 target;
+    int pitch;
+    int x, y;
+
+    YUVSetupTargetSSE2(swdata, &target);
+    pitch = (cols + mod) * target.bpp;
+
+    for (y = 0; y < rows; ++y) {
+        const Uint8 *srcrow = src + y * cols_2 * 4;
+        Uint8 *row = out + y * pitch;
+
+        for (x = 0; x + 16 <= cols_2 * 2; x += 16) {
+            const __m128i lo = _mm_loadu_si128((const __m128i *) (srcrow + x * 2));
+            const __m128i hi = _mm_loadu_si128((const __m128i *) (srcrow + x * 2 + 16));
+            __m128i clo, chi, first, second, r, g, b, R, G, B;
+
+            clo = _mm_and_si128(_mm_srl_epi16(lo, chroma_shift), lowbyte);
+            chi = _mm_and_si128(_mm_srl_epi16(hi, chroma_shift), lowbyte);
+            first = _mm_packs_epi32(_mm_and_si128(clo, lowword),
+                                    _mm_and_si128(chi, lowword));
+            second = _mm_packs_epi32(_mm_srli_epi32(clo, 16),
+                                     _mm_srli_epi32(chi, 16));
+            if (cb_first) {
+                YUVChromaSSE2(second, first, &r, &g, &b);
+            } else {
+                YUVChromaSSE2(first, second, &r, &g, &b);
+            }
+            YUVPixelsSSE2(_mm_and_si128(_mm_srl_epi16(lo, lum_shift), lowbyte),
+                          _mm_and_si128(_mm_srl_epi16(hi, lum_shift), lowbyte),
+                          r, g, b, &R, &G, &B);
+            YUVStoreSSE2(&target, row + x * target.bpp, R, G, B);
+        }
+        for (; x < cols_2 * 2; x += 2) {
+            const int CR = cr[y * cols_2 * 4 + x * 2];
+            const int CB = cb[y * cols_2 * 4 + x * 2];
+
+            YUVStorePixel(swdata, row + x * target.bpp, target.bpp,
+                          lum[y * cols_2 * 4 + x * 2], CR, CB);
+            YUVStorePixel(swdata, row + (x + 1) * target.bpp, target.bpp,
+                          lum[y * cols_2 * 4 + x * 2 + 2], CR, CB);
+        }
+    }
+}
+
+#endif /* __SSE2__ */
+
+#if SDL_NEON_YUV
+
+typedef struct
+{
+    int bpp;
+    int order[4];
+    uint8x16_t fill;
+    int16x8_t loss[3];
+    int16x8_t shift[3];
+    uint16x8_t amask;
+} YUVTargetNEON;
+
+static void
+YUVSetupTargetNEON(const SDL_SW_YUVTexture * swdata, YUVTargetNEON * target)
+{
+    int i;
+
+    target->bpp = SDL_BYTESPERPIXEL(swdata->target_format);
+    if (target->bpp == 4) {
+        YUVGetByteOrder(swdata, target->order);
+        target->fill = vdupq_n_u8(YUVGetFillByte(swdata, target->order));
+    }
+    for (i = 0; i < 3; ++i) {
+        target->loss[i] = vdupq_n_s16((int16_t) -swdata->loss[i]);
+        target->shift[i] = vdupq_n_s16((int16_t) swdata->shift[i]);
+    }
+    target->amask = vdupq_n_u16((uint16_t) swdata->Amask);
+}
+
+static SDL_INLINE uint16x8_t
+YUVMulHiNEON(uint16x8_t a, uint16_t k)
+{
+    return vcombine_u16(vshrn_n_u32(vmull_n_u16(vget_low_u16(a), k), 16),
+                        vshrn_n_u32(vmull_n_u16(vget_high_u16(a), k), 16));
+}
+
+/* Computes the red, green and blue offsets of 8 chroma samples */
+static SDL_INLINE void
+YUVChromaNEON(uint8x8_t cr, uint8x8_t cb,
+              int16x8_t * r, int16x8_t * g, int16x8_t * b)
+{
+    const int16x8_t v = vreinterpretq_s16_u16(vsubl_u8(cr, vdup_n_u8(128)));
+    const int16x8_t u = vreinterpretq_s16_u16(vsubl_u8(cb, vdup_n_u8(128)));
+    const int16x8_t vsign = vshrq_n_s16(v, 15);
+    const int16x8_t usign = vshrq_n_s16(u, 15);
+    const uint16x8_t vabs = vreinterpretq_u16_s16(vabsq_s16(v));
+    const uint16x8_t uabs = vreinterpretq_u16_s16(vabsq_s16(u));
+    int16x8_t rv, gv, gu, bu;
+
+    /* The factors above 1.0 are applied as 1.0 plus the fraction */
+    rv = vreinterpretq_s16_u16(vaddq_u16(vabs, YUVMulHiNEON(vabs, YUV_K_RV - 0x10000)));
+    gv = vreinterpretq_s16_u16(YUVMulHiNEON(vabs, YUV_K_GV));
+    gu = vreinterpretq_s16_u16(YUVMulHiNEON(uabs, YUV_K_GU));
+    bu = vreinterpretq_s16_u16(vaddq_u16(uabs, YUVMulHiNEON(uabs, YUV_K_BU - 0x10000)));
+
+    *r = vsubq_s16(veorq_s16(rv, vsign), vsign);
+    *g = vaddq_s16(vsubq_s16(vsign, veorq_s16(gv, vsign)),
+                   vsubq_s16(usign, veorq_s16(gu, usign)));
+    *b = vsubq_s16(veorq_s16(bu, usign), usign);
+}
+
+static SDL_INLINE uint8x8_t
+YUVAddNEON(uint8x8_t y, int16x8_t offset)
+{
+    return vqmovun_s16(vaddq_s16(vreinterpretq_s16_u16(vmovl_u8(y)), offset));
+}
+
+static SDL_INLINE uint16x8_t
+YUVPack16NEON(const YUVTargetNEON * target, uint8x8_t r, uint8x8_t g, uint8x8_t b)
+{
+    const uint16x8_t r16 = vshlq_u16(vshlq_u16(vmovl_u8(r), target->loss[0]), target->shift[0]);
+    const uint16x8_t g16 = vshlq_u16(vshlq_u16(vmovl_u8(g), target->loss[1]), target->shift[1]);
+    const uint16x8_t b16 = vshlq_u16(vshlq_u16(vmovl_u8(b), target->loss[2]), target->shift[2]);
+
+    return vorrq_u16(vorrq_u16(r16, g16), vorrq_u16(b16, target->amask));
+}
+
+/* Writes 16 pixels */
+static SDL_INLINE void
+YUVStoreNEON(const YUVTargetNEON * target, Uint8 * out,
+             uint8x16_t R, uint8x16_t G, uint8x16_t B)
+{
+    if (target->bpp == 4) {
+        uint8x16_t channels[4];
+        uint8x16x4_t pixels;
+        int i;
+
+        channels[0] = R;
+        channels[1] = G;
+        channels[2] = B;
+        channels[3] = target->fill;
+        for (i = 0; i < 4; ++i) {
+            pixels.val[i] = channels[target->order[i]];
+        }
+        vst4q_u8(out, pixels);
+    } else {
+        vst1q_u16((uint16_t *) out,
+                  YUVPack16NEON(target, vget_low_u8(R), vget_low_u8(G), vget_low_u8(B)));
+        vst1q_u16((uint16_t *) (out + 16),
+                  YUVPack16NEON(target, vget_high_u8(R), vget_high_u8(G), vget_high_u8(B)));
+    }
+}
+
+/* Converts 16 luma samples, the offsets cover two pixels each */
+static SDL_INLINE void
+YUVStoreRowNEON(const YUVTargetNEON * target, Uint8 * out, uint8x16_t Y,
+                int16x8_t r, int16x8_t g, int16x8_t b)
+{
+    const int16x8x2_t rr = vzipq_s16(r, r);
+    const int16x8x2_t gg = vzipq_s16(g, g);
+    const int16x8x2_t bb = vzipq_s16(b, b);
+    const uint8x8_t ylo = vget_low_u8(Y);
+    const uint8x8_t yhi = vget_high_u8(Y);
+
+    YUVStoreNEON(target, out,
+                 vcombine_u8(YUVAddNEON(ylo, rr.val[0]), YUVAddNEON(yhi, rr.val[1])),
+                 vcombine_u8(YUVAddNEON(ylo, gg.val[0]), YUVAddNEON(yhi, gg.val[1])),
+                 vcombine_u8(YUVAddNEON(ylo, bb.val[0]), YUVAddNEON(yhi, bb.val[1])));
+}
+
+static void
+ColorDitherYV12NEON(SDL_SW_YUVTexture * swdata,
+                    const Uint8 * lum, const Uint8 * cr,
+                    const Uint8 * cb, Uint8 * out,
+                    int rows, int cols, int mod)
+{
+    const int cols_2 = cols / 2;
+    YUVTargetNEON target;
+    int pitch;
+    int x, y;
+
+    YUVSetupTargetNEON(swdata, &target);
+    pitch = (cols + mod) * target.bpp;
+
+    for (y = 0; y < rows / 2; ++y) {
+        const Uint8 *lum1 = lum + (2 * y) * cols;
+        const Uint8 *lum2 = lum1 + cols;
+        const Uint8 *crrow = cr + y * cols_2;
+        const Uint8 *cbrow = cb + y * cols_2;
+        Uint8 *row1 = out + (2 * y) * pitch;
+        Uint8 *row2 = row1 + pitch;
+
+        for (x = 0; x + 16 <= cols_2 * 2; x += 16) {
+            int16x8_t r, g, b;
+
+            YUVChromaNEON(vld1_u8(crrow + x / 2), vld1_u8(cbrow + x / 2), &r, &g, &b);
+            YUVStoreRowNEON(&target, row1 + x * target.bpp, vld1q_u8(lum1 + x), r, g, b);
+            YUVStoreRowNEON(&target, row2 + x * target.bpp, vld1q_u8(lum2 + x), r, g, b);
+        }
+        for (; x < cols_2 * 2; x += 2) {
+            const int CR = crrow[x / 2];
+            const int CB = cbrow[x / 2];
+
+            YUVStorePixel(swdata, row1 + x * target.bpp, target.bpp, lum1[x], CR, CB);
+            YUVStorePixel(swdata, row1 + (x + 1) * target.bpp, target.bpp, lum1[x + 1], CR, CB);
+            YUVStorePixel(swdata, row2 + x * target.bpp, target.bpp, lum2[x], CR, CB);
+            YUVStorePixel(swdata, row2 + (x + 1) * target.bpp, target.bpp, lum2[x + 1], CR, CB);
+        }
+    }
+}
+
+/* NV12 and NV21, the chroma pointers give the byte order */
+static void
+ColorDitherNV12NEON(SDL_SW_YUVTexture * swdata,
+                    const Uint8 * lum, const Uint8 * cr,
+                    const Uint8 * cb, Uint8 * out,
+                    int rows, int cols, int mod)
+{
+    const int cols_2 = cols / 2;
+    const SDL_bool cb_first = (cb < cr);
+    YUVTargetNEON target;
+    int pitch;
+    int x, y;
+
+    YUVSetupTargetNEON(swdata, &target);
+    pitch = (cols + mod) * target.bpp;
+
+    for (y = 0; y < rows / 2; ++y) {
+        const Uint8 *lum1 = lum + (2 * y) * cols;
+        const Uint8 *lum2 = lum1 + cols;
+        const Uint8 *crrow = cr + y * cols;
+        const Uint8 *cbrow = cb + y * cols;
+        const Uint8 *uvrow = cb_first ? cbrow : crrow;
+        Uint8 *row1 = out + (2 * y) * pitch;
+        Uint8 *row2 = row1 + pitch;
+
+        for (x = 0; x + 16 <= cols_2 * 2; x += 16) {
+            const uint8x8x2_t uv = vld2_u8(uvrow + x);
+            int16x8_t r, g, b;
+
+            if (cb_first) {
+                YUVChromaNEON(uv.val[1], uv.val[0], &r, &g, &b);
+            } else {
+                YUVChromaNEON(uv.val[0], uv.val[1], &r, &g, &b);
+            }
+            YUVStoreRowNEON(&target, row1 + x * target.bpp, vld1q_u8(lum1 + x), r, g, b);
+            YUVStoreRowNEON(&target, row2 + x * target.bpp, vld1q_u8(lum2 + x), r, g, b);
+        }
+        for (; x < cols_2 * 2; x += 2) {
+            const int CR = crrow[x];
+            const int CB = cbrow[x];
+
+            YUVStorePixel(swdata, row1 + x * target.bpp, target.bpp, lum1[x], CR, CB);
+            YUVStorePixel(swdata, row1 + (x + 1) * target.bpp, target.bpp, lum1[x + 1], CR, CB);
+            YUVStorePixel(swdata, row2 + x * target.bpp, target.bpp, lum2[x], CR, CB);
+            YUVStorePixel(swdata, row2 + (x + 1) * target.bpp, target.bpp, lum2[x + 1], CR, CB);
+        }
+    }
+}
+
+/* YUY2, UYVY and YVYU, the chroma pointers give the byte order */
+static void
+ColorDitherYUY2NEON(SDL_SW_YUVTexture * swdata,
+                    const Uint8 * lum, const Uint8 * cr,
+                    const Uint8 * cb, Uint8 * out,
+                    int rows, int cols, int mod)
+{
+    const int cols_2 = cols / 2;
+    /* Where luma and the two chroma samples sit in each 4 byte group */
+    const int lum_offset = (lum < cb && lum < cr) ? 0 : 1;
+    const int cr_index = (int) (cr - (lum - lum_offset));
+    const int cb_index = (int) (cb - (lum - lum_offset));
+    const Uint8 *src = lum - lum_offset;
+    YUVTargetNEON target;
+    int pitch;
+    int x, y;
+
+    YUVSetupTargetNEON(swdata, &target);
+    pitch = (cols + mod) * target.bpp;
+
+    for (y = 0; y < rows; ++y) {
+        const Uint8 *srcrow = src + y * cols_2 * 4;
+        Uint8 *row = out + y * pitch;
+
+        for (x = 0; x + 16 <= cols_2 * 2; x += 16) {
+            const uint8x8x4_t in = vld4_u8(srcrow + x * 2);
+            const uint8x8_t yeven = in.val[lum_offset];
+            const uint8x8_t yodd = in.val[lum_offset + 2];
+            uint8x8x2_t R, G, B;
+            int16x8_t r, g, b;
+
+            YUVChromaNEON(in.val[cr_index], in.val[cb_index], &r, &g, &b);
+            R = vzip_u8(YUVAddNEON(yeven, r), YUVAddNEON(yodd, r));
+            G = vzip_u8(YUVAddNEON(yeven, g), YUVAddNEON(yodd, g));
+            B = vzip_u8(YUVAddNEON(yeven, b), YUVAddNEON(yodd, b));
+            YUVStoreNEON(&target, row + x * target.bpp,
+                         vcombine_u8(R.val[0], R.val[1]),
+                         vcombine_u8(G.val[0], G.val[1]),
+                         vcombine_u8(B.val[0], B.val[1]));
+        }
+        for (; x < cols_2 * 2; x += 2) {
+            const int CR = cr[y * cols_2 * 4 + x * 2];
+            const int CB = cb[y * cols_2 * 4 + x * 2];
+
+            YUVStorePixel(swdata, row + x * target.bpp, target.bpp,
+                          lum[y * cols_2 * 4 + x * 2], CR, CB);
+            YUVStorePixel(swdata, row + (x + 1) * target.bpp, target.bpp,
+                          lum[y * cols_2 * 4 + x * 2 + 2], CR, CB);
+        }
+    }
+}
+
+#endif /* SDL_NEON_YUV */
+
+#endif /* __SSE2__ || SDL_NEON_YUV */
+
 /*
  * How many 1 bits are there in the Uint32.
  * Low performance, do not call often.
@@ -885,6 +1750,86 @@ free_bits_at_bottom(Uint32 a)
     return 1 + free_bits_at_bottom(a >> 1);
 }
 
+/* Picks a vectorized converter if the CPU and the target format allow it */
+static void
+SDL_SW_SetupYUVSIMD(SDL_SW_YUVTexture * swdata, Uint32 Rmask, Uint32 Gmask,
+                    Uint32 Bmask, Uint32 Amask)
+{
+    const int bpp = SDL_BYTESPERPIXEL(swdata->target_format);
+    enum { YUV_LAYOUT_PLANAR, YUV_LAYOUT_SEMIPLANAR, YUV_LAYOUT_PACKED } layout;
+    Uint32 masks[3];
+    int order[4];
+    int i;
+
+    swdata->DisplaySIMD = NULL;
+    if (bpp != 2 && bpp != 4) {
+        return;
+    }
+    masks[0] = Rmask;
+    masks[1] = Gmask;
+    masks[2] = Bmask;
+    for (i = 0; i < 3; ++i) {
+        const int bits = number_of_bits_set(masks[i]);
+        if (bits == 0 || bits > 8) {
+            return;
+        }
+        swdata->loss[i] = 8 - bits;
+        swdata->shift[i] = free_bits_at_bottom(masks[i]);
+    }
+    swdata->Amask = Amask;
+    if (bpp == 4 && !YUVGetByteOrder(swdata, order)) {
+        return;
+    }
+
+    switch (swdata->format) {
+    case SDL_PIXELFORMAT_YV12:
+    case SDL_PIXELFORMAT_IYUV:
+        layout = YUV_LAYOUT_PLANAR;
+        break;
+    case SDL_PIXELFORMAT_NV12:
+    case SDL_PIXELFORMAT_NV21:
+        layout = YUV_LAYOUT_SEMIPLANAR;
+        break;
+    case SDL_PIXELFORMAT_YUY2:
+    case SDL_PIXELFORMAT_UYVY:
+    case SDL_PIXELFORMAT_YVYU:
+        layout = YUV_LAYOUT_PACKED;
+        break;
+    default:
+        return;
+    }
+
+#ifdef __SSE2__
+    if (SDL_HasSSE2()) {
+        switch (layout) {
+        case YUV_LAYOUT_PLANAR:
+            swdata->DisplaySIMD = ColorDitherYV12SSE2;
+            break;
+        case YUV_LAYOUT_SEMIPLANAR:
+            swdata->DisplaySIMD = ColorDitherNV12SSE2;
+            break;
+        case YUV_LAYOUT_PACKED:
+            swdata->DisplaySIMD = ColorDitherYUY2SSE2;
+            break;
+        }
+        return;
+    }
+#endif
+#if SDL_NEON_YUV
+    switch (layout) {
+    case YUV_LAYOUT_PLANAR:
+        swdata->DisplaySIMD = ColorDitherYV12NEON;
+        break;
+    case YUV_LAYOUT_SEMIPLANAR:
+        swdata->DisplaySIMD = ColorDitherNV12NEON;
+        break;
+    case YUV_LAYOUT_PACKED:
+        swdata->DisplaySIMD = ColorDitherYUY2NEON;
+        break;
+    }
+#endif
+}
+
 static int
 SDL_SW_SetupYUVDisplay(SDL_SW_YUVTexture * swdata, Uint32 target_format)
 {
@@ -991,6 +1936,20 @@ SDL_SW_SetupYUVDisplay(SDL_SW_YUVTexture * swdata, Uint32 target_format)
             swdata->Display2X = Color32DitherYV12Mod2X;
         }
         break;
+    case SDL_PIXELFORMAT_NV12:
+    case SDL_PIXELFORMAT_NV21:
+        /* No 2x blitters, the copy stretches the 1x output instead */
+        swdata->Display2X = NULL;
+        if (SDL_BYTESPERPIXEL(target_format) == 2) {
+            swdata->Display1X = Color16DitherNV12Mod1X;
+        }
+        if (SDL_BYTESPERPIXEL(target_format) == 3) {
+            swdata->Display1X = Color24DitherNV12Mod1X;
+        }
+        if (SDL_BYTESPERPIXEL(target_format) == 4) {
+            swdata->Display1X = Color32DitherNV12Mod1X;
+        }
+        break;
     case SDL_PIXELFORMAT_YUY2:
     case SDL_PIXELFORMAT_UYVY:
     case SDL_PIXELFORMAT_YVYU:
@@ -1011,6 +1970,7 @@ SDL_SW_SetupYUVDisplay(SDL_SW_YUVTexture * swdata, Uint32 target_format)
         /* We should never get here (caught above) */
         break;
     }
+    SDL_SW_SetupYUVSIMD(swdata, Rmask, Gmask, Bmask, Amask);
 
     SDL_FreeSurface(swdata->display);
     swdata->display = NULL;
@@ -1031,6 +1991,8 @@ SDL_SW_CreateYUVTexture(Uint32 format, int w, int h)
     switch (format) {
     case SDL_PIXELFORMAT_YV12:
     case SDL_PIXELFORMAT_IYUV:
+    case SDL_PIXELFORMAT_NV12:
+    case SDL_PIXELFORMAT_NV21:
     case SDL_PIXELFORMAT_YUY2:
     case SDL_PIXELFORMAT_UYVY:
     case SDL_PIXELFORMAT_YVYU:
@@ -1086,6 +2048,13 @@ SDL_SW_CreateYUVTexture(Uint32 format, int w, int h)
         swdata->planes[1] = swdata->planes[0] + swdata->pitches[0] * h;
         swdata->planes[2] = swdata->planes[1] + swdata->pitches[1] * h / 2;
         break;
+    case SDL_PIXELFORMAT_NV12:
+    case SDL_PIXELFORMAT_NV21:
+        swdata->pitches[0] = w;
+        swdata->pitches[1] = swdata->pitches[0];
+        swdata->planes[0] = swdata->pixels;
+        swdata->planes[1] = swdata->planes[0] + swdata->pitches[0] * h;
+        break;
     case SDL_PIXELFORMAT_YUY2:
     case SDL_PIXELFORMAT_UYVY:
     case SDL_PIXELFORMAT_YVYU:
@@ -1160,6 +2129,40 @@ SDL_SW_UpdateYUVTexture(SDL_SW_YUVTexture * swdata, const SDL_Rect * rect,
             }
         }
         break;
+    case SDL_PIXELFORMAT_NV12:
+    case SDL_PIXELFORMAT_NV21:
+        if (rect->x == 0 && rect->y == 0 &&
+            rect->w == swdata->w && rect->h == swdata->h &&
+            pitch == swdata->pitches[0]) {
+                SDL_memcpy(swdata->pixels, pixels,
+                           (swdata->h * swdata->w) + (swdata->h * swdata->w) / 2);
+        } else {
+            Uint8 *src, *dst;
+            int row;
+            size_t length;
+
+            /* Copy the Y plane */
+            src = (Uint8 *) pixels;
+            dst = swdata->planes[0] + rect->y * swdata->pitches[0] + rect->x;
+            length = rect->w;
+            for (row = 0; row < rect->h; ++row) {
+                SDL_memcpy(dst, src, length);
+                src += pitch;
+                dst += swdata->pitches[0];
+            }
+
+            /* Copy the interleaved chroma plane, whole pairs only */
+            src = (Uint8 *) pixels + rect->h * pitch;
+            dst = swdata->planes[1] + rect->y/2 * swdata->pitches[1] +
+                  (rect->x & ~1);
+            length = (rect->w / 2) * 2;
+            for (row = 0; row < rect->h/2; ++row) {
+                SDL_memcpy(dst, src, length);
+                src += pitch;
+                dst += swdata->pitches[1];
+            }
+        }
+        break;
     case SDL_PIXELFORMAT_YUY2:
     case SDL_PIXELFORMAT_UYVY:
     case SDL_PIXELFORMAT_YVYU:
@@ -1253,6 +2256,15 @@ SDL_SW_LockYUVTexture(SDL_SW_YUVTexture * swdata, const SDL_Rect * rect,
                 ("YV12 and IYUV textures only support full surface locks");
         }
         break;
+    case SDL_PIXELFORMAT_NV12:
+    case SDL_PIXELFORMAT_NV21:
+        if (rect
+            && (rect->x != 0 || rect->y != 0 || rect->w != swdata->w
+                || rect->h != swdata->h)) {
+            return SDL_SetError
+                ("NV12 and NV21 textures only support full surface locks");
+        }
+        break;
     }
 
     if (rect) {
@@ -1269,6 +2281,48 @@ SDL_SW_UnlockYUVTexture(SDL_SW_YUVTexture * swdata)
 {
 }
 
+/* A conversion split into row bands, each band is converted as if it was
+   a frame of its own.  Band boundaries fall on even rows for the 4:2:0
+   formats, so every band starts on its own chroma row.
+ */
+typedef struct
+{
+    SDL_SW_YUVTexture *swdata;
+    Uint8 *lum;
+    Uint8 *Cr;
+    Uint8 *Cb;
+    Uint8 *out;
+    int scale;              /* output rows per source row */
+    int mod;
+    int lum_pitch;          /* bytes per source row of the lum plane */
+    int chroma_pitch;       /* bytes per chroma row */
+    int chroma_shift;       /* log2 of the source rows per chroma row */
+    int out_pitch;          /* bytes per output row, as the converters see it */
+} SDL_SW_YUVBandJob;
+
+static void
+SDL_SW_CopyYUVBand(void *data, int start, int end)
+{
+    const SDL_SW_YUVBandJob *job = (const SDL_SW_YUVBandJob *) data;
+    SDL_SW_YUVTexture *swdata = job->swdata;
+    const int chroma = (start >> job->chroma_shift) * job->chroma_pitch;
+    Uint8 *lum = job->lum + start * job->lum_pitch;
+    Uint8 *Cr = job->Cr + chroma;
+    Uint8 *Cb = job->Cb + chroma;
+    Uint8 *out = job->out + start * job->scale * job->out_pitch;
+    const int rows = end - start;
+
+    if (job->scale == 2) {
+        swdata->Display2X(swdata->colortab, swdata->rgb_2_pix,
+                          lum, Cr, Cb, out, rows, swdata->w, job->mod);
+    } else if (swdata->DisplaySIMD) {
+        swdata->DisplaySIMD(swdata, lum, Cr, Cb, out, rows, swdata->w, job->mod);
+    } else {
+        swdata->Display1X(swdata->colortab, swdata->rgb_2_pix,
+                          lum, Cr, Cb, out, rows, swdata->w, job->mod);
+    }
+}
+
 int
 SDL_SW_CopyYUVToRGB(SDL_SW_YUVTexture * swdata, const SDL_Rect * srcrect,
                     Uint32 target_format, int w, int h, void *pixels,
@@ -1278,6 +2332,7 @@ SDL_SW_CopyYUVToRGB(SDL_SW_YUVTexture * swdata, const SDL_Rect * srcrect,
     int scale_2x;
     Uint8 *lum, *Cr, *Cb;
     int mod;
+    SDL_SW_YUVBandJob job;
 
     /* Make sure we're set up to display in the desired format */
     if (target_format != swdata->target_format) {
@@ -1297,7 +2352,8 @@ SDL_SW_CopyYUVToRGB(SDL_SW_YUVTexture * swdata, const SDL_Rect * srcrect,
          */
         stretch = 1;
     } else if ((srcrect->w != w) || (srcrect->h != h)) {
-        if ((w == 2 * srcrect->w) && (h == 2 * srcrect->h)) {
+        if ((w == 2 * srcrect->w) && (h == 2 * srcrect->h) &&
+            swdata->Display2X) {
             scale_2x = 1;
         } else {
             stretch = 1;
@@ -1348,6 +2404,16 @@ SDL_SW_CopyYUVToRGB(SDL_SW_YUVTexture * swdata, const SDL_Rect * srcrect,
         Cr = swdata->planes[2];
         Cb = swdata->planes[1];
         break;
+    case SDL_PIXELFORMAT_NV12:
+        lum = swdata->planes[0];
+        Cr = swdata->planes[1] + 1;
+        Cb = swdata->planes[1];
+        break;
+    case SDL_PIXELFORMAT_NV21:
+        lum = swdata->planes[0];
+        Cr = swdata->planes[1];
+        Cb = swdata->planes[1] + 1;
+        break;
     case SDL_PIXELFORMAT_YUY2:
         lum = swdata->planes[0];
         Cr = lum + 3;
@@ -1368,15 +2434,39 @@ SDL_SW_CopyYUVToRGB(SDL_SW_YUVTexture * swdata, const SDL_Rect * srcrect,
     }
     mod = (pitch / SDL_BYTESPERPIXEL(target_format));
 
-    if (scale_2x) {
-        mod -= (swdata->w * 2);
-        swdata->Display2X(swdata->colortab, swdata->rgb_2_pix,
-                          lum, Cr, Cb, pixels, swdata->h, swdata->w, mod);
-    } else {
-        mod -= swdata->w;
-        swdata->Display1X(swdata->colortab, swdata->rgb_2_pix,
-                          lum, Cr, Cb, pixels, swdata->h, swdata->w, mod);
+    job.swdata = swdata;
+    job.lum = lum;
+    job.Cr = Cr;
+    job.Cb = Cb;
+    job.out = (Uint8 *) pixels;
+    job.scale = scale_2x ? 2 : 1;
+    job.mod = mod - swdata->w * job.scale;
+    job.out_pitch = mod * SDL_BYTESPERPIXEL(target_format);
+    switch (swdata->format) {
+    case SDL_PIXELFORMAT_YV12:
+    case SDL_PIXELFORMAT_IYUV:
+        job.lum_pitch = swdata->w;
+        job.chroma_pitch = swdata->w / 2;
+        job.chroma_shift = 1;
+        break;
+    case SDL_PIXELFORMAT_NV12:
+    case SDL_PIXELFORMAT_NV21:
+        job.lum_pitch = swdata->w;
+        job.chroma_pitch = swdata->w;
+        job.chroma_shift = 1;
+        break;
+    default:
+        /* Packed formats carry their chroma on every row */
+        job.lum_pitch = swdata->pitches[0];
+        job.chroma_pitch = swdata->pitches[0];
+        job.chroma_shift = 0;
+        break;
     }
+
+    /* Converting large frames on the worker threads is opt in, with
+       SDL_HINT_SOFTWARE_THREADS, and gives the same output */
+    SDL_ParallelFor(swdata->h, SDL_YUV_BAND_PIXELS / swdata->w + 1,
+                    1 << job.chroma_shift, SDL_SW_CopyYUVBand, &job);
     if (stretch) {
         SDL_Rect rect = *srcrect;
         SDL_SoftStretch(swdata->stretch, &rect, swdata->display, NULL);
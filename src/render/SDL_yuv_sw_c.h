@@ -41,6 +41,15 @@ struct SDL_SW_YUVTexture
                        unsigned char *cb, unsigned char *out,
                        int rows, int cols, int mod);
 
+    /* Vectorized Display1X, with the target layout it works from */
+    void (*DisplaySIMD) (struct SDL_SW_YUVTexture * swdata,
+                         const Uint8 * lum, const Uint8 * cr,
+                         const Uint8 * cb, Uint8 * out,
+                         int rows, int cols, int mod);
+    int loss[3];
+    int shift[3];
+    Uint32 Amask;
+
     /* These are just so we don't have to allocate them separately */
     Uint16 pitches[3];
     Uint8 *planes[3];
@@ -168,6 +168,9 @@ typedef struct
     GLuint utexture;
     GLuint vtexture;
 
+    /* NV12 texture support, the interleaved chroma lives in utexture */
+    SDL_bool nv12;
+
     GL_FBOList *fbo;
 } GL_TextureData;
 
@@ -533,6 +536,11 @@ GL_CreateRenderer(SDL_Window * window, Uint32 flags)
         renderer->info.texture_formats[renderer->info.num_texture_formats++] = SDL_PIXELFORMAT_YV12;
         renderer->info.texture_formats[renderer->info.num_texture_formats++] = SDL_PIXELFORMAT_IYUV;
     }
+    /* ... and NV12 textures using 2 textures and a shader */
+    if (data->shaders && data->num_texture_units >= 2) {
+        renderer->info.texture_formats[renderer->info.num_texture_formats++] = SDL_PIXELFORMAT_NV12;
+        renderer->info.texture_formats[renderer->info.num_texture_formats++] = SDL_PIXELFORMAT_NV21;
+    }
 
 #ifdef __MACOSX__
     renderer->info.texture_formats[renderer->info.num_texture_formats++] = SDL_PIXELFORMAT_UYVY;
@@ -602,6 +610,8 @@ convert_format(GL_RenderData *renderdata, Uint32 pixel_format,
         break;
     case SDL_PIXELFORMAT_YV12:
     case SDL_PIXELFORMAT_IYUV:
+    case SDL_PIXELFORMAT_NV12:
+    case SDL_PIXELFORMAT_NV21:
         *internalFormat = GL_LUMINANCE;
         *format = GL_LUMINANCE;
         *type = GL_UNSIGNED_BYTE;
@@ -663,6 +673,11 @@ GL_CreateTexture(SDL_Renderer * renderer, SDL_Texture * texture)
             /* Need to add size for the U and V planes */
             size += (2 * (texture->h * data->pitch) / 4);
         }
+        if (texture->format == SDL_PIXELFORMAT_NV12 ||
+            texture->format == SDL_PIXELFORMAT_NV21) {
+            /* Need to add size for the interleaved U/V plane */
+            size += ((texture->h * data->pitch) / 2);
+        }
         data->pixels = SDL_calloc(1, size);
         if (!data->pixels) {
             SDL_free(data);
@@ -789,6 +804,28 @@ GL_CreateTexture(SDL_Renderer * renderer, SDL_Texture * texture)
         renderdata->glDisable(data->type);
     }
 
+    if (texture->format == SDL_PIXELFORMAT_NV12 ||
+        texture->format == SDL_PIXELFORMAT_NV21) {
+        data->nv12 = SDL_TRUE;
+
+        renderdata->glGenTextures(1, &data->utexture);
+        renderdata->glEnable(data->type);
+
+        renderdata->glBindTexture(data->type, data->utexture);
+        renderdata->glTexParameteri(data->type, GL_TEXTURE_MIN_FILTER,
+                                    scaleMode);
+        renderdata->glTexParameteri(data->type, GL_TEXTURE_MAG_FILTER,
+                                    scaleMode);
+        renderdata->glTexParameteri(data->type, GL_TEXTURE_WRAP_S,
+                                    GL_CLAMP_TO_EDGE);
+        renderdata->glTexParameteri(data->type, GL_TEXTURE_WRAP_T,
+                                    GL_CLAMP_TO_EDGE);
+        renderdata->glTexImage2D(data->type, 0, GL_LUMINANCE_ALPHA, texture_w/2,
+                                 texture_h/2, 0, GL_LUMINANCE_ALPHA,
+                                 GL_UNSIGNED_BYTE, NULL);
+        renderdata->glDisable(data->type);
+    }
+
     return GL_CheckError("", renderer);
 }
 
@@ -834,6 +871,18 @@ GL_UpdateTexture(SDL_Renderer * renderer, SDL_Texture * texture,
                                     rect->w/2, rect->h/2,
                                     data->format, data->formattype, pixels);
     }
+    if (data->nv12) {
+        /* The U/V pairs have the same pitch in bytes as the Y rows */
+        renderdata->glPixelStorei(GL_UNPACK_ROW_LENGTH, (pitch / 2));
+
+        /* Skip to the correct offset into the next texture */
+        pixels = (const void*)((const Uint8*)pixels + rect->h * pitch);
+        renderdata->glBindTexture(data->type, data->utexture);
+        renderdata->glTexSubImage2D(data->type, 0, rect->x/2, rect->y/2,
+                                    rect->w/2, rect->h/2,
+                                    GL_LUMINANCE_ALPHA, GL_UNSIGNED_BYTE,
+                                    pixels);
+    }
     renderdata->glDisable(data->type);
 
     return GL_CheckError("glTexSubImage2D()", renderer);
@@ -893,14 +942,9 @@ static void
 GL_UnlockTexture(SDL_Renderer * renderer, SDL_Texture * texture)
 {
     GL_TextureData *data = (GL_TextureData *) texture->driverdata;
-    const SDL_Rect *rect;
-    void *pixels;
 
-    rect = &data->locked_rect;
-    pixels =
-        (void *) ((Uint8 *) data->pixels + rect->y * data->pitch +
-                  rect->x * SDL_BYTESPERPIXEL(texture->format));
-    GL_UpdateTexture(renderer, texture, rect, pixels, data->pitch);
+    SDL_UploadLockedTexture(renderer, texture, &data->locked_rect,
+                            data->pixels, data->pitch);
 }
 
 static int
@@ -1008,6 +1052,19 @@ GL_SetColor(GL_RenderData * data, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
     }
 }
 
+/* Premultiplied color has to fade along with the alpha modulation */
+static void
+GL_SetTextureColor(GL_RenderData * data, SDL_Texture * texture)
+{
+    if (texture->blendMode == SDL_BLENDMODE_PREMULTIPLIED) {
+        GL_SetColor(data, (Uint8) ((texture->r * texture->a) / 255),
+                    (Uint8) ((texture->g * texture->a) / 255),
+                    (Uint8) ((texture->b * texture->a) / 255), texture->a);
+    } else {
+        GL_SetColor(data, texture->r, texture->g, texture->b, texture->a);
+    }
+}
+
 static void
 GL_SetBlendMode(GL_RenderData * data, int blendMode)
 {
@@ -1027,6 +1084,11 @@ GL_SetBlendMode(GL_RenderData * data, int blendMode)
             data->glEnable(GL_BLEND);
             data->glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE, GL_ZERO, GL_ONE);
             break;
+        case SDL_BLENDMODE_PREMULTIPLIED:
+            data->glTexEnvf(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE);
+            data->glEnable(GL_BLEND);
+            data->glBlendFuncSeparate(GL_ONE, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+            break;
         case SDL_BLENDMODE_MOD:
             data->glTexEnvf(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE);
             data->glEnable(GL_BLEND);
@@ -1190,10 +1252,16 @@ GL_RenderCopy(SDL_Renderer * renderer, SDL_Texture * texture,
 
         data->glActiveTextureARB(GL_TEXTURE0_ARB);
     }
+    if (texturedata->nv12) {
+        data->glActiveTextureARB(GL_TEXTURE1_ARB);
+        data->glBindTexture(texturedata->type, texturedata->utexture);
+
+        data->glActiveTextureARB(GL_TEXTURE0_ARB);
+    }
     data->glBindTexture(texturedata->type, texturedata->texture);
 
     if (texture->modMode) {
-        GL_SetColor(data, texture->r, texture->g, texture->b, texture->a);
+        GL_SetTextureColor(data, texture);
     } else {
         GL_SetColor(data, 255, 255, 255, 255);
     }
@@ -1202,6 +1270,12 @@ GL_RenderCopy(SDL_Renderer * renderer, SDL_Texture * texture,
 
     if (texturedata->yuv) {
         GL_SetShader(data, SHADER_YV12);
+    } else if (texturedata->nv12) {
+        if (texture->format == SDL_PIXELFORMAT_NV12) {
+            GL_SetShader(data, SHADER_NV12);
+        } else {
+            GL_SetShader(data, SHADER_NV21);
+        }
     } else {
         GL_SetShader(data, SHADER_RGB);
     }
@@ -1259,10 +1333,16 @@ GL_RenderCopyEx(SDL_Renderer * renderer, SDL_Texture * texture,
 
         data->glActiveTextureARB(GL_TEXTURE0_ARB);
     }
+    if (texturedata->nv12) {
+        data->glActiveTextureARB(GL_TEXTURE1_ARB);
+        data->glBindTexture(texturedata->type, texturedata->utexture);
+
+        data->glActiveTextureARB(GL_TEXTURE0_ARB);
+    }
     data->glBindTexture(texturedata->type, texturedata->texture);
 
     if (texture->modMode) {
-        GL_SetColor(data, texture->r, texture->g, texture->b, texture->a);
+        GL_SetTextureColor(data, texture);
     } else {
         GL_SetColor(data, 255, 255, 255, 255);
     }
@@ -1271,6 +1351,12 @@ GL_RenderCopyEx(SDL_Renderer * renderer, SDL_Texture * texture,
 
     if (texturedata->yuv) {
         GL_SetShader(data, SHADER_YV12);
+    } else if (texturedata->nv12) {
+        if (texture->format == SDL_PIXELFORMAT_NV12) {
+            GL_SetShader(data, SHADER_NV12);
+        } else {
+            GL_SetShader(data, SHADER_NV21);
+        }
     } else {
         GL_SetShader(data, SHADER_RGB);
     }
@@ -1413,6 +1499,9 @@ GL_DestroyTexture(SDL_Renderer * renderer, SDL_Texture * texture)
         renderdata->glDeleteTextures(1, &data->utexture);
         renderdata->glDeleteTextures(1, &data->vtexture);
     }
+    if (data->nv12) {
+        renderdata->glDeleteTextures(1, &data->utexture);
+    }
     SDL_free(data->pixels);
     SDL_free(data);
     texture->driverdata = NULL;
@@ -1468,6 +1557,12 @@ GL_BindTexture (SDL_Renderer * renderer, SDL_Texture *texture, float *texw, floa
 
         data->glActiveTextureARB(GL_TEXTURE0_ARB);
     }
+    if (texturedata->nv12) {
+        data->glActiveTextureARB(GL_TEXTURE1_ARB);
+        data->glBindTexture(texturedata->type, texturedata->utexture);
+
+        data->glActiveTextureARB(GL_TEXTURE0_ARB);
+    }
     data->glBindTexture(texturedata->type, texturedata->texture);
 
     if(texw) *texw = (float)texturedata->texw;
@@ -1492,6 +1587,12 @@ GL_UnbindTexture (SDL_Renderer * renderer, SDL_Texture *texture)
 
         data->glActiveTextureARB(GL_TEXTURE0_ARB);
     }
+    if (texturedata->nv12) {
+        data->glActiveTextureARB(GL_TEXTURE1_ARB);
+        data->glDisable(texturedata->type);
+
+        data->glActiveTextureARB(GL_TEXTURE0_ARB);
+    }
 
     data->glDisable(texturedata->type);
 
@@ -27,6 +27,8 @@ typedef enum {
     SHADER_SOLID,
     SHADER_RGB,
     SHADER_YV12,
+    SHADER_NV12,
+    SHADER_NV21,
     NUM_SHADERS
 } GL_Shader;
 
@@ -623,7 +623,7 @@ GLES_UnlockTexture(SDL_Renderer * renderer, SDL_Texture * texture)
     rect.y = 0;
     rect.w = texture->w;
     rect.h = texture->h;
-    GLES_UpdateTexture(renderer, texture, &rect, data->pixels, data->pitch);
+    SDL_UploadLockedTexture(renderer, texture, &rect, data->pixels, data->pitch);
 }
 
 static int
@@ -714,6 +714,19 @@ GLES_SetColor(GLES_RenderData * data, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
     }
 }
 
+/* Premultiplied color has to fade along with the alpha modulation */
+static void
+GLES_SetTextureColor(GLES_RenderData * data, SDL_Texture * texture)
+{
+    if (texture->blendMode == SDL_BLENDMODE_PREMULTIPLIED) {
+        GLES_SetColor(data, (Uint8) ((texture->r * texture->a) / 255),
+                      (Uint8) ((texture->g * texture->a) / 255),
+                      (Uint8) ((texture->b * texture->a) / 255), texture->a);
+    } else {
+        GLES_SetColor(data, texture->r, texture->g, texture->b, texture->a);
+    }
+}
+
 static void
 GLES_SetBlendMode(GLES_RenderData * data, int blendMode)
 {
@@ -741,6 +754,11 @@ GLES_SetBlendMode(GLES_RenderData * data, int blendMode)
                 data->glBlendFunc(GL_SRC_ALPHA, GL_ONE);
             }
             break;
+        case SDL_BLENDMODE_PREMULTIPLIED:
+            data->glTexEnvf(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE);
+            data->glEnable(GL_BLEND);
+            data->glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+            break;
         case SDL_BLENDMODE_MOD:
             data->glTexEnvf(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE);
             data->glEnable(GL_BLEND);
@@ -889,7 +907,7 @@ GLES_RenderCopy(SDL_Renderer * renderer, SDL_Texture * texture,
     data->glBindTexture(texturedata->type, texturedata->texture);
 
     if (texture->modMode) {
-        GLES_SetColor(data, texture->r, texture->g, texture->b, texture->a);
+        GLES_SetTextureColor(data, texture);
     } else {
         GLES_SetColor(data, 255, 255, 255, 255);
     }
@@ -990,7 +1008,7 @@ GLES_RenderCopyEx(SDL_Renderer * renderer, SDL_Texture * texture,
     data->glBindTexture(texturedata->type, texturedata->texture);
 
     if (texture->modMode) {
-        GLES_SetColor(data, texture->r, texture->g, texture->b, texture->a);
+        GLES_SetTextureColor(data, texture);
     } else {
         GLES_SetColor(data, 255, 255, 255, 255);
     }
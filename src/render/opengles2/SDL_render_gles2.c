@@ -48,11 +48,13 @@ SDL_RenderDriver GLES2_RenderDriver = {
     {
         "opengles2",
         (SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC | SDL_RENDERER_TARGETTEXTURE),
-        4,
+        6,
         {SDL_PIXELFORMAT_ABGR8888,
         SDL_PIXELFORMAT_ARGB8888,
         SDL_PIXELFORMAT_RGB888,
-        SDL_PIXELFORMAT_BGR888},
+        SDL_PIXELFORMAT_BGR888,
+        SDL_PIXELFORMAT_NV12,
+        SDL_PIXELFORMAT_NV21},
         0,
         0
     }
@@ -79,6 +81,9 @@ typedef struct GLES2_TextureData
     GLenum pixel_type;
     void *pixel_data;
     size_t pitch;
+    /* NV12 texture support, the interleaved chroma lives in texture_u */
+    SDL_bool nv12;
+    GLenum texture_u;
     GLES2_FBOList *fbo;
 } GLES2_TextureData;
 
@@ -133,7 +138,8 @@ typedef enum
     GLES2_UNIFORM_PROJECTION,
     GLES2_UNIFORM_TEXTURE,
     GLES2_UNIFORM_MODULATION,
-    GLES2_UNIFORM_COLOR
+    GLES2_UNIFORM_COLOR,
+    GLES2_UNIFORM_TEXTURE_U
 } GLES2_Uniform;
 
 typedef enum
@@ -142,7 +148,9 @@ typedef enum
     GLES2_IMAGESOURCE_TEXTURE_ABGR,
     GLES2_IMAGESOURCE_TEXTURE_ARGB,
     GLES2_IMAGESOURCE_TEXTURE_RGB,
-    GLES2_IMAGESOURCE_TEXTURE_BGR
+    GLES2_IMAGESOURCE_TEXTURE_BGR,
+    GLES2_IMAGESOURCE_TEXTURE_NV12,
+    GLES2_IMAGESOURCE_TEXTURE_NV21
 } GLES2_ImageSource;
 
 typedef struct GLES2_DriverContext
@@ -472,6 +480,11 @@ GLES2_CreateTexture(SDL_Renderer *renderer, SDL_Texture *texture)
         format = GL_RGBA;
         type = GL_UNSIGNED_BYTE;
         break;
+    case SDL_PIXELFORMAT_NV12:
+    case SDL_PIXELFORMAT_NV21:
+        format = GL_LUMINANCE;
+        type = GL_UNSIGNED_BYTE;
+        break;
     default:
         return SDL_SetError("Texture format not supported");
     }
@@ -485,12 +498,20 @@ GLES2_CreateTexture(SDL_Renderer *renderer, SDL_Texture *texture)
     data->texture_type = GL_TEXTURE_2D;
     data->pixel_format = format;
     data->pixel_type = type;
+    data->nv12 = (texture->format == SDL_PIXELFORMAT_NV12 ||
+                  texture->format == SDL_PIXELFORMAT_NV21);
     scaleMode = GetScaleQuality();
 
     /* Allocate a blob for image renderdata */
     if (texture->access == SDL_TEXTUREACCESS_STREAMING) {
+        size_t size;
         data->pitch = texture->w * SDL_BYTESPERPIXEL(texture->format);
-        data->pixel_data = SDL_calloc(1, data->pitch * texture->h);
+        size = data->pitch * texture->h;
+        if (data->nv12) {
+            /* Need to add size for the interleaved U/V plane */
+            size += (data->pitch * texture->h) / 2;
+        }
+        data->pixel_data = SDL_calloc(1, size);
         if (!data->pixel_data) {
             SDL_free(data);
             return SDL_OutOfMemory();
@@ -514,6 +535,22 @@ GLES2_CreateTexture(SDL_Renderer *renderer, SDL_Texture *texture)
         return -1;
     }
 
+    if (data->nv12) {
+        renderdata->glGenTextures(1, &data->texture_u);
+        if (GL_CheckError("glGenTexures()", renderer) < 0) {
+            return -1;
+        }
+        renderdata->glBindTexture(data->texture_type, data->texture_u);
+        renderdata->glTexParameteri(data->texture_type, GL_TEXTURE_MIN_FILTER, scaleMode);
+        renderdata->glTexParameteri(data->texture_type, GL_TEXTURE_MAG_FILTER, scaleMode);
+        renderdata->glTexParameteri(data->texture_type, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        renderdata->glTexParameteri(data->texture_type, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        renderdata->glTexImage2D(data->texture_type, 0, GL_LUMINANCE_ALPHA, texture->w / 2, texture->h / 2, 0, GL_LUMINANCE_ALPHA, GL_UNSIGNED_BYTE, NULL);
+        if (GL_CheckError("glTexImage2D()", renderer) < 0) {
+            return -1;
+        }
+    }
+
     if (texture->access == SDL_TEXTUREACCESS_TARGET) {
        data->fbo = GLES2_GetFBO(renderer->driverdata, texture->w, texture->h);
     } else {
@@ -524,32 +561,23 @@ GLES2_CreateTexture(SDL_Renderer *renderer, SDL_Texture *texture)
 }
 
 static int
-GLES2_UpdateTexture(SDL_Renderer *renderer, SDL_Texture *texture, const SDL_Rect *rect,
-                    const void *pixels, int pitch)
+GLES2_TexSubImage2D(GLES2_DriverContext *data, GLenum target, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const GLvoid *pixels, GLint pitch, GLint bpp)
 {
-    GLES2_DriverContext *data = (GLES2_DriverContext *)renderer->driverdata;
-    GLES2_TextureData *tdata = (GLES2_TextureData *)texture->driverdata;
     Uint8 *blob = NULL;
     Uint8 *src;
     int srcPitch;
     int y;
 
-    GLES2_ActivateRenderer(renderer);
-
-    /* Bail out if we're supposed to update an empty rectangle */
-    if (rect->w <= 0 || rect->h <= 0)
-        return 0;
-
     /* Reformat the texture data into a tightly packed array */
-    srcPitch = rect->w * SDL_BYTESPERPIXEL(texture->format);
+    srcPitch = width * bpp;
     src = (Uint8 *)pixels;
     if (pitch != srcPitch) {
-        blob = (Uint8 *)SDL_malloc(srcPitch * rect->h);
+        blob = (Uint8 *)SDL_malloc(srcPitch * height);
         if (!blob) {
             return SDL_OutOfMemory();
         }
         src = blob;
-        for (y = 0; y < rect->h; ++y)
+        for (y = 0; y < height; ++y)
         {
             SDL_memcpy(src, pixels, srcPitch);
             src += srcPitch;
@@ -558,18 +586,52 @@ GLES2_UpdateTexture(SDL_Renderer *renderer, SDL_Texture *texture, const SDL_Rect
         src = blob;
     }
 
+    data->glTexSubImage2D(target, 0, xoffset, yoffset, width, height, format, type, src);
+    SDL_free(blob);
+    return 0;
+}
+
+static int
+GLES2_UpdateTexture(SDL_Renderer *renderer, SDL_Texture *texture, const SDL_Rect *rect,
+                    const void *pixels, int pitch)
+{
+    GLES2_DriverContext *data = (GLES2_DriverContext *)renderer->driverdata;
+    GLES2_TextureData *tdata = (GLES2_TextureData *)texture->driverdata;
+
+    GLES2_ActivateRenderer(renderer);
+
+    /* Bail out if we're supposed to update an empty rectangle */
+    if (rect->w <= 0 || rect->h <= 0)
+        return 0;
+
     /* Create a texture subimage with the supplied data */
     data->glBindTexture(tdata->texture_type, tdata->texture);
-    data->glTexSubImage2D(tdata->texture_type,
-                    0,
+    if (GLES2_TexSubImage2D(data, tdata->texture_type,
                     rect->x,
                     rect->y,
                     rect->w,
                     rect->h,
                     tdata->pixel_format,
                     tdata->pixel_type,
-                    src);
-    SDL_free(blob);
+                    pixels, pitch, SDL_BYTESPERPIXEL(texture->format)) < 0) {
+        return -1;
+    }
+
+    if (tdata->nv12) {
+        /* Skip to the interleaved U/V plane, it has the same pitch in bytes */
+        pixels = (const Uint8 *)pixels + rect->h * pitch;
+        data->glBindTexture(tdata->texture_type, tdata->texture_u);
+        if (GLES2_TexSubImage2D(data, tdata->texture_type,
+                        rect->x / 2,
+                        rect->y / 2,
+                        rect->w / 2,
+                        rect->h / 2,
+                        GL_LUMINANCE_ALPHA,
+                        GL_UNSIGNED_BYTE,
+                        pixels, pitch, 2) < 0) {
+            return -1;
+        }
+    }
 
     return GL_CheckError("glTexSubImage2D()", renderer);
 }
@@ -600,7 +662,7 @@ GLES2_UnlockTexture(SDL_Renderer *renderer, SDL_Texture *texture)
     rect.y = 0;
     rect.w = texture->w;
     rect.h = texture->h;
-    GLES2_UpdateTexture(renderer, texture, &rect, tdata->pixel_data, tdata->pitch);
+    SDL_UploadLockedTexture(renderer, texture, &rect, tdata->pixel_data, tdata->pitch);
 }
 
 static int
@@ -638,6 +700,9 @@ GLES2_DestroyTexture(SDL_Renderer *renderer, SDL_Texture *texture)
     if (tdata)
     {
         data->glDeleteTextures(1, &tdata->texture);
+        if (tdata->nv12) {
+            data->glDeleteTextures(1, &tdata->texture_u);
+        }
         SDL_free(tdata->pixel_data);
         SDL_free(tdata);
         texture->driverdata = NULL;
@@ -729,6 +794,8 @@ GLES2_CacheProgram(SDL_Renderer *renderer, GLES2_ShaderCacheEntry *vertex,
         data->glGetUniformLocation(entry->id, "u_modulation");
     entry->uniform_locations[GLES2_UNIFORM_COLOR] =
         data->glGetUniformLocation(entry->id, "u_color");
+    entry->uniform_locations[GLES2_UNIFORM_TEXTURE_U] =
+        data->glGetUniformLocation(entry->id, "u_texture_u");
 
     entry->modulation_r = entry->modulation_g = entry->modulation_b = entry->modulation_a = 255;
     entry->color_r = entry->color_g = entry->color_b = entry->color_a = 255;
@@ -736,6 +803,7 @@ GLES2_CacheProgram(SDL_Renderer *renderer, GLES2_ShaderCacheEntry *vertex,
     data->glUseProgram(entry->id);
     data->glUniformMatrix4fv(entry->uniform_locations[GLES2_UNIFORM_PROJECTION], 1, GL_FALSE, (GLfloat *)entry->projection);
     data->glUniform1i(entry->uniform_locations[GLES2_UNIFORM_TEXTURE], 0);  /* always texture unit 0. */
+    data->glUniform1i(entry->uniform_locations[GLES2_UNIFORM_TEXTURE_U], 1);  /* NV12 chroma, texture unit 1. */
     data->glUniform4f(entry->uniform_locations[GLES2_UNIFORM_MODULATION], 1.0f, 1.0f, 1.0f, 1.0f);
     data->glUniform4f(entry->uniform_locations[GLES2_UNIFORM_COLOR], 1.0f, 1.0f, 1.0f, 1.0f);
 
@@ -927,6 +995,12 @@ GLES2_SelectProgram(SDL_Renderer *renderer, GLES2_ImageSource source, SDL_BlendM
     case GLES2_IMAGESOURCE_TEXTURE_BGR:
         ftype = GLES2_SHADER_FRAGMENT_TEXTURE_BGR_SRC;
         break;
+    case GLES2_IMAGESOURCE_TEXTURE_NV12:
+        ftype = GLES2_SHADER_FRAGMENT_TEXTURE_NV12_SRC;
+        break;
+    case GLES2_IMAGESOURCE_TEXTURE_NV21:
+        ftype = GLES2_SHADER_FRAGMENT_TEXTURE_NV21_SRC;
+        break;
     default:
         goto fault;
     }
@@ -1104,6 +1178,10 @@ GLES2_SetBlendMode(GLES2_DriverContext *data, int blendMode)
             data->glEnable(GL_BLEND);
             data->glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE, GL_ZERO, GL_ONE);
             break;
+        case SDL_BLENDMODE_PREMULTIPLIED:
+            data->glEnable(GL_BLEND);
+            data->glBlendFuncSeparate(GL_ONE, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+            break;
         case SDL_BLENDMODE_MOD:
             data->glEnable(GL_BLEND);
             data->glBlendFuncSeparate(GL_ZERO, GL_SRC_COLOR, GL_ZERO, GL_ONE);
@@ -1287,6 +1365,12 @@ GLES2_RenderCopy(SDL_Renderer *renderer, SDL_Texture *texture, const SDL_Rect *s
         if (renderer->target->format != texture->format) {
             switch (texture->format)
             {
+            case SDL_PIXELFORMAT_NV12:
+                sourceType = GLES2_IMAGESOURCE_TEXTURE_NV12;
+                break;
+            case SDL_PIXELFORMAT_NV21:
+                sourceType = GLES2_IMAGESOURCE_TEXTURE_NV21;
+                break;
             case SDL_PIXELFORMAT_ABGR8888:
                 switch (renderer->target->format)
                 {
@@ -1358,6 +1442,12 @@ GLES2_RenderCopy(SDL_Renderer *renderer, SDL_Texture *texture, const SDL_Rect *s
             case SDL_PIXELFORMAT_RGB888:
                 sourceType = GLES2_IMAGESOURCE_TEXTURE_RGB;
                 break;
+            case SDL_PIXELFORMAT_NV12:
+                sourceType = GLES2_IMAGESOURCE_TEXTURE_NV12;
+                break;
+            case SDL_PIXELFORMAT_NV21:
+                sourceType = GLES2_IMAGESOURCE_TEXTURE_NV21;
+                break;
             default:
                 return -1;
         }
@@ -1368,6 +1458,12 @@ GLES2_RenderCopy(SDL_Renderer *renderer, SDL_Texture *texture, const SDL_Rect *s
     }
 
     /* Select the target texture */
+    if (tdata->nv12) {
+        data->glActiveTexture(GL_TEXTURE1);
+        data->glBindTexture(tdata->texture_type, tdata->texture_u);
+
+        data->glActiveTexture(GL_TEXTURE0);
+    }
     data->glBindTexture(tdata->texture_type, tdata->texture);
 
     /* Configure color modulation */
@@ -1383,6 +1479,12 @@ GLES2_RenderCopy(SDL_Renderer *renderer, SDL_Texture *texture, const SDL_Rect *s
         r = texture->r;
         b = texture->b;
     }
+    if (texture->blendMode == SDL_BLENDMODE_PREMULTIPLIED) {
+        /* Premultiplied color has to fade along with the alpha modulation */
+        r = (r * a) / 255;
+        g = (g * a) / 255;
+        b = (b * a) / 255;
+    }
 
     program = data->current_program;
 
@@ -1455,6 +1557,12 @@ GLES2_RenderCopyEx(SDL_Renderer *renderer, SDL_Texture *texture, const SDL_Rect
         if (renderer->target->format != texture->format) {
             switch (texture->format)
             {
+            case SDL_PIXELFORMAT_NV12:
+                sourceType = GLES2_IMAGESOURCE_TEXTURE_NV12;
+                break;
+            case SDL_PIXELFORMAT_NV21:
+                sourceType = GLES2_IMAGESOURCE_TEXTURE_NV21;
+                break;
             case SDL_PIXELFORMAT_ABGR8888:
                 switch (renderer->target->format)
                 {
@@ -1526,6 +1634,12 @@ GLES2_RenderCopyEx(SDL_Renderer *renderer, SDL_Texture *texture, const SDL_Rect
             case SDL_PIXELFORMAT_RGB888:
                 sourceType = GLES2_IMAGESOURCE_TEXTURE_RGB;
                 break;
+            case SDL_PIXELFORMAT_NV12:
+                sourceType = GLES2_IMAGESOURCE_TEXTURE_NV12;
+                break;
+            case SDL_PIXELFORMAT_NV21:
+                sourceType = GLES2_IMAGESOURCE_TEXTURE_NV21;
+                break;
             default:
                 return -1;
         }
@@ -1534,6 +1648,12 @@ GLES2_RenderCopyEx(SDL_Renderer *renderer, SDL_Texture *texture, const SDL_Rect
         return -1;
 
     /* Select the target texture */
+    if (tdata->nv12) {
+        data->glActiveTexture(GL_TEXTURE1);
+        data->glBindTexture(tdata->texture_type, tdata->texture_u);
+
+        data->glActiveTexture(GL_TEXTURE0);
+    }
     data->glBindTexture(tdata->texture_type, tdata->texture);
 
     /* Configure color modulation */
@@ -1550,6 +1670,12 @@ GLES2_RenderCopyEx(SDL_Renderer *renderer, SDL_Texture *texture, const SDL_Rect
         r = texture->r;
         b = texture->b;
     }
+    if (texture->blendMode == SDL_BLENDMODE_PREMULTIPLIED) {
+        /* Premultiplied color has to fade along with the alpha modulation */
+        r = (r * a) / 255;
+        g = (g * a) / 255;
+        b = (b * a) / 255;
+    }
 
     program = data->current_program;
 
@@ -126,6 +126,54 @@ static const Uint8 GLES2_FragmentSrc_TextureBGRSrc_[] = " \
     } \
 ";
 
+/* NV12 (Y + U/V) to ABGR conversion, the chroma plane is a luminance/alpha texture */
+static const Uint8 GLES2_FragmentSrc_TextureNV12Src_[] = " \
+    precision mediump float; \
+    uniform sampler2D u_texture; \
+    uniform sampler2D u_texture_u; \
+    uniform vec4 u_modulation; \
+    varying vec2 v_texCoord; \
+    \
+    void main() \
+    { \
+        mediump vec3 yuv; \
+        lowp vec3 rgb; \
+        \
+        yuv.x = texture2D(u_texture, v_texCoord).r; \
+        yuv.yz = texture2D(u_texture_u, v_texCoord).ra; \
+        yuv += vec3(-0.0625, -0.5, -0.5); \
+        rgb.r = dot(yuv, vec3(1.164,  0.000,  1.596)); \
+        rgb.g = dot(yuv, vec3(1.164, -0.391, -0.813)); \
+        rgb.b = dot(yuv, vec3(1.164,  2.018,  0.000)); \
+        gl_FragColor = vec4(rgb, 1.0); \
+        gl_FragColor *= u_modulation; \
+    } \
+";
+
+/* NV21 (Y + V/U) to ABGR conversion, the chroma plane is a luminance/alpha texture */
+static const Uint8 GLES2_FragmentSrc_TextureNV21Src_[] = " \
+    precision mediump float; \
+    uniform sampler2D u_texture; \
+    uniform sampler2D u_texture_u; \
+    uniform vec4 u_modulation; \
+    varying vec2 v_texCoord; \
+    \
+    void main() \
+    { \
+        mediump vec3 yuv; \
+        lowp vec3 rgb; \
+        \
+        yuv.x = texture2D(u_texture, v_texCoord).r; \
+        yuv.yz = texture2D(u_texture_u, v_texCoord).ar; \
+        yuv += vec3(-0.0625, -0.5, -0.5); \
+        rgb.r = dot(yuv, vec3(1.164,  0.000,  1.596)); \
+        rgb.g = dot(yuv, vec3(1.164, -0.391, -0.813)); \
+        rgb.b = dot(yuv, vec3(1.164,  2.018,  0.000)); \
+        gl_FragColor = vec4(rgb, 1.0); \
+        gl_FragColor *= u_modulation; \
+    } \
+";
+
 static const GLES2_ShaderInstance GLES2_VertexSrc_Default = {
     GL_VERTEX_SHADER,
     GLES2_SOURCE_SHADER,
@@ -168,6 +216,20 @@ static const GLES2_ShaderInstance GLES2_FragmentSrc_TextureBGRSrc = {
     GLES2_FragmentSrc_TextureBGRSrc_
 };
 
+static const GLES2_ShaderInstance GLES2_FragmentSrc_TextureNV12Src = {
+    GL_FRAGMENT_SHADER,
+    GLES2_SOURCE_SHADER,
+    sizeof(GLES2_FragmentSrc_TextureNV12Src_),
+    GLES2_FragmentSrc_TextureNV12Src_
+};
+
+static const GLES2_ShaderInstance GLES2_FragmentSrc_TextureNV21Src = {
+    GL_FRAGMENT_SHADER,
+    GLES2_SOURCE_SHADER,
+    sizeof(GLES2_FragmentSrc_TextureNV21Src_),
+    GLES2_FragmentSrc_TextureNV21Src_
+};
+
 /*************************************************************************************************
  * Vertex/fragment shader binaries (NVIDIA Tegra 1/2)                                            *
  *************************************************************************************************/
@@ -692,6 +754,62 @@ static GLES2_Shader GLES2_FragmentShader_Modulated_TextureBGRSrc = {
     }
 };
 
+static GLES2_Shader GLES2_FragmentShader_None_TextureNV12Src = {
+    1,
+    {
+        &GLES2_FragmentSrc_TextureNV12Src
+    }
+};
+
+static GLES2_Shader GLES2_FragmentShader_Alpha_TextureNV12Src = {
+    1,
+    {
+        &GLES2_FragmentSrc_TextureNV12Src
+    }
+};
+
+static GLES2_Shader GLES2_FragmentShader_Additive_TextureNV12Src = {
+    1,
+    {
+        &GLES2_FragmentSrc_TextureNV12Src
+    }
+};
+
+static GLES2_Shader GLES2_FragmentShader_Modulated_TextureNV12Src = {
+    1,
+    {
+        &GLES2_FragmentSrc_TextureNV12Src
+    }
+};
+
+static GLES2_Shader GLES2_FragmentShader_None_TextureNV21Src = {
+    1,
+    {
+        &GLES2_FragmentSrc_TextureNV21Src
+    }
+};
+
+static GLES2_Shader GLES2_FragmentShader_Alpha_TextureNV21Src = {
+    1,
+    {
+        &GLES2_FragmentSrc_TextureNV21Src
+    }
+};
+
+static GLES2_Shader GLES2_FragmentShader_Additive_TextureNV21Src = {
+    1,
+    {
+        &GLES2_FragmentSrc_TextureNV21Src
+    }
+};
+
+static GLES2_Shader GLES2_FragmentShader_Modulated_TextureNV21Src = {
+    1,
+    {
+        &GLES2_FragmentSrc_TextureNV21Src
+    }
+};
+
 /*************************************************************************************************
  * Shader selector                                                                               *
  *************************************************************************************************/
@@ -708,6 +826,7 @@ const GLES2_Shader *GLES2_GetShader(GLES2_ShaderType type, SDL_BlendMode blendMo
     case SDL_BLENDMODE_NONE:
         return &GLES2_FragmentShader_None_SolidSrc;
     case SDL_BLENDMODE_BLEND:
+    case SDL_BLENDMODE_PREMULTIPLIED:
         return &GLES2_FragmentShader_Alpha_SolidSrc;
     case SDL_BLENDMODE_ADD:
         return &GLES2_FragmentShader_Additive_SolidSrc;
@@ -722,6 +841,7 @@ const GLES2_Shader *GLES2_GetShader(GLES2_ShaderType type, SDL_BlendMode blendMo
         case SDL_BLENDMODE_NONE:
             return &GLES2_FragmentShader_None_TextureABGRSrc;
         case SDL_BLENDMODE_BLEND:
+        case SDL_BLENDMODE_PREMULTIPLIED:
             return &GLES2_FragmentShader_Alpha_TextureABGRSrc;
         case SDL_BLENDMODE_ADD:
             return &GLES2_FragmentShader_Additive_TextureABGRSrc;
@@ -736,6 +856,7 @@ const GLES2_Shader *GLES2_GetShader(GLES2_ShaderType type, SDL_BlendMode blendMo
         case SDL_BLENDMODE_NONE:
             return &GLES2_FragmentShader_None_TextureARGBSrc;
         case SDL_BLENDMODE_BLEND:
+        case SDL_BLENDMODE_PREMULTIPLIED:
             return &GLES2_FragmentShader_Alpha_TextureARGBSrc;
         case SDL_BLENDMODE_ADD:
             return &GLES2_FragmentShader_Additive_TextureARGBSrc;
@@ -751,6 +872,7 @@ const GLES2_Shader *GLES2_GetShader(GLES2_ShaderType type, SDL_BlendMode blendMo
         case SDL_BLENDMODE_NONE:
             return &GLES2_FragmentShader_None_TextureRGBSrc;
         case SDL_BLENDMODE_BLEND:
+        case SDL_BLENDMODE_PREMULTIPLIED:
             return &GLES2_FragmentShader_Alpha_TextureRGBSrc;
         case SDL_BLENDMODE_ADD:
             return &GLES2_FragmentShader_Additive_TextureRGBSrc;
@@ -766,6 +888,7 @@ const GLES2_Shader *GLES2_GetShader(GLES2_ShaderType type, SDL_BlendMode blendMo
         case SDL_BLENDMODE_NONE:
             return &GLES2_FragmentShader_None_TextureBGRSrc;
         case SDL_BLENDMODE_BLEND:
+        case SDL_BLENDMODE_PREMULTIPLIED:
             return &GLES2_FragmentShader_Alpha_TextureBGRSrc;
         case SDL_BLENDMODE_ADD:
             return &GLES2_FragmentShader_Additive_TextureBGRSrc;
@@ -775,6 +898,38 @@ const GLES2_Shader *GLES2_GetShader(GLES2_ShaderType type, SDL_BlendMode blendMo
             return NULL;
     }
 
+    case GLES2_SHADER_FRAGMENT_TEXTURE_NV12_SRC:
+        switch (blendMode)
+    {
+        case SDL_BLENDMODE_NONE:
+            return &GLES2_FragmentShader_None_TextureNV12Src;
+        case SDL_BLENDMODE_BLEND:
+        case SDL_BLENDMODE_PREMULTIPLIED:
+            return &GLES2_FragmentShader_Alpha_TextureNV12Src;
+        case SDL_BLENDMODE_ADD:
+            return &GLES2_FragmentShader_Additive_TextureNV12Src;
+        case SDL_BLENDMODE_MOD:
+            return &GLES2_FragmentShader_Modulated_TextureNV12Src;
+        default:
+            return NULL;
+    }
+
+    case GLES2_SHADER_FRAGMENT_TEXTURE_NV21_SRC:
+        switch (blendMode)
+    {
+        case SDL_BLENDMODE_NONE:
+            return &GLES2_FragmentShader_None_TextureNV21Src;
+        case SDL_BLENDMODE_BLEND:
+        case SDL_BLENDMODE_PREMULTIPLIED:
+            return &GLES2_FragmentShader_Alpha_TextureNV21Src;
+        case SDL_BLENDMODE_ADD:
+            return &GLES2_FragmentShader_Additive_TextureNV21Src;
+        case SDL_BLENDMODE_MOD:
+            return &GLES2_FragmentShader_Modulated_TextureNV21Src;
+        default:
+            return NULL;
+    }
+
     default:
         return NULL;
     }
@@ -430,7 +430,7 @@ PSL1GHT_RenderDrawPoints(SDL_Renderer * renderer, const SDL_FPoint * points,
         return -1;
     }
 
-    final_points = SDL_stack_alloc(SDL_Point, count);
+    final_points = SDL_AllocRenderScratch(renderer, count, sizeof(SDL_Point));
     if (!final_points) {
         SDL_OutOfMemory();
         return -1;
@@ -463,7 +463,7 @@ PSL1GHT_RenderDrawPoints(SDL_Renderer * renderer, const SDL_FPoint * points,
                                 renderer->r, renderer->g, renderer->b,
                                 renderer->a);
     }
-    SDL_stack_free(final_points);
+    SDL_FreeRenderScratch(renderer, final_points);
 
     return status;
 }
@@ -480,7 +480,7 @@ PSL1GHT_RenderDrawLines(SDL_Renderer * renderer, const SDL_FPoint * points,
         return -1;
     }
 
-    final_points = SDL_stack_alloc(SDL_Point, count);
+    final_points = SDL_AllocRenderScratch(renderer, count, sizeof(SDL_Point));
     if (!final_points) {
         SDL_OutOfMemory();
         return -1;
@@ -513,7 +513,7 @@ PSL1GHT_RenderDrawLines(SDL_Renderer * renderer, const SDL_FPoint * points,
                                 renderer->r, renderer->g, renderer->b,
                                 renderer->a);
     }
-    SDL_stack_free(final_points);
+    SDL_FreeRenderScratch(renderer, final_points);
 
     return status;
 }
@@ -529,7 +529,7 @@ PSL1GHT_RenderFillRects(SDL_Renderer * renderer, const SDL_FRect * rects, int co
         return -1;
     }
 
-    final_rects = SDL_stack_alloc(SDL_Rect, count);
+    final_rects = SDL_AllocRenderScratch(renderer, count, sizeof(SDL_Rect));
     if (!final_rects) {
         SDL_OutOfMemory();
         return -1;
@@ -564,7 +564,7 @@ PSL1GHT_RenderFillRects(SDL_Renderer * renderer, const SDL_FRect * rects, int co
                                     renderer->r, renderer->g, renderer->b,
                                     renderer->a);
     }
-    SDL_stack_free(final_rects);
+    SDL_FreeRenderScratch(renderer, final_rects);
 
     return status;
 }
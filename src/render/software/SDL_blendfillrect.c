@@ -34,6 +34,7 @@ SDL_BlendFillRect_RGB555(SDL_Surface * dst, const SDL_Rect * rect,
 
     switch (blendMode) {
     case SDL_BLENDMODE_BLEND:
+    case SDL_BLENDMODE_PREMULTIPLIED:
         FILLRECT(Uint16, DRAW_SETPIXEL_BLEND_RGB555);
         break;
     case SDL_BLENDMODE_ADD:
@@ -57,6 +58,7 @@ SDL_BlendFillRect_RGB565(SDL_Surface * dst, const SDL_Rect * rect,
 
     switch (blendMode) {
     case SDL_BLENDMODE_BLEND:
+    case SDL_BLENDMODE_PREMULTIPLIED:
         FILLRECT(Uint16, DRAW_SETPIXEL_BLEND_RGB565);
         break;
     case SDL_BLENDMODE_ADD:
@@ -80,6 +82,7 @@ SDL_BlendFillRect_RGB888(SDL_Surface * dst, const SDL_Rect * rect,
 
     switch (blendMode) {
     case SDL_BLENDMODE_BLEND:
+    case SDL_BLENDMODE_PREMULTIPLIED:
         FILLRECT(Uint32, DRAW_SETPIXEL_BLEND_RGB888);
         break;
     case SDL_BLENDMODE_ADD:
@@ -103,6 +106,7 @@ SDL_BlendFillRect_ARGB8888(SDL_Surface * dst, const SDL_Rect * rect,
 
     switch (blendMode) {
     case SDL_BLENDMODE_BLEND:
+    case SDL_BLENDMODE_PREMULTIPLIED:
         FILLRECT(Uint32, DRAW_SETPIXEL_BLEND_ARGB8888);
         break;
     case SDL_BLENDMODE_ADD:
@@ -129,6 +133,7 @@ SDL_BlendFillRect_RGB(SDL_Surface * dst, const SDL_Rect * rect,
     case 2:
         switch (blendMode) {
         case SDL_BLENDMODE_BLEND:
+        case SDL_BLENDMODE_PREMULTIPLIED:
             FILLRECT(Uint16, DRAW_SETPIXEL_BLEND_RGB);
             break;
         case SDL_BLENDMODE_ADD:
@@ -145,6 +150,7 @@ SDL_BlendFillRect_RGB(SDL_Surface * dst, const SDL_Rect * rect,
     case 4:
         switch (blendMode) {
         case SDL_BLENDMODE_BLEND:
+        case SDL_BLENDMODE_PREMULTIPLIED:
             FILLRECT(Uint32, DRAW_SETPIXEL_BLEND_RGB);
             break;
         case SDL_BLENDMODE_ADD:
@@ -174,6 +180,7 @@ SDL_BlendFillRect_RGBA(SDL_Surface * dst, const SDL_Rect * rect,
     case 4:
         switch (blendMode) {
         case SDL_BLENDMODE_BLEND:
+        case SDL_BLENDMODE_PREMULTIPLIED:
             FILLRECT(Uint32, DRAW_SETPIXEL_BLEND_RGBA);
             break;
         case SDL_BLENDMODE_ADD:
@@ -222,6 +229,11 @@ SDL_BlendFillRect(SDL_Surface * dst, const SDL_Rect * rect,
         r = DRAW_MUL(r, a);
         g = DRAW_MUL(g, a);
         b = DRAW_MUL(b, a);
+    } else if (blendMode == SDL_BLENDMODE_PREMULTIPLIED) {
+        /* The color is already scaled, just keep it from overflowing */
+        r = SDL_min(r, a);
+        g = SDL_min(g, a);
+        b = SDL_min(b, a);
     }
 
     switch (dst->format->BitsPerPixel) {
@@ -282,6 +294,11 @@ SDL_BlendFillRects(SDL_Surface * dst, const SDL_Rect * rects, int count,
         r = DRAW_MUL(r, a);
         g = DRAW_MUL(g, a);
         b = DRAW_MUL(b, a);
+    } else if (blendMode == SDL_BLENDMODE_PREMULTIPLIED) {
+        /* The color is already scaled, just keep it from overflowing */
+        r = SDL_min(r, a);
+        g = SDL_min(g, a);
+        b = SDL_min(b, a);
     }
 
     /* FIXME: Does this function pointer slow things down significantly? */
@@ -326,6 +343,7 @@ SDL_BlendFillRects(SDL_Surface * dst, const SDL_Rect * rects, int count,
         if (!SDL_IntersectRect(&rects[i], &dst->clip_rect, &rect)) {
             continue;
         }
+        SDL_DAMAGE_RECT(dst, &rect);
         status = func(dst, &rect, blendMode, r, g, b, a);
     }
     return status;
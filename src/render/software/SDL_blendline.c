@@ -51,6 +51,7 @@ SDL_BlendLine_RGB2(SDL_Surface * dst, int x1, int y1, int x2, int y2,
     if (y1 == y2) {
         switch (blendMode) {
         case SDL_BLENDMODE_BLEND:
+        case SDL_BLENDMODE_PREMULTIPLIED:
             HLINE(Uint16, DRAW_SETPIXEL_BLEND_RGB, draw_end);
             break;
         case SDL_BLENDMODE_ADD:
@@ -66,6 +67,7 @@ SDL_BlendLine_RGB2(SDL_Surface * dst, int x1, int y1, int x2, int y2,
     } else if (x1 == x2) {
         switch (blendMode) {
         case SDL_BLENDMODE_BLEND:
+        case SDL_BLENDMODE_PREMULTIPLIED:
             VLINE(Uint16, DRAW_SETPIXEL_BLEND_RGB, draw_end);
             break;
         case SDL_BLENDMODE_ADD:
@@ -81,6 +83,7 @@ SDL_BlendLine_RGB2(SDL_Surface * dst, int x1, int y1, int x2, int y2,
     } else if (ABS(x1 - x2) == ABS(y1 - y2)) {
         switch (blendMode) {
         case SDL_BLENDMODE_BLEND:
+        case SDL_BLENDMODE_PREMULTIPLIED:
             DLINE(Uint16, DRAW_SETPIXEL_BLEND_RGB, draw_end);
             break;
         case SDL_BLENDMODE_ADD:
@@ -96,6 +99,7 @@ SDL_BlendLine_RGB2(SDL_Surface * dst, int x1, int y1, int x2, int y2,
     } else {
         switch (blendMode) {
         case SDL_BLENDMODE_BLEND:
+        case SDL_BLENDMODE_PREMULTIPLIED:
             AALINE(x1, y1, x2, y2,
                    DRAW_SETPIXELXY2_BLEND_RGB, DRAW_SETPIXELXY2_BLEND_RGB,
                    draw_end);
@@ -142,6 +146,7 @@ SDL_BlendLine_RGB555(SDL_Surface * dst, int x1, int y1, int x2, int y2,
     if (y1 == y2) {
         switch (blendMode) {
         case SDL_BLENDMODE_BLEND:
+        case SDL_BLENDMODE_PREMULTIPLIED:
             HLINE(Uint16, DRAW_SETPIXEL_BLEND_RGB555, draw_end);
             break;
         case SDL_BLENDMODE_ADD:
@@ -157,6 +162,7 @@ SDL_BlendLine_RGB555(SDL_Surface * dst, int x1, int y1, int x2, int y2,
     } else if (x1 == x2) {
         switch (blendMode) {
         case SDL_BLENDMODE_BLEND:
+        case SDL_BLENDMODE_PREMULTIPLIED:
             VLINE(Uint16, DRAW_SETPIXEL_BLEND_RGB555, draw_end);
             break;
         case SDL_BLENDMODE_ADD:
@@ -172,6 +178,7 @@ SDL_BlendLine_RGB555(SDL_Surface * dst, int x1, int y1, int x2, int y2,
     } else if (ABS(x1 - x2) == ABS(y1 - y2)) {
         switch (blendMode) {
         case SDL_BLENDMODE_BLEND:
+        case SDL_BLENDMODE_PREMULTIPLIED:
             DLINE(Uint16, DRAW_SETPIXEL_BLEND_RGB555, draw_end);
             break;
         case SDL_BLENDMODE_ADD:
@@ -187,6 +194,7 @@ SDL_BlendLine_RGB555(SDL_Surface * dst, int x1, int y1, int x2, int y2,
     } else {
         switch (blendMode) {
         case SDL_BLENDMODE_BLEND:
+        case SDL_BLENDMODE_PREMULTIPLIED:
             AALINE(x1, y1, x2, y2,
                    DRAW_SETPIXELXY_BLEND_RGB555, DRAW_SETPIXELXY_BLEND_RGB555,
                    draw_end);
@@ -233,6 +241,7 @@ SDL_BlendLine_RGB565(SDL_Surface * dst, int x1, int y1, int x2, int y2,
     if (y1 == y2) {
         switch (blendMode) {
         case SDL_BLENDMODE_BLEND:
+        case SDL_BLENDMODE_PREMULTIPLIED:
             HLINE(Uint16, DRAW_SETPIXEL_BLEND_RGB565, draw_end);
             break;
         case SDL_BLENDMODE_ADD:
@@ -248,6 +257,7 @@ SDL_BlendLine_RGB565(SDL_Surface * dst, int x1, int y1, int x2, int y2,
     } else if (x1 == x2) {
         switch (blendMode) {
         case SDL_BLENDMODE_BLEND:
+        case SDL_BLENDMODE_PREMULTIPLIED:
             VLINE(Uint16, DRAW_SETPIXEL_BLEND_RGB565, draw_end);
             break;
         case SDL_BLENDMODE_ADD:
@@ -263,6 +273,7 @@ SDL_BlendLine_RGB565(SDL_Surface * dst, int x1, int y1, int x2, int y2,
     } else if (ABS(x1 - x2) == ABS(y1 - y2)) {
         switch (blendMode) {
         case SDL_BLENDMODE_BLEND:
+        case SDL_BLENDMODE_PREMULTIPLIED:
             DLINE(Uint16, DRAW_SETPIXEL_BLEND_RGB565, draw_end);
             break;
         case SDL_BLENDMODE_ADD:
@@ -278,6 +289,7 @@ SDL_BlendLine_RGB565(SDL_Surface * dst, int x1, int y1, int x2, int y2,
     } else {
         switch (blendMode) {
         case SDL_BLENDMODE_BLEND:
+        case SDL_BLENDMODE_PREMULTIPLIED:
             AALINE(x1, y1, x2, y2,
                    DRAW_SETPIXELXY_BLEND_RGB565, DRAW_SETPIXELXY_BLEND_RGB565,
                    draw_end);
@@ -325,6 +337,7 @@ SDL_BlendLine_RGB4(SDL_Surface * dst, int x1, int y1, int x2, int y2,
     if (y1 == y2) {
         switch (blendMode) {
         case SDL_BLENDMODE_BLEND:
+        case SDL_BLENDMODE_PREMULTIPLIED:
             HLINE(Uint32, DRAW_SETPIXEL_BLEND_RGB, draw_end);
             break;
         case SDL_BLENDMODE_ADD:
@@ -340,6 +353,7 @@ SDL_BlendLine_RGB4(SDL_Surface * dst, int x1, int y1, int x2, int y2,
     } else if (x1 == x2) {
         switch (blendMode) {
         case SDL_BLENDMODE_BLEND:
+        case SDL_BLENDMODE_PREMULTIPLIED:
             VLINE(Uint32, DRAW_SETPIXEL_BLEND_RGB, draw_end);
             break;
         case SDL_BLENDMODE_ADD:
@@ -355,6 +369,7 @@ SDL_BlendLine_RGB4(SDL_Surface * dst, int x1, int y1, int x2, int y2,
     } else if (ABS(x1 - x2) == ABS(y1 - y2)) {
         switch (blendMode) {
         case SDL_BLENDMODE_BLEND:
+        case SDL_BLENDMODE_PREMULTIPLIED:
             DLINE(Uint32, DRAW_SETPIXEL_BLEND_RGB, draw_end);
             break;
         case SDL_BLENDMODE_ADD:
@@ -370,6 +385,7 @@ SDL_BlendLine_RGB4(SDL_Surface * dst, int x1, int y1, int x2, int y2,
     } else {
         switch (blendMode) {
         case SDL_BLENDMODE_BLEND:
+        case SDL_BLENDMODE_PREMULTIPLIED:
             AALINE(x1, y1, x2, y2,
                    DRAW_SETPIXELXY4_BLEND_RGB, DRAW_SETPIXELXY4_BLEND_RGB,
                    draw_end);
@@ -417,6 +433,7 @@ SDL_BlendLine_RGBA4(SDL_Surface * dst, int x1, int y1, int x2, int y2,
     if (y1 == y2) {
         switch (blendMode) {
         case SDL_BLENDMODE_BLEND:
+        case SDL_BLENDMODE_PREMULTIPLIED:
             HLINE(Uint32, DRAW_SETPIXEL_BLEND_RGBA, draw_end);
             break;
         case SDL_BLENDMODE_ADD:
@@ -432,6 +449,7 @@ SDL_BlendLine_RGBA4(SDL_Surface * dst, int x1, int y1, int x2, int y2,
     } else if (x1 == x2) {
         switch (blendMode) {
         case SDL_BLENDMODE_BLEND:
+        case SDL_BLENDMODE_PREMULTIPLIED:
             VLINE(Uint32, DRAW_SETPIXEL_BLEND_RGBA, draw_end);
             break;
         case SDL_BLENDMODE_ADD:
@@ -447,6 +465,7 @@ SDL_BlendLine_RGBA4(SDL_Surface * dst, int x1, int y1, int x2, int y2,
     } else if (ABS(x1 - x2) == ABS(y1 - y2)) {
         switch (blendMode) {
         case SDL_BLENDMODE_BLEND:
+        case SDL_BLENDMODE_PREMULTIPLIED:
             DLINE(Uint32, DRAW_SETPIXEL_BLEND_RGBA, draw_end);
             break;
         case SDL_BLENDMODE_ADD:
@@ -462,6 +481,7 @@ SDL_BlendLine_RGBA4(SDL_Surface * dst, int x1, int y1, int x2, int y2,
     } else {
         switch (blendMode) {
         case SDL_BLENDMODE_BLEND:
+        case SDL_BLENDMODE_PREMULTIPLIED:
             AALINE(x1, y1, x2, y2,
                    DRAW_SETPIXELXY4_BLEND_RGBA, DRAW_SETPIXELXY4_BLEND_RGBA,
                    draw_end);
@@ -508,6 +528,7 @@ SDL_BlendLine_RGB888(SDL_Surface * dst, int x1, int y1, int x2, int y2,
     if (y1 == y2) {
         switch (blendMode) {
         case SDL_BLENDMODE_BLEND:
+        case SDL_BLENDMODE_PREMULTIPLIED:
             HLINE(Uint32, DRAW_SETPIXEL_BLEND_RGB888, draw_end);
             break;
         case SDL_BLENDMODE_ADD:
@@ -523,6 +544,7 @@ SDL_BlendLine_RGB888(SDL_Surface * dst, int x1, int y1, int x2, int y2,
     } else if (x1 == x2) {
         switch (blendMode) {
         case SDL_BLENDMODE_BLEND:
+        case SDL_BLENDMODE_PREMULTIPLIED:
             VLINE(Uint32, DRAW_SETPIXEL_BLEND_RGB888, draw_end);
             break;
         case SDL_BLENDMODE_ADD:
@@ -538,6 +560,7 @@ SDL_BlendLine_RGB888(SDL_Surface * dst, int x1, int y1, int x2, int y2,
     } else if (ABS(x1 - x2) == ABS(y1 - y2)) {
         switch (blendMode) {
         case SDL_BLENDMODE_BLEND:
+        case SDL_BLENDMODE_PREMULTIPLIED:
             DLINE(Uint32, DRAW_SETPIXEL_BLEND_RGB888, draw_end);
             break;
         case SDL_BLENDMODE_ADD:
@@ -553,6 +576,7 @@ SDL_BlendLine_RGB888(SDL_Surface * dst, int x1, int y1, int x2, int y2,
     } else {
         switch (blendMode) {
         case SDL_BLENDMODE_BLEND:
+        case SDL_BLENDMODE_PREMULTIPLIED:
             AALINE(x1, y1, x2, y2,
                    DRAW_SETPIXELXY_BLEND_RGB888, DRAW_SETPIXELXY_BLEND_RGB888,
                    draw_end);
@@ -599,6 +623,7 @@ SDL_BlendLine_ARGB8888(SDL_Surface * dst, int x1, int y1, int x2, int y2,
     if (y1 == y2) {
         switch (blendMode) {
         case SDL_BLENDMODE_BLEND:
+        case SDL_BLENDMODE_PREMULTIPLIED:
             HLINE(Uint32, DRAW_SETPIXEL_BLEND_ARGB8888, draw_end);
             break;
         case SDL_BLENDMODE_ADD:
@@ -614,6 +639,7 @@ SDL_BlendLine_ARGB8888(SDL_Surface * dst, int x1, int y1, int x2, int y2,
     } else if (x1 == x2) {
         switch (blendMode) {
         case SDL_BLENDMODE_BLEND:
+        case SDL_BLENDMODE_PREMULTIPLIED:
             VLINE(Uint32, DRAW_SETPIXEL_BLEND_ARGB8888, draw_end);
             break;
         case SDL_BLENDMODE_ADD:
@@ -629,6 +655,7 @@ SDL_BlendLine_ARGB8888(SDL_Surface * dst, int x1, int y1, int x2, int y2,
     } else if (ABS(x1 - x2) == ABS(y1 - y2)) {
         switch (blendMode) {
         case SDL_BLENDMODE_BLEND:
+        case SDL_BLENDMODE_PREMULTIPLIED:
             DLINE(Uint32, DRAW_SETPIXEL_BLEND_ARGB8888, draw_end);
             break;
         case SDL_BLENDMODE_ADD:
@@ -644,6 +671,7 @@ SDL_BlendLine_ARGB8888(SDL_Surface * dst, int x1, int y1, int x2, int y2,
     } else {
         switch (blendMode) {
         case SDL_BLENDMODE_BLEND:
+        case SDL_BLENDMODE_PREMULTIPLIED:
             AALINE(x1, y1, x2, y2,
                    DRAW_SETPIXELXY_BLEND_ARGB8888, DRAW_SETPIXELXY_BLEND_ARGB8888,
                    draw_end);
@@ -719,6 +747,13 @@ SDL_BlendLine(SDL_Surface * dst, int x1, int y1, int x2, int y2,
         return SDL_SetError("SDL_BlendLine(): Unsupported surface format");
     }
 
+    if (blendMode == SDL_BLENDMODE_PREMULTIPLIED) {
+        /* The color is already scaled, just keep it from overflowing */
+        r = SDL_min(r, a);
+        g = SDL_min(g, a);
+        b = SDL_min(b, a);
+    }
+
     /* Perform clipping */
     /* FIXME: We don't actually want to clip, as it may change line slope */
     if (!SDL_IntersectRectAndLine(&dst->clip_rect, &x1, &y1, &x2, &y2)) {
@@ -748,6 +783,14 @@ SDL_BlendLines(SDL_Surface * dst, const SDL_Point * points, int count,
         return SDL_SetError("SDL_BlendLines(): Unsupported surface format");
     }
 
+    if (blendMode == SDL_BLENDMODE_PREMULTIPLIED) {
+        /* The color is already scaled, just keep it from overflowing */
+        r = SDL_min(r, a);
+        g = SDL_min(g, a);
+        b = SDL_min(b, a);
+    }
+
+    SDL_DAMAGE_POINTS(dst, points, count);
     for (i = 1; i < count; ++i) {
         x1 = points[i-1].x;
         y1 = points[i-1].y;
@@ -181,6 +181,8 @@ SDL_DrawLines(SDL_Surface * dst, const SDL_Point * points, int count,
         return SDL_SetError("SDL_DrawLines(): Unsupported surface format");
     }
 
+    SDL_DAMAGE_POINTS(dst, points, count);
+
     for (i = 1; i < count; ++i) {
         x1 = points[i-1].x;
         y1 = points[i-1].y;
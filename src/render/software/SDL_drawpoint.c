@@ -84,6 +84,7 @@ SDL_DrawPoints(SDL_Surface * dst, const SDL_Point * points, int count,
     miny = dst->clip_rect.y;
     maxy = dst->clip_rect.y + dst->clip_rect.h - 1;
 
+    SDL_DAMAGE_POINTS(dst, points, count);
     for (i = 0; i < count; ++i) {
         x = points[i].x;
         y = points[i].y;
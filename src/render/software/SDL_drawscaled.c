@@ -0,0 +1,376 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2014 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "../../SDL_internal.h"
+
+#if !SDL_RENDER_DISABLED
+
+#include "SDL_draw.h"
+#include "SDL_drawscaled.h"
+#include "SDL_drawline.h"
+#include "SDL_blendline.h"
+#include "SDL_blendfillrect.h"
+
+/* Points and horizontal or vertical lines are filled as a single rect of
+   the target per logical span. Opaque spans are filled right away, blended
+   ones are batched. Other lines stay thin lines between their scaled end
+   points, as they are drawn by renderers without native scaling, and runs
+   of them are batched too.
+ */
+#define SCALED_BATCH        64
+#define SCALED_COORD_LIMIT  0x3FFFFFFF
+
+typedef struct
+{
+    SDL_Surface *dst;
+    int origin_x;
+    int origin_y;
+    float scale_x;
+    float scale_y;
+    Sint64 step_x;              /* 16.16 fixed point scale, rounded up */
+    Sint64 step_y;
+    SDL_BlendMode blendMode;
+    Uint8 r, g, b, a;
+    Uint32 color;
+    SDL_Rect rects[SCALED_BATCH];
+    int count;
+    SDL_Point thin[SCALED_BATCH];
+    int thin_count;
+    int status;
+} SDL_ScaledDraw;
+
+static void
+SDL_InitScaledDraw(SDL_ScaledDraw * draw, SDL_Surface * dst,
+                   int origin_x, int origin_y, float scale_x, float scale_y,
+                   SDL_BlendMode blendMode, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+    draw->dst = dst;
+    draw->origin_x = origin_x;
+    draw->origin_y = origin_y;
+    draw->scale_x = scale_x;
+    draw->scale_y = scale_y;
+    draw->step_x = (Sint64) SDL_ceil(scale_x * 65536.0);
+    draw->step_y = (Sint64) SDL_ceil(scale_y * 65536.0);
+    draw->blendMode = blendMode;
+    draw->r = r;
+    draw->g = g;
+    draw->b = b;
+    draw->a = a;
+    draw->color = SDL_MapRGBA(dst->format, r, g, b, a);
+    draw->count = 0;
+    draw->thin_count = 0;
+    draw->status = 0;
+}
+
+static void
+SDL_FlushScaledDraw(SDL_ScaledDraw * draw)
+{
+    int status;
+
+    if (!draw->count) {
+        return;
+    }
+    status = SDL_BlendFillRects(draw->dst, draw->rects, draw->count,
+                                draw->blendMode,
+                                draw->r, draw->g, draw->b, draw->a);
+    if (status < 0) {
+        draw->status = status;
+    }
+    draw->count = 0;
+}
+
+/* Fills an opaque span right away, most of them are only a few pixels */
+static void
+SDL_FillScaledSpan(SDL_ScaledDraw * draw, const SDL_Rect * rect)
+{
+    SDL_Surface *dst = draw->dst;
+    SDL_Rect clipped;
+    Uint8 *pixels;
+    int x, h;
+
+    if (!SDL_IntersectRect(rect, &dst->clip_rect, &clipped)) {
+        return;
+    }
+    if (clipped.w >= 32 || dst->format->BytesPerPixel == 3) {
+        if (SDL_FillRect(dst, &clipped, draw->color) < 0) {
+            draw->status = -1;
+        }
+        return;
+    }
+
+    SDL_DAMAGE_RECT(dst, &clipped);
+    pixels = (Uint8 *) dst->pixels + clipped.y * dst->pitch +
+                                     clipped.x * dst->format->BytesPerPixel;
+    h = clipped.h;
+    switch (dst->format->BytesPerPixel) {
+    case 1:
+        while (h--) {
+            SDL_memset(pixels, (Uint8) draw->color, clipped.w);
+            pixels += dst->pitch;
+        }
+        break;
+    case 2:
+        while (h--) {
+            Uint16 *row = (Uint16 *) pixels;
+            for (x = 0; x < clipped.w; ++x) {
+                row[x] = (Uint16) draw->color;
+            }
+            pixels += dst->pitch;
+        }
+        break;
+    case 4:
+        while (h--) {
+            Uint32 *row = (Uint32 *) pixels;
+            for (x = 0; x < clipped.w; ++x) {
+                row[x] = draw->color;
+            }
+            pixels += dst->pitch;
+        }
+        break;
+    }
+}
+
+/* Maps a logical coordinate to the first target pixel it covers */
+static SDL_INLINE int
+SDL_ScaleCoordinate(int value, Sint64 step, int origin)
+{
+    return origin + (int) (((Sint64) value * step) >> 16);
+}
+
+/* Adds the span of logical pixels between (x1,y1) and (x2,y2), inclusive */
+static void
+SDL_AddScaledSpan(SDL_ScaledDraw * draw, int x1, int y1, int x2, int y2)
+{
+    SDL_Rect span, *rect;
+    int right, bottom;
+
+    if (x1 > x2) {
+        int tmp = x1; x1 = x2; x2 = tmp;
+    }
+    if (y1 > y2) {
+        int tmp = y1; y1 = y2; y2 = tmp;
+    }
+    if (draw->blendMode == SDL_BLENDMODE_NONE) {
+        rect = &span;
+    } else {
+        if (draw->count == SCALED_BATCH) {
+            SDL_FlushScaledDraw(draw);
+        }
+        rect = &draw->rects[draw->count++];
+    }
+    rect->x = SDL_ScaleCoordinate(x1, draw->step_x, draw->origin_x);
+    rect->y = SDL_ScaleCoordinate(y1, draw->step_y, draw->origin_y);
+    right = SDL_ScaleCoordinate(x2 + 1, draw->step_x, draw->origin_x);
+    bottom = SDL_ScaleCoordinate(y2 + 1, draw->step_y, draw->origin_y);
+    rect->w = SDL_max(right - rect->x, 1);
+    rect->h = SDL_max(bottom - rect->y, 1);
+
+    if (rect == &span) {
+        SDL_FillScaledSpan(draw, &span);
+    }
+}
+
+/* Adds a horizontal or vertical line, leaving out the end like SDL_DrawLines() */
+static void
+SDL_AddScaledAxisLine(SDL_ScaledDraw * draw, int x1, int y1, int x2, int y2,
+                      SDL_bool draw_end)
+{
+    if (!draw_end) {
+        if (x1 < x2) {
+            --x2;
+        } else if (x1 > x2) {
+            ++x2;
+        } else if (y1 < y2) {
+            --y2;
+        } else if (y1 > y2) {
+            ++y2;
+        } else {
+            return;
+        }
+    }
+    SDL_AddScaledSpan(draw, x1, y1, x2, y2);
+}
+
+static void
+SDL_FlushScaledThinLines(SDL_ScaledDraw * draw)
+{
+    int status;
+
+    if (draw->thin_count < 2) {
+        draw->thin_count = 0;
+        return;
+    }
+    if (draw->blendMode == SDL_BLENDMODE_NONE) {
+        status = SDL_DrawLines(draw->dst, draw->thin, draw->thin_count,
+                               draw->color);
+    } else {
+        status = SDL_BlendLines(draw->dst, draw->thin, draw->thin_count,
+                                draw->blendMode,
+                                draw->r, draw->g, draw->b, draw->a);
+    }
+    if (status < 0) {
+        draw->status = status;
+    }
+    draw->thin_count = 0;
+}
+
+/* Maps a logical point the way the generic path in SDL_render.c does */
+static void
+SDL_AddScaledThinPoint(SDL_ScaledDraw * draw, const SDL_Point * point)
+{
+    SDL_Point *thin = &draw->thin[draw->thin_count++];
+
+    thin->x = (int) (draw->origin_x + point->x * draw->scale_x);
+    thin->y = (int) (draw->origin_y + point->y * draw->scale_y);
+}
+
+/* Adds the thin line from (p1) to (p2), continuing the current run */
+static void
+SDL_AddScaledThinLine(SDL_ScaledDraw * draw, const SDL_Point * p1,
+                      const SDL_Point * p2)
+{
+    if (draw->thin_count == SCALED_BATCH) {
+        SDL_FlushScaledThinLines(draw);
+    }
+    if (draw->thin_count == 0) {
+        SDL_AddScaledThinPoint(draw, p1);
+    }
+    SDL_AddScaledThinPoint(draw, p2);
+}
+
+/* Returns the logical pixels that cover the clip rect of the target */
+static SDL_bool
+SDL_GetScaledClipRect(const SDL_ScaledDraw * draw, SDL_Rect * clip)
+{
+    const SDL_Rect *rect = &draw->dst->clip_rect;
+    double x1, y1, x2, y2;
+
+    if (rect->w <= 0 || rect->h <= 0 || draw->scale_x <= 0.0f || draw->scale_y <= 0.0f) {
+        return SDL_FALSE;
+    }
+    x1 = SDL_floor((rect->x - draw->origin_x) / (double)draw->scale_x);
+    y1 = SDL_floor((rect->y - draw->origin_y) / (double)draw->scale_y);
+    x2 = SDL_floor((rect->x + rect->w - 1 - draw->origin_x) / (double)draw->scale_x);
+    y2 = SDL_floor((rect->y + rect->h - 1 - draw->origin_y) / (double)draw->scale_y);
+    if (x1 < -SCALED_COORD_LIMIT || y1 < -SCALED_COORD_LIMIT ||
+        x2 > SCALED_COORD_LIMIT || y2 > SCALED_COORD_LIMIT) {
+        /* Extremely small scales would overflow, skip the logical clipping */
+        clip->x = clip->y = -SCALED_COORD_LIMIT;
+        clip->w = clip->h = 2 * SCALED_COORD_LIMIT;
+        return SDL_TRUE;
+    }
+    clip->x = (int)x1;
+    clip->y = (int)y1;
+    clip->w = (int)(x2 - x1) + 1;
+    clip->h = (int)(y2 - y1) + 1;
+    return SDL_TRUE;
+}
+
+int
+SDL_DrawScaledPoints(SDL_Surface * dst, const SDL_Point * points, int count,
+                     int origin_x, int origin_y, float scale_x, float scale_y,
+                     SDL_BlendMode blendMode, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+    SDL_ScaledDraw draw;
+    SDL_Rect clip;
+    int i;
+
+    if (!dst) {
+        return SDL_SetError("SDL_DrawScaledPoints(): Passed NULL destination surface");
+    }
+
+    SDL_InitScaledDraw(&draw, dst, origin_x, origin_y, scale_x, scale_y,
+                       blendMode, r, g, b, a);
+    if (!SDL_GetScaledClipRect(&draw, &clip)) {
+        return 0;
+    }
+    for (i = 0; i < count; ++i) {
+        const int x = points[i].x;
+        const int y = points[i].y;
+
+        if (x < clip.x || x >= clip.x + clip.w || y < clip.y || y >= clip.y + clip.h) {
+            continue;
+        }
+        SDL_AddScaledSpan(&draw, x, y, x, y);
+    }
+    SDL_FlushScaledDraw(&draw);
+    return draw.status;
+}
+
+int
+SDL_DrawScaledLines(SDL_Surface * dst, const SDL_Point * points, int count,
+                    int origin_x, int origin_y, float scale_x, float scale_y,
+                    SDL_BlendMode blendMode, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+    SDL_ScaledDraw draw;
+    SDL_Rect clip;
+    int i;
+    int x1, y1;
+    int x2, y2;
+    SDL_bool draw_end;
+
+    if (!dst) {
+        return SDL_SetError("SDL_DrawScaledLines(): Passed NULL destination surface");
+    }
+
+    SDL_InitScaledDraw(&draw, dst, origin_x, origin_y, scale_x, scale_y,
+                       blendMode, r, g, b, a);
+    if (!SDL_GetScaledClipRect(&draw, &clip)) {
+        return 0;
+    }
+    for (i = 1; i < count; ++i) {
+        x1 = points[i-1].x;
+        y1 = points[i-1].y;
+        x2 = points[i].x;
+        y2 = points[i].y;
+
+        if (x1 != x2 && y1 != y2) {
+            SDL_AddScaledThinLine(&draw, &points[i-1], &points[i]);
+            continue;
+        }
+        SDL_FlushScaledThinLines(&draw);
+
+        /* Perform clipping */
+        if (!SDL_IntersectRectAndLine(&clip, &x1, &y1, &x2, &y2)) {
+            continue;
+        }
+
+        /* Draw the end if it was clipped */
+        draw_end = (x2 != points[i].x || y2 != points[i].y);
+
+        SDL_AddScaledAxisLine(&draw, x1, y1, x2, y2, draw_end);
+    }
+    if (draw.thin_count) {
+        /* The run of thin lines draws its own end */
+        SDL_FlushScaledThinLines(&draw);
+    } else if (points[0].x != points[count-1].x || points[0].y != points[count-1].y) {
+        x1 = points[count-1].x;
+        y1 = points[count-1].y;
+        if (x1 >= clip.x && x1 < clip.x + clip.w && y1 >= clip.y && y1 < clip.y + clip.h) {
+            SDL_AddScaledSpan(&draw, x1, y1, x1, y1);
+        }
+    }
+    SDL_FlushScaledDraw(&draw);
+    return draw.status;
+}
+
+#endif /* !SDL_RENDER_DISABLED */
+
+/* vi: set ts=4 sw=4 expandtab: */
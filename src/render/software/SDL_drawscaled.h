@@ -0,0 +1,32 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2014 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "../../SDL_internal.h"
+
+
+/* These draw with every logical pixel scaled up to a block of the target,
+   with the logical pixel (0,0) covering the target pixel (origin_x,origin_y).
+   Lines that aren't horizontal or vertical are thin lines between the
+   scaled end points instead.
+ */
+extern int SDL_DrawScaledPoints(SDL_Surface * dst, const SDL_Point * points, int count, int origin_x, int origin_y, float scale_x, float scale_y, SDL_BlendMode blendMode, Uint8 r, Uint8 g, Uint8 b, Uint8 a);
+extern int SDL_DrawScaledLines(SDL_Surface * dst, const SDL_Point * points, int count, int origin_x, int origin_y, float scale_x, float scale_y, SDL_BlendMode blendMode, Uint8 r, Uint8 g, Uint8 b, Uint8 a);
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -32,7 +32,9 @@
 #include "SDL_blendpoint.h"
 #include "SDL_drawline.h"
 #include "SDL_drawpoint.h"
+#include "SDL_drawscaled.h"
 #include "SDL_rotate.h"
+#include "../../video/SDL_RLEaccel_c.h"
 
 /* SDL surface based renderer implementation */
 
@@ -63,6 +65,10 @@ static int SW_RenderDrawLines(SDL_Renderer * renderer,
                               const SDL_FPoint * points, int count);
 static int SW_RenderFillRects(SDL_Renderer * renderer,
                               const SDL_FRect * rects, int count);
+static int SW_RenderDrawPointsScaled(SDL_Renderer * renderer,
+                                     const SDL_Point * points, int count);
+static int SW_RenderDrawLinesScaled(SDL_Renderer * renderer,
+                                    const SDL_Point * points, int count);
 static int SW_RenderCopy(SDL_Renderer * renderer, SDL_Texture * texture,
                          const SDL_Rect * srcrect, const SDL_FRect * dstrect);
 static int SW_RenderCopyEx(SDL_Renderer * renderer, SDL_Texture * texture,
@@ -163,6 +169,8 @@ SW_CreateRendererForSurface(SDL_Surface * surface)
     renderer->RenderDrawPoints = SW_RenderDrawPoints;
     renderer->RenderDrawLines = SW_RenderDrawLines;
     renderer->RenderFillRects = SW_RenderFillRects;
+    renderer->RenderDrawPointsScaled = SW_RenderDrawPointsScaled;
+    renderer->RenderDrawLinesScaled = SW_RenderDrawLinesScaled;
     renderer->RenderCopy = SW_RenderCopy;
     renderer->RenderCopyEx = SW_RenderCopyEx;
     renderer->RenderReadPixels = SW_RenderReadPixels;
@@ -328,35 +336,38 @@ SW_SetRenderTarget(SDL_Renderer * renderer, SDL_Texture * texture)
 }
 
 static int
-SW_UpdateViewport(SDL_Renderer * renderer)
+SW_UpdateClipRect(SDL_Renderer * renderer)
 {
     SW_RenderData *data = (SW_RenderData *) renderer->driverdata;
     SDL_Surface *surface = data->surface;
+    const SDL_Rect *rect = &renderer->clip_rect;
+    SDL_Rect clip_rect;
 
-    if (!surface) {
-        /* We'll update the viewport after we recreate the surface */
-        return 0;
+    if (surface) {
+        /* Like the scissor test of the other renderers, the clip rect
+           limits drawing within the viewport */
+        clip_rect = renderer->viewport;
+        if (!SDL_RectEmpty(rect) &&
+            !SDL_IntersectRect(rect, &renderer->viewport, &clip_rect)) {
+            clip_rect.w = clip_rect.h = 0;
+        }
+        SDL_SetClipRect(surface, &clip_rect);
     }
-
-    SDL_SetClipRect(data->surface, &renderer->viewport);
     return 0;
 }
 
 static int
-SW_UpdateClipRect(SDL_Renderer * renderer)
+SW_UpdateViewport(SDL_Renderer * renderer)
 {
     SW_RenderData *data = (SW_RenderData *) renderer->driverdata;
     SDL_Surface *surface = data->surface;
-    const SDL_Rect *rect = &renderer->clip_rect;
 
-    if (surface) {
-        if (!SDL_RectEmpty(rect)) {
-            SDL_SetClipRect(surface, rect);
-        } else {
-            SDL_SetClipRect(surface, NULL);
-        }
+    if (!surface) {
+        /* We'll update the viewport after we recreate the surface */
+        return 0;
     }
-    return 0;
+
+    return SW_UpdateClipRect(renderer);
 }
 
 static int
@@ -393,7 +404,7 @@ SW_RenderDrawPoints(SDL_Renderer * renderer, const SDL_FPoint * points,
         return -1;
     }
 
-    final_points = SDL_stack_alloc(SDL_Point, count);
+    final_points = SDL_AllocRenderScratch(renderer, count, sizeof(SDL_Point));
     if (!final_points) {
         return SDL_OutOfMemory();
     }
@@ -425,7 +436,7 @@ SW_RenderDrawPoints(SDL_Renderer * renderer, const SDL_FPoint * points,
                                 renderer->r, renderer->g, renderer->b,
                                 renderer->a);
     }
-    SDL_stack_free(final_points);
+    SDL_FreeRenderScratch(renderer, final_points);
 
     return status;
 }
@@ -442,7 +453,7 @@ SW_RenderDrawLines(SDL_Renderer * renderer, const SDL_FPoint * points,
         return -1;
     }
 
-    final_points = SDL_stack_alloc(SDL_Point, count);
+    final_points = SDL_AllocRenderScratch(renderer, count, sizeof(SDL_Point));
     if (!final_points) {
         return SDL_OutOfMemory();
     }
@@ -474,11 +485,47 @@ SW_RenderDrawLines(SDL_Renderer * renderer, const SDL_FPoint * points,
                                 renderer->r, renderer->g, renderer->b,
                                 renderer->a);
     }
-    SDL_stack_free(final_points);
+    SDL_FreeRenderScratch(renderer, final_points);
 
     return status;
 }
 
+static int
+SW_RenderDrawPointsScaled(SDL_Renderer * renderer, const SDL_Point * points,
+                          int count)
+{
+    SDL_Surface *surface = SW_ActivateRenderer(renderer);
+
+    if (!surface) {
+        return -1;
+    }
+
+    return SDL_DrawScaledPoints(surface, points, count,
+                                renderer->viewport.x, renderer->viewport.y,
+                                renderer->scale.x, renderer->scale.y,
+                                renderer->blendMode,
+                                renderer->r, renderer->g, renderer->b,
+                                renderer->a);
+}
+
+static int
+SW_RenderDrawLinesScaled(SDL_Renderer * renderer, const SDL_Point * points,
+                         int count)
+{
+    SDL_Surface *surface = SW_ActivateRenderer(renderer);
+
+    if (!surface) {
+        return -1;
+    }
+
+    return SDL_DrawScaledLines(surface, points, count,
+                               renderer->viewport.x, renderer->viewport.y,
+                               renderer->scale.x, renderer->scale.y,
+                               renderer->blendMode,
+                               renderer->r, renderer->g, renderer->b,
+                               renderer->a);
+}
+
 static int
 SW_RenderFillRects(SDL_Renderer * renderer, const SDL_FRect * rects, int count)
 {
@@ -490,7 +537,7 @@ SW_RenderFillRects(SDL_Renderer * renderer, const SDL_FRect * rects, int count)
         return -1;
     }
 
-    final_rects = SDL_stack_alloc(SDL_Rect, count);
+    final_rects = SDL_AllocRenderScratch(renderer, count, sizeof(SDL_Rect));
     if (!final_rects) {
         return SDL_OutOfMemory();
     }
@@ -524,11 +571,23 @@ SW_RenderFillRects(SDL_Renderer * renderer, const SDL_FRect * rects, int count)
                                     renderer->r, renderer->g, renderer->b,
                                     renderer->a);
     }
-    SDL_stack_free(final_rects);
+    SDL_FreeRenderScratch(renderer, final_rects);
 
     return status;
 }
 
+static int
+GetScaleQuality(void)
+{
+    const char *hint = SDL_GetHint(SDL_HINT_RENDER_SCALE_QUALITY);
+
+    if (!hint || *hint == '0' || SDL_strcasecmp(hint, "nearest") == 0) {
+        return 0;
+    } else {
+        return 1;
+    }
+}
+
 static int
 SW_RenderCopy(SDL_Renderer * renderer, SDL_Texture * texture,
               const SDL_Rect * srcrect, const SDL_FRect * dstrect)
@@ -554,19 +613,8 @@ SW_RenderCopy(SDL_Renderer * renderer, SDL_Texture * texture,
     if ( srcrect->w == final_rect.w && srcrect->h == final_rect.h ) {
         return SDL_BlitSurface(src, srcrect, surface, &final_rect);
     } else {
-        return SDL_BlitScaled(src, srcrect, surface, &final_rect);
-    }
-}
-
-static int
-GetScaleQuality(void)
-{
-    const char *hint = SDL_GetHint(SDL_HINT_RENDER_SCALE_QUALITY);
-
-    if (!hint || *hint == '0' || SDL_strcasecmp(hint, "nearest") == 0) {
-        return 0;
-    } else {
-        return 1;
+        return SDL_PrivateUpperBlitScaled(src, srcrect, surface, &final_rect,
+                                          GetScaleQuality() ? SDL_TRUE : SDL_FALSE);
     }
 }
 
@@ -597,6 +645,19 @@ SW_RenderCopyEx(SDL_Renderer * renderer, SDL_Texture * texture,
     final_rect.w = (int)dstrect->w;
     final_rect.h = (int)dstrect->h;
 
+    if (SDLgfx_transformBlitSupported(src, surface)) {
+        /* Rotation needs random access to the texture pixels, so a texture
+           that is drawn rotated isn't kept RLE encoded any more */
+        if (src->map->info.flags & SDL_COPY_RLE_DESIRED) {
+            SDL_SetSurfaceRLE(src, 0);
+        }
+        if (src->flags & SDL_RLEACCEL) {
+            SDL_UnRLESurface(src, 1);
+        }
+        return SDLgfx_transformBlit(src, srcrect, surface, &final_rect, angle, center->x, center->y,
+                                    GetScaleQuality(), flip & SDL_FLIP_HORIZONTAL, flip & SDL_FLIP_VERTICAL);
+    }
+
     surface_scaled = SDL_CreateRGBSurface(SDL_SWSURFACE, final_rect.w, final_rect.h, src->format->BitsPerPixel,
                                           src->format->Rmask, src->format->Gmask,
                                           src->format->Bmask, src->format->Amask );
@@ -607,7 +668,8 @@ SW_RenderCopyEx(SDL_Renderer * renderer, SDL_Texture * texture,
         tmp_rect.x = 0;
         tmp_rect.y = 0;
 
-        retval = SDL_BlitScaled(src, srcrect, surface_scaled, &tmp_rect);
+        retval = SDL_PrivateUpperBlitScaled(src, srcrect, surface_scaled, &tmp_rect,
+                                            GetScaleQuality() ? SDL_TRUE : SDL_FALSE);
         if (!retval) {
             SDLgfx_rotozoomSurfaceSizeTrig(tmp_rect.w, tmp_rect.h, -angle, &dstwidth, &dstheight, &cangle, &sangle);
             surface_rotated = SDLgfx_rotateSurface(surface_scaled, -angle, dstwidth/2, dstheight/2, GetScaleQuality(), flip & SDL_FLIP_HORIZONTAL, flip & SDL_FLIP_VERTICAL, dstwidth, dstheight, cangle, sangle);
@@ -39,6 +39,8 @@ Andreas Schiffler -- aschiffler at ferzkopp dot net
 
 #include "SDL.h"
 #include "SDL_rotate.h"
+#include "../../video/SDL_blit.h"
+#include "../../thread/SDL_parallel_c.h"
 
 /* ---- Internally used structures */
 
@@ -499,3 +501,368 @@ SDLgfx_rotateSurface(SDL_Surface * src, double angle, int centerx, int centery,
     */
     return (rz_dst);
 }
+
+/* !
+\brief Work shared by the rows of a transformed blit.
+
+The source position of a destination pixel is affine in the destination
+coordinates, (u0, v0) is the position for the center of destination pixel
+(0, 0), relative to the source rectangle, in source pixels.
+*/
+typedef struct tTransformJob {
+    SDL_Surface *src;
+    SDL_Surface *dst;
+    SDL_Rect srcrect;
+    SDL_Rect bounds;
+    double u0, v0;
+    double dux, duy;
+    double dvx, dvy;
+    int smooth;
+    int flags;
+    Uint32 colorkey;
+    Uint32 modR, modG, modB, modA;
+} tTransformJob;
+
+/* !
+\brief Bilinear interpolation of four 32 bit pixels with 8 bit channels.
+
+The channel order doesn't matter, every byte is interpolated on its own.
+Weights are in 1/256th.
+*/
+static SDL_INLINE Uint32
+_interpolateRGBA(Uint32 c00, Uint32 c01, Uint32 c10, Uint32 c11, Uint32 wx, Uint32 wy)
+{
+    Uint32 rb0, rb1, ag0, ag1;
+
+    rb0 = (((c00 & 0x00ff00ff) * (256 - wx) + (c01 & 0x00ff00ff) * wx) >> 8) & 0x00ff00ff;
+    ag0 = ((((c00 >> 8) & 0x00ff00ff) * (256 - wx) + ((c01 >> 8) & 0x00ff00ff) * wx) >> 8) & 0x00ff00ff;
+    rb1 = (((c10 & 0x00ff00ff) * (256 - wx) + (c11 & 0x00ff00ff) * wx) >> 8) & 0x00ff00ff;
+    ag1 = ((((c10 >> 8) & 0x00ff00ff) * (256 - wx) + ((c11 >> 8) & 0x00ff00ff) * wx) >> 8) & 0x00ff00ff;
+    rb0 = ((rb0 * (256 - wy) + rb1 * wy) >> 8) & 0x00ff00ff;
+    ag0 = ((ag0 * (256 - wy) + ag1 * wy) >> 8) & 0x00ff00ff;
+    return rb0 | (ag0 << 8);
+}
+
+/* !
+\brief Blends one source pixel onto a destination pixel.
+
+Same arithmetic as the generated blitters, so a transformed blit without
+rotation, scaling or flipping matches SDL_BlitSurface().
+*/
+static SDL_INLINE void
+_blendPixel(const tTransformJob *job, const SDL_PixelFormat *sf, const SDL_PixelFormat *df, Uint32 srcpixel, Uint32 *dst)
+{
+    const int flags = job->flags;
+    Uint32 srcR, srcG, srcB, srcA;
+    Uint32 dstR, dstG, dstB, dstA;
+    Uint32 dstpixel;
+
+    srcR = (Uint8)(srcpixel >> sf->Rshift);
+    srcG = (Uint8)(srcpixel >> sf->Gshift);
+    srcB = (Uint8)(srcpixel >> sf->Bshift);
+    srcA = sf->Amask ? (Uint8)(srcpixel >> sf->Ashift) : 0xFF;
+    if (flags & SDL_COPY_MODULATE_COLOR) {
+        srcR = (srcR * job->modR) / 255;
+        srcG = (srcG * job->modG) / 255;
+        srcB = (srcB * job->modB) / 255;
+    }
+    if (flags & SDL_COPY_MODULATE_ALPHA) {
+        srcA = (srcA * job->modA) / 255;
+        if (flags & SDL_COPY_PREMULTIPLIED) {
+            srcR = (srcR * job->modA) / 255;
+            srcG = (srcG * job->modA) / 255;
+            srcB = (srcB * job->modA) / 255;
+        }
+    }
+    if (flags & (SDL_COPY_BLEND | SDL_COPY_ADD)) {
+        if (srcA < 255) {
+            srcR = (srcR * srcA) / 255;
+            srcG = (srcG * srcA) / 255;
+            srcB = (srcB * srcA) / 255;
+        }
+    }
+
+    if (!(flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED))) {
+        dstR = srcR;
+        dstG = srcG;
+        dstB = srcB;
+        dstA = srcA;
+    } else {
+        dstpixel = *dst;
+        dstR = (Uint8)(dstpixel >> df->Rshift);
+        dstG = (Uint8)(dstpixel >> df->Gshift);
+        dstB = (Uint8)(dstpixel >> df->Bshift);
+        dstA = df->Amask ? (Uint8)(dstpixel >> df->Ashift) : 0xFF;
+        switch (flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED)) {
+        case SDL_COPY_BLEND:
+            dstR = srcR + ((255 - srcA) * dstR) / 255;
+            dstG = srcG + ((255 - srcA) * dstG) / 255;
+            dstB = srcB + ((255 - srcA) * dstB) / 255;
+            dstA = srcA + ((255 - srcA) * dstA) / 255;
+            break;
+        case SDL_COPY_PREMULTIPLIED:
+            dstR = SDL_min(srcR + ((255 - srcA) * dstR) / 255, 255);
+            dstG = SDL_min(srcG + ((255 - srcA) * dstG) / 255, 255);
+            dstB = SDL_min(srcB + ((255 - srcA) * dstB) / 255, 255);
+            dstA = srcA + ((255 - srcA) * dstA) / 255;
+            break;
+        case SDL_COPY_ADD:
+            dstR = SDL_min(srcR + dstR, 255);
+            dstG = SDL_min(srcG + dstG, 255);
+            dstB = SDL_min(srcB + dstB, 255);
+            break;
+        case SDL_COPY_MOD:
+            dstR = (srcR * dstR) / 255;
+            dstG = (srcG * dstG) / 255;
+            dstB = (srcB * dstB) / 255;
+            break;
+        }
+    }
+    dstpixel = (dstR << df->Rshift) | (dstG << df->Gshift) | (dstB << df->Bshift);
+    if (df->Amask) {
+        dstpixel |= (dstA << df->Ashift);
+    }
+    *dst = dstpixel;
+}
+
+/* !
+\brief Finds the steps k in [*k0, *k1) for which p + k * dp is in [0, size).
+
+The result is widened by a step on each side to be safe from rounding, the
+caller still checks every position.
+*/
+static void
+_clipSpan(double p, double dp, int size, int *k0, int *k1)
+{
+    double a, b;
+
+    if (dp == 0.0) {
+        if (p < 0.0 || p >= size) {
+            *k1 = *k0;
+        }
+        return;
+    }
+    a = -p / dp;
+    b = (size - p) / dp;
+    if (a > b) {
+        double tmp = a;
+        a = b;
+        b = tmp;
+    }
+    a = SDL_floor(a) - 1.0;
+    b = SDL_ceil(b) + 1.0;
+    if (a > *k0) {
+        *k0 = (a < *k1) ? (int)a : *k1;
+    }
+    if (b < *k1) {
+        *k1 = (b > *k0) ? (int)b : *k0;
+    }
+}
+
+/* !
+\brief Draws the rows [start, end) of the destination bounds of a transformed blit.
+*/
+static void
+_transformBlitRows(void *data, int start, int end)
+{
+    const tTransformJob *job = (const tTransformJob *) data;
+    const SDL_PixelFormat *sf = job->src->format;
+    const SDL_PixelFormat *df = job->dst->format;
+    const int sw = job->srcrect.w, sh = job->srcrect.h;
+    const int spitch = job->src->pitch / 4;
+    const Uint32 *spixels = (const Uint32 *) job->src->pixels + job->srcrect.y * spitch + job->srcrect.x;
+    const int copy = (sf->format == df->format) &&
+        !(job->flags & (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND |
+                        SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED));
+    const int colorkey = (job->flags & SDL_COPY_COLORKEY);
+    const int smooth = job->smooth && !colorkey;
+    int row, k, k0, k1, x, y, fu, fv, dfu, dfv;
+    double u, v;
+    Uint32 *pc;
+    Uint32 pixel;
+
+    dfu = (int) SDL_floor(job->dux * 65536.0 + 0.5);
+    dfv = (int) SDL_floor(job->dvx * 65536.0 + 0.5);
+    for (row = start; row < end; ++row) {
+        y = job->bounds.y + row;
+        x = job->bounds.x;
+        u = job->u0 + y * job->duy + x * job->dux;
+        v = job->v0 + y * job->dvy + x * job->dvx;
+
+        /* Only walk the part of the row that lands in the source */
+        k0 = 0;
+        k1 = job->bounds.w;
+        _clipSpan(u, job->dux, sw, &k0, &k1);
+        _clipSpan(v, job->dvx, sh, &k0, &k1);
+        if (k0 >= k1) {
+            continue;
+        }
+
+        fu = (int) SDL_floor((u + k0 * job->dux) * 65536.0);
+        fv = (int) SDL_floor((v + k0 * job->dvx) * 65536.0);
+        pc = (Uint32 *) ((Uint8 *) job->dst->pixels + y * job->dst->pitch) + x + k0;
+        for (k = k0; k < k1; ++k, ++pc, fu += dfu, fv += dfv) {
+            if ((unsigned)fu >= ((unsigned)sw << 16) || (unsigned)fv >= ((unsigned)sh << 16)) {
+                continue;
+            }
+            if (smooth) {
+                /* Sample around the pixel center, clamped to the source rectangle */
+                const int su = fu - 0x8000, sv = fv - 0x8000;
+                int ix = su >> 16, iy = sv >> 16;
+                const Uint32 wx = (su >> 8) & 0xFF, wy = (sv >> 8) & 0xFF;
+                int ix1 = ix + 1, iy1 = iy + 1;
+                const Uint32 *r0, *r1;
+
+                if (ix < 0) ix = 0;
+                if (iy < 0) iy = 0;
+                if (ix1 >= sw) ix1 = sw - 1;
+                if (iy1 >= sh) iy1 = sh - 1;
+                r0 = spixels + iy * spitch;
+                r1 = spixels + iy1 * spitch;
+                pixel = _interpolateRGBA(r0[ix], r0[ix1], r1[ix], r1[ix1], wx, wy);
+            } else {
+                pixel = spixels[(fv >> 16) * spitch + (fu >> 16)];
+                if (colorkey && pixel == job->colorkey) {
+                    continue;
+                }
+            }
+            if (copy) {
+                *pc = pixel;
+            } else {
+                _blendPixel(job, sf, df, pixel, pc);
+            }
+        }
+    }
+}
+
+/* !
+\brief Checks whether SDLgfx_transformBlit() can draw 'src' onto 'dst'.
+
+Both surfaces need 32 bit pixels with 8 bit channels.
+*/
+SDL_bool
+SDLgfx_transformBlitSupported(SDL_Surface * src, SDL_Surface * dst)
+{
+    const SDL_PixelFormat *sf = src->format;
+    const SDL_PixelFormat *df = dst->format;
+
+    if (sf->BytesPerPixel != 4 || df->BytesPerPixel != 4 ||
+        SDL_ISPIXELFORMAT_FOURCC(sf->format) || SDL_ISPIXELFORMAT_FOURCC(df->format)) {
+        return SDL_FALSE;
+    }
+    if (sf->Rloss || sf->Gloss || sf->Bloss || (sf->Amask && sf->Aloss) ||
+        df->Rloss || df->Gloss || df->Bloss || (df->Amask && df->Aloss)) {
+        return SDL_FALSE;
+    }
+    if (src->w >= 32768 || src->h >= 32768 || (dst->flags & SDL_RLEACCEL)) {
+        return SDL_FALSE;
+    }
+    return SDL_TRUE;
+}
+
+/* !
+\brief Rotates, scales and flips part of a surface straight onto another one.
+
+Draws 'srcrect' of 'src' into 'dstrect' of 'dst', flipped as requested and
+then rotated clockwise by 'angle' degrees around ('centerx', 'centery'),
+which is relative to 'dstrect'.  Every destination pixel is mapped back to the source with 16.16
+fixed point steps, sampled with nearest neighbor or bilinear filtering and
+blended with the blend mode, color and alpha modulation and colorkey of 'src'.
+Nothing is allocated, large blits are split into row bands, see
+SDL_HINT_SOFTWARE_THREADS.
+
+Check the surfaces with SDLgfx_transformBlitSupported() first, 'src' must not
+be RLE encoded.  Colorkeyed sources always use nearest neighbor sampling.
+
+\param src The source surface.
+\param srcrect The part of the source to draw.
+\param dst The destination surface, drawing is clipped to its clip rectangle.
+\param dstrect Where the unrotated source would be drawn.
+\param angle The angle to rotate in degrees.
+\param centerx The horizontal coordinate of the center of rotation, relative to 'dstrect'.
+\param centery The vertical coordinate of the center of rotation, relative to 'dstrect'.
+\param smooth Antialiasing flag; set to 1 for bilinear filtering.
+\param flipx Set to 1 to flip the image horizontally
+\param flipy Set to 1 to flip the image vertically
+\return 0 on success, -1 on error.
+*/
+int
+SDLgfx_transformBlit(SDL_Surface * src, const SDL_Rect * srcrect, SDL_Surface * dst, const SDL_Rect * dstrect,
+                     double angle, double centerx, double centery, int smooth, int flipx, int flipy)
+{
+    tTransformJob job;
+    SDL_Rect bounds;
+    double radangle, c, s, pivotx, pivoty, scalex, scaley, fx, fy, px, py;
+    double minx, miny, maxx, maxy;
+    int i;
+
+    if (srcrect->w <= 0 || srcrect->h <= 0 || dstrect->w <= 0 || dstrect->h <= 0) {
+        return 0;
+    }
+    if (!src->pixels || !dst->pixels) {
+        return SDL_SetError("SDLgfx_transformBlit(): Surface has no pixels");
+    }
+
+    radangle = angle * (M_PI / 180.0);
+    c = SDL_cos(radangle);
+    s = SDL_sin(radangle);
+    pivotx = dstrect->x + centerx;
+    pivoty = dstrect->y + centery;
+
+    /* Destination bounds of the rotated rectangle, clipped */
+    minx = miny = 1e30;
+    maxx = maxy = -1e30;
+    for (i = 0; i < 4; ++i) {
+        px = ((i & 1) ? dstrect->w : 0) - centerx;
+        py = ((i & 2) ? dstrect->h : 0) - centery;
+        fx = px * c - py * s + pivotx;
+        fy = px * s + py * c + pivoty;
+        minx = SDL_min(minx, fx);
+        miny = SDL_min(miny, fy);
+        maxx = SDL_max(maxx, fx);
+        maxy = SDL_max(maxy, fy);
+    }
+    minx = SDL_max(minx, dst->clip_rect.x);
+    miny = SDL_max(miny, dst->clip_rect.y);
+    maxx = SDL_min(maxx, dst->clip_rect.x + dst->clip_rect.w);
+    maxy = SDL_min(maxy, dst->clip_rect.y + dst->clip_rect.h);
+    if (minx >= maxx || miny >= maxy) {
+        return 0;
+    }
+    bounds.x = (int) SDL_floor(minx);
+    bounds.y = (int) SDL_floor(miny);
+    bounds.w = (int) SDL_ceil(maxx) - bounds.x;
+    bounds.h = (int) SDL_ceil(maxy) - bounds.y;
+    SDL_DAMAGE_RECT(dst, &bounds);
+
+    /* Map destination pixel centers back: unrotate, unflip, then scale to the source */
+    scalex = (double) srcrect->w / dstrect->w;
+    scaley = (double) srcrect->h / dstrect->h;
+    fx = flipx ? -1.0 : 1.0;
+    fy = flipy ? -1.0 : 1.0;
+    px = 0.5 - pivotx;
+    py = 0.5 - pivoty;
+    job.u0 = c * px + s * py + centerx;
+    job.v0 = -s * px + c * py + centery;
+    job.u0 = (flipx ? dstrect->w - job.u0 : job.u0) * scalex;
+    job.v0 = (flipy ? dstrect->h - job.v0 : job.v0) * scaley;
+    job.dux = fx * c * scalex;
+    job.duy = fx * s * scalex;
+    job.dvx = -fy * s * scaley;
+    job.dvy = fy * c * scaley;
+
+    job.src = src;
+    job.dst = dst;
+    job.srcrect = *srcrect;
+    job.bounds = bounds;
+    job.smooth = smooth;
+    job.flags = src->map->info.flags;
+    job.colorkey = src->map->info.colorkey;
+    job.modR = src->map->info.r;
+    job.modG = src->map->info.g;
+    job.modB = src->map->info.b;
+    job.modA = src->map->info.a;
+
+    SDL_ParallelFor(bounds.h, 16384 / bounds.w + 1, 1, _transformBlitRows, &job);
+    return 0;
+}
@@ -0,0 +1,238 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2014 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "../SDL_internal.h"
+
+/* A small worker pool for the row based software rendering routines */
+
+#include "SDL_atomic.h"
+#include "SDL_cpuinfo.h"
+#include "SDL_hints.h"
+#include "SDL_mutex.h"
+#include "SDL_thread.h"
+#include "SDL_timer.h"
+#include "SDL_parallel_c.h"
+
+#define SDL_PARALLEL_MAX_THREADS    16
+
+/* Bands per thread, so uneven bands don't leave threads idle */
+#define SDL_PARALLEL_BANDS_PER_THREAD   4
+
+int
+SDL_GetParallelThreadCount(void)
+{
+    const char *hint = SDL_GetHint(SDL_HINT_SOFTWARE_THREADS);
+    int count = 1;
+
+    if (hint && *hint) {
+        count = SDL_atoi(hint);
+        if (count <= 0) {
+            count = SDL_GetCPUCount();
+        }
+    }
+    if (count > SDL_PARALLEL_MAX_THREADS) {
+        count = SDL_PARALLEL_MAX_THREADS;
+    }
+    return (count > 1) ? count : 1;
+}
+
+#if SDL_THREADS_DISABLED
+
+void
+SDL_ParallelFor(int count, int min_rows, int align,
+                SDL_ParallelFunc func, void *data)
+{
+    if (count > 0) {
+        func(data, 0, count);
+    }
+}
+
+void
+SDL_QuitParallel(void)
+{
+}
+
+#else
+
+typedef struct
+{
+    SDL_ParallelFunc func;
+    void *data;
+    int count;
+    int band_rows;
+    int num_bands;
+    SDL_atomic_t next_band;
+} SDL_ParallelJob;
+
+/* Set while a job runs, jobs started meanwhile run on their own thread */
+static SDL_atomic_t pool_busy;
+static SDL_atomic_t pool_quit;
+static SDL_sem *work_sem = NULL;
+static SDL_sem *done_sem = NULL;
+static SDL_Thread *workers[SDL_PARALLEL_MAX_THREADS - 1];
+static int num_workers = 0;
+static SDL_ParallelJob *current_job = NULL;
+
+static void
+RunBands(SDL_ParallelJob * job)
+{
+    int band;
+
+    while ((band = SDL_AtomicAdd(&job->next_band, 1)) < job->num_bands) {
+        const int start = band * job->band_rows;
+        const int end = SDL_min(start + job->band_rows, job->count);
+        job->func(job->data, start, end);
+    }
+}
+
+static int
+WorkerThread(void *data)
+{
+    for (;;) {
+        SDL_SemWait(work_sem);
+        if (SDL_AtomicGet(&pool_quit)) {
+            break;
+        }
+        RunBands(current_job);
+        SDL_SemPost(done_sem);
+    }
+    return 0;
+}
+
+/* Starts workers until there are 'count' of them, returns how many run */
+static int
+StartWorkers(int count)
+{
+    if (!work_sem) {
+        work_sem = SDL_CreateSemaphore(0);
+        done_sem = SDL_CreateSemaphore(0);
+        if (!work_sem || !done_sem) {
+            if (work_sem) {
+                SDL_DestroySemaphore(work_sem);
+                work_sem = NULL;
+            }
+            if (done_sem) {
+                SDL_DestroySemaphore(done_sem);
+                done_sem = NULL;
+            }
+            return 0;
+        }
+    }
+    while (num_workers < count) {
+        SDL_Thread *thread = SDL_CreateThread(WorkerThread, "SDLParallel", NULL);
+        if (!thread) {
+            break;
+        }
+        workers[num_workers++] = thread;
+    }
+    return num_workers;
+}
+
+void
+SDL_ParallelFor(int count, int min_rows, int align,
+                SDL_ParallelFunc func, void *data)
+{
+    SDL_ParallelJob job;
+    int threads, helpers, i;
+
+    if (count <= 0) {
+        return;
+    }
+    if (min_rows < 1) {
+        min_rows = 1;
+    }
+    if (align < 1) {
+        align = 1;
+    }
+
+    threads = SDL_GetParallelThreadCount();
+    threads = SDL_min(threads, count / min_rows);
+    if (threads <= 1 || !SDL_AtomicCAS(&pool_busy, 0, 1)) {
+        func(data, 0, count);
+        return;
+    }
+
+    helpers = StartWorkers(threads - 1);
+    helpers = SDL_min(helpers, threads - 1);
+    if (helpers <= 0) {
+        SDL_AtomicSet(&pool_busy, 0);
+        func(data, 0, count);
+        return;
+    }
+
+    /* Split into bands of at least min_rows, rounded up to the alignment */
+    job.func = func;
+    job.data = data;
+    job.count = count;
+    job.band_rows = (count + threads * SDL_PARALLEL_BANDS_PER_THREAD - 1) /
+                    (threads * SDL_PARALLEL_BANDS_PER_THREAD);
+    job.band_rows = SDL_max(job.band_rows, min_rows);
+    job.band_rows = ((job.band_rows + align - 1) / align) * align;
+    job.num_bands = (count + job.band_rows - 1) / job.band_rows;
+    SDL_AtomicSet(&job.next_band, 0);
+    helpers = SDL_min(helpers, job.num_bands - 1);
+
+    current_job = &job;
+    for (i = 0; i < helpers; ++i) {
+        SDL_SemPost(work_sem);
+    }
+    RunBands(&job);
+    for (i = 0; i < helpers; ++i) {
+        SDL_SemWait(done_sem);
+    }
+    current_job = NULL;
+
+    SDL_AtomicSet(&pool_busy, 0);
+}
+
+void
+SDL_QuitParallel(void)
+{
+    int i;
+
+    /* Wait for a running job to finish and keep new ones off the pool */
+    while (!SDL_AtomicCAS(&pool_busy, 0, 1)) {
+        SDL_Delay(1);
+    }
+
+    SDL_AtomicSet(&pool_quit, 1);
+    for (i = 0; i < num_workers; ++i) {
+        SDL_SemPost(work_sem);
+    }
+    for (i = 0; i < num_workers; ++i) {
+        SDL_WaitThread(workers[i], NULL);
+    }
+    num_workers = 0;
+    if (work_sem) {
+        SDL_DestroySemaphore(work_sem);
+        work_sem = NULL;
+    }
+    if (done_sem) {
+        SDL_DestroySemaphore(done_sem);
+        done_sem = NULL;
+    }
+    SDL_AtomicSet(&pool_quit, 0);
+
+    SDL_AtomicSet(&pool_busy, 0);
+}
+
+#endif /* SDL_THREADS_DISABLED */
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -0,0 +1,49 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2014 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "../SDL_internal.h"
+
+#ifndef _SDL_parallel_c_h
+#define _SDL_parallel_c_h
+
+/* Splits row based software rendering work into bands that run on a small
+   pool of worker threads, see SDL_HINT_SOFTWARE_THREADS.
+ */
+
+/* Processes the rows [start, end) of a parallel job */
+typedef void (*SDL_ParallelFunc) (void *data, int start, int end);
+
+/* Returns how many threads, including the caller, a parallel job may use */
+extern int SDL_GetParallelThreadCount(void);
+
+/* Runs func over the rows [0, count) and returns when all of them are done.
+   Every band has at least 'min_rows' rows, band boundaries are multiples of
+   'align' rows.  Small jobs, or jobs started while another one is running,
+   are run on the calling thread.
+ */
+extern void SDL_ParallelFor(int count, int min_rows, int align,
+                            SDL_ParallelFunc func, void *data);
+
+/* Stops the worker threads, called from SDL_Quit() */
+extern void SDL_QuitParallel(void);
+
+#endif /* _SDL_parallel_c_h */
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -61,7 +61,10 @@
  * Encoding of surfaces with per-pixel alpha:
  *
  *   The sequence begins with a struct RLEDestFormat describing the target
- *   pixel format, to provide reliable un-encoding.
+ *   pixel format, to provide reliable un-encoding, followed by a 32-bit
+ *   offset for each scan line, from the start of the first line, so blits
+ *   of a part of the surface (e.g. one frame of a sprite sheet) can start
+ *   at any line without walking through the ones above it.
  *
  *   Each scan line is encoded twice: First all completely opaque pixels,
  *   encoded in the target format as described above, and then all
@@ -89,6 +92,7 @@
 #include "SDL_sysvideo.h"
 #include "SDL_blit.h"
 #include "SDL_RLEaccel_c.h"
+#include "SDL_pixels_c.h"
 
 #ifndef MAX
 #define MAX(a, b) ((a) > (b) ? (a) : (b))
@@ -732,61 +736,8 @@ SDL_RLEAlphaBlit(SDL_Surface * src, SDL_Rect * srcrect,
     dstbuf = (Uint8 *) dst->pixels + y * dst->pitch + x * df->BytesPerPixel;
     srcbuf = (Uint8 *) src->map->data + sizeof(RLEDestFormat);
 
-    {
-        /* skip lines at the top if necessary */
-        int vskip = srcrect->y;
-        if (vskip) {
-            int ofs;
-            if (df->BytesPerPixel == 2) {
-                /* the 16/32 interleaved format */
-                do {
-                    /* skip opaque line */
-                    ofs = 0;
-                    do {
-                        int run;
-                        ofs += srcbuf[0];
-                        run = srcbuf[1];
-                        srcbuf += 2;
-                        if (run) {
-                            srcbuf += 2 * run;
-                            ofs += run;
-                        } else if (!ofs)
-                            goto done;
-                    } while (ofs < w);
-
-                    /* skip padding */
-                    srcbuf += (uintptr_t) srcbuf & 2;
-
-                    /* skip translucent line */
-                    ofs = 0;
-                    do {
-                        int run;
-                        ofs += ((Uint16 *) srcbuf)[0];
-                        run = ((Uint16 *) srcbuf)[1];
-                        srcbuf += 4 * (run + 1);
-                        ofs += run;
-                    } while (ofs < w);
-                } while (--vskip);
-            } else {
-                /* the 32/32 interleaved format */
-                vskip <<= 1;    /* opaque and translucent have same format */
-                do {
-                    ofs = 0;
-                    do {
-                        int run;
-                        ofs += ((Uint16 *) srcbuf)[0];
-                        run = ((Uint16 *) srcbuf)[1];
-                        srcbuf += 4;
-                        if (run) {
-                            srcbuf += 4 * run;
-                            ofs += run;
-                        } else if (!ofs)
-                            goto done;
-                    } while (ofs < w);
-                } while (--vskip);
-            }
-        }
-    }
+    /* skip lines at the top if necessary */
+    srcbuf += src->h * sizeof(Uint32) + ((Uint32 *) srcbuf)[srcrect->y];
 
     /* if left or right edge clipping needed, call clip blit */
     if (srcrect->x || srcrect->w != src->w) {
@@ -979,7 +930,9 @@ copy_32(void *dst, Uint32 * src, int n,
     for (i = 0; i < n; i++) {
         unsigned r, g, b, a;
         RGBA_FROM_8888(*src, sfmt, r, g, b, a);
-        PIXEL_FROM_RGBA(*d, dfmt, r, g, b, a);
+        /* the alpha goes in the top byte even if the target has none */
+        PIXEL_FROM_RGB(*d, dfmt, r, g, b);
+        *d |= (Uint32) a << 24;
         d++;
         src++;
     }
@@ -1020,6 +973,7 @@ RLEAlphaSurface(SDL_Surface * surface)
     int max_transl_run = 65535;
     unsigned masksum;
     Uint8 *rlebuf, *dst;
+    Uint32 *lines;
     int (*copy_opaque) (void *, Uint32 *, int,
                         SDL_PixelFormat *, SDL_PixelFormat *);
     int (*copy_transl) (void *, Uint32 *, int,
@@ -1078,7 +1032,7 @@ RLEAlphaSurface(SDL_Surface * surface)
         return -1;              /* anything else unsupported right now */
     }
 
-    maxsize += sizeof(RLEDestFormat);
+    maxsize += sizeof(RLEDestFormat) + surface->h * sizeof(Uint32);
     rlebuf = (Uint8 *) SDL_malloc(maxsize);
     if (!rlebuf) {
         return SDL_OutOfMemory();
@@ -1100,7 +1054,8 @@ RLEAlphaSurface(SDL_Surface * surface)
         r->Bshift = df->Bshift;
         r->Ashift = df->Ashift;
     }
-    dst = rlebuf + sizeof(RLEDestFormat);
+    lines = (Uint32 *) (rlebuf + sizeof(RLEDestFormat));
+    dst = (Uint8 *) (lines + surface->h);
 
     /* Do the actual encoding */
     {
@@ -1108,6 +1063,7 @@ RLEAlphaSurface(SDL_Surface * surface)
         int h = surface->h, w = surface->w;
         SDL_PixelFormat *sf = surface->format;
         Uint32 *src = (Uint32 *) surface->pixels;
+        Uint8 *first = dst;
         Uint8 *lastline = dst;  /* end of last non-blank line */
 
         /* opaque counts are 8 or 16 bits, depending on target depth */
@@ -1129,6 +1085,7 @@ RLEAlphaSurface(SDL_Surface * surface)
         for (y = 0; y < h; y++) {
             int runstart, skipstart;
             int blankline = 0;
+            lines[y] = (Uint32) (dst - first);
             /* First encode all opaque pixels of a scan line */
             x = 0;
             do {
@@ -1200,6 +1157,11 @@ RLEAlphaSurface(SDL_Surface * surface)
             src += surface->pitch >> 2;
         }
         dst = lastline;         /* back up past trailing blank lines */
+        for (y = 0; y < h; y++) {
+            if (lines[y] > (Uint32) (lastline - first)) {
+                lines[y] = (Uint32) (lastline - first);
+            }
+        }
         ADD_OPAQUE_COUNTS(0, 0);
     }
 
@@ -1208,7 +1170,7 @@ RLEAlphaSurface(SDL_Surface * surface)
 
     /* Now that we have it encoded, release the original pixels */
     if (!(surface->flags & SDL_PREALLOC)) {
-        SDL_free(surface->pixels);
+        SDL_FreeSurfacePixels(surface);
         surface->pixels = NULL;
     }
 
@@ -1368,7 +1330,7 @@ RLEColorkeySurface(SDL_Surface * surface)
 
     /* Now that we have it encoded, release the original pixels */
     if (!(surface->flags & SDL_PREALLOC)) {
-        SDL_free(surface->pixels);
+        SDL_FreeSurfacePixels(surface);
         surface->pixels = NULL;
     }
 
@@ -1413,7 +1375,7 @@ SDL_RLESurface(SDL_Surface * surface)
     /* Pass on combinations not supported */
     if ((flags & SDL_COPY_MODULATE_COLOR) ||
         ((flags & SDL_COPY_MODULATE_ALPHA) && surface->format->Amask) ||
-        (flags & (SDL_COPY_ADD | SDL_COPY_MOD)) ||
+        (flags & (SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED)) ||
         (flags & SDL_COPY_NEAREST)) {
         return -1;
     }
@@ -1469,7 +1431,7 @@ UnRLEAlpha(SDL_Surface * surface)
         uncopy_opaque = uncopy_transl = uncopy_32;
     }
 
-    surface->pixels = SDL_malloc(surface->h * surface->pitch);
+    surface->pixels = SDL_AllocSurfacePixels(surface);
     if (!surface->pixels) {
         return (SDL_FALSE);
     }
@@ -1477,7 +1439,7 @@ UnRLEAlpha(SDL_Surface * surface)
     SDL_memset(surface->pixels, 0, surface->h * surface->pitch);
 
     dst = surface->pixels;
-    srcbuf = (Uint8 *) (df + 1);
+    srcbuf = (Uint8 *) (df + 1) + surface->h * sizeof(Uint32);
     for (;;) {
         /* copy opaque pixels */
         int ofs = 0;
@@ -1532,7 +1494,7 @@ SDL_UnRLESurface(SDL_Surface * surface, int recode)
                 SDL_Rect full;
 
                 /* re-create the original surface */
-                surface->pixels = SDL_malloc(surface->h * surface->pitch);
+                surface->pixels = SDL_AllocSurfacePixels(surface);
                 if (!surface->pixels) {
                     /* Oh crap... */
                     surface->flags |= SDL_RLEACCEL;
@@ -20,6 +20,7 @@
 */
 #include "../SDL_internal.h"
 
+#include "SDL_atomic.h"
 #include "SDL_video.h"
 #include "SDL_sysvideo.h"
 #include "SDL_blit.h"
@@ -28,6 +29,33 @@
 #include "SDL_blit_slow.h"
 #include "SDL_RLEaccel_c.h"
 #include "SDL_pixels_c.h"
+#include "../thread/SDL_parallel_c.h"
+
+/* Don't split blits into bands smaller than this many pixels */
+#define SDL_BLIT_BAND_PIXELS    (128 * 1024)
+
+/* Set up the blit information for blitting srcrect to dstrect */
+static void
+SDL_SetupBlitInfo(SDL_BlitInfo * info, SDL_Surface * src, SDL_Rect * srcrect,
+                  SDL_Surface * dst, SDL_Rect * dstrect)
+{
+    info->src = (Uint8 *) src->pixels +
+        (Uint16) srcrect->y * src->pitch +
+        (Uint16) srcrect->x * info->src_fmt->BytesPerPixel;
+    info->src_w = srcrect->w;
+    info->src_h = srcrect->h;
+    info->src_pitch = src->pitch;
+    info->src_skip =
+        info->src_pitch - info->src_w * info->src_fmt->BytesPerPixel;
+    info->dst =
+        (Uint8 *) dst->pixels + (Uint16) dstrect->y * dst->pitch +
+        (Uint16) dstrect->x * info->dst_fmt->BytesPerPixel;
+    info->dst_w = dstrect->w;
+    info->dst_h = dstrect->h;
+    info->dst_pitch = dst->pitch;
+    info->dst_skip =
+        info->dst_pitch - info->dst_w * info->dst_fmt->BytesPerPixel;
+}
 
 /* The general purpose software blit routine */
 static int
@@ -66,22 +94,7 @@ SDL_SoftBlit(SDL_Surface * src, SDL_Rect * srcrect,
         SDL_BlitInfo *info = &src->map->info;
 
         /* Set up the blit information */
-        info->src = (Uint8 *) src->pixels +
-            (Uint16) srcrect->y * src->pitch +
-            (Uint16) srcrect->x * info->src_fmt->BytesPerPixel;
-        info->src_w = srcrect->w;
-        info->src_h = srcrect->h;
-        info->src_pitch = src->pitch;
-        info->src_skip =
-            info->src_pitch - info->src_w * info->src_fmt->BytesPerPixel;
-        info->dst =
-            (Uint8 *) dst->pixels + (Uint16) dstrect->y * dst->pitch +
-            (Uint16) dstrect->x * info->dst_fmt->BytesPerPixel;
-        info->dst_w = dstrect->w;
-        info->dst_h = dstrect->h;
-        info->dst_pitch = dst->pitch;
-        info->dst_skip =
-            info->dst_pitch - info->dst_w * info->dst_fmt->BytesPerPixel;
+        SDL_SetupBlitInfo(info, src, srcrect, dst, dstrect);
         RunBlit = (SDL_BlitFunc) src->map->data;
 
         /* Run the actual software blit */
@@ -99,6 +112,51 @@ SDL_SoftBlit(SDL_Surface * src, SDL_Rect * srcrect,
     return (okay ? 0 : -1);
 }
 
+typedef struct
+{
+    SDL_BlitInfo info;
+    SDL_BlitFunc blit;
+} SDL_BlitBandJob;
+
+static void
+SDL_SoftBlitBand(void *data, int start, int end)
+{
+    const SDL_BlitBandJob *job = (const SDL_BlitBandJob *) data;
+    SDL_BlitInfo info = job->info;
+
+    info.src += start * info.src_pitch;
+    info.dst += start * info.dst_pitch;
+    info.src_h = info.dst_h = end - start;
+    job->blit(&info);
+}
+
+/* Run a large unscaled software blit in row bands on several threads, each
+   band gets its own copy of the blit information.  Other blits, like RLE or
+   scaled ones, go through the mapped blit routine.
+ */
+int
+SDL_SoftBlitBands(SDL_Surface * src, SDL_Rect * srcrect,
+                  SDL_Surface * dst, SDL_Rect * dstrect)
+{
+    SDL_BlitBandJob job;
+
+    if (src->map->blit != SDL_SoftBlit ||
+        SDL_MUSTLOCK(src) || SDL_MUSTLOCK(dst) ||
+        srcrect->w != dstrect->w || srcrect->h != dstrect->h ||
+        srcrect->w <= 0 || srcrect->h <= 0 ||
+        srcrect->h < 2 * (SDL_BLIT_BAND_PIXELS / srcrect->w) ||
+        SDL_GetParallelThreadCount() <= 1) {
+        return src->map->blit(src, srcrect, dst, dstrect);
+    }
+
+    job.info = src->map->info;
+    SDL_SetupBlitInfo(&job.info, src, srcrect, dst, dstrect);
+    job.blit = (SDL_BlitFunc) src->map->data;
+    SDL_ParallelFor(srcrect->h, SDL_BLIT_BAND_PIXELS / srcrect->w + 1, 1,
+                    SDL_SoftBlitBand, &job);
+    return 0;
+}
+
 #ifdef __MACOSX__
 #include <sys/sysctl.h>
 
@@ -124,11 +182,9 @@ SDL_UseAltivecPrefetch()
 }
 #endif /* __MACOSX__ */
 
-static SDL_BlitFunc
-SDL_ChooseBlitFunc(Uint32 src_format, Uint32 dst_format, int flags,
-                   SDL_BlitFuncEntry * entries)
+static Uint32
+SDL_GetBlitCPUFeatures(void)
 {
-    int i, flagcheck;
     static Uint32 features = 0xffffffff;
 
     /* Get the available CPU features */
@@ -153,7 +209,11 @@ SDL_ChooseBlitFunc(Uint32 src_format, Uint32 dst_format, int flags,
             if (SDL_HasSSE2()) {
                 features |= SDL_CPU_SSE2;
             }
+#if defined(__ARM_NEON__) || defined(__ARM_NEON)
+            features |= SDL_CPU_NEON;
+#endif
             if (SDL_HasAltiVec()) {
+                features |= SDL_CPU_ALTIVEC;
                 if (SDL_UseAltivecPrefetch()) {
                     features |= SDL_CPU_ALTIVEC_PREFETCH;
                 } else {
@@ -162,6 +222,15 @@ SDL_ChooseBlitFunc(Uint32 src_format, Uint32 dst_format, int flags,
             }
         }
     }
+    return features;
+}
+
+static SDL_BlitFunc
+SDL_ChooseBlitFunc(Uint32 src_format, Uint32 dst_format, int flags,
+                   SDL_BlitFuncEntry * entries)
+{
+    int i, flagcheck;
+    const Uint32 features = SDL_GetBlitCPUFeatures();
 
     for (i = 0; entries[i].func; ++i) {
         /* Check for matching pixel formats */
@@ -182,7 +251,8 @@ SDL_ChooseBlitFunc(Uint32 src_format, Uint32 dst_format, int flags,
         /* Check blend flags */
         flagcheck =
             (flags &
-             (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD));
+             (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD |
+              SDL_COPY_PREMULTIPLIED));
         if ((flagcheck & entries[i].flags) != flagcheck) {
             continue;
         }
@@ -211,31 +281,14 @@ SDL_ChooseBlitFunc(Uint32 src_format, Uint32 dst_format, int flags,
     return NULL;
 }
 
-/* Figure out which of many blit routines to set up on a surface */
-int
-SDL_CalculateBlit(SDL_Surface * surface)
+/* Choose the blit routine for a surface, without looking at the cache */
+static SDL_BlitFunc
+SDL_ChooseBlit(SDL_Surface * surface)
 {
     SDL_BlitFunc blit = NULL;
     SDL_BlitMap *map = surface->map;
     SDL_Surface *dst = map->dst;
 
-    /* Clean everything out to start */
-    if ((surface->flags & SDL_RLEACCEL) == SDL_RLEACCEL) {
-        SDL_UnRLESurface(surface, 1);
-    }
-    map->blit = SDL_SoftBlit;
-    map->info.src_fmt = surface->format;
-    map->info.src_pitch = surface->pitch;
-    map->info.dst_fmt = dst->format;
-    map->info.dst_pitch = dst->pitch;
-
-    /* See if we can do RLE acceleration */
-    if (map->info.flags & SDL_COPY_RLE_DESIRED) {
-        if (SDL_RLESurface(surface) == 0) {
-            return 0;
-        }
-    }
-
     /* Choose a standard blit function */
     if (map->identity && !(map->info.flags & ~SDL_COPY_RLE_DESIRED)) {
         blit = SDL_BlitCopy;
@@ -245,7 +298,7 @@ SDL_CalculateBlit(SDL_Surface * surface)
     } else if (surface->format->BytesPerPixel == 1 &&
                SDL_ISPIXELFORMAT_INDEXED(surface->format->format)) {
         blit = SDL_CalculateBlit1(surface);
-    } else if (map->info.flags & SDL_COPY_BLEND) {
+    } else if (map->info.flags & (SDL_COPY_BLEND | SDL_COPY_PREMULTIPLIED)) {
         blit = SDL_CalculateBlitA(surface);
     } else {
         blit = SDL_CalculateBlitN(surface);
@@ -272,6 +325,161 @@ SDL_CalculateBlit(SDL_Surface * surface)
             blit = SDL_Blit_Slow;
         }
     }
+    return blit;
+}
+
+/* Cache of chosen blit routines, so changing the blend mode or the color
+   and alpha modulation of a surface doesn't search the blit tables again.
+   The choice only depends on the pixel formats, the copy flags, whether the
+   mapping is the identity and the CPU features.
+ */
+#define SDL_BLIT_CACHE_SIZE     256     /* must be a power of two */
+#define SDL_BLIT_CACHE_PROBES   4
+
+/* Identity mappings get their own entries, they may use a plain copy */
+#define SDL_BLIT_CACHE_IDENTITY 0x80000000
+
+typedef struct
+{
+    Uint32 src_format;
+    Uint32 dst_format;
+    Uint32 flags;
+    Uint32 features;
+    SDL_BlitFunc blit;
+    SDL_bool used;
+} SDL_BlitCacheEntry;
+
+static SDL_BlitCacheEntry SDL_blit_cache[SDL_BLIT_CACHE_SIZE];
+static SDL_SpinLock SDL_blit_cache_lock;
+static int SDL_blit_cache_hits;
+static int SDL_blit_cache_misses;
+
+static int
+SDL_BlitCacheSlot(Uint32 src_format, Uint32 dst_format, Uint32 flags)
+{
+    Uint32 hash = src_format * 0x9E3779B1u;
+    hash = (hash ^ dst_format) * 0x85EBCA6Bu;
+    hash = (hash ^ flags) * 0xC2B2AE35u;
+    return (int) ((hash >> 16) & (SDL_BLIT_CACHE_SIZE - 1));
+}
+
+static SDL_bool
+SDL_LookupBlitCache(Uint32 src_format, Uint32 dst_format, Uint32 flags,
+                    SDL_BlitFunc * blit)
+{
+    const Uint32 features = SDL_GetBlitCPUFeatures();
+    int slot = SDL_BlitCacheSlot(src_format, dst_format, flags);
+    SDL_bool found = SDL_FALSE;
+    int i;
+
+    SDL_AtomicLock(&SDL_blit_cache_lock);
+    for (i = 0; i < SDL_BLIT_CACHE_PROBES; ++i) {
+        const SDL_BlitCacheEntry *entry = &SDL_blit_cache[slot];
+        if (!entry->used) {
+            break;
+        }
+        if (entry->src_format == src_format &&
+            entry->dst_format == dst_format &&
+            entry->flags == flags && entry->features == features) {
+            *blit = entry->blit;
+            found = SDL_TRUE;
+            break;
+        }
+        slot = (slot + 1) & (SDL_BLIT_CACHE_SIZE - 1);
+    }
+    if (found) {
+        ++SDL_blit_cache_hits;
+    } else {
+        ++SDL_blit_cache_misses;
+    }
+    SDL_AtomicUnlock(&SDL_blit_cache_lock);
+
+    return found;
+}
+
+static void
+SDL_AddBlitCache(Uint32 src_format, Uint32 dst_format, Uint32 flags,
+                 SDL_BlitFunc blit)
+{
+    const int home = SDL_BlitCacheSlot(src_format, dst_format, flags);
+    SDL_BlitCacheEntry *entry = &SDL_blit_cache[home];
+    int slot = home;
+    int i;
+
+    SDL_AtomicLock(&SDL_blit_cache_lock);
+    for (i = 0; i < SDL_BLIT_CACHE_PROBES; ++i) {
+        if (!SDL_blit_cache[slot].used) {
+            entry = &SDL_blit_cache[slot];
+            break;
+        }
+        slot = (slot + 1) & (SDL_BLIT_CACHE_SIZE - 1);
+    }
+    /* If all the probed slots are taken, the home slot is replaced */
+    entry->src_format = src_format;
+    entry->dst_format = dst_format;
+    entry->flags = flags;
+    entry->features = SDL_GetBlitCPUFeatures();
+    entry->blit = blit;
+    entry->used = SDL_TRUE;
+    SDL_AtomicUnlock(&SDL_blit_cache_lock);
+}
+
+void
+SDL_GetBlitCacheStats(int *hits, int *misses)
+{
+    SDL_AtomicLock(&SDL_blit_cache_lock);
+    if (hits) {
+        *hits = SDL_blit_cache_hits;
+    }
+    if (misses) {
+        *misses = SDL_blit_cache_misses;
+    }
+    SDL_AtomicUnlock(&SDL_blit_cache_lock);
+}
+
+/* Figure out which of many blit routines to set up on a surface */
+int
+SDL_CalculateBlit(SDL_Surface * surface)
+{
+    SDL_BlitFunc blit = NULL;
+    SDL_BlitMap *map = surface->map;
+    SDL_Surface *dst = map->dst;
+    Uint32 cache_flags;
+    SDL_bool cacheable;
+
+    /* Clean everything out to start */
+    if ((surface->flags & SDL_RLEACCEL) == SDL_RLEACCEL) {
+        SDL_UnRLESurface(surface, 1);
+    }
+    map->blit = SDL_SoftBlit;
+    map->info.src_fmt = surface->format;
+    map->info.src_pitch = surface->pitch;
+    map->info.dst_fmt = dst->format;
+    map->info.dst_pitch = dst->pitch;
+
+    /* See if we can do RLE acceleration */
+    if (map->info.flags & SDL_COPY_RLE_DESIRED) {
+        if (SDL_RLESurface(surface) == 0) {
+            return 0;
+        }
+    }
+
+    /* See if we've chosen a blit function for this combination before */
+    cache_flags = (Uint32) map->info.flags;
+    if (map->identity) {
+        cache_flags |= SDL_BLIT_CACHE_IDENTITY;
+    }
+    cacheable = (surface->format->format != SDL_PIXELFORMAT_UNKNOWN &&
+                 dst->format->format != SDL_PIXELFORMAT_UNKNOWN);
+    if (!cacheable ||
+        !SDL_LookupBlitCache(surface->format->format, dst->format->format,
+                             cache_flags, &blit)) {
+        blit = SDL_ChooseBlit(surface);
+        if (cacheable) {
+            SDL_AddBlitCache(surface->format->format, dst->format->format,
+                             cache_flags, blit);
+        }
+    }
     map->data = blit;
 
     /* Make sure we have a blit function */
@@ -26,6 +26,7 @@
 #include "SDL_cpuinfo.h"
 #include "SDL_endian.h"
 #include "SDL_surface.h"
+#include "SDL_rect_c.h"
 
 /* Table to do pixel byte expansion */
 extern Uint8* SDL_expand_byte[9];
@@ -36,6 +37,7 @@ extern Uint8* SDL_expand_byte[9];
 #define SDL_COPY_BLEND              0x00000010
 #define SDL_COPY_ADD                0x00000020
 #define SDL_COPY_MOD                0x00000040
+#define SDL_COPY_PREMULTIPLIED      0x00000080
 #define SDL_COPY_COLORKEY           0x00000100
 #define SDL_COPY_NEAREST            0x00000200
 #define SDL_COPY_RLE_DESIRED        0x00001000
@@ -51,6 +53,16 @@ extern Uint8* SDL_expand_byte[9];
 #define SDL_CPU_SSE2                0x00000008
 #define SDL_CPU_ALTIVEC_PREFETCH    0x00000010
 #define SDL_CPU_ALTIVEC_NOPREFETCH  0x00000020
+#define SDL_CPU_NEON                0x00000040
+#define SDL_CPU_ALTIVEC             0x00000080
+
+/* The NEON kernels assume the little endian byte order of packed pixels */
+#if (defined(__ARM_NEON__) || defined(__ARM_NEON)) && SDL_BYTEORDER == SDL_LIL_ENDIAN
+#include <arm_neon.h>
+#define SDL_NEON_BLITTERS           1
+#else
+#define SDL_NEON_BLITTERS           0
+#endif
 
 typedef struct
 {
@@ -81,6 +93,9 @@ typedef struct
     SDL_BlitFunc func;
 } SDL_BlitFuncEntry;
 
+/* Private to SDL_stretch.c */
+typedef struct SDL_StretchCache SDL_StretchCache;
+
 /* Blit mapping definition */
 typedef struct SDL_BlitMap
 {
@@ -94,10 +109,35 @@ typedef struct SDL_BlitMap
        an invalid mapping */
     Uint32 dst_palette_version;
     Uint32 src_palette_version;
+
+    /* set on window surfaces that record where they were drawn to */
+    SDL_DamageRegion *damage;
+
+    /* scratch space for linear stretches from this surface */
+    SDL_StretchCache *stretch;
 } SDL_BlitMap;
 
+/* Record a write to a surface that tracks damage */
+#define SDL_DAMAGE_RECT(surface, rect) \
+    do { \
+        if ((surface)->map->damage) { \
+            SDL_AddDamageRect((surface)->map->damage, rect); \
+        } \
+    } while (0)
+
+#define SDL_DAMAGE_POINTS(surface, points, count) \
+    do { \
+        if ((surface)->map->damage) { \
+            SDL_AddDamagePoints((surface)->map->damage, points, count, \
+                                &(surface)->clip_rect); \
+        } \
+    } while (0)
+
 /* Functions found in SDL_blit.c */
 extern int SDL_CalculateBlit(SDL_Surface * surface);
+extern void SDL_GetBlitCacheStats(int *hits, int *misses);
+extern int SDL_SoftBlitBands(SDL_Surface * src, SDL_Rect * srcrect,
+                             SDL_Surface * dst, SDL_Rect * dstrect);
 
 /* Functions found in SDL_blit_*.c */
 extern SDL_BlitFunc SDL_CalculateBlit0(SDL_Surface * surface);
@@ -105,6 +145,26 @@ extern SDL_BlitFunc SDL_CalculateBlit1(SDL_Surface * surface);
 extern SDL_BlitFunc SDL_CalculateBlitN(SDL_Surface * surface);
 extern SDL_BlitFunc SDL_CalculateBlitA(SDL_Surface * surface);
 
+/* Functions found in SDL_stretch.c */
+extern SDL_bool SDL_SoftStretchLinearSupported(const SDL_PixelFormat * fmt);
+extern int SDL_SoftStretchLinear(SDL_Surface * src, const SDL_Rect * srcrect,
+                                 SDL_Surface * dst, const SDL_Rect * dstrect);
+extern int SDL_SoftStretchLinearBlit(SDL_Surface * src, const SDL_Rect * srcrect,
+                                     SDL_Surface * dst, const SDL_Rect * dstrect);
+extern void SDL_FreeStretchCache(SDL_StretchCache * cache);
+
+/* Functions found in SDL_surface.c */
+extern int SDL_ValidateBlitMap(SDL_Surface * src, SDL_Surface * dst);
+
+/* Functions found in SDL_surface.c, scaled blits with bilinear filtering
+   when 'linear' is set and the formats allow it */
+extern int SDL_PrivateUpperBlitScaled(SDL_Surface * src, const SDL_Rect * srcrect,
+                                      SDL_Surface * dst, SDL_Rect * dstrect,
+                                      SDL_bool linear);
+extern int SDL_PrivateLowerBlitScaled(SDL_Surface * src, SDL_Rect * srcrect,
+                                      SDL_Surface * dst, SDL_Rect * dstrect,
+                                      SDL_bool linear);
+
 /*
  * Useful macros for blitting routines
  */
@@ -442,6 +442,260 @@ BlitBtoNAlphaKey(SDL_BlitInfo * info)
     }
 }
 
+#ifdef __SSE2__
+/* Blits bitmaps to 16 or 32-bit pixels, 8 pixels (one source byte) at a
+   time.  Each bit picks one of the two mapped colors with a mask.
+ */
+static void
+BlitBtoNSSE2(SDL_BlitInfo * info, int dstbpp, SDL_bool keyed)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint8 *src = info->src;
+    Uint8 *dst = info->dst;
+    int srcskip = info->src_skip;
+    int dstskip = info->dst_skip;
+    const Uint32 ckey = info->colorkey;
+    Uint32 color0, color1;
+    __m128i c0, c1, bits0, bits1, flip;
+    int c;
+
+    /* Set up some basic variables */
+    srcskip += width - (width + 7) / 8;
+    if (ckey > 1) {
+        /* A colorkey outside of the palette never matches */
+        keyed = SDL_FALSE;
+    }
+    if (dstbpp == 4) {
+        color0 = ((Uint32 *) info->table)[0];
+        color1 = ((Uint32 *) info->table)[1];
+        c0 = _mm_set1_epi32(color0);
+        c1 = _mm_set1_epi32(color1);
+        bits0 = _mm_setr_epi32(0x80, 0x40, 0x20, 0x10);
+        bits1 = _mm_setr_epi32(0x08, 0x04, 0x02, 0x01);
+    } else {
+        color0 = ((Uint16 *) info->table)[0];
+        color1 = ((Uint16 *) info->table)[1];
+        c0 = _mm_set1_epi16((short) color0);
+        c1 = _mm_set1_epi16((short) color1);
+        bits0 = _mm_setr_epi16(0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01);
+        bits1 = bits0;
+    }
+    /* Flips the "bit is set" mask into a "pixel is colorkey" mask */
+    flip = (ckey == 0) ? _mm_set1_epi32(-1) : _mm_setzero_si128();
+
+    while (height--) {
+        Uint8 byte = 0, bit;
+
+        for (c = width / 8; c; --c) {
+            __m128i v, m, pix;
+
+            byte = *src++;
+            if (keyed && byte == (ckey ? 0xff : 0x00)) {
+                /* All eight pixels are transparent */
+                dst += 8 * dstbpp;
+                continue;
+            }
+            if (dstbpp == 4) {
+                v = _mm_set1_epi32(byte);
+            } else {
+                v = _mm_set1_epi16(byte);
+            }
+
+            if (dstbpp == 4) {
+                m = _mm_cmpeq_epi32(_mm_and_si128(v, bits0), bits0);
+            } else {
+                m = _mm_cmpeq_epi16(_mm_and_si128(v, bits0), bits0);
+            }
+            pix = _mm_or_si128(_mm_and_si128(m, c1), _mm_andnot_si128(m, c0));
+            if (keyed) {
+                const __m128i t = _mm_xor_si128(m, flip);
+                pix = _mm_or_si128(_mm_and_si128(t, _mm_loadu_si128((__m128i *) dst)),
+                                   _mm_andnot_si128(t, pix));
+            }
+            _mm_storeu_si128((__m128i *) dst, pix);
+
+            if (dstbpp == 4) {
+                m = _mm_cmpeq_epi32(_mm_and_si128(v, bits1), bits1);
+                pix = _mm_or_si128(_mm_and_si128(m, c1), _mm_andnot_si128(m, c0));
+                if (keyed) {
+                    const __m128i t = _mm_xor_si128(m, flip);
+                    pix = _mm_or_si128(_mm_and_si128(t, _mm_loadu_si128((__m128i *) (dst + 16))),
+                                       _mm_andnot_si128(t, pix));
+                }
+                _mm_storeu_si128((__m128i *) (dst + 16), pix);
+            }
+            dst += 8 * dstbpp;
+        }
+        if (width & 7) {
+            byte = *src++;
+            for (c = width & 7; c; --c) {
+                bit = (byte & 0x80) >> 7;
+                if (!keyed || bit != ckey) {
+                    if (dstbpp == 4) {
+                        *(Uint32 *) dst = bit ? color1 : color0;
+                    } else {
+                        *(Uint16 *) dst = (Uint16) (bit ? color1 : color0);
+                    }
+                }
+                byte <<= 1;
+                dst += dstbpp;
+            }
+        }
+        src += srcskip;
+        dst += dstskip;
+    }
+}
+
+static void
+BlitBto2SSE2(SDL_BlitInfo * info)
+{
+    BlitBtoNSSE2(info, 2, SDL_FALSE);
+}
+
+static void
+BlitBto4SSE2(SDL_BlitInfo * info)
+{
+    BlitBtoNSSE2(info, 4, SDL_FALSE);
+}
+
+static void
+BlitBto2KeySSE2(SDL_BlitInfo * info)
+{
+    BlitBtoNSSE2(info, 2, SDL_TRUE);
+}
+
+static void
+BlitBto4KeySSE2(SDL_BlitInfo * info)
+{
+    BlitBtoNSSE2(info, 4, SDL_TRUE);
+}
+#endif /* __SSE2__ */
+
+#if SDL_NEON_BLITTERS
+/* Blits bitmaps to 16 or 32-bit pixels, 8 pixels (one source byte) at a
+   time.  Each bit picks one of the two mapped colors with a mask.
+ */
+static void
+BlitBtoNNEON(SDL_BlitInfo * info, int dstbpp, SDL_bool keyed)
+{
+    static const Uint32 bits32[8] = { 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01 };
+    static const Uint16 bits16[8] = { 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01 };
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint8 *src = info->src;
+    Uint8 *dst = info->dst;
+    int srcskip = info->src_skip;
+    int dstskip = info->dst_skip;
+    const Uint32 ckey = info->colorkey;
+    const uint32x4_t bits0 = vld1q_u32(bits32);
+    const uint32x4_t bits1 = vld1q_u32(bits32 + 4);
+    const uint16x8_t bits = vld1q_u16(bits16);
+    Uint32 color0, color1;
+    int c;
+
+    /* Set up some basic variables */
+    srcskip += width - (width + 7) / 8;
+    if (ckey > 1) {
+        /* A colorkey outside of the palette never matches */
+        keyed = SDL_FALSE;
+    }
+    if (dstbpp == 4) {
+        color0 = ((Uint32 *) info->table)[0];
+        color1 = ((Uint32 *) info->table)[1];
+    } else {
+        color0 = ((Uint16 *) info->table)[0];
+        color1 = ((Uint16 *) info->table)[1];
+    }
+
+    while (height--) {
+        Uint8 byte = 0, bit;
+
+        for (c = width / 8; c; --c) {
+            byte = *src++;
+            if (keyed && byte == (ckey ? 0xff : 0x00)) {
+                /* All eight pixels are transparent */
+                dst += 8 * dstbpp;
+                continue;
+            }
+            if (dstbpp == 4) {
+                const uint32x4_t v = vdupq_n_u32(byte);
+                const uint32x4_t c0 = vdupq_n_u32(color0);
+                const uint32x4_t c1 = vdupq_n_u32(color1);
+                uint32x4_t m0 = vtstq_u32(v, bits0);
+                uint32x4_t m1 = vtstq_u32(v, bits1);
+                uint32x4_t p0 = vbslq_u32(m0, c1, c0);
+                uint32x4_t p1 = vbslq_u32(m1, c1, c0);
+
+                if (keyed) {
+                    if (ckey == 0) {
+                        m0 = vmvnq_u32(m0);
+                        m1 = vmvnq_u32(m1);
+                    }
+                    p0 = vbslq_u32(m0, vld1q_u32((Uint32 *) dst), p0);
+                    p1 = vbslq_u32(m1, vld1q_u32((Uint32 *) dst + 4), p1);
+                }
+                vst1q_u32((Uint32 *) dst, p0);
+                vst1q_u32((Uint32 *) dst + 4, p1);
+            } else {
+                uint16x8_t m = vtstq_u16(vdupq_n_u16(byte), bits);
+                uint16x8_t p = vbslq_u16(m, vdupq_n_u16((Uint16) color1), vdupq_n_u16((Uint16) color0));
+
+                if (keyed) {
+                    if (ckey == 0) {
+                        m = vmvnq_u16(m);
+                    }
+                    p = vbslq_u16(m, vld1q_u16((Uint16 *) dst), p);
+                }
+                vst1q_u16((Uint16 *) dst, p);
+            }
+            dst += 8 * dstbpp;
+        }
+        if (width & 7) {
+            byte = *src++;
+            for (c = width & 7; c; --c) {
+                bit = (byte & 0x80) >> 7;
+                if (!keyed || bit != ckey) {
+                    if (dstbpp == 4) {
+                        *(Uint32 *) dst = bit ? color1 : color0;
+                    } else {
+                        *(Uint16 *) dst = (Uint16) (bit ? color1 : color0);
+                    }
+                }
+                byte <<= 1;
+                dst += dstbpp;
+            }
+        }
+        src += srcskip;
+        dst += dstskip;
+    }
+}
+
+static void
+BlitBto2NEON(SDL_BlitInfo * info)
+{
+    BlitBtoNNEON(info, 2, SDL_FALSE);
+}
+
+static void
+BlitBto4NEON(SDL_BlitInfo * info)
+{
+    BlitBtoNNEON(info, 4, SDL_FALSE);
+}
+
+static void
+BlitBto2KeyNEON(SDL_BlitInfo * info)
+{
+    BlitBtoNNEON(info, 2, SDL_TRUE);
+}
+
+static void
+BlitBto4KeyNEON(SDL_BlitInfo * info)
+{
+    BlitBtoNNEON(info, 4, SDL_TRUE);
+}
+#endif /* SDL_NEON_BLITTERS */
+
 static const SDL_BlitFunc bitmap_blit[] = {
     (SDL_BlitFunc) NULL, BlitBto1, BlitBto2, BlitBto3, BlitBto4
 };
@@ -466,9 +720,29 @@ SDL_CalculateBlit0(SDL_Surface * surface)
     }
     switch (surface->map->info.flags & ~SDL_COPY_RLE_MASK) {
     case 0:
+#ifdef __SSE2__
+        if ((which == 2 || which == 4) && SDL_HasSSE2()) {
+            return which == 2 ? BlitBto2SSE2 : BlitBto4SSE2;
+        }
+#endif
+#if SDL_NEON_BLITTERS
+        if (which == 2 || which == 4) {
+            return which == 2 ? BlitBto2NEON : BlitBto4NEON;
+        }
+#endif
         return bitmap_blit[which];
 
     case SDL_COPY_COLORKEY:
+#ifdef __SSE2__
+        if ((which == 2 || which == 4) && SDL_HasSSE2()) {
+            return which == 2 ? BlitBto2KeySSE2 : BlitBto4KeySSE2;
+        }
+#endif
+#if SDL_NEON_BLITTERS
+        if (which == 2 || which == 4) {
+            return which == 2 ? BlitBto2KeyNEON : BlitBto4KeyNEON;
+        }
+#endif
         return colorkey_blit[which];
 
     case SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND:
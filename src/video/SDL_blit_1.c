@@ -508,6 +508,303 @@ Blit1toNAlphaKey(SDL_BlitInfo * info)
     }
 }
 
+#ifdef __SSE2__
+/* Expand 16 source pixels through the palette map, pixels where 'key' has
+   all bits set keep the destination.
+ */
+static SDL_INLINE void
+Blit1to4Group16SSE2(const Uint8 * src, Uint32 * dst, const Uint32 * map,
+                    __m128i key, SDL_bool keyed)
+{
+    __m128i p0 = _mm_setr_epi32(map[src[0]], map[src[1]], map[src[2]], map[src[3]]);
+    __m128i p1 = _mm_setr_epi32(map[src[4]], map[src[5]], map[src[6]], map[src[7]]);
+    __m128i p2 = _mm_setr_epi32(map[src[8]], map[src[9]], map[src[10]], map[src[11]]);
+    __m128i p3 = _mm_setr_epi32(map[src[12]], map[src[13]], map[src[14]], map[src[15]]);
+
+    if (keyed) {
+        const __m128i k16lo = _mm_unpacklo_epi8(key, key);
+        const __m128i k16hi = _mm_unpackhi_epi8(key, key);
+        __m128i k;
+
+        k = _mm_unpacklo_epi16(k16lo, k16lo);
+        p0 = _mm_or_si128(_mm_and_si128(k, _mm_loadu_si128((__m128i *) dst)), _mm_andnot_si128(k, p0));
+        k = _mm_unpackhi_epi16(k16lo, k16lo);
+        p1 = _mm_or_si128(_mm_and_si128(k, _mm_loadu_si128((__m128i *) (dst + 4))), _mm_andnot_si128(k, p1));
+        k = _mm_unpacklo_epi16(k16hi, k16hi);
+        p2 = _mm_or_si128(_mm_and_si128(k, _mm_loadu_si128((__m128i *) (dst + 8))), _mm_andnot_si128(k, p2));
+        k = _mm_unpackhi_epi16(k16hi, k16hi);
+        p3 = _mm_or_si128(_mm_and_si128(k, _mm_loadu_si128((__m128i *) (dst + 12))), _mm_andnot_si128(k, p3));
+    }
+    _mm_storeu_si128((__m128i *) dst, p0);
+    _mm_storeu_si128((__m128i *) (dst + 4), p1);
+    _mm_storeu_si128((__m128i *) (dst + 8), p2);
+    _mm_storeu_si128((__m128i *) (dst + 12), p3);
+}
+
+static SDL_INLINE void
+Blit1to2Group16SSE2(const Uint8 * src, Uint16 * dst, const Uint16 * map,
+                    __m128i key, SDL_bool keyed)
+{
+    __m128i p0 = _mm_setr_epi16(map[src[0]], map[src[1]], map[src[2]], map[src[3]],
+                                map[src[4]], map[src[5]], map[src[6]], map[src[7]]);
+    __m128i p1 = _mm_setr_epi16(map[src[8]], map[src[9]], map[src[10]], map[src[11]],
+                                map[src[12]], map[src[13]], map[src[14]], map[src[15]]);
+
+    if (keyed) {
+        __m128i k;
+
+        k = _mm_unpacklo_epi8(key, key);
+        p0 = _mm_or_si128(_mm_and_si128(k, _mm_loadu_si128((__m128i *) dst)), _mm_andnot_si128(k, p0));
+        k = _mm_unpackhi_epi8(key, key);
+        p1 = _mm_or_si128(_mm_and_si128(k, _mm_loadu_si128((__m128i *) (dst + 8))), _mm_andnot_si128(k, p1));
+    }
+    _mm_storeu_si128((__m128i *) dst, p0);
+    _mm_storeu_si128((__m128i *) (dst + 8), p1);
+}
+
+/* Blits 8-bit pixels to 16 or 32-bit pixels, 16 pixels at a time.
+   Groups that are all colorkey are skipped, groups without any colorkey
+   pixels don't read the destination.
+ */
+static void
+Blit1toNSSE2(SDL_BlitInfo * info, int dstbpp, SDL_bool keyed)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint8 *src = info->src;
+    int srcskip = info->src_skip;
+    Uint8 *dst = info->dst;
+    int dstskip = info->dst_skip;
+    const Uint8 ckey = (Uint8) info->colorkey;
+    const __m128i vkey = _mm_set1_epi8((char) ckey);
+    const __m128i none = _mm_setzero_si128();
+
+    /* A colorkey outside of the palette never matches */
+    if (info->colorkey > 0xff) {
+        keyed = SDL_FALSE;
+    }
+
+    while (height--) {
+        int n = width;
+
+        while (n >= 16) {
+            SDL_bool group_keyed = SDL_FALSE;
+            __m128i key = none;
+
+            if (keyed) {
+                int mask;
+
+                key = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *) src), vkey);
+                mask = _mm_movemask_epi8(key);
+                group_keyed = (mask != 0);
+                if (mask == 0xffff) {
+                    src += 16;
+                    dst += 16 * dstbpp;
+                    n -= 16;
+                    continue;
+                }
+            }
+            if (dstbpp == 4) {
+                Blit1to4Group16SSE2(src, (Uint32 *) dst, (const Uint32 *) info->table, key, group_keyed);
+            } else {
+                Blit1to2Group16SSE2(src, (Uint16 *) dst, (const Uint16 *) info->table, key, group_keyed);
+            }
+            src += 16;
+            dst += 16 * dstbpp;
+            n -= 16;
+        }
+        while (n--) {
+            if (!keyed || *src != ckey) {
+                if (dstbpp == 4) {
+                    *(Uint32 *) dst = ((const Uint32 *) info->table)[*src];
+                } else {
+                    *(Uint16 *) dst = ((const Uint16 *) info->table)[*src];
+                }
+            }
+            src++;
+            dst += dstbpp;
+        }
+        src += srcskip;
+        dst += dstskip;
+    }
+}
+
+static void
+Blit1to2SSE2(SDL_BlitInfo * info)
+{
+    Blit1toNSSE2(info, 2, SDL_FALSE);
+}
+
+static void
+Blit1to4SSE2(SDL_BlitInfo * info)
+{
+    Blit1toNSSE2(info, 4, SDL_FALSE);
+}
+
+static void
+Blit1to2KeySSE2(SDL_BlitInfo * info)
+{
+    Blit1toNSSE2(info, 2, SDL_TRUE);
+}
+
+static void
+Blit1to4KeySSE2(SDL_BlitInfo * info)
+{
+    Blit1toNSSE2(info, 4, SDL_TRUE);
+}
+#endif /* __SSE2__ */
+
+#if SDL_NEON_BLITTERS
+static SDL_INLINE uint32x4_t
+Gather4x32NEON(const Uint8 * src, const Uint32 * map)
+{
+    uint32x4_t p = vdupq_n_u32(map[src[0]]);
+    p = vsetq_lane_u32(map[src[1]], p, 1);
+    p = vsetq_lane_u32(map[src[2]], p, 2);
+    p = vsetq_lane_u32(map[src[3]], p, 3);
+    return p;
+}
+
+static SDL_INLINE uint16x8_t
+Gather8x16NEON(const Uint8 * src, const Uint16 * map)
+{
+    uint16x8_t p = vdupq_n_u16(map[src[0]]);
+    p = vsetq_lane_u16(map[src[1]], p, 1);
+    p = vsetq_lane_u16(map[src[2]], p, 2);
+    p = vsetq_lane_u16(map[src[3]], p, 3);
+    p = vsetq_lane_u16(map[src[4]], p, 4);
+    p = vsetq_lane_u16(map[src[5]], p, 5);
+    p = vsetq_lane_u16(map[src[6]], p, 6);
+    p = vsetq_lane_u16(map[src[7]], p, 7);
+    return p;
+}
+
+/* Blits 8-bit pixels to 16 or 32-bit pixels, 16 pixels at a time.
+   Groups that are all colorkey are skipped, groups without any colorkey
+   pixels don't read the destination.
+ */
+static void
+Blit1toNNEON(SDL_BlitInfo * info, int dstbpp, SDL_bool keyed)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint8 *src = info->src;
+    int srcskip = info->src_skip;
+    Uint8 *dst = info->dst;
+    int dstskip = info->dst_skip;
+    const Uint8 ckey = (Uint8) info->colorkey;
+    const uint8x16_t vkey = vdupq_n_u8(ckey);
+
+    /* A colorkey outside of the palette never matches */
+    if (info->colorkey > 0xff) {
+        keyed = SDL_FALSE;
+    }
+
+    while (height--) {
+        int n = width;
+
+        while (n >= 16) {
+            SDL_bool group_keyed = SDL_FALSE;
+            uint8x16_t key = vdupq_n_u8(0);
+
+            if (keyed) {
+                uint64x2_t k64;
+                Uint64 any, all;
+
+                key = vceqq_u8(vld1q_u8(src), vkey);
+                k64 = vreinterpretq_u64_u8(key);
+                any = vgetq_lane_u64(k64, 0) | vgetq_lane_u64(k64, 1);
+                all = vgetq_lane_u64(k64, 0) & vgetq_lane_u64(k64, 1);
+                if (all == ~(Uint64) 0) {
+                    src += 16;
+                    dst += 16 * dstbpp;
+                    n -= 16;
+                    continue;
+                }
+                group_keyed = (any != 0);
+            }
+            if (dstbpp == 4) {
+                const Uint32 *map = (const Uint32 *) info->table;
+                Uint32 *d = (Uint32 *) dst;
+                uint32x4_t p0 = Gather4x32NEON(src, map);
+                uint32x4_t p1 = Gather4x32NEON(src + 4, map);
+                uint32x4_t p2 = Gather4x32NEON(src + 8, map);
+                uint32x4_t p3 = Gather4x32NEON(src + 12, map);
+
+                if (group_keyed) {
+                    const uint8x16x2_t k16 = vzipq_u8(key, key);
+                    const uint16x8x2_t k32lo = vzipq_u16(vreinterpretq_u16_u8(k16.val[0]), vreinterpretq_u16_u8(k16.val[0]));
+                    const uint16x8x2_t k32hi = vzipq_u16(vreinterpretq_u16_u8(k16.val[1]), vreinterpretq_u16_u8(k16.val[1]));
+
+                    p0 = vbslq_u32(vreinterpretq_u32_u16(k32lo.val[0]), vld1q_u32(d), p0);
+                    p1 = vbslq_u32(vreinterpretq_u32_u16(k32lo.val[1]), vld1q_u32(d + 4), p1);
+                    p2 = vbslq_u32(vreinterpretq_u32_u16(k32hi.val[0]), vld1q_u32(d + 8), p2);
+                    p3 = vbslq_u32(vreinterpretq_u32_u16(k32hi.val[1]), vld1q_u32(d + 12), p3);
+                }
+                vst1q_u32(d, p0);
+                vst1q_u32(d + 4, p1);
+                vst1q_u32(d + 8, p2);
+                vst1q_u32(d + 12, p3);
+            } else {
+                const Uint16 *map = (const Uint16 *) info->table;
+                Uint16 *d = (Uint16 *) dst;
+                uint16x8_t p0 = Gather8x16NEON(src, map);
+                uint16x8_t p1 = Gather8x16NEON(src + 8, map);
+
+                if (group_keyed) {
+                    const uint8x16x2_t k16 = vzipq_u8(key, key);
+
+                    p0 = vbslq_u16(vreinterpretq_u16_u8(k16.val[0]), vld1q_u16(d), p0);
+                    p1 = vbslq_u16(vreinterpretq_u16_u8(k16.val[1]), vld1q_u16(d + 8), p1);
+                }
+                vst1q_u16(d, p0);
+                vst1q_u16(d + 8, p1);
+            }
+            src += 16;
+            dst += 16 * dstbpp;
+            n -= 16;
+        }
+        while (n--) {
+            if (!keyed || *src != ckey) {
+                if (dstbpp == 4) {
+                    *(Uint32 *) dst = ((const Uint32 *) info->table)[*src];
+                } else {
+                    *(Uint16 *) dst = ((const Uint16 *) info->table)[*src];
+                }
+            }
+            src++;
+            dst += dstbpp;
+        }
+        src += srcskip;
+        dst += dstskip;
+    }
+}
+
+static void
+Blit1to2NEON(SDL_BlitInfo * info)
+{
+    Blit1toNNEON(info, 2, SDL_FALSE);
+}
+
+static void
+Blit1to4NEON(SDL_BlitInfo * info)
+{
+    Blit1toNNEON(info, 4, SDL_FALSE);
+}
+
+static void
+Blit1to2KeyNEON(SDL_BlitInfo * info)
+{
+    Blit1toNNEON(info, 2, SDL_TRUE);
+}
+
+static void
+Blit1to4KeyNEON(SDL_BlitInfo * info)
+{
+    Blit1toNNEON(info, 4, SDL_TRUE);
+}
+#endif /* SDL_NEON_BLITTERS */
+
 static const SDL_BlitFunc one_blit[] = {
     (SDL_BlitFunc) NULL, Blit1to1, Blit1to2, Blit1to3, Blit1to4
 };
@@ -530,9 +827,29 @@ SDL_CalculateBlit1(SDL_Surface * surface)
     }
     switch (surface->map->info.flags & ~SDL_COPY_RLE_MASK) {
     case 0:
+#ifdef __SSE2__
+        if ((which == 2 || which == 4) && SDL_HasSSE2()) {
+            return which == 2 ? Blit1to2SSE2 : Blit1to4SSE2;
+        }
+#endif
+#if SDL_NEON_BLITTERS
+        if (which == 2 || which == 4) {
+            return which == 2 ? Blit1to2NEON : Blit1to4NEON;
+        }
+#endif
         return one_blit[which];
 
     case SDL_COPY_COLORKEY:
+#ifdef __SSE2__
+        if ((which == 2 || which == 4) && SDL_HasSSE2()) {
+            return which == 2 ? Blit1to2KeySSE2 : Blit1to4KeySSE2;
+        }
+#endif
+#if SDL_NEON_BLITTERS
+        if (which == 2 || which == 4) {
+            return which == 2 ? Blit1to2KeyNEON : Blit1to4KeyNEON;
+        }
+#endif
         return one_blitkey[which];
 
     case SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND:
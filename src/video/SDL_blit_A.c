@@ -509,6 +509,56 @@ BlitRGBtoRGBPixelAlpha(SDL_BlitInfo * info)
     }
 }
 
+/* fast premultiplied ARGB8888->(A)RGB888 blending:
+   d = s + d * (255 - alpha) / 255, saturated per channel */
+static void
+BlitRGBtoRGBPremultipliedPixelAlpha(SDL_BlitInfo * info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint32 *srcp = (Uint32 *) info->src;
+    int srcskip = info->src_skip >> 2;
+    Uint32 *dstp = (Uint32 *) info->dst;
+    int dstskip = info->dst_skip >> 2;
+
+    while (height--) {
+	    /* *INDENT-OFF* */
+	    DUFFS_LOOP4({
+		Uint32 s = *srcp;
+		Uint32 alpha = s >> 24;
+		if (alpha == SDL_ALPHA_OPAQUE) {
+			*dstp = s;
+		} else if (s) {
+		    /*
+		     * scale and add two channels at a time, x / 255 is
+		     * (x + 1 + (x >> 8)) >> 8 and the carries are caught
+		     * in the otherwise unused bit above each channel
+		     */
+		    Uint32 d = *dstp;
+		    Uint32 ialpha = alpha ^ 0xFF;
+		    Uint32 d1 = (d & 0xff00ff) * ialpha;
+		    Uint32 d2 = ((d >> 8) & 0xff00ff) * ialpha;
+		    Uint32 o1;
+		    Uint32 o2;
+		    d1 = ((d1 + 0x10001 + ((d1 >> 8) & 0xff00ff)) >> 8) & 0xff00ff;
+		    d2 = ((d2 + 0x10001 + ((d2 >> 8) & 0xff00ff)) >> 8) & 0xff00ff;
+		    d1 += s & 0xff00ff;
+		    d2 += (s >> 8) & 0xff00ff;
+		    o1 = d1 & 0x1000100;
+		    o2 = d2 & 0x1000100;
+		    d1 = (d1 | (o1 - (o1 >> 8))) & 0xff00ff;
+		    d2 = (d2 | (o2 - (o2 >> 8))) & 0xff00ff;
+		    *dstp = d1 | (d2 << 8);
+		}
+		++srcp;
+		++dstp;
+	    }, width);
+	    /* *INDENT-ON* */
+        srcp += srcskip;
+        dstp += dstskip;
+    }
+}
+
 #ifdef __3dNOW__
 /* fast (as in MMX with prefetch) ARGB888->(A)RGB888 blending with pixel alpha */
 static void
@@ -1142,6 +1192,762 @@ BlitARGBto555PixelAlpha(SDL_BlitInfo * info)
     }
 }
 
+#ifdef __SSE2__
+
+/* blend unpacked 16-bit lanes: (s * wa + d * wd) >> shift */
+#define BLEND_LANES_SSE2(s, d, wa, wd, shift) \
+    _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(s, wa), \
+                                 _mm_mullo_epi16(d, wd)), shift)
+
+/* blend 2 unpacked ARGB8888 pixels with their own alpha */
+static SDL_INLINE __m128i
+BlendRGBtoRGBPixelAlpha2SSE2(__m128i s, __m128i d)
+{
+    const __m128i alphalane = _mm_set_epi16(-1, 0, 0, 0, -1, 0, 0, 0);
+    const __m128i weight = _mm_set_epi16(255, 256, 256, 256,
+                                         255, 256, 256, 256);
+    __m128i a, wa, wd;
+
+    a = _mm_shufflelo_epi16(s, _MM_SHUFFLE(3, 3, 3, 3));
+    a = _mm_shufflehi_epi16(a, _MM_SHUFFLE(3, 3, 3, 3));
+    wa = _mm_andnot_si128(alphalane, a);        /* a a a 0 */
+    wd = _mm_sub_epi16(weight, a);      /* 256-a 256-a 256-a 255-a */
+    s = BLEND_LANES_SSE2(s, d, wa, wd, 8);
+    return _mm_add_epi16(s, _mm_and_si128(a, alphalane));
+}
+
+/* blend 4 ARGB8888 pixels, same results as BlitRGBtoRGBPixelAlpha */
+static SDL_INLINE __m128i
+BlendRGBtoRGBPixelAlpha4SSE2(__m128i s, __m128i d)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i amask = _mm_set1_epi32(0xff000000);
+    __m128i sa = _mm_and_si128(s, amask);
+    __m128i opaque = _mm_cmpeq_epi32(sa, amask);
+    __m128i transparent = _mm_cmpeq_epi32(sa, zero);
+    __m128i lo, hi, res;
+
+    lo = BlendRGBtoRGBPixelAlpha2SSE2(_mm_unpacklo_epi8(s, zero),
+                                      _mm_unpacklo_epi8(d, zero));
+    hi = BlendRGBtoRGBPixelAlpha2SSE2(_mm_unpackhi_epi8(s, zero),
+                                      _mm_unpackhi_epi8(d, zero));
+    res = _mm_packus_epi16(lo, hi);
+    res = _mm_or_si128(_mm_and_si128(opaque, s),
+                       _mm_andnot_si128(opaque, res));
+    return _mm_or_si128(_mm_and_si128(transparent, d),
+                        _mm_andnot_si128(transparent, res));
+}
+
+/* fast ARGB8888->(A)RGB888 blending with pixel alpha */
+static void
+BlitRGBtoRGBPixelAlphaSSE2(SDL_BlitInfo * info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint32 *srcp = (Uint32 *) info->src;
+    int srcskip = info->src_skip >> 2;
+    Uint32 *dstp = (Uint32 *) info->dst;
+    int dstskip = info->dst_skip >> 2;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i amask = _mm_set1_epi32(0xff000000);
+
+    while (height--) {
+        int n = width;
+        while (n >= 4) {
+            __m128i s = _mm_loadu_si128((const __m128i *) srcp);
+            __m128i sa = _mm_and_si128(s, amask);
+            if (_mm_movemask_epi8(_mm_cmpeq_epi32(sa, amask)) == 0xffff) {
+                _mm_storeu_si128((__m128i *) dstp, s);
+            } else if (_mm_movemask_epi8(_mm_cmpeq_epi32(sa, zero)) != 0xffff) {
+                __m128i d = _mm_loadu_si128((const __m128i *) dstp);
+                _mm_storeu_si128((__m128i *) dstp,
+                                 BlendRGBtoRGBPixelAlpha4SSE2(s, d));
+            }
+            srcp += 4;
+            dstp += 4;
+            n -= 4;
+        }
+        if (n) {
+            Uint32 s[4] = { 0, 0, 0, 0 }, d[4] = { 0, 0, 0, 0 };
+            __m128i res;
+            SDL_memcpy(s, srcp, n * 4);
+            SDL_memcpy(d, dstp, n * 4);
+            res = BlendRGBtoRGBPixelAlpha4SSE2(_mm_loadu_si128((__m128i *) s),
+                                               _mm_loadu_si128((__m128i *) d));
+            _mm_storeu_si128((__m128i *) d, res);
+            SDL_memcpy(dstp, d, n * 4);
+            srcp += n;
+            dstp += n;
+        }
+        srcp += srcskip;
+        dstp += dstskip;
+    }
+}
+
+/* blend 4 premultiplied ARGB8888 pixels, same results as
+   BlitRGBtoRGBPremultipliedPixelAlpha */
+static SDL_INLINE __m128i
+BlendRGBtoRGBPremultiplied4SSE2(__m128i s, __m128i d)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i one = _mm_set1_epi16(1);
+    __m128i lo, hi, ialpha, x;
+
+    /* 255 - alpha, splatted over each pixel's four lanes */
+    ialpha = _mm_andnot_si128(s, _mm_set1_epi32(0xff000000));
+    ialpha = _mm_srli_epi32(ialpha, 24);
+    ialpha = _mm_or_si128(ialpha, _mm_slli_epi32(ialpha, 16));
+    lo = _mm_shuffle_epi32(ialpha, _MM_SHUFFLE(1, 1, 0, 0));
+    hi = _mm_shuffle_epi32(ialpha, _MM_SHUFFLE(3, 3, 2, 2));
+
+    x = _mm_mullo_epi16(_mm_unpacklo_epi8(d, zero), lo);
+    lo = _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(x, one),
+                                      _mm_srli_epi16(x, 8)), 8);
+    x = _mm_mullo_epi16(_mm_unpackhi_epi8(d, zero), hi);
+    hi = _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(x, one),
+                                      _mm_srli_epi16(x, 8)), 8);
+    return _mm_adds_epu8(s, _mm_packus_epi16(lo, hi));
+}
+
+/* fast premultiplied ARGB8888->(A)RGB888 blending */
+static void
+BlitRGBtoRGBPremultipliedPixelAlphaSSE2(SDL_BlitInfo * info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint32 *srcp = (Uint32 *) info->src;
+    int srcskip = info->src_skip >> 2;
+    Uint32 *dstp = (Uint32 *) info->dst;
+    int dstskip = info->dst_skip >> 2;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i amask = _mm_set1_epi32(0xff000000);
+
+    while (height--) {
+        int n = width;
+        while (n >= 4) {
+            __m128i s = _mm_loadu_si128((const __m128i *) srcp);
+            if (_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(s, amask),
+                                                  amask)) == 0xffff) {
+                _mm_storeu_si128((__m128i *) dstp, s);
+            } else if (_mm_movemask_epi8(_mm_cmpeq_epi32(s, zero)) != 0xffff) {
+                __m128i d = _mm_loadu_si128((const __m128i *) dstp);
+                _mm_storeu_si128((__m128i *) dstp,
+                                 BlendRGBtoRGBPremultiplied4SSE2(s, d));
+            }
+            srcp += 4;
+            dstp += 4;
+            n -= 4;
+        }
+        if (n) {
+            Uint32 s[4] = { 0, 0, 0, 0 }, d[4] = { 0, 0, 0, 0 };
+            __m128i res;
+            SDL_memcpy(s, srcp, n * 4);
+            SDL_memcpy(d, dstp, n * 4);
+            res = BlendRGBtoRGBPremultiplied4SSE2(_mm_loadu_si128((__m128i *) s),
+                                                  _mm_loadu_si128((__m128i *) d));
+            _mm_storeu_si128((__m128i *) d, res);
+            SDL_memcpy(dstp, d, n * 4);
+            srcp += n;
+            dstp += n;
+        }
+        srcp += srcskip;
+        dstp += dstskip;
+    }
+}
+
+/* blend 4 RGB888 pixels with a constant alpha, same as BlitRGBtoRGBSurfaceAlpha */
+static SDL_INLINE __m128i
+BlendRGBtoRGBSurfaceAlpha4SSE2(__m128i s, __m128i d, __m128i wa, __m128i wd)
+{
+    const __m128i zero = _mm_setzero_si128();
+    __m128i lo, hi;
+
+    lo = BLEND_LANES_SSE2(_mm_unpacklo_epi8(s, zero),
+                          _mm_unpacklo_epi8(d, zero), wa, wd, 8);
+    hi = BLEND_LANES_SSE2(_mm_unpackhi_epi8(s, zero),
+                          _mm_unpackhi_epi8(d, zero), wa, wd, 8);
+    return _mm_or_si128(_mm_packus_epi16(lo, hi),
+                        _mm_set1_epi32(0xff000000));
+}
+
+/* fast RGB888->(A)RGB888 blending with surface alpha */
+static void
+BlitRGBtoRGBSurfaceAlphaSSE2(SDL_BlitInfo * info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint32 *srcp = (Uint32 *) info->src;
+    int srcskip = info->src_skip >> 2;
+    Uint32 *dstp = (Uint32 *) info->dst;
+    int dstskip = info->dst_skip >> 2;
+    const __m128i wa = _mm_set1_epi16(info->a);
+    const __m128i wd = _mm_set1_epi16(256 - info->a);
+
+    while (height--) {
+        int n = width;
+        while (n >= 4) {
+            __m128i s = _mm_loadu_si128((const __m128i *) srcp);
+            __m128i d = _mm_loadu_si128((const __m128i *) dstp);
+            _mm_storeu_si128((__m128i *) dstp,
+                             BlendRGBtoRGBSurfaceAlpha4SSE2(s, d, wa, wd));
+            srcp += 4;
+            dstp += 4;
+            n -= 4;
+        }
+        if (n) {
+            Uint32 s[4] = { 0, 0, 0, 0 }, d[4] = { 0, 0, 0, 0 };
+            __m128i res;
+            SDL_memcpy(s, srcp, n * 4);
+            SDL_memcpy(d, dstp, n * 4);
+            res = BlendRGBtoRGBSurfaceAlpha4SSE2(_mm_loadu_si128((__m128i *) s),
+                                                 _mm_loadu_si128((__m128i *) d),
+                                                 wa, wd);
+            _mm_storeu_si128((__m128i *) d, res);
+            SDL_memcpy(dstp, d, n * 4);
+            srcp += n;
+            dstp += n;
+        }
+        srcp += srcskip;
+        dstp += dstskip;
+    }
+}
+
+/* blend 8 RGB565/RGB555 pixels field by field with a 5-bit alpha */
+static SDL_INLINE __m128i
+Blend16to16SurfaceAlpha8SSE2(__m128i s, __m128i d, __m128i rshift,
+                             __m128i gmask, __m128i wa, __m128i wd)
+{
+    const __m128i fmask = _mm_set1_epi16(0x1f);
+    __m128i r, g, b;
+
+    r = BLEND_LANES_SSE2(_mm_and_si128(_mm_srl_epi16(s, rshift), fmask),
+                         _mm_and_si128(_mm_srl_epi16(d, rshift), fmask),
+                         wa, wd, 5);
+    g = BLEND_LANES_SSE2(_mm_and_si128(_mm_srli_epi16(s, 5), gmask),
+                         _mm_and_si128(_mm_srli_epi16(d, 5), gmask),
+                         wa, wd, 5);
+    b = BLEND_LANES_SSE2(_mm_and_si128(s, fmask), _mm_and_si128(d, fmask),
+                         wa, wd, 5);
+    return _mm_or_si128(_mm_or_si128(_mm_sll_epi16(r, rshift),
+                                     _mm_slli_epi16(g, 5)), b);
+}
+
+static void
+Blit16to16SurfaceAlphaSSE2(SDL_BlitInfo * info, int rshift, Uint16 gmask)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint16 *srcp = (Uint16 *) info->src;
+    int srcskip = info->src_skip >> 1;
+    Uint16 *dstp = (Uint16 *) info->dst;
+    int dstskip = info->dst_skip >> 1;
+    unsigned alpha = info->a >> 3;      /* downscale alpha to 5 bits */
+    const __m128i rcount = _mm_cvtsi32_si128(rshift);
+    const __m128i gm = _mm_set1_epi16(gmask);
+    const __m128i wa = _mm_set1_epi16(alpha);
+    const __m128i wd = _mm_set1_epi16(32 - alpha);
+
+    while (height--) {
+        int n = width;
+        while (n >= 8) {
+            __m128i s = _mm_loadu_si128((const __m128i *) srcp);
+            __m128i d = _mm_loadu_si128((const __m128i *) dstp);
+            _mm_storeu_si128((__m128i *) dstp,
+                             Blend16to16SurfaceAlpha8SSE2(s, d, rcount, gm,
+                                                          wa, wd));
+            srcp += 8;
+            dstp += 8;
+            n -= 8;
+        }
+        if (n) {
+            Uint16 s[8] = { 0 }, d[8] = { 0 };
+            __m128i res;
+            SDL_memcpy(s, srcp, n * 2);
+            SDL_memcpy(d, dstp, n * 2);
+            res = Blend16to16SurfaceAlpha8SSE2(_mm_loadu_si128((__m128i *) s),
+                                               _mm_loadu_si128((__m128i *) d),
+                                               rcount, gm, wa, wd);
+            _mm_storeu_si128((__m128i *) d, res);
+            SDL_memcpy(dstp, d, n * 2);
+            srcp += n;
+            dstp += n;
+        }
+        srcp += srcskip;
+        dstp += dstskip;
+    }
+}
+
+/* fast RGB565->RGB565 blending with surface alpha */
+static void
+Blit565to565SurfaceAlphaSSE2(SDL_BlitInfo * info)
+{
+    if (info->a == 128) {
+        Blit16to16SurfaceAlpha128(info, 0xf7de);
+    } else {
+        Blit16to16SurfaceAlphaSSE2(info, 11, 0x3f);
+    }
+}
+
+/* fast RGB555->RGB555 blending with surface alpha */
+static void
+Blit555to555SurfaceAlphaSSE2(SDL_BlitInfo * info)
+{
+    if (info->a == 128) {
+        Blit16to16SurfaceAlpha128(info, 0xfbde);
+    } else {
+        Blit16to16SurfaceAlphaSSE2(info, 10, 0x1f);
+    }
+}
+
+/* blend 8 ARGB8888 pixels onto 8 RGB565/RGB555 pixels, same results as
+   BlitARGBto565PixelAlpha and BlitARGBto555PixelAlpha */
+static SDL_INLINE __m128i
+BlendARGBto16PixelAlpha8SSE2(__m128i s0, __m128i s1, __m128i d,
+                             __m128i rshift, __m128i gshift, __m128i gmask)
+{
+    const __m128i fmask32 = _mm_set1_epi32(0x1f);
+    const __m128i fmask = _mm_set1_epi16(0x1f);
+    const __m128i opaque = _mm_set1_epi16(SDL_ALPHA_OPAQUE >> 3);
+    const __m128i gmask32 = _mm_unpacklo_epi16(gmask, _mm_setzero_si128());
+    __m128i a, wd, sr, sg, sb, r, g, b, res, sel;
+
+    /* downscale alpha to 5 bits, pack the source fields into 16-bit lanes */
+    a = _mm_packs_epi32(_mm_srli_epi32(s0, 27), _mm_srli_epi32(s1, 27));
+    sr = _mm_packs_epi32(_mm_and_si128(_mm_srli_epi32(s0, 19), fmask32),
+                         _mm_and_si128(_mm_srli_epi32(s1, 19), fmask32));
+    sg = _mm_packs_epi32(_mm_and_si128(_mm_srl_epi32(s0, gshift), gmask32),
+                         _mm_and_si128(_mm_srl_epi32(s1, gshift), gmask32));
+    sb = _mm_packs_epi32(_mm_and_si128(_mm_srli_epi32(s0, 3), fmask32),
+                         _mm_and_si128(_mm_srli_epi32(s1, 3), fmask32));
+
+    wd = _mm_sub_epi16(_mm_set1_epi16(32), a);
+    r = BLEND_LANES_SSE2(sr, _mm_and_si128(_mm_srl_epi16(d, rshift), fmask),
+                         a, wd, 5);
+    g = BLEND_LANES_SSE2(sg, _mm_and_si128(_mm_srli_epi16(d, 5), gmask),
+                         a, wd, 5);
+    b = BLEND_LANES_SSE2(sb, _mm_and_si128(d, fmask), a, wd, 5);
+
+    /* opaque pixels are converted without blending */
+    sel = _mm_cmpeq_epi16(a, opaque);
+    r = _mm_or_si128(_mm_and_si128(sel, sr), _mm_andnot_si128(sel, r));
+    g = _mm_or_si128(_mm_and_si128(sel, sg), _mm_andnot_si128(sel, g));
+    b = _mm_or_si128(_mm_and_si128(sel, sb), _mm_andnot_si128(sel, b));
+    res = _mm_or_si128(_mm_or_si128(_mm_sll_epi16(r, rshift),
+                                    _mm_slli_epi16(g, 5)), b);
+
+    /* transparent pixels leave the destination untouched */
+    sel = _mm_cmpeq_epi16(a, _mm_setzero_si128());
+    return _mm_or_si128(_mm_and_si128(sel, d), _mm_andnot_si128(sel, res));
+}
+
+static void
+BlitARGBto16PixelAlphaSSE2(SDL_BlitInfo * info, int rshift, int gshift,
+                           Uint16 gmask)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint32 *srcp = (Uint32 *) info->src;
+    int srcskip = info->src_skip >> 2;
+    Uint16 *dstp = (Uint16 *) info->dst;
+    int dstskip = info->dst_skip >> 1;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i amask = _mm_set1_epi32(0xf8000000);
+    const __m128i rcount = _mm_cvtsi32_si128(rshift);
+    const __m128i gcount = _mm_cvtsi32_si128(gshift);
+    const __m128i gm = _mm_set1_epi16(gmask);
+
+    while (height--) {
+        int n = width;
+        while (n >= 8) {
+            __m128i s0 = _mm_loadu_si128((const __m128i *) srcp);
+            __m128i s1 = _mm_loadu_si128((const __m128i *) (srcp + 4));
+            __m128i sa = _mm_or_si128(_mm_and_si128(s0, amask),
+                                      _mm_and_si128(s1, amask));
+            if (_mm_movemask_epi8(_mm_cmpeq_epi32(sa, zero)) != 0xffff) {
+                __m128i d = _mm_loadu_si128((const __m128i *) dstp);
+                _mm_storeu_si128((__m128i *) dstp,
+                                 BlendARGBto16PixelAlpha8SSE2(s0, s1, d,
+                                                              rcount, gcount,
+                                                              gm));
+            }
+            srcp += 8;
+            dstp += 8;
+            n -= 8;
+        }
+        if (n) {
+            Uint32 s[8] = { 0 };
+            Uint16 d[8] = { 0 };
+            __m128i res;
+            SDL_memcpy(s, srcp, n * 4);
+            SDL_memcpy(d, dstp, n * 2);
+            res = BlendARGBto16PixelAlpha8SSE2(_mm_loadu_si128((__m128i *) s),
+                                               _mm_loadu_si128((__m128i *) (s + 4)),
+                                               _mm_loadu_si128((__m128i *) d),
+                                               rcount, gcount, gm);
+            _mm_storeu_si128((__m128i *) d, res);
+            SDL_memcpy(dstp, d, n * 2);
+            srcp += n;
+            dstp += n;
+        }
+        srcp += srcskip;
+        dstp += dstskip;
+    }
+}
+
+/* fast ARGB8888->RGB565 blending with pixel alpha */
+static void
+BlitARGBto565PixelAlphaSSE2(SDL_BlitInfo * info)
+{
+    BlitARGBto16PixelAlphaSSE2(info, 11, 10, 0x3f);
+}
+
+/* fast ARGB8888->RGB555 blending with pixel alpha */
+static void
+BlitARGBto555PixelAlphaSSE2(SDL_BlitInfo * info)
+{
+    BlitARGBto16PixelAlphaSSE2(info, 10, 11, 0x1f);
+}
+
+#endif /* __SSE2__ */
+
+#if SDL_NEON_BLITTERS
+
+/* blend 8 deinterleaved 8-bit channels: (s * wa + d * wd) >> 8 */
+#define BLEND_CHANNEL_NEON(s, d, wa, wd) \
+    vshrn_n_u16(vmlaq_u16(vmulq_u16(vmovl_u8(s), wa), vmovl_u8(d), wd), 8)
+
+/* blend 8 ARGB8888 pixels, same results as BlitRGBtoRGBPixelAlpha */
+static SDL_INLINE void
+BlendRGBtoRGBPixelAlpha8NEON(const Uint32 * srcp, Uint32 * dstp)
+{
+    uint8x8x4_t s = vld4_u8((const uint8_t *) srcp);
+    uint8x8x4_t d = vld4_u8((const uint8_t *) dstp);
+    uint16x8_t wa = vmovl_u8(s.val[3]);
+    uint16x8_t wd = vsubq_u16(vdupq_n_u16(256), wa);
+    uint8x8_t opaque = vceq_u8(s.val[3], vdup_n_u8(SDL_ALPHA_OPAQUE));
+    uint8x8_t transparent = vceq_u8(s.val[3], vdup_n_u8(0));
+    uint8x8x4_t res;
+    int i;
+
+    for (i = 0; i < 3; ++i) {
+        res.val[i] = BLEND_CHANNEL_NEON(s.val[i], d.val[i], wa, wd);
+    }
+    res.val[3] = vadd_u8(s.val[3],
+                         vshrn_n_u16(vmulq_u16(vmovl_u8(d.val[3]),
+                                               vsubq_u16(vdupq_n_u16(255),
+                                                         wa)), 8));
+    for (i = 0; i < 4; ++i) {
+        res.val[i] = vbsl_u8(opaque, s.val[i], res.val[i]);
+        res.val[i] = vbsl_u8(transparent, d.val[i], res.val[i]);
+    }
+    vst4_u8((uint8_t *) dstp, res);
+}
+
+/* fast ARGB8888->(A)RGB888 blending with pixel alpha */
+static void
+BlitRGBtoRGBPixelAlphaNEON(SDL_BlitInfo * info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint32 *srcp = (Uint32 *) info->src;
+    int srcskip = info->src_skip >> 2;
+    Uint32 *dstp = (Uint32 *) info->dst;
+    int dstskip = info->dst_skip >> 2;
+
+    while (height--) {
+        int n = width;
+        while (n >= 8) {
+            BlendRGBtoRGBPixelAlpha8NEON(srcp, dstp);
+            srcp += 8;
+            dstp += 8;
+            n -= 8;
+        }
+        if (n) {
+            Uint32 s[8] = { 0 }, d[8] = { 0 };
+            SDL_memcpy(s, srcp, n * 4);
+            SDL_memcpy(d, dstp, n * 4);
+            BlendRGBtoRGBPixelAlpha8NEON(s, d);
+            SDL_memcpy(dstp, d, n * 4);
+            srcp += n;
+            dstp += n;
+        }
+        srcp += srcskip;
+        dstp += dstskip;
+    }
+}
+
+/* blend 8 premultiplied ARGB8888 pixels, same results as
+   BlitRGBtoRGBPremultipliedPixelAlpha */
+static SDL_INLINE void
+BlendRGBtoRGBPremultiplied8NEON(const Uint32 * srcp, Uint32 * dstp)
+{
+    uint8x8x4_t s = vld4_u8((const uint8_t *) srcp);
+    uint8x8x4_t d = vld4_u8((const uint8_t *) dstp);
+    uint8x8_t ialpha = vmvn_u8(s.val[3]);
+    uint16x8_t x;
+    int i;
+
+    for (i = 0; i < 4; ++i) {
+        x = vmull_u8(d.val[i], ialpha);
+        x = vaddq_u16(vaddq_u16(x, vdupq_n_u16(1)), vshrq_n_u16(x, 8));
+        d.val[i] = vqadd_u8(s.val[i], vshrn_n_u16(x, 8));
+    }
+    vst4_u8((uint8_t *) dstp, d);
+}
+
+/* fast premultiplied ARGB8888->(A)RGB888 blending */
+static void
+BlitRGBtoRGBPremultipliedPixelAlphaNEON(SDL_BlitInfo * info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint32 *srcp = (Uint32 *) info->src;
+    int srcskip = info->src_skip >> 2;
+    Uint32 *dstp = (Uint32 *) info->dst;
+    int dstskip = info->dst_skip >> 2;
+
+    while (height--) {
+        int n = width;
+        while (n >= 8) {
+            BlendRGBtoRGBPremultiplied8NEON(srcp, dstp);
+            srcp += 8;
+            dstp += 8;
+            n -= 8;
+        }
+        if (n) {
+            Uint32 s[8] = { 0 }, d[8] = { 0 };
+            SDL_memcpy(s, srcp, n * 4);
+            SDL_memcpy(d, dstp, n * 4);
+            BlendRGBtoRGBPremultiplied8NEON(s, d);
+            SDL_memcpy(dstp, d, n * 4);
+            srcp += n;
+            dstp += n;
+        }
+        srcp += srcskip;
+        dstp += dstskip;
+    }
+}
+
+/* blend 8 RGB888 pixels with a constant alpha */
+static SDL_INLINE void
+BlendRGBtoRGBSurfaceAlpha8NEON(const Uint32 * srcp, Uint32 * dstp,
+                               uint16x8_t wa, uint16x8_t wd)
+{
+    uint8x8x4_t s = vld4_u8((const uint8_t *) srcp);
+    uint8x8x4_t d = vld4_u8((const uint8_t *) dstp);
+    int i;
+
+    for (i = 0; i < 3; ++i) {
+        d.val[i] = BLEND_CHANNEL_NEON(s.val[i], d.val[i], wa, wd);
+    }
+    d.val[3] = vdup_n_u8(0xff);
+    vst4_u8((uint8_t *) dstp, d);
+}
+
+/* fast RGB888->(A)RGB888 blending with surface alpha */
+static void
+BlitRGBtoRGBSurfaceAlphaNEON(SDL_BlitInfo * info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint32 *srcp = (Uint32 *) info->src;
+    int srcskip = info->src_skip >> 2;
+    Uint32 *dstp = (Uint32 *) info->dst;
+    int dstskip = info->dst_skip >> 2;
+    const uint16x8_t wa = vdupq_n_u16(info->a);
+    const uint16x8_t wd = vdupq_n_u16(256 - info->a);
+
+    while (height--) {
+        int n = width;
+        while (n >= 8) {
+            BlendRGBtoRGBSurfaceAlpha8NEON(srcp, dstp, wa, wd);
+            srcp += 8;
+            dstp += 8;
+            n -= 8;
+        }
+        if (n) {
+            Uint32 s[8] = { 0 }, d[8] = { 0 };
+            SDL_memcpy(s, srcp, n * 4);
+            SDL_memcpy(d, dstp, n * 4);
+            BlendRGBtoRGBSurfaceAlpha8NEON(s, d, wa, wd);
+            SDL_memcpy(dstp, d, n * 4);
+            srcp += n;
+            dstp += n;
+        }
+        srcp += srcskip;
+        dstp += dstskip;
+    }
+}
+
+/* blend 16-bit fields: (s * wa + d * wd) >> 5 */
+#define BLEND_FIELD_NEON(s, d, wa, wd) \
+    vshrq_n_u16(vmlaq_u16(vmulq_u16(s, wa), d, wd), 5)
+
+/* blend 8 RGB565/RGB555 pixels field by field with a 5-bit alpha */
+static SDL_INLINE uint16x8_t
+Blend16to16SurfaceAlpha8NEON(uint16x8_t s, uint16x8_t d, int rshift,
+                             uint16x8_t gmask, uint16x8_t wa, uint16x8_t wd)
+{
+    const uint16x8_t fmask = vdupq_n_u16(0x1f);
+    const int16x8_t rright = vdupq_n_s16(-rshift);
+    uint16x8_t r, g, b;
+
+    r = BLEND_FIELD_NEON(vandq_u16(vshlq_u16(s, rright), fmask),
+                         vandq_u16(vshlq_u16(d, rright), fmask), wa, wd);
+    g = BLEND_FIELD_NEON(vandq_u16(vshrq_n_u16(s, 5), gmask),
+                         vandq_u16(vshrq_n_u16(d, 5), gmask), wa, wd);
+    b = BLEND_FIELD_NEON(vandq_u16(s, fmask), vandq_u16(d, fmask), wa, wd);
+    return vorrq_u16(vorrq_u16(vshlq_u16(r, vdupq_n_s16(rshift)),
+                               vshlq_n_u16(g, 5)), b);
+}
+
+static void
+Blit16to16SurfaceAlphaNEON(SDL_BlitInfo * info, int rshift, Uint16 gmask)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint16 *srcp = (Uint16 *) info->src;
+    int srcskip = info->src_skip >> 1;
+    Uint16 *dstp = (Uint16 *) info->dst;
+    int dstskip = info->dst_skip >> 1;
+    unsigned alpha = info->a >> 3;      /* downscale alpha to 5 bits */
+    const uint16x8_t gm = vdupq_n_u16(gmask);
+    const uint16x8_t wa = vdupq_n_u16(alpha);
+    const uint16x8_t wd = vdupq_n_u16(32 - alpha);
+
+    while (height--) {
+        int n = width;
+        while (n >= 8) {
+            vst1q_u16(dstp,
+                      Blend16to16SurfaceAlpha8NEON(vld1q_u16(srcp),
+                                                   vld1q_u16(dstp), rshift,
+                                                   gm, wa, wd));
+            srcp += 8;
+            dstp += 8;
+            n -= 8;
+        }
+        if (n) {
+            Uint16 s[8] = { 0 }, d[8] = { 0 };
+            SDL_memcpy(s, srcp, n * 2);
+            SDL_memcpy(d, dstp, n * 2);
+            vst1q_u16(d, Blend16to16SurfaceAlpha8NEON(vld1q_u16(s),
+                                                      vld1q_u16(d), rshift,
+                                                      gm, wa, wd));
+            SDL_memcpy(dstp, d, n * 2);
+            srcp += n;
+            dstp += n;
+        }
+        srcp += srcskip;
+        dstp += dstskip;
+    }
+}
+
+/* fast RGB565->RGB565 blending with surface alpha */
+static void
+Blit565to565SurfaceAlphaNEON(SDL_BlitInfo * info)
+{
+    if (info->a == 128) {
+        Blit16to16SurfaceAlpha128(info, 0xf7de);
+    } else {
+        Blit16to16SurfaceAlphaNEON(info, 11, 0x3f);
+    }
+}
+
+/* fast RGB555->RGB555 blending with surface alpha */
+static void
+Blit555to555SurfaceAlphaNEON(SDL_BlitInfo * info)
+{
+    if (info->a == 128) {
+        Blit16to16SurfaceAlpha128(info, 0xfbde);
+    } else {
+        Blit16to16SurfaceAlphaNEON(info, 10, 0x1f);
+    }
+}
+
+/* blend 8 ARGB8888 pixels onto 8 RGB565/RGB555 pixels */
+static SDL_INLINE void
+BlendARGBto16PixelAlpha8NEON(const Uint32 * srcp, Uint16 * dstp, int rshift,
+                             int gloss, uint16x8_t gmask)
+{
+    const uint16x8_t fmask = vdupq_n_u16(0x1f);
+    const int16x8_t rright = vdupq_n_s16(-rshift);
+    uint8x8x4_t s = vld4_u8((const uint8_t *) srcp);
+    uint16x8_t d = vld1q_u16(dstp);
+    uint16x8_t a = vmovl_u8(vshr_n_u8(s.val[3], 3));
+    uint16x8_t wd = vsubq_u16(vdupq_n_u16(32), a);
+    uint16x8_t sr = vmovl_u8(vshr_n_u8(s.val[2], 3));
+    uint16x8_t sg = vmovl_u8(vshl_u8(s.val[1], vdup_n_s8(-gloss)));
+    uint16x8_t sb = vmovl_u8(vshr_n_u8(s.val[0], 3));
+    uint16x8_t r, g, b, res, sel;
+
+    r = BLEND_FIELD_NEON(sr, vandq_u16(vshlq_u16(d, rright), fmask), a, wd);
+    g = BLEND_FIELD_NEON(sg, vandq_u16(vshrq_n_u16(d, 5), gmask), a, wd);
+    b = BLEND_FIELD_NEON(sb, vandq_u16(d, fmask), a, wd);
+
+    /* opaque pixels are converted without blending */
+    sel = vceqq_u16(a, vdupq_n_u16(SDL_ALPHA_OPAQUE >> 3));
+    r = vbslq_u16(sel, sr, r);
+    g = vbslq_u16(sel, sg, g);
+    b = vbslq_u16(sel, sb, b);
+    res = vorrq_u16(vorrq_u16(vshlq_u16(r, vdupq_n_s16(rshift)),
+                              vshlq_n_u16(g, 5)), b);
+
+    /* transparent pixels leave the destination untouched */
+    sel = vceqq_u16(a, vdupq_n_u16(0));
+    vst1q_u16(dstp, vbslq_u16(sel, d, res));
+}
+
+static void
+BlitARGBto16PixelAlphaNEON(SDL_BlitInfo * info, int rshift, int gloss,
+                           Uint16 gmask)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint32 *srcp = (Uint32 *) info->src;
+    int srcskip = info->src_skip >> 2;
+    Uint16 *dstp = (Uint16 *) info->dst;
+    int dstskip = info->dst_skip >> 1;
+    const uint16x8_t gm = vdupq_n_u16(gmask);
+
+    while (height--) {
+        int n = width;
+        while (n >= 8) {
+            BlendARGBto16PixelAlpha8NEON(srcp, dstp, rshift, gloss, gm);
+            srcp += 8;
+            dstp += 8;
+            n -= 8;
+        }
+        if (n) {
+            Uint32 s[8] = { 0 };
+            Uint16 d[8] = { 0 };
+            SDL_memcpy(s, srcp, n * 4);
+            SDL_memcpy(d, dstp, n * 2);
+            BlendARGBto16PixelAlpha8NEON(s, d, rshift, gloss, gm);
+            SDL_memcpy(dstp, d, n * 2);
+            srcp += n;
+            dstp += n;
+        }
+        srcp += srcskip;
+        dstp += dstskip;
+    }
+}
+
+/* fast ARGB8888->RGB565 blending with pixel alpha */
+static void
+BlitARGBto565PixelAlphaNEON(SDL_BlitInfo * info)
+{
+    BlitARGBto16PixelAlphaNEON(info, 11, 2, 0x3f);
+}
+
+/* fast ARGB8888->RGB555 blending with pixel alpha */
+static void
+BlitARGBto555PixelAlphaNEON(SDL_BlitInfo * info)
+{
+    BlitARGBto16PixelAlphaNEON(info, 10, 3, 0x1f);
+}
+
+#endif /* SDL_NEON_BLITTERS */
+
 /* General (slow) N->N blending with per-surface alpha */
 static void
 BlitNtoNSurfaceAlpha(SDL_BlitInfo * info)
@@ -1283,10 +2089,25 @@ SDL_CalculateBlitA(SDL_Surface * surface)
                     && sf->Gmask == 0xff00
                     && ((sf->Rmask == 0xff && df->Rmask == 0x1f)
                         || (sf->Bmask == 0xff && df->Bmask == 0x1f))) {
-                if (df->Gmask == 0x7e0)
+                if (df->Gmask == 0x7e0) {
+#ifdef __SSE2__
+                    if (SDL_HasSSE2())
+                        return BlitARGBto565PixelAlphaSSE2;
+#endif
+#if SDL_NEON_BLITTERS
+                    return BlitARGBto565PixelAlphaNEON;
+#endif
                     return BlitARGBto565PixelAlpha;
-                else if (df->Gmask == 0x3e0)
+                } else if (df->Gmask == 0x3e0) {
+#ifdef __SSE2__
+                    if (SDL_HasSSE2())
+                        return BlitARGBto555PixelAlphaSSE2;
+#endif
+#if SDL_NEON_BLITTERS
+                    return BlitARGBto555PixelAlphaNEON;
+#endif
                     return BlitARGBto555PixelAlpha;
+                }
             }
             return BlitNtoNPixelAlpha;
 
@@ -1294,6 +2115,15 @@ SDL_CalculateBlitA(SDL_Surface * surface)
             if (sf->Rmask == df->Rmask
                 && sf->Gmask == df->Gmask
                 && sf->Bmask == df->Bmask && sf->BytesPerPixel == 4) {
+                if (sf->Amask == 0xff000000) {
+#ifdef __SSE2__
+                    if (SDL_HasSSE2())
+                        return BlitRGBtoRGBPixelAlphaSSE2;
+#endif
+#if SDL_NEON_BLITTERS
+                    return BlitRGBtoRGBPixelAlphaNEON;
+#endif
+                }
 #if defined(__MMX__) || defined(__3dNOW__)
                 if (sf->Rshift % 8 == 0
                     && sf->Gshift % 8 == 0
@@ -1331,6 +2161,13 @@ SDL_CalculateBlitA(SDL_Surface * surface)
             case 2:
                 if (surface->map->identity) {
                     if (df->Gmask == 0x7e0) {
+#ifdef __SSE2__
+                        if (SDL_HasSSE2())
+                            return Blit565to565SurfaceAlphaSSE2;
+#endif
+#if SDL_NEON_BLITTERS
+                        return Blit565to565SurfaceAlphaNEON;
+#endif
 #ifdef __MMX__
                         if (SDL_HasMMX())
                             return Blit565to565SurfaceAlphaMMX;
@@ -1338,6 +2175,13 @@ SDL_CalculateBlitA(SDL_Surface * surface)
 #endif
                             return Blit565to565SurfaceAlpha;
                     } else if (df->Gmask == 0x3e0) {
+#ifdef __SSE2__
+                        if (SDL_HasSSE2())
+                            return Blit555to555SurfaceAlphaSSE2;
+#endif
+#if SDL_NEON_BLITTERS
+                        return Blit555to555SurfaceAlphaNEON;
+#endif
 #ifdef __MMX__
                         if (SDL_HasMMX())
                             return Blit555to555SurfaceAlphaMMX;
@@ -1352,6 +2196,15 @@ SDL_CalculateBlitA(SDL_Surface * surface)
                 if (sf->Rmask == df->Rmask
                     && sf->Gmask == df->Gmask
                     && sf->Bmask == df->Bmask && sf->BytesPerPixel == 4) {
+                    if ((sf->Rmask | sf->Gmask | sf->Bmask) == 0xffffff) {
+#ifdef __SSE2__
+                        if (SDL_HasSSE2())
+                            return BlitRGBtoRGBSurfaceAlphaSSE2;
+#endif
+#if SDL_NEON_BLITTERS
+                        return BlitRGBtoRGBSurfaceAlphaNEON;
+#endif
+                    }
 #ifdef __MMX__
                     if (sf->Rshift % 8 == 0
                         && sf->Gshift % 8 == 0
@@ -1371,6 +2224,24 @@ SDL_CalculateBlitA(SDL_Surface * surface)
         }
         break;
 
+    case SDL_COPY_PREMULTIPLIED:
+        if (sf->BytesPerPixel == 4 && df->BytesPerPixel == 4
+            && sf->Rmask == df->Rmask
+            && sf->Gmask == df->Gmask
+            && sf->Bmask == df->Bmask
+            && sf->Amask == 0xff000000
+            && (sf->Rmask | sf->Gmask | sf->Bmask) == 0xffffff) {
+#ifdef __SSE2__
+            if (SDL_HasSSE2())
+                return BlitRGBtoRGBPremultipliedPixelAlphaSSE2;
+#endif
+#if SDL_NEON_BLITTERS
+            return BlitRGBtoRGBPremultipliedPixelAlphaNEON;
+#endif
+            return BlitRGBtoRGBPremultipliedPixelAlpha;
+        }
+        break;
+
     case SDL_COPY_COLORKEY | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND:
         if (sf->Amask == 0) {
             if (df->BytesPerPixel == 1) {
@@ -2427,6 +2427,485 @@ BlitNto2101010(SDL_BlitInfo * info)
     }
 }
 
+#if defined(__SSE2__) || SDL_NEON_BLITTERS
+/* Blits between 24 and 32-bit formats with 8-bit channels only move bytes
+   around, so the vector blitters below handle them with shuffles and masks.
+ */
+typedef struct
+{
+    int count;
+    int src_shift[4];
+    int dst_shift[4];
+    Uint32 fill;        /* Bits set in every destination pixel */
+    Uint32 keymask;     /* Bits of the source pixel compared to the colorkey */
+} ByteMoves;
+
+static SDL_bool
+IsByteChannelFormat(const SDL_PixelFormat * fmt)
+{
+    if (fmt->BytesPerPixel != 3 && fmt->BytesPerPixel != 4) {
+        return SDL_FALSE;
+    }
+    if (fmt->Rloss || fmt->Gloss || fmt->Bloss ||
+        (fmt->Rshift % 8) || (fmt->Gshift % 8) || (fmt->Bshift % 8)) {
+        return SDL_FALSE;
+    }
+    if (fmt->Amask && (fmt->BytesPerPixel != 4 || fmt->Aloss || (fmt->Ashift % 8))) {
+        return SDL_FALSE;
+    }
+    return SDL_TRUE;
+}
+
+static void
+SetupByteMoves(const SDL_BlitInfo * info, SDL_bool copy_alpha, ByteMoves * moves)
+{
+    const SDL_PixelFormat *srcfmt = info->src_fmt;
+    const SDL_PixelFormat *dstfmt = info->dst_fmt;
+
+    moves->src_shift[0] = srcfmt->Rshift;
+    moves->dst_shift[0] = dstfmt->Rshift;
+    moves->src_shift[1] = srcfmt->Gshift;
+    moves->dst_shift[1] = dstfmt->Gshift;
+    moves->src_shift[2] = srcfmt->Bshift;
+    moves->dst_shift[2] = dstfmt->Bshift;
+    moves->count = 3;
+    moves->fill = 0;
+    if (dstfmt->Amask) {
+        if (copy_alpha) {
+            moves->src_shift[3] = srcfmt->Ashift;
+            moves->dst_shift[3] = dstfmt->Ashift;
+            moves->count = 4;
+        } else {
+            moves->fill = (Uint32) info->a << dstfmt->Ashift;
+        }
+    }
+    moves->keymask = ~srcfmt->Amask;
+    if (srcfmt->BytesPerPixel == 3) {
+        moves->keymask &= 0x00FFFFFF;
+    }
+}
+
+static SDL_INLINE Uint32
+MoveBytes(const ByteMoves * moves, Uint32 pixel)
+{
+    Uint32 result = moves->fill;
+    int i;
+
+    for (i = 0; i < moves->count; ++i) {
+        result |= ((pixel >> moves->src_shift[i]) & 0xFF) << moves->dst_shift[i];
+    }
+    return result;
+}
+
+/* Blits the pixels left over by the vector loops */
+static SDL_INLINE void
+BlitBytesTail(const ByteMoves * moves, const Uint8 * src, int srcbpp,
+              Uint8 * dst, int dstbpp, int n, SDL_bool keyed, Uint32 ckey)
+{
+    while (n--) {
+        Uint32 pixel;
+
+        if (srcbpp == 4) {
+            pixel = *(const Uint32 *) src;
+        } else {
+            pixel = src[0] | (src[1] << 8) | (src[2] << 16);
+        }
+        if (!keyed || (pixel & moves->keymask) != ckey) {
+            pixel = MoveBytes(moves, pixel);
+            if (dstbpp == 4) {
+                *(Uint32 *) dst = pixel;
+            } else {
+                dst[0] = (Uint8) pixel;
+                dst[1] = (Uint8) (pixel >> 8);
+                dst[2] = (Uint8) (pixel >> 16);
+            }
+        }
+        src += srcbpp;
+        dst += dstbpp;
+    }
+}
+#endif /* __SSE2__ || SDL_NEON_BLITTERS */
+
+#ifdef __SSE2__
+/* Loads 4 packed 24-bit pixels into the low bytes of 4 32-bit lanes */
+static SDL_INLINE __m128i
+Load24SSE2(const Uint8 * p)
+{
+    const __m128i v = _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i *) p),
+                                         _mm_cvtsi32_si128(*(const Uint32 *) (p + 8)));
+    return _mm_unpacklo_epi64(_mm_unpacklo_epi32(v, _mm_srli_si128(v, 3)),
+                              _mm_unpacklo_epi32(_mm_srli_si128(v, 6), _mm_srli_si128(v, 9)));
+}
+
+/* Stores the low bytes of 4 32-bit lanes as 4 packed 24-bit pixels */
+static SDL_INLINE void
+Store24SSE2(Uint8 * p, __m128i v)
+{
+    const __m128i even = _mm_and_si128(v, _mm_setr_epi32(0x00FFFFFF, 0, 0x00FFFFFF, 0));
+    const __m128i odd = _mm_srli_epi64(_mm_and_si128(v, _mm_setr_epi32(0, 0x00FFFFFF, 0, 0x00FFFFFF)), 32);
+    const __m128i pairs = _mm_or_si128(even, _mm_slli_epi64(odd, 24));
+    const __m128i packed = _mm_or_si128(_mm_and_si128(pairs, _mm_setr_epi32(-1, 0x0000FFFF, 0, 0)),
+                                        _mm_and_si128(_mm_srli_si128(pairs, 2), _mm_setr_epi32(0, 0xFFFF0000, -1, 0)));
+
+    _mm_storel_epi64((__m128i *) p, packed);
+    *(Uint32 *) (p + 8) = (Uint32) _mm_cvtsi128_si32(_mm_srli_si128(packed, 8));
+}
+
+/* Blits 4 pixels at a time between formats with 8-bit channels */
+static void
+BlitNtoNBytesSSE2(SDL_BlitInfo * info, SDL_bool copy_alpha, SDL_bool keyed)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint8 *src = info->src;
+    int srcskip = info->src_skip;
+    Uint8 *dst = info->dst;
+    int dstskip = info->dst_skip;
+    const int srcbpp = info->src_fmt->BytesPerPixel;
+    const int dstbpp = info->dst_fmt->BytesPerPixel;
+    const __m128i ff = _mm_set1_epi32(0xFF);
+    __m128i src_shift[4], dst_shift[4], fill, keymask, key;
+    ByteMoves moves;
+    Uint32 ckey;
+    int i;
+
+    SetupByteMoves(info, copy_alpha, &moves);
+    ckey = info->colorkey & ~info->src_fmt->Amask;
+    if (ckey & ~moves.keymask) {
+        /* The colorkey has bits the pixels don't, it never matches */
+        keyed = SDL_FALSE;
+    }
+    for (i = 0; i < moves.count; ++i) {
+        src_shift[i] = _mm_cvtsi32_si128(moves.src_shift[i]);
+        dst_shift[i] = _mm_cvtsi32_si128(moves.dst_shift[i]);
+    }
+    fill = _mm_set1_epi32(moves.fill);
+    keymask = _mm_set1_epi32(moves.keymask);
+    key = _mm_set1_epi32(ckey);
+
+    while (height--) {
+        int n = width;
+
+        while (n >= 4) {
+            __m128i pixels, result, k = _mm_setzero_si128();
+
+            pixels = (srcbpp == 4) ? _mm_loadu_si128((const __m128i *) src) : Load24SSE2(src);
+            if (keyed) {
+                k = _mm_cmpeq_epi32(_mm_and_si128(pixels, keymask), key);
+            }
+
+            result = fill;
+            for (i = 0; i < moves.count; ++i) {
+                result = _mm_or_si128(result,
+                             _mm_sll_epi32(_mm_and_si128(_mm_srl_epi32(pixels, src_shift[i]), ff), dst_shift[i]));
+            }
+
+            if (keyed) {
+                /* Mixing in every group is cheaper than guessing which groups have keyed pixels */
+                const __m128i old = (dstbpp == 4) ? _mm_loadu_si128((const __m128i *) dst) : Load24SSE2(dst);
+                result = _mm_or_si128(_mm_and_si128(k, old), _mm_andnot_si128(k, result));
+            }
+            if (dstbpp == 4) {
+                _mm_storeu_si128((__m128i *) dst, result);
+            } else {
+                Store24SSE2(dst, result);
+            }
+            src += 4 * srcbpp;
+            dst += 4 * dstbpp;
+            n -= 4;
+        }
+        BlitBytesTail(&moves, src, srcbpp, dst, dstbpp, n, keyed, ckey);
+        src += n * srcbpp + srcskip;
+        dst += n * dstbpp + dstskip;
+    }
+}
+
+static void
+BlitNtoNSSE2(SDL_BlitInfo * info)
+{
+    BlitNtoNBytesSSE2(info, SDL_FALSE, SDL_FALSE);
+}
+
+static void
+BlitNtoNCopyAlphaSSE2(SDL_BlitInfo * info)
+{
+    BlitNtoNBytesSSE2(info, SDL_TRUE, SDL_FALSE);
+}
+
+static void
+BlitNtoNKeySSE2(SDL_BlitInfo * info)
+{
+    BlitNtoNBytesSSE2(info, SDL_FALSE, SDL_TRUE);
+}
+
+static void
+BlitNtoNKeyCopyAlphaSSE2(SDL_BlitInfo * info)
+{
+    BlitNtoNBytesSSE2(info, SDL_TRUE, SDL_TRUE);
+}
+
+static void
+Blit2to2KeySSE2(SDL_BlitInfo * info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint16 *srcp = (Uint16 *) info->src;
+    int srcskip = info->src_skip;
+    Uint16 *dstp = (Uint16 *) info->dst;
+    int dstskip = info->dst_skip;
+    Uint32 ckey = info->colorkey;
+    Uint32 rgbmask = ~info->src_fmt->Amask;
+    __m128i vkey, vmask;
+
+    /* Set up some basic variables */
+    srcskip /= 2;
+    dstskip /= 2;
+    ckey &= rgbmask;
+    vkey = _mm_set1_epi16((short) ckey);
+    vmask = _mm_set1_epi16((short) rgbmask);
+
+    while (height--) {
+        int n = width;
+
+        if (ckey > 0xFFFF) {
+            /* The colorkey never matches, this is a plain copy */
+            SDL_memcpy(dstp, srcp, n * 2);
+            srcp += n;
+            dstp += n;
+            n = 0;
+        }
+        while (n >= 8) {
+            const __m128i pixels = _mm_loadu_si128((const __m128i *) srcp);
+            const __m128i k = _mm_cmpeq_epi16(_mm_and_si128(pixels, vmask), vkey);
+            const int mask = _mm_movemask_epi8(k);
+
+            if (mask == 0) {
+                _mm_storeu_si128((__m128i *) dstp, pixels);
+            } else if (mask != 0xFFFF) {
+                const __m128i old = _mm_loadu_si128((const __m128i *) dstp);
+                _mm_storeu_si128((__m128i *) dstp,
+                                 _mm_or_si128(_mm_and_si128(k, old), _mm_andnot_si128(k, pixels)));
+            }
+            srcp += 8;
+            dstp += 8;
+            n -= 8;
+        }
+        while (n--) {
+            if ((*srcp & rgbmask) != ckey) {
+                *dstp = *srcp;
+            }
+            dstp++;
+            srcp++;
+        }
+        srcp += srcskip;
+        dstp += dstskip;
+    }
+}
+#endif /* __SSE2__ */
+
+#if SDL_NEON_BLITTERS
+/* Blits 16 pixels at a time between formats with 8-bit channels, working
+   on planes of bytes, one per byte of the pixel.
+ */
+static void
+BlitNtoNBytesNEON(SDL_BlitInfo * info, SDL_bool copy_alpha, SDL_bool keyed)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint8 *src = info->src;
+    int srcskip = info->src_skip;
+    Uint8 *dst = info->dst;
+    int dstskip = info->dst_skip;
+    const int srcbpp = info->src_fmt->BytesPerPixel;
+    const int dstbpp = info->dst_fmt->BytesPerPixel;
+    int plane_from[4];      /* Source plane for each destination plane, or -1 */
+    Uint8 plane_fill[4];
+    SDL_bool plane_keyed[4];
+    Uint8 plane_key[4];
+    ByteMoves moves;
+    Uint32 ckey;
+    int i;
+
+    SetupByteMoves(info, copy_alpha, &moves);
+    ckey = info->colorkey & ~info->src_fmt->Amask;
+    if (ckey & ~moves.keymask) {
+        /* The colorkey has bits the pixels don't, it never matches */
+        keyed = SDL_FALSE;
+    }
+    for (i = 0; i < 4; ++i) {
+        int j;
+
+        plane_from[i] = -1;
+        for (j = 0; j < moves.count; ++j) {
+            if (moves.dst_shift[j] == i * 8) {
+                plane_from[i] = moves.src_shift[j] / 8;
+            }
+        }
+        plane_fill[i] = (Uint8) (moves.fill >> (i * 8));
+        plane_keyed[i] = ((moves.keymask >> (i * 8)) & 0xFF) ? SDL_TRUE : SDL_FALSE;
+        plane_key[i] = (Uint8) (ckey >> (i * 8));
+    }
+
+    while (height--) {
+        int n = width;
+
+        while (n >= 16) {
+            uint8x16_t in[4], out[4];
+            uint8x16_t k = vdupq_n_u8(0xFF);
+            SDL_bool any = SDL_FALSE;
+
+            if (srcbpp == 4) {
+                const uint8x16x4_t v = vld4q_u8(src);
+                in[0] = v.val[0];
+                in[1] = v.val[1];
+                in[2] = v.val[2];
+                in[3] = v.val[3];
+            } else {
+                const uint8x16x3_t v = vld3q_u8(src);
+                in[0] = v.val[0];
+                in[1] = v.val[1];
+                in[2] = v.val[2];
+                in[3] = vdupq_n_u8(0);
+            }
+            if (keyed) {
+                uint64x2_t k64;
+
+                for (i = 0; i < srcbpp; ++i) {
+                    if (plane_keyed[i]) {
+                        k = vandq_u8(k, vceqq_u8(in[i], vdupq_n_u8(plane_key[i])));
+                    }
+                }
+                k64 = vreinterpretq_u64_u8(k);
+                if ((vgetq_lane_u64(k64, 0) & vgetq_lane_u64(k64, 1)) == ~(Uint64) 0) {
+                    src += 16 * srcbpp;
+                    dst += 16 * dstbpp;
+                    n -= 16;
+                    continue;
+                }
+                any = (vgetq_lane_u64(k64, 0) | vgetq_lane_u64(k64, 1)) ? SDL_TRUE : SDL_FALSE;
+            }
+
+            for (i = 0; i < dstbpp; ++i) {
+                out[i] = (plane_from[i] >= 0) ? in[plane_from[i]] : vdupq_n_u8(plane_fill[i]);
+            }
+
+            if (dstbpp == 4) {
+                uint8x16x4_t v;
+                if (any) {
+                    const uint8x16x4_t old = vld4q_u8(dst);
+                    for (i = 0; i < 4; ++i) {
+                        out[i] = vbslq_u8(k, old.val[i], out[i]);
+                    }
+                }
+                v.val[0] = out[0];
+                v.val[1] = out[1];
+                v.val[2] = out[2];
+                v.val[3] = out[3];
+                vst4q_u8(dst, v);
+            } else {
+                uint8x16x3_t v;
+                if (any) {
+                    const uint8x16x3_t old = vld3q_u8(dst);
+                    for (i = 0; i < 3; ++i) {
+                        out[i] = vbslq_u8(k, old.val[i], out[i]);
+                    }
+                }
+                v.val[0] = out[0];
+                v.val[1] = out[1];
+                v.val[2] = out[2];
+                vst3q_u8(dst, v);
+            }
+            src += 16 * srcbpp;
+            dst += 16 * dstbpp;
+            n -= 16;
+        }
+        BlitBytesTail(&moves, src, srcbpp, dst, dstbpp, n, keyed, ckey);
+        src += n * srcbpp + srcskip;
+        dst += n * dstbpp + dstskip;
+    }
+}
+
+static void
+BlitNtoNNEON(SDL_BlitInfo * info)
+{
+    BlitNtoNBytesNEON(info, SDL_FALSE, SDL_FALSE);
+}
+
+static void
+BlitNtoNCopyAlphaNEON(SDL_BlitInfo * info)
+{
+    BlitNtoNBytesNEON(info, SDL_TRUE, SDL_FALSE);
+}
+
+static void
+BlitNtoNKeyNEON(SDL_BlitInfo * info)
+{
+    BlitNtoNBytesNEON(info, SDL_FALSE, SDL_TRUE);
+}
+
+static void
+BlitNtoNKeyCopyAlphaNEON(SDL_BlitInfo * info)
+{
+    BlitNtoNBytesNEON(info, SDL_TRUE, SDL_TRUE);
+}
+
+static void
+Blit2to2KeyNEON(SDL_BlitInfo * info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint16 *srcp = (Uint16 *) info->src;
+    int srcskip = info->src_skip;
+    Uint16 *dstp = (Uint16 *) info->dst;
+    int dstskip = info->dst_skip;
+    Uint32 ckey = info->colorkey;
+    Uint32 rgbmask = ~info->src_fmt->Amask;
+    uint16x8_t vkey, vmask;
+
+    /* Set up some basic variables */
+    srcskip /= 2;
+    dstskip /= 2;
+    ckey &= rgbmask;
+    vkey = vdupq_n_u16((Uint16) ckey);
+    vmask = vdupq_n_u16((Uint16) rgbmask);
+
+    while (height--) {
+        int n = width;
+
+        if (ckey > 0xFFFF) {
+            /* The colorkey never matches, this is a plain copy */
+            SDL_memcpy(dstp, srcp, n * 2);
+            srcp += n;
+            dstp += n;
+            n = 0;
+        }
+        while (n >= 8) {
+            const uint16x8_t pixels = vld1q_u16(srcp);
+            const uint16x8_t k = vceqq_u16(vandq_u16(pixels, vmask), vkey);
+            const uint64x2_t k64 = vreinterpretq_u64_u16(k);
+
+            if ((vgetq_lane_u64(k64, 0) | vgetq_lane_u64(k64, 1)) == 0) {
+                vst1q_u16(dstp, pixels);
+            } else if ((vgetq_lane_u64(k64, 0) & vgetq_lane_u64(k64, 1)) != ~(Uint64) 0) {
+                vst1q_u16(dstp, vbslq_u16(k, vld1q_u16(dstp), pixels));
+            }
+            srcp += 8;
+            dstp += 8;
+            n -= 8;
+        }
+        while (n--) {
+            if ((*srcp & rgbmask) != ckey) {
+                *dstp = *srcp;
+            }
+            dstp++;
+            srcp++;
+        }
+        srcp += srcskip;
+        dstp += dstskip;
+    }
+}
+#endif /* SDL_NEON_BLITTERS */
+
 /* Normal N to N optimized blitters */
 struct blit_table
 {
@@ -2568,6 +3047,19 @@ SDL_CalculateBlitN(SDL_Surface * surface)
                     blitfun = BlitNtoNCopyAlpha;
                 }
             }
+#if defined(__SSE2__) || SDL_NEON_BLITTERS
+            if ((blitfun == BlitNtoN || blitfun == BlitNtoNCopyAlpha) &&
+                IsByteChannelFormat(srcfmt) && IsByteChannelFormat(dstfmt)) {
+#ifdef __SSE2__
+                if (SDL_HasSSE2()) {
+                    return (blitfun == BlitNtoN) ? BlitNtoNSSE2 : BlitNtoNCopyAlphaSSE2;
+                }
+#endif
+#if SDL_NEON_BLITTERS
+                return (blitfun == BlitNtoN) ? BlitNtoNNEON : BlitNtoNCopyAlphaNEON;
+#endif
+            }
+#endif /* __SSE2__ || SDL_NEON_BLITTERS */
         }
         return (blitfun);
 
@@ -2576,9 +3068,17 @@ SDL_CalculateBlitN(SDL_Surface * surface)
            because RLE is the preferred fast way to deal with this.
            If a particular case turns out to be useful we'll add it. */
 
-        if (srcfmt->BytesPerPixel == 2 && surface->map->identity)
+        if (srcfmt->BytesPerPixel == 2 && surface->map->identity) {
+#ifdef __SSE2__
+            if (SDL_HasSSE2()) {
+                return Blit2to2KeySSE2;
+            }
+#endif
+#if SDL_NEON_BLITTERS
+            return Blit2to2KeyNEON;
+#endif
             return Blit2to2Key;
-        else if (dstfmt->BytesPerPixel == 1)
+        } else if (dstfmt->BytesPerPixel == 1)
             return BlitNto1Key;
         else {
 #if SDL_ALTIVEC_BLITTERS
@@ -2587,6 +3087,19 @@ SDL_CalculateBlitN(SDL_Surface * surface)
                 return Blit32to32KeyAltivec;
             } else
 #endif
+#if defined(__SSE2__) || SDL_NEON_BLITTERS
+            if (IsByteChannelFormat(srcfmt) && IsByteChannelFormat(dstfmt)) {
+                const SDL_bool copy_alpha = (srcfmt->Amask && dstfmt->Amask) ? SDL_TRUE : SDL_FALSE;
+#ifdef __SSE2__
+                if (SDL_HasSSE2()) {
+                    return copy_alpha ? BlitNtoNKeyCopyAlphaSSE2 : BlitNtoNKeySSE2;
+                }
+#endif
+#if SDL_NEON_BLITTERS
+                return copy_alpha ? BlitNtoNKeyCopyAlphaNEON : BlitNtoNKeyNEON;
+#endif
+            }
+#endif /* __SSE2__ || SDL_NEON_BLITTERS */
             if (srcfmt->Amask && dstfmt->Amask) {
                 return BlitNtoNKeyCopyAlpha;
             } else {
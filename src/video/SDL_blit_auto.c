@@ -90,13 +90,19 @@ static void SDL_Blit_RGB888_RGB888_Blend(SDL_BlitInfo *info)
                     srcB = (srcB * srcA) / 255;
                 }
             }
-            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
             case SDL_COPY_BLEND:
                 dstR = srcR + ((255 - srcA) * dstR) / 255;
                 dstG = srcG + ((255 - srcA) * dstG) / 255;
                 dstB = srcB + ((255 - srcA) * dstB) / 255;
                 dstA = srcA + ((255 - srcA) * dstA) / 255;
                 break;
+            case SDL_COPY_PREMULTIPLIED:
+                dstR = srcR + ((255 - srcA) * dstR) / 255; if (dstR > 255) dstR = 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255; if (dstG > 255) dstG = 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255; if (dstB > 255) dstB = 255;
+                dstA = srcA + ((255 - srcA) * dstA) / 255;
+                break;
             case SDL_COPY_ADD:
                 dstR = srcR + dstR; if (dstR > 255) dstR = 255;
                 dstG = srcG + dstG; if (dstG > 255) dstG = 255;
@@ -164,13 +170,19 @@ static void SDL_Blit_RGB888_RGB888_Blend_Scale(SDL_BlitInfo *info)
                     srcB = (srcB * srcA) / 255;
                 }
             }
-            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
             case SDL_COPY_BLEND:
                 dstR = srcR + ((255 - srcA) * dstR) / 255;
                 dstG = srcG + ((255 - srcA) * dstG) / 255;
                 dstB = srcB + ((255 - srcA) * dstB) / 255;
                 dstA = srcA + ((255 - srcA) * dstA) / 255;
                 break;
+            case SDL_COPY_PREMULTIPLIED:
+                dstR = srcR + ((255 - srcA) * dstR) / 255; if (dstR > 255) dstR = 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255; if (dstG > 255) dstG = 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255; if (dstB > 255) dstB = 255;
+                dstA = srcA + ((255 - srcA) * dstA) / 255;
+                break;
             case SDL_COPY_ADD:
                 dstR = srcR + dstR; if (dstR > 255) dstR = 255;
                 dstG = srcG + dstG; if (dstG > 255) dstG = 255;
@@ -312,6 +324,12 @@ static void SDL_Blit_RGB888_RGB888_Modulate_Blend(SDL_BlitInfo *info)
             if (flags & SDL_COPY_MODULATE_ALPHA) {
                 srcA = (srcA * modulateA) / 255;
             }
+            if ((flags & (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) == (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) {
+                /* Premultiplied color fades along with its alpha */
+                srcR = (srcR * modulateA) / 255;
+                srcG = (srcG * modulateA) / 255;
+                srcB = (srcB * modulateA) / 255;
+            }
             if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
                 /* This goes away if we ever use premultiplied alpha */
                 if (srcA < 255) {
@@ -320,13 +338,19 @@ static void SDL_Blit_RGB888_RGB888_Modulate_Blend(SDL_BlitInfo *info)
                     srcB = (srcB * srcA) / 255;
                 }
             }
-            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
             case SDL_COPY_BLEND:
                 dstR = srcR + ((255 - srcA) * dstR) / 255;
                 dstG = srcG + ((255 - srcA) * dstG) / 255;
                 dstB = srcB + ((255 - srcA) * dstB) / 255;
                 dstA = srcA + ((255 - srcA) * dstA) / 255;
                 break;
+            case SDL_COPY_PREMULTIPLIED:
+                dstR = srcR + ((255 - srcA) * dstR) / 255; if (dstR > 255) dstR = 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255; if (dstG > 255) dstG = 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255; if (dstB > 255) dstB = 255;
+                dstA = srcA + ((255 - srcA) * dstA) / 255;
+                break;
             case SDL_COPY_ADD:
                 dstR = srcR + dstR; if (dstR > 255) dstR = 255;
                 dstG = srcG + dstG; if (dstG > 255) dstG = 255;
@@ -398,6 +422,12 @@ static void SDL_Blit_RGB888_RGB888_Modulate_Blend_Scale(SDL_BlitInfo *info)
             if (flags & SDL_COPY_MODULATE_ALPHA) {
                 srcA = (srcA * modulateA) / 255;
             }
+            if ((flags & (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) == (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) {
+                /* Premultiplied color fades along with its alpha */
+                srcR = (srcR * modulateA) / 255;
+                srcG = (srcG * modulateA) / 255;
+                srcB = (srcB * modulateA) / 255;
+            }
             if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
                 /* This goes away if we ever use premultiplied alpha */
                 if (srcA < 255) {
@@ -406,13 +436,19 @@ static void SDL_Blit_RGB888_RGB888_Modulate_Blend_Scale(SDL_BlitInfo *info)
                     srcB = (srcB * srcA) / 255;
                 }
             }
-            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
             case SDL_COPY_BLEND:
                 dstR = srcR + ((255 - srcA) * dstR) / 255;
                 dstG = srcG + ((255 - srcA) * dstG) / 255;
                 dstB = srcB + ((255 - srcA) * dstB) / 255;
                 dstA = srcA + ((255 - srcA) * dstA) / 255;
                 break;
+            case SDL_COPY_PREMULTIPLIED:
+                dstR = srcR + ((255 - srcA) * dstR) / 255; if (dstR > 255) dstR = 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255; if (dstG > 255) dstG = 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255; if (dstB > 255) dstB = 255;
+                dstA = srcA + ((255 - srcA) * dstA) / 255;
+                break;
             case SDL_COPY_ADD:
                 dstR = srcR + dstR; if (dstR > 255) dstR = 255;
                 dstG = srcG + dstG; if (dstG > 255) dstG = 255;
@@ -502,13 +538,19 @@ static void SDL_Blit_RGB888_BGR888_Blend(SDL_BlitInfo *info)
                     srcB = (srcB * srcA) / 255;
                 }
             }
-            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
             case SDL_COPY_BLEND:
                 dstR = srcR + ((255 - srcA) * dstR) / 255;
                 dstG = srcG + ((255 - srcA) * dstG) / 255;
                 dstB = srcB + ((255 - srcA) * dstB) / 255;
                 dstA = srcA + ((255 - srcA) * dstA) / 255;
                 break;
+            case SDL_COPY_PREMULTIPLIED:
+                dstR = srcR + ((255 - srcA) * dstR) / 255; if (dstR > 255) dstR = 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255; if (dstG > 255) dstG = 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255; if (dstB > 255) dstB = 255;
+                dstA = srcA + ((255 - srcA) * dstA) / 255;
+                break;
             case SDL_COPY_ADD:
                 dstR = srcR + dstR; if (dstR > 255) dstR = 255;
                 dstG = srcG + dstG; if (dstG > 255) dstG = 255;
@@ -576,13 +618,19 @@ static void SDL_Blit_RGB888_BGR888_Blend_Scale(SDL_BlitInfo *info)
                     srcB = (srcB * srcA) / 255;
                 }
             }
-            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
             case SDL_COPY_BLEND:
                 dstR = srcR + ((255 - srcA) * dstR) / 255;
                 dstG = srcG + ((255 - srcA) * dstG) / 255;
                 dstB = srcB + ((255 - srcA) * dstB) / 255;
                 dstA = srcA + ((255 - srcA) * dstA) / 255;
                 break;
+            case SDL_COPY_PREMULTIPLIED:
+                dstR = srcR + ((255 - srcA) * dstR) / 255; if (dstR > 255) dstR = 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255; if (dstG > 255) dstG = 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255; if (dstB > 255) dstB = 255;
+                dstA = srcA + ((255 - srcA) * dstA) / 255;
+                break;
             case SDL_COPY_ADD:
                 dstR = srcR + dstR; if (dstR > 255) dstR = 255;
                 dstG = srcG + dstG; if (dstG > 255) dstG = 255;
@@ -724,6 +772,12 @@ static void SDL_Blit_RGB888_BGR888_Modulate_Blend(SDL_BlitInfo *info)
             if (flags & SDL_COPY_MODULATE_ALPHA) {
                 srcA = (srcA * modulateA) / 255;
             }
+            if ((flags & (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) == (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) {
+                /* Premultiplied color fades along with its alpha */
+                srcR = (srcR * modulateA) / 255;
+                srcG = (srcG * modulateA) / 255;
+                srcB = (srcB * modulateA) / 255;
+            }
             if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
                 /* This goes away if we ever use premultiplied alpha */
                 if (srcA < 255) {
@@ -732,13 +786,19 @@ static void SDL_Blit_RGB888_BGR888_Modulate_Blend(SDL_BlitInfo *info)
                     srcB = (srcB * srcA) / 255;
                 }
             }
-            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
             case SDL_COPY_BLEND:
                 dstR = srcR + ((255 - srcA) * dstR) / 255;
                 dstG = srcG + ((255 - srcA) * dstG) / 255;
                 dstB = srcB + ((255 - srcA) * dstB) / 255;
                 dstA = srcA + ((255 - srcA) * dstA) / 255;
                 break;
+            case SDL_COPY_PREMULTIPLIED:
+                dstR = srcR + ((255 - srcA) * dstR) / 255; if (dstR > 255) dstR = 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255; if (dstG > 255) dstG = 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255; if (dstB > 255) dstB = 255;
+                dstA = srcA + ((255 - srcA) * dstA) / 255;
+                break;
             case SDL_COPY_ADD:
                 dstR = srcR + dstR; if (dstR > 255) dstR = 255;
                 dstG = srcG + dstG; if (dstG > 255) dstG = 255;
@@ -810,6 +870,12 @@ static void SDL_Blit_RGB888_BGR888_Modulate_Blend_Scale(SDL_BlitInfo *info)
             if (flags & SDL_COPY_MODULATE_ALPHA) {
                 srcA = (srcA * modulateA) / 255;
             }
+            if ((flags & (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) == (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) {
+                /* Premultiplied color fades along with its alpha */
+                srcR = (srcR * modulateA) / 255;
+                srcG = (srcG * modulateA) / 255;
+                srcB = (srcB * modulateA) / 255;
+            }
             if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
                 /* This goes away if we ever use premultiplied alpha */
                 if (srcA < 255) {
@@ -818,13 +884,19 @@ static void SDL_Blit_RGB888_BGR888_Modulate_Blend_Scale(SDL_BlitInfo *info)
                     srcB = (srcB * srcA) / 255;
                 }
             }
-            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
             case SDL_COPY_BLEND:
                 dstR = srcR + ((255 - srcA) * dstR) / 255;
                 dstG = srcG + ((255 - srcA) * dstG) / 255;
                 dstB = srcB + ((255 - srcA) * dstB) / 255;
                 dstA = srcA + ((255 - srcA) * dstA) / 255;
                 break;
+            case SDL_COPY_PREMULTIPLIED:
+                dstR = srcR + ((255 - srcA) * dstR) / 255; if (dstR > 255) dstR = 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255; if (dstG > 255) dstG = 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255; if (dstB > 255) dstB = 255;
+                dstA = srcA + ((255 - srcA) * dstA) / 255;
+                break;
             case SDL_COPY_ADD:
                 dstR = srcR + dstR; if (dstR > 255) dstR = 255;
                 dstG = srcG + dstG; if (dstG > 255) dstG = 255;
@@ -914,13 +986,19 @@ static void SDL_Blit_RGB888_ARGB8888_Blend(SDL_BlitInfo *info)
                     srcB = (srcB * srcA) / 255;
                 }
             }
-            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
             case SDL_COPY_BLEND:
                 dstR = srcR + ((255 - srcA) * dstR) / 255;
                 dstG = srcG + ((255 - srcA) * dstG) / 255;
                 dstB = srcB + ((255 - srcA) * dstB) / 255;
                 dstA = srcA + ((255 - srcA) * dstA) / 255;
                 break;
+            case SDL_COPY_PREMULTIPLIED:
+                dstR = srcR + ((255 - srcA) * dstR) / 255; if (dstR > 255) dstR = 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255; if (dstG > 255) dstG = 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255; if (dstB > 255) dstB = 255;
+                dstA = srcA + ((255 - srcA) * dstA) / 255;
+                break;
             case SDL_COPY_ADD:
                 dstR = srcR + dstR; if (dstR > 255) dstR = 255;
                 dstG = srcG + dstG; if (dstG > 255) dstG = 255;
@@ -988,13 +1066,19 @@ static void SDL_Blit_RGB888_ARGB8888_Blend_Scale(SDL_BlitInfo *info)
                     srcB = (srcB * srcA) / 255;
                 }
             }
-            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
             case SDL_COPY_BLEND:
                 dstR = srcR + ((255 - srcA) * dstR) / 255;
                 dstG = srcG + ((255 - srcA) * dstG) / 255;
                 dstB = srcB + ((255 - srcA) * dstB) / 255;
                 dstA = srcA + ((255 - srcA) * dstA) / 255;
                 break;
+            case SDL_COPY_PREMULTIPLIED:
+                dstR = srcR + ((255 - srcA) * dstR) / 255; if (dstR > 255) dstR = 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255; if (dstG > 255) dstG = 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255; if (dstB > 255) dstB = 255;
+                dstA = srcA + ((255 - srcA) * dstA) / 255;
+                break;
             case SDL_COPY_ADD:
                 dstR = srcR + dstR; if (dstR > 255) dstR = 255;
                 dstG = srcG + dstG; if (dstG > 255) dstG = 255;
@@ -1136,6 +1220,12 @@ static void SDL_Blit_RGB888_ARGB8888_Modulate_Blend(SDL_BlitInfo *info)
             if (flags & SDL_COPY_MODULATE_ALPHA) {
                 srcA = (srcA * modulateA) / 255;
             }
+            if ((flags & (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) == (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) {
+                /* Premultiplied color fades along with its alpha */
+                srcR = (srcR * modulateA) / 255;
+                srcG = (srcG * modulateA) / 255;
+                srcB = (srcB * modulateA) / 255;
+            }
             if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
                 /* This goes away if we ever use premultiplied alpha */
                 if (srcA < 255) {
@@ -1144,13 +1234,19 @@ static void SDL_Blit_RGB888_ARGB8888_Modulate_Blend(SDL_BlitInfo *info)
                     srcB = (srcB * srcA) / 255;
                 }
             }
-            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
             case SDL_COPY_BLEND:
                 dstR = srcR + ((255 - srcA) * dstR) / 255;
                 dstG = srcG + ((255 - srcA) * dstG) / 255;
                 dstB = srcB + ((255 - srcA) * dstB) / 255;
                 dstA = srcA + ((255 - srcA) * dstA) / 255;
                 break;
+            case SDL_COPY_PREMULTIPLIED:
+                dstR = srcR + ((255 - srcA) * dstR) / 255; if (dstR > 255) dstR = 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255; if (dstG > 255) dstG = 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255; if (dstB > 255) dstB = 255;
+                dstA = srcA + ((255 - srcA) * dstA) / 255;
+                break;
             case SDL_COPY_ADD:
                 dstR = srcR + dstR; if (dstR > 255) dstR = 255;
                 dstG = srcG + dstG; if (dstG > 255) dstG = 255;
@@ -1222,6 +1318,12 @@ static void SDL_Blit_RGB888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
             if (flags & SDL_COPY_MODULATE_ALPHA) {
                 srcA = (srcA * modulateA) / 255;
             }
+            if ((flags & (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) == (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) {
+                /* Premultiplied color fades along with its alpha */
+                srcR = (srcR * modulateA) / 255;
+                srcG = (srcG * modulateA) / 255;
+                srcB = (srcB * modulateA) / 255;
+            }
             if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
                 /* This goes away if we ever use premultiplied alpha */
                 if (srcA < 255) {
@@ -1230,13 +1332,19 @@ static void SDL_Blit_RGB888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
                     srcB = (srcB * srcA) / 255;
                 }
             }
-            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
             case SDL_COPY_BLEND:
                 dstR = srcR + ((255 - srcA) * dstR) / 255;
                 dstG = srcG + ((255 - srcA) * dstG) / 255;
                 dstB = srcB + ((255 - srcA) * dstB) / 255;
                 dstA = srcA + ((255 - srcA) * dstA) / 255;
                 break;
+            case SDL_COPY_PREMULTIPLIED:
+                dstR = srcR + ((255 - srcA) * dstR) / 255; if (dstR > 255) dstR = 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255; if (dstG > 255) dstG = 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255; if (dstB > 255) dstB = 255;
+                dstA = srcA + ((255 - srcA) * dstA) / 255;
+                break;
             case SDL_COPY_ADD:
                 dstR = srcR + dstR; if (dstR > 255) dstR = 255;
                 dstG = srcG + dstG; if (dstG > 255) dstG = 255;
@@ -1326,13 +1434,19 @@ static void SDL_Blit_BGR888_RGB888_Blend(SDL_BlitInfo *info)
                     srcB = (srcB * srcA) / 255;
                 }
             }
-            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
             case SDL_COPY_BLEND:
                 dstR = srcR + ((255 - srcA) * dstR) / 255;
                 dstG = srcG + ((255 - srcA) * dstG) / 255;
                 dstB = srcB + ((255 - srcA) * dstB) / 255;
                 dstA = srcA + ((255 - srcA) * dstA) / 255;
                 break;
+            case SDL_COPY_PREMULTIPLIED:
+                dstR = srcR + ((255 - srcA) * dstR) / 255; if (dstR > 255) dstR = 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255; if (dstG > 255) dstG = 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255; if (dstB > 255) dstB = 255;
+                dstA = srcA + ((255 - srcA) * dstA) / 255;
+                break;
             case SDL_COPY_ADD:
                 dstR = srcR + dstR; if (dstR > 255) dstR = 255;
                 dstG = srcG + dstG; if (dstG > 255) dstG = 255;
@@ -1400,13 +1514,19 @@ static void SDL_Blit_BGR888_RGB888_Blend_Scale(SDL_BlitInfo *info)
                     srcB = (srcB * srcA) / 255;
                 }
             }
-            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
             case SDL_COPY_BLEND:
                 dstR = srcR + ((255 - srcA) * dstR) / 255;
                 dstG = srcG + ((255 - srcA) * dstG) / 255;
                 dstB = srcB + ((255 - srcA) * dstB) / 255;
                 dstA = srcA + ((255 - srcA) * dstA) / 255;
                 break;
+            case SDL_COPY_PREMULTIPLIED:
+                dstR = srcR + ((255 - srcA) * dstR) / 255; if (dstR > 255) dstR = 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255; if (dstG > 255) dstG = 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255; if (dstB > 255) dstB = 255;
+                dstA = srcA + ((255 - srcA) * dstA) / 255;
+                break;
             case SDL_COPY_ADD:
                 dstR = srcR + dstR; if (dstR > 255) dstR = 255;
                 dstG = srcG + dstG; if (dstG > 255) dstG = 255;
@@ -1548,6 +1668,12 @@ static void SDL_Blit_BGR888_RGB888_Modulate_Blend(SDL_BlitInfo *info)
             if (flags & SDL_COPY_MODULATE_ALPHA) {
                 srcA = (srcA * modulateA) / 255;
             }
+            if ((flags & (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) == (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) {
+                /* Premultiplied color fades along with its alpha */
+                srcR = (srcR * modulateA) / 255;
+                srcG = (srcG * modulateA) / 255;
+                srcB = (srcB * modulateA) / 255;
+            }
             if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
                 /* This goes away if we ever use premultiplied alpha */
                 if (srcA < 255) {
@@ -1556,13 +1682,19 @@ static void SDL_Blit_BGR888_RGB888_Modulate_Blend(SDL_BlitInfo *info)
                     srcB = (srcB * srcA) / 255;
                 }
             }
-            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
             case SDL_COPY_BLEND:
                 dstR = srcR + ((255 - srcA) * dstR) / 255;
                 dstG = srcG + ((255 - srcA) * dstG) / 255;
                 dstB = srcB + ((255 - srcA) * dstB) / 255;
                 dstA = srcA + ((255 - srcA) * dstA) / 255;
                 break;
+            case SDL_COPY_PREMULTIPLIED:
+                dstR = srcR + ((255 - srcA) * dstR) / 255; if (dstR > 255) dstR = 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255; if (dstG > 255) dstG = 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255; if (dstB > 255) dstB = 255;
+                dstA = srcA + ((255 - srcA) * dstA) / 255;
+                break;
             case SDL_COPY_ADD:
                 dstR = srcR + dstR; if (dstR > 255) dstR = 255;
                 dstG = srcG + dstG; if (dstG > 255) dstG = 255;
@@ -1634,6 +1766,12 @@ static void SDL_Blit_BGR888_RGB888_Modulate_Blend_Scale(SDL_BlitInfo *info)
             if (flags & SDL_COPY_MODULATE_ALPHA) {
                 srcA = (srcA * modulateA) / 255;
             }
+            if ((flags & (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) == (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) {
+                /* Premultiplied color fades along with its alpha */
+                srcR = (srcR * modulateA) / 255;
+                srcG = (srcG * modulateA) / 255;
+                srcB = (srcB * modulateA) / 255;
+            }
             if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
                 /* This goes away if we ever use premultiplied alpha */
                 if (srcA < 255) {
@@ -1642,13 +1780,19 @@ static void SDL_Blit_BGR888_RGB888_Modulate_Blend_Scale(SDL_BlitInfo *info)
                     srcB = (srcB * srcA) / 255;
                 }
             }
-            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
             case SDL_COPY_BLEND:
                 dstR = srcR + ((255 - srcA) * dstR) / 255;
                 dstG = srcG + ((255 - srcA) * dstG) / 255;
                 dstB = srcB + ((255 - srcA) * dstB) / 255;
                 dstA = srcA + ((255 - srcA) * dstA) / 255;
                 break;
+            case SDL_COPY_PREMULTIPLIED:
+                dstR = srcR + ((255 - srcA) * dstR) / 255; if (dstR > 255) dstR = 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255; if (dstG > 255) dstG = 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255; if (dstB > 255) dstB = 255;
+                dstA = srcA + ((255 - srcA) * dstA) / 255;
+                break;
             case SDL_COPY_ADD:
                 dstR = srcR + dstR; if (dstR > 255) dstR = 255;
                 dstG = srcG + dstG; if (dstG > 255) dstG = 255;
@@ -1733,13 +1877,19 @@ static void SDL_Blit_BGR888_BGR888_Blend(SDL_BlitInfo *info)
                     srcB = (srcB * srcA) / 255;
                 }
             }
-            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
             case SDL_COPY_BLEND:
                 dstR = srcR + ((255 - srcA) * dstR) / 255;
                 dstG = srcG + ((255 - srcA) * dstG) / 255;
                 dstB = srcB + ((255 - srcA) * dstB) / 255;
                 dstA = srcA + ((255 - srcA) * dstA) / 255;
                 break;
+            case SDL_COPY_PREMULTIPLIED:
+                dstR = srcR + ((255 - srcA) * dstR) / 255; if (dstR > 255) dstR = 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255; if (dstG > 255) dstG = 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255; if (dstB > 255) dstB = 255;
+                dstA = srcA + ((255 - srcA) * dstA) / 255;
+                break;
             case SDL_COPY_ADD:
                 dstR = srcR + dstR; if (dstR > 255) dstR = 255;
                 dstG = srcG + dstG; if (dstG > 255) dstG = 255;
@@ -1807,13 +1957,19 @@ static void SDL_Blit_BGR888_BGR888_Blend_Scale(SDL_BlitInfo *info)
                     srcB = (srcB * srcA) / 255;
                 }
             }
-            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
             case SDL_COPY_BLEND:
                 dstR = srcR + ((255 - srcA) * dstR) / 255;
                 dstG = srcG + ((255 - srcA) * dstG) / 255;
                 dstB = srcB + ((255 - srcA) * dstB) / 255;
                 dstA = srcA + ((255 - srcA) * dstA) / 255;
                 break;
+            case SDL_COPY_PREMULTIPLIED:
+                dstR = srcR + ((255 - srcA) * dstR) / 255; if (dstR > 255) dstR = 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255; if (dstG > 255) dstG = 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255; if (dstB > 255) dstB = 255;
+                dstA = srcA + ((255 - srcA) * dstA) / 255;
+                break;
             case SDL_COPY_ADD:
                 dstR = srcR + dstR; if (dstR > 255) dstR = 255;
                 dstG = srcG + dstG; if (dstG > 255) dstG = 255;
@@ -1955,6 +2111,12 @@ static void SDL_Blit_BGR888_BGR888_Modulate_Blend(SDL_BlitInfo *info)
             if (flags & SDL_COPY_MODULATE_ALPHA) {
                 srcA = (srcA * modulateA) / 255;
             }
+            if ((flags & (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) == (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) {
+                /* Premultiplied color fades along with its alpha */
+                srcR = (srcR * modulateA) / 255;
+                srcG = (srcG * modulateA) / 255;
+                srcB = (srcB * modulateA) / 255;
+            }
             if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
                 /* This goes away if we ever use premultiplied alpha */
                 if (srcA < 255) {
@@ -1963,13 +2125,19 @@ static void SDL_Blit_BGR888_BGR888_Modulate_Blend(SDL_BlitInfo *info)
                     srcB = (srcB * srcA) / 255;
                 }
             }
-            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
             case SDL_COPY_BLEND:
                 dstR = srcR + ((255 - srcA) * dstR) / 255;
                 dstG = srcG + ((255 - srcA) * dstG) / 255;
                 dstB = srcB + ((255 - srcA) * dstB) / 255;
                 dstA = srcA + ((255 - srcA) * dstA) / 255;
                 break;
+            case SDL_COPY_PREMULTIPLIED:
+                dstR = srcR + ((255 - srcA) * dstR) / 255; if (dstR > 255) dstR = 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255; if (dstG > 255) dstG = 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255; if (dstB > 255) dstB = 255;
+                dstA = srcA + ((255 - srcA) * dstA) / 255;
+                break;
             case SDL_COPY_ADD:
                 dstR = srcR + dstR; if (dstR > 255) dstR = 255;
                 dstG = srcG + dstG; if (dstG > 255) dstG = 255;
@@ -2041,6 +2209,12 @@ static void SDL_Blit_BGR888_BGR888_Modulate_Blend_Scale(SDL_BlitInfo *info)
             if (flags & SDL_COPY_MODULATE_ALPHA) {
                 srcA = (srcA * modulateA) / 255;
             }
+            if ((flags & (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) == (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) {
+                /* Premultiplied color fades along with its alpha */
+                srcR = (srcR * modulateA) / 255;
+                srcG = (srcG * modulateA) / 255;
+                srcB = (srcB * modulateA) / 255;
+            }
             if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
                 /* This goes away if we ever use premultiplied alpha */
                 if (srcA < 255) {
@@ -2049,13 +2223,19 @@ static void SDL_Blit_BGR888_BGR888_Modulate_Blend_Scale(SDL_BlitInfo *info)
                     srcB = (srcB * srcA) / 255;
                 }
             }
-            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
             case SDL_COPY_BLEND:
                 dstR = srcR + ((255 - srcA) * dstR) / 255;
                 dstG = srcG + ((255 - srcA) * dstG) / 255;
                 dstB = srcB + ((255 - srcA) * dstB) / 255;
                 dstA = srcA + ((255 - srcA) * dstA) / 255;
                 break;
+            case SDL_COPY_PREMULTIPLIED:
+                dstR = srcR + ((255 - srcA) * dstR) / 255; if (dstR > 255) dstR = 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255; if (dstG > 255) dstG = 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255; if (dstB > 255) dstB = 255;
+                dstA = srcA + ((255 - srcA) * dstA) / 255;
+                break;
             case SDL_COPY_ADD:
                 dstR = srcR + dstR; if (dstR > 255) dstR = 255;
                 dstG = srcG + dstG; if (dstG > 255) dstG = 255;
@@ -2145,13 +2325,19 @@ static void SDL_Blit_BGR888_ARGB8888_Blend(SDL_BlitInfo *info)
                     srcB = (srcB * srcA) / 255;
                 }
             }
-            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
             case SDL_COPY_BLEND:
                 dstR = srcR + ((255 - srcA) * dstR) / 255;
                 dstG = srcG + ((255 - srcA) * dstG) / 255;
                 dstB = srcB + ((255 - srcA) * dstB) / 255;
                 dstA = srcA + ((255 - srcA) * dstA) / 255;
                 break;
+            case SDL_COPY_PREMULTIPLIED:
+                dstR = srcR + ((255 - srcA) * dstR) / 255; if (dstR > 255) dstR = 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255; if (dstG > 255) dstG = 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255; if (dstB > 255) dstB = 255;
+                dstA = srcA + ((255 - srcA) * dstA) / 255;
+                break;
             case SDL_COPY_ADD:
                 dstR = srcR + dstR; if (dstR > 255) dstR = 255;
                 dstG = srcG + dstG; if (dstG > 255) dstG = 255;
@@ -2219,13 +2405,19 @@ static void SDL_Blit_BGR888_ARGB8888_Blend_Scale(SDL_BlitInfo *info)
                     srcB = (srcB * srcA) / 255;
                 }
             }
-            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
             case SDL_COPY_BLEND:
                 dstR = srcR + ((255 - srcA) * dstR) / 255;
                 dstG = srcG + ((255 - srcA) * dstG) / 255;
                 dstB = srcB + ((255 - srcA) * dstB) / 255;
                 dstA = srcA + ((255 - srcA) * dstA) / 255;
                 break;
+            case SDL_COPY_PREMULTIPLIED:
+                dstR = srcR + ((255 - srcA) * dstR) / 255; if (dstR > 255) dstR = 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255; if (dstG > 255) dstG = 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255; if (dstB > 255) dstB = 255;
+                dstA = srcA + ((255 - srcA) * dstA) / 255;
+                break;
             case SDL_COPY_ADD:
                 dstR = srcR + dstR; if (dstR > 255) dstR = 255;
                 dstG = srcG + dstG; if (dstG > 255) dstG = 255;
@@ -2367,6 +2559,12 @@ static void SDL_Blit_BGR888_ARGB8888_Modulate_Blend(SDL_BlitInfo *info)
             if (flags & SDL_COPY_MODULATE_ALPHA) {
                 srcA = (srcA * modulateA) / 255;
             }
+            if ((flags & (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) == (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) {
+                /* Premultiplied color fades along with its alpha */
+                srcR = (srcR * modulateA) / 255;
+                srcG = (srcG * modulateA) / 255;
+                srcB = (srcB * modulateA) / 255;
+            }
             if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
                 /* This goes away if we ever use premultiplied alpha */
                 if (srcA < 255) {
@@ -2375,13 +2573,19 @@ static void SDL_Blit_BGR888_ARGB8888_Modulate_Blend(SDL_BlitInfo *info)
                     srcB = (srcB * srcA) / 255;
                 }
             }
-            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
             case SDL_COPY_BLEND:
                 dstR = srcR + ((255 - srcA) * dstR) / 255;
                 dstG = srcG + ((255 - srcA) * dstG) / 255;
                 dstB = srcB + ((255 - srcA) * dstB) / 255;
                 dstA = srcA + ((255 - srcA) * dstA) / 255;
                 break;
+            case SDL_COPY_PREMULTIPLIED:
+                dstR = srcR + ((255 - srcA) * dstR) / 255; if (dstR > 255) dstR = 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255; if (dstG > 255) dstG = 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255; if (dstB > 255) dstB = 255;
+                dstA = srcA + ((255 - srcA) * dstA) / 255;
+                break;
             case SDL_COPY_ADD:
                 dstR = srcR + dstR; if (dstR > 255) dstR = 255;
                 dstG = srcG + dstG; if (dstG > 255) dstG = 255;
@@ -2453,6 +2657,12 @@ static void SDL_Blit_BGR888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
             if (flags & SDL_COPY_MODULATE_ALPHA) {
                 srcA = (srcA * modulateA) / 255;
             }
+            if ((flags & (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) == (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) {
+                /* Premultiplied color fades along with its alpha */
+                srcR = (srcR * modulateA) / 255;
+                srcG = (srcG * modulateA) / 255;
+                srcB = (srcB * modulateA) / 255;
+            }
             if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
                 /* This goes away if we ever use premultiplied alpha */
                 if (srcA < 255) {
@@ -2461,13 +2671,19 @@ static void SDL_Blit_BGR888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
                     srcB = (srcB * srcA) / 255;
                 }
             }
-            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
             case SDL_COPY_BLEND:
                 dstR = srcR + ((255 - srcA) * dstR) / 255;
                 dstG = srcG + ((255 - srcA) * dstG) / 255;
                 dstB = srcB + ((255 - srcA) * dstB) / 255;
                 dstA = srcA + ((255 - srcA) * dstA) / 255;
                 break;
+            case SDL_COPY_PREMULTIPLIED:
+                dstR = srcR + ((255 - srcA) * dstR) / 255; if (dstR > 255) dstR = 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255; if (dstG > 255) dstG = 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255; if (dstB > 255) dstB = 255;
+                dstA = srcA + ((255 - srcA) * dstA) / 255;
+                break;
             case SDL_COPY_ADD:
                 dstR = srcR + dstR; if (dstR > 255) dstR = 255;
                 dstG = srcG + dstG; if (dstG > 255) dstG = 255;
@@ -2557,13 +2773,19 @@ static void SDL_Blit_ARGB8888_RGB888_Blend(SDL_BlitInfo *info)
                     srcB = (srcB * srcA) / 255;
                 }
             }
-            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
             case SDL_COPY_BLEND:
                 dstR = srcR + ((255 - srcA) * dstR) / 255;
                 dstG = srcG + ((255 - srcA) * dstG) / 255;
                 dstB = srcB + ((255 - srcA) * dstB) / 255;
                 dstA = srcA + ((255 - srcA) * dstA) / 255;
                 break;
+            case SDL_COPY_PREMULTIPLIED:
+                dstR = srcR + ((255 - srcA) * dstR) / 255; if (dstR > 255) dstR = 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255; if (dstG > 255) dstG = 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255; if (dstB > 255) dstB = 255;
+                dstA = srcA + ((255 - srcA) * dstA) / 255;
+                break;
             case SDL_COPY_ADD:
                 dstR = srcR + dstR; if (dstR > 255) dstR = 255;
                 dstG = srcG + dstG; if (dstG > 255) dstG = 255;
@@ -2631,13 +2853,19 @@ static void SDL_Blit_ARGB8888_RGB888_Blend_Scale(SDL_BlitInfo *info)
                     srcB = (srcB * srcA) / 255;
                 }
             }
-            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
             case SDL_COPY_BLEND:
                 dstR = srcR + ((255 - srcA) * dstR) / 255;
                 dstG = srcG + ((255 - srcA) * dstG) / 255;
                 dstB = srcB + ((255 - srcA) * dstB) / 255;
                 dstA = srcA + ((255 - srcA) * dstA) / 255;
                 break;
+            case SDL_COPY_PREMULTIPLIED:
+                dstR = srcR + ((255 - srcA) * dstR) / 255; if (dstR > 255) dstR = 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255; if (dstG > 255) dstG = 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255; if (dstB > 255) dstB = 255;
+                dstA = srcA + ((255 - srcA) * dstA) / 255;
+                break;
             case SDL_COPY_ADD:
                 dstR = srcR + dstR; if (dstR > 255) dstR = 255;
                 dstG = srcG + dstG; if (dstG > 255) dstG = 255;
@@ -2779,6 +3007,12 @@ static void SDL_Blit_ARGB8888_RGB888_Modulate_Blend(SDL_BlitInfo *info)
             if (flags & SDL_COPY_MODULATE_ALPHA) {
                 srcA = (srcA * modulateA) / 255;
             }
+            if ((flags & (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) == (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) {
+                /* Premultiplied color fades along with its alpha */
+                srcR = (srcR * modulateA) / 255;
+                srcG = (srcG * modulateA) / 255;
+                srcB = (srcB * modulateA) / 255;
+            }
             if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
                 /* This goes away if we ever use premultiplied alpha */
                 if (srcA < 255) {
@@ -2787,13 +3021,19 @@ static void SDL_Blit_ARGB8888_RGB888_Modulate_Blend(SDL_BlitInfo *info)
                     srcB = (srcB * srcA) / 255;
                 }
             }
-            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
             case SDL_COPY_BLEND:
                 dstR = srcR + ((255 - srcA) * dstR) / 255;
                 dstG = srcG + ((255 - srcA) * dstG) / 255;
                 dstB = srcB + ((255 - srcA) * dstB) / 255;
                 dstA = srcA + ((255 - srcA) * dstA) / 255;
                 break;
+            case SDL_COPY_PREMULTIPLIED:
+                dstR = srcR + ((255 - srcA) * dstR) / 255; if (dstR > 255) dstR = 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255; if (dstG > 255) dstG = 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255; if (dstB > 255) dstB = 255;
+                dstA = srcA + ((255 - srcA) * dstA) / 255;
+                break;
             case SDL_COPY_ADD:
                 dstR = srcR + dstR; if (dstR > 255) dstR = 255;
                 dstG = srcG + dstG; if (dstG > 255) dstG = 255;
@@ -2865,6 +3105,12 @@ static void SDL_Blit_ARGB8888_RGB888_Modulate_Blend_Scale(SDL_BlitInfo *info)
             if (flags & SDL_COPY_MODULATE_ALPHA) {
                 srcA = (srcA * modulateA) / 255;
             }
+            if ((flags & (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) == (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) {
+                /* Premultiplied color fades along with its alpha */
+                srcR = (srcR * modulateA) / 255;
+                srcG = (srcG * modulateA) / 255;
+                srcB = (srcB * modulateA) / 255;
+            }
             if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
                 /* This goes away if we ever use premultiplied alpha */
                 if (srcA < 255) {
@@ -2873,13 +3119,19 @@ static void SDL_Blit_ARGB8888_RGB888_Modulate_Blend_Scale(SDL_BlitInfo *info)
                     srcB = (srcB * srcA) / 255;
                 }
             }
-            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
             case SDL_COPY_BLEND:
                 dstR = srcR + ((255 - srcA) * dstR) / 255;
                 dstG = srcG + ((255 - srcA) * dstG) / 255;
                 dstB = srcB + ((255 - srcA) * dstB) / 255;
                 dstA = srcA + ((255 - srcA) * dstA) / 255;
                 break;
+            case SDL_COPY_PREMULTIPLIED:
+                dstR = srcR + ((255 - srcA) * dstR) / 255; if (dstR > 255) dstR = 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255; if (dstG > 255) dstG = 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255; if (dstB > 255) dstB = 255;
+                dstA = srcA + ((255 - srcA) * dstA) / 255;
+                break;
             case SDL_COPY_ADD:
                 dstR = srcR + dstR; if (dstR > 255) dstR = 255;
                 dstG = srcG + dstG; if (dstG > 255) dstG = 255;
@@ -2969,13 +3221,19 @@ static void SDL_Blit_ARGB8888_BGR888_Blend(SDL_BlitInfo *info)
                     srcB = (srcB * srcA) / 255;
                 }
             }
-            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
             case SDL_COPY_BLEND:
                 dstR = srcR + ((255 - srcA) * dstR) / 255;
                 dstG = srcG + ((255 - srcA) * dstG) / 255;
                 dstB = srcB + ((255 - srcA) * dstB) / 255;
                 dstA = srcA + ((255 - srcA) * dstA) / 255;
                 break;
+            case SDL_COPY_PREMULTIPLIED:
+                dstR = srcR + ((255 - srcA) * dstR) / 255; if (dstR > 255) dstR = 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255; if (dstG > 255) dstG = 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255; if (dstB > 255) dstB = 255;
+                dstA = srcA + ((255 - srcA) * dstA) / 255;
+                break;
             case SDL_COPY_ADD:
                 dstR = srcR + dstR; if (dstR > 255) dstR = 255;
                 dstG = srcG + dstG; if (dstG > 255) dstG = 255;
@@ -3043,13 +3301,19 @@ static void SDL_Blit_ARGB8888_BGR888_Blend_Scale(SDL_BlitInfo *info)
                     srcB = (srcB * srcA) / 255;
                 }
             }
-            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
             case SDL_COPY_BLEND:
                 dstR = srcR + ((255 - srcA) * dstR) / 255;
                 dstG = srcG + ((255 - srcA) * dstG) / 255;
                 dstB = srcB + ((255 - srcA) * dstB) / 255;
                 dstA = srcA + ((255 - srcA) * dstA) / 255;
                 break;
+            case SDL_COPY_PREMULTIPLIED:
+                dstR = srcR + ((255 - srcA) * dstR) / 255; if (dstR > 255) dstR = 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255; if (dstG > 255) dstG = 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255; if (dstB > 255) dstB = 255;
+                dstA = srcA + ((255 - srcA) * dstA) / 255;
+                break;
             case SDL_COPY_ADD:
                 dstR = srcR + dstR; if (dstR > 255) dstR = 255;
                 dstG = srcG + dstG; if (dstG > 255) dstG = 255;
@@ -3191,6 +3455,12 @@ static void SDL_Blit_ARGB8888_BGR888_Modulate_Blend(SDL_BlitInfo *info)
             if (flags & SDL_COPY_MODULATE_ALPHA) {
                 srcA = (srcA * modulateA) / 255;
             }
+            if ((flags & (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) == (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) {
+                /* Premultiplied color fades along with its alpha */
+                srcR = (srcR * modulateA) / 255;
+                srcG = (srcG * modulateA) / 255;
+                srcB = (srcB * modulateA) / 255;
+            }
             if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
                 /* This goes away if we ever use premultiplied alpha */
                 if (srcA < 255) {
@@ -3199,13 +3469,19 @@ static void SDL_Blit_ARGB8888_BGR888_Modulate_Blend(SDL_BlitInfo *info)
                     srcB = (srcB * srcA) / 255;
                 }
             }
-            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
             case SDL_COPY_BLEND:
                 dstR = srcR + ((255 - srcA) * dstR) / 255;
                 dstG = srcG + ((255 - srcA) * dstG) / 255;
                 dstB = srcB + ((255 - srcA) * dstB) / 255;
                 dstA = srcA + ((255 - srcA) * dstA) / 255;
                 break;
+            case SDL_COPY_PREMULTIPLIED:
+                dstR = srcR + ((255 - srcA) * dstR) / 255; if (dstR > 255) dstR = 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255; if (dstG > 255) dstG = 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255; if (dstB > 255) dstB = 255;
+                dstA = srcA + ((255 - srcA) * dstA) / 255;
+                break;
             case SDL_COPY_ADD:
                 dstR = srcR + dstR; if (dstR > 255) dstR = 255;
                 dstG = srcG + dstG; if (dstG > 255) dstG = 255;
@@ -3277,6 +3553,12 @@ static void SDL_Blit_ARGB8888_BGR888_Modulate_Blend_Scale(SDL_BlitInfo *info)
             if (flags & SDL_COPY_MODULATE_ALPHA) {
                 srcA = (srcA * modulateA) / 255;
             }
+            if ((flags & (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) == (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) {
+                /* Premultiplied color fades along with its alpha */
+                srcR = (srcR * modulateA) / 255;
+                srcG = (srcG * modulateA) / 255;
+                srcB = (srcB * modulateA) / 255;
+            }
             if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
                 /* This goes away if we ever use premultiplied alpha */
                 if (srcA < 255) {
@@ -3285,13 +3567,19 @@ static void SDL_Blit_ARGB8888_BGR888_Modulate_Blend_Scale(SDL_BlitInfo *info)
                     srcB = (srcB * srcA) / 255;
                 }
             }
-            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
             case SDL_COPY_BLEND:
                 dstR = srcR + ((255 - srcA) * dstR) / 255;
                 dstG = srcG + ((255 - srcA) * dstG) / 255;
                 dstB = srcB + ((255 - srcA) * dstB) / 255;
                 dstA = srcA + ((255 - srcA) * dstA) / 255;
                 break;
+            case SDL_COPY_PREMULTIPLIED:
+                dstR = srcR + ((255 - srcA) * dstR) / 255; if (dstR > 255) dstR = 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255; if (dstG > 255) dstG = 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255; if (dstB > 255) dstB = 255;
+                dstA = srcA + ((255 - srcA) * dstA) / 255;
+                break;
             case SDL_COPY_ADD:
                 dstR = srcR + dstR; if (dstR > 255) dstR = 255;
                 dstG = srcG + dstG; if (dstG > 255) dstG = 255;
@@ -3376,13 +3664,19 @@ static void SDL_Blit_ARGB8888_ARGB8888_Blend(SDL_BlitInfo *info)
                     srcB = (srcB * srcA) / 255;
                 }
             }
-            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
             case SDL_COPY_BLEND:
                 dstR = srcR + ((255 - srcA) * dstR) / 255;
                 dstG = srcG + ((255 - srcA) * dstG) / 255;
                 dstB = srcB + ((255 - srcA) * dstB) / 255;
                 dstA = srcA + ((255 - srcA) * dstA) / 255;
                 break;
+            case SDL_COPY_PREMULTIPLIED:
+                dstR = srcR + ((255 - srcA) * dstR) / 255; if (dstR > 255) dstR = 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255; if (dstG > 255) dstG = 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255; if (dstB > 255) dstB = 255;
+                dstA = srcA + ((255 - srcA) * dstA) / 255;
+                break;
             case SDL_COPY_ADD:
                 dstR = srcR + dstR; if (dstR > 255) dstR = 255;
                 dstG = srcG + dstG; if (dstG > 255) dstG = 255;
@@ -3450,13 +3744,19 @@ static void SDL_Blit_ARGB8888_ARGB8888_Blend_Scale(SDL_BlitInfo *info)
                     srcB = (srcB * srcA) / 255;
                 }
             }
-            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
             case SDL_COPY_BLEND:
                 dstR = srcR + ((255 - srcA) * dstR) / 255;
                 dstG = srcG + ((255 - srcA) * dstG) / 255;
                 dstB = srcB + ((255 - srcA) * dstB) / 255;
                 dstA = srcA + ((255 - srcA) * dstA) / 255;
                 break;
+            case SDL_COPY_PREMULTIPLIED:
+                dstR = srcR + ((255 - srcA) * dstR) / 255; if (dstR > 255) dstR = 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255; if (dstG > 255) dstG = 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255; if (dstB > 255) dstB = 255;
+                dstA = srcA + ((255 - srcA) * dstA) / 255;
+                break;
             case SDL_COPY_ADD:
                 dstR = srcR + dstR; if (dstR > 255) dstR = 255;
                 dstG = srcG + dstG; if (dstG > 255) dstG = 255;
@@ -3598,6 +3898,12 @@ static void SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend(SDL_BlitInfo *info)
             if (flags & SDL_COPY_MODULATE_ALPHA) {
                 srcA = (srcA * modulateA) / 255;
             }
+            if ((flags & (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) == (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) {
+                /* Premultiplied color fades along with its alpha */
+                srcR = (srcR * modulateA) / 255;
+                srcG = (srcG * modulateA) / 255;
+                srcB = (srcB * modulateA) / 255;
+            }
             if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
                 /* This goes away if we ever use premultiplied alpha */
                 if (srcA < 255) {
@@ -3606,13 +3912,19 @@ static void SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend(SDL_BlitInfo *info)
                     srcB = (srcB * srcA) / 255;
                 }
             }
-            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
             case SDL_COPY_BLEND:
                 dstR = srcR + ((255 - srcA) * dstR) / 255;
                 dstG = srcG + ((255 - srcA) * dstG) / 255;
                 dstB = srcB + ((255 - srcA) * dstB) / 255;
                 dstA = srcA + ((255 - srcA) * dstA) / 255;
                 break;
+            case SDL_COPY_PREMULTIPLIED:
+                dstR = srcR + ((255 - srcA) * dstR) / 255; if (dstR > 255) dstR = 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255; if (dstG > 255) dstG = 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255; if (dstB > 255) dstB = 255;
+                dstA = srcA + ((255 - srcA) * dstA) / 255;
+                break;
             case SDL_COPY_ADD:
                 dstR = srcR + dstR; if (dstR > 255) dstR = 255;
                 dstG = srcG + dstG; if (dstG > 255) dstG = 255;
@@ -3684,6 +3996,12 @@ static void SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
             if (flags & SDL_COPY_MODULATE_ALPHA) {
                 srcA = (srcA * modulateA) / 255;
             }
+            if ((flags & (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) == (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) {
+                /* Premultiplied color fades along with its alpha */
+                srcR = (srcR * modulateA) / 255;
+                srcG = (srcG * modulateA) / 255;
+                srcB = (srcB * modulateA) / 255;
+            }
             if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
                 /* This goes away if we ever use premultiplied alpha */
                 if (srcA < 255) {
@@ -3692,13 +4010,19 @@ static void SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
                     srcB = (srcB * srcA) / 255;
                 }
             }
-            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
             case SDL_COPY_BLEND:
                 dstR = srcR + ((255 - srcA) * dstR) / 255;
                 dstG = srcG + ((255 - srcA) * dstG) / 255;
                 dstB = srcB + ((255 - srcA) * dstB) / 255;
                 dstA = srcA + ((255 - srcA) * dstA) / 255;
                 break;
+            case SDL_COPY_PREMULTIPLIED:
+                dstR = srcR + ((255 - srcA) * dstR) / 255; if (dstR > 255) dstR = 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255; if (dstG > 255) dstG = 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255; if (dstB > 255) dstB = 255;
+                dstA = srcA + ((255 - srcA) * dstA) / 255;
+                break;
             case SDL_COPY_ADD:
                 dstR = srcR + dstR; if (dstR > 255) dstR = 255;
                 dstG = srcG + dstG; if (dstG > 255) dstG = 255;
@@ -3788,13 +4112,19 @@ static void SDL_Blit_RGBA8888_RGB888_Blend(SDL_BlitInfo *info)
                     srcB = (srcB * srcA) / 255;
                 }
             }
-            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
             case SDL_COPY_BLEND:
                 dstR = srcR + ((255 - srcA) * dstR) / 255;
                 dstG = srcG + ((255 - srcA) * dstG) / 255;
                 dstB = srcB + ((255 - srcA) * dstB) / 255;
                 dstA = srcA + ((255 - srcA) * dstA) / 255;
                 break;
+            case SDL_COPY_PREMULTIPLIED:
+                dstR = srcR + ((255 - srcA) * dstR) / 255; if (dstR > 255) dstR = 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255; if (dstG > 255) dstG = 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255; if (dstB > 255) dstB = 255;
+                dstA = srcA + ((255 - srcA) * dstA) / 255;
+                break;
             case SDL_COPY_ADD:
                 dstR = srcR + dstR; if (dstR > 255) dstR = 255;
                 dstG = srcG + dstG; if (dstG > 255) dstG = 255;
@@ -3862,13 +4192,19 @@ static void SDL_Blit_RGBA8888_RGB888_Blend_Scale(SDL_BlitInfo *info)
                     srcB = (srcB * srcA) / 255;
                 }
             }
-            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
             case SDL_COPY_BLEND:
                 dstR = srcR + ((255 - srcA) * dstR) / 255;
                 dstG = srcG + ((255 - srcA) * dstG) / 255;
                 dstB = srcB + ((255 - srcA) * dstB) / 255;
                 dstA = srcA + ((255 - srcA) * dstA) / 255;
                 break;
+            case SDL_COPY_PREMULTIPLIED:
+                dstR = srcR + ((255 - srcA) * dstR) / 255; if (dstR > 255) dstR = 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255; if (dstG > 255) dstG = 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255; if (dstB > 255) dstB = 255;
+                dstA = srcA + ((255 - srcA) * dstA) / 255;
+                break;
             case SDL_COPY_ADD:
                 dstR = srcR + dstR; if (dstR > 255) dstR = 255;
                 dstG = srcG + dstG; if (dstG > 255) dstG = 255;
@@ -4010,6 +4346,12 @@ static void SDL_Blit_RGBA8888_RGB888_Modulate_Blend(SDL_BlitInfo *info)
             if (flags & SDL_COPY_MODULATE_ALPHA) {
                 srcA = (srcA * modulateA) / 255;
             }
+            if ((flags & (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) == (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) {
+                /* Premultiplied color fades along with its alpha */
+                srcR = (srcR * modulateA) / 255;
+                srcG = (srcG * modulateA) / 255;
+                srcB = (srcB * modulateA) / 255;
+            }
             if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
                 /* This goes away if we ever use premultiplied alpha */
                 if (srcA < 255) {
@@ -4018,13 +4360,19 @@ static void SDL_Blit_RGBA8888_RGB888_Modulate_Blend(SDL_BlitInfo *info)
                     srcB = (srcB * srcA) / 255;
                 }
             }
-            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
             case SDL_COPY_BLEND:
                 dstR = srcR + ((255 - srcA) * dstR) / 255;
                 dstG = srcG + ((255 - srcA) * dstG) / 255;
                 dstB = srcB + ((255 - srcA) * dstB) / 255;
                 dstA = srcA + ((255 - srcA) * dstA) / 255;
                 break;
+            case SDL_COPY_PREMULTIPLIED:
+                dstR = srcR + ((255 - srcA) * dstR) / 255; if (dstR > 255) dstR = 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255; if (dstG > 255) dstG = 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255; if (dstB > 255) dstB = 255;
+                dstA = srcA + ((255 - srcA) * dstA) / 255;
+                break;
             case SDL_COPY_ADD:
                 dstR = srcR + dstR; if (dstR > 255) dstR = 255;
                 dstG = srcG + dstG; if (dstG > 255) dstG = 255;
@@ -4096,6 +4444,12 @@ static void SDL_Blit_RGBA8888_RGB888_Modulate_Blend_Scale(SDL_BlitInfo *info)
             if (flags & SDL_COPY_MODULATE_ALPHA) {
                 srcA = (srcA * modulateA) / 255;
             }
+            if ((flags & (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) == (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) {
+                /* Premultiplied color fades along with its alpha */
+                srcR = (srcR * modulateA) / 255;
+                srcG = (srcG * modulateA) / 255;
+                srcB = (srcB * modulateA) / 255;
+            }
             if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
                 /* This goes away if we ever use premultiplied alpha */
                 if (srcA < 255) {
@@ -4104,13 +4458,19 @@ static void SDL_Blit_RGBA8888_RGB888_Modulate_Blend_Scale(SDL_BlitInfo *info)
                     srcB = (srcB * srcA) / 255;
                 }
             }
-            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
             case SDL_COPY_BLEND:
                 dstR = srcR + ((255 - srcA) * dstR) / 255;
                 dstG = srcG + ((255 - srcA) * dstG) / 255;
                 dstB = srcB + ((255 - srcA) * dstB) / 255;
                 dstA = srcA + ((255 - srcA) * dstA) / 255;
                 break;
+            case SDL_COPY_PREMULTIPLIED:
+                dstR = srcR + ((255 - srcA) * dstR) / 255; if (dstR > 255) dstR = 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255; if (dstG > 255) dstG = 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255; if (dstB > 255) dstB = 255;
+                dstA = srcA + ((255 - srcA) * dstA) / 255;
+                break;
             case SDL_COPY_ADD:
                 dstR = srcR + dstR; if (dstR > 255) dstR = 255;
                 dstG = srcG + dstG; if (dstG > 255) dstG = 255;
@@ -4200,13 +4560,19 @@ static void SDL_Blit_RGBA8888_BGR888_Blend(SDL_BlitInfo *info)
                     srcB = (srcB * srcA) / 255;
                 }
             }
-            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
             case SDL_COPY_BLEND:
                 dstR = srcR + ((255 - srcA) * dstR) / 255;
                 dstG = srcG + ((255 - srcA) * dstG) / 255;
                 dstB = srcB + ((255 - srcA) * dstB) / 255;
                 dstA = srcA + ((255 - srcA) * dstA) / 255;
                 break;
+            case SDL_COPY_PREMULTIPLIED:
+                dstR = srcR + ((255 - srcA) * dstR) / 255; if (dstR > 255) dstR = 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255; if (dstG > 255) dstG = 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255; if (dstB > 255) dstB = 255;
+                dstA = srcA + ((255 - srcA) * dstA) / 255;
+                break;
             case SDL_COPY_ADD:
                 dstR = srcR + dstR; if (dstR > 255) dstR = 255;
                 dstG = srcG + dstG; if (dstG > 255) dstG = 255;
@@ -4274,13 +4640,19 @@ static void SDL_Blit_RGBA8888_BGR888_Blend_Scale(SDL_BlitInfo *info)
                     srcB = (srcB * srcA) / 255;
                 }
             }
-            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
             case SDL_COPY_BLEND:
                 dstR = srcR + ((255 - srcA) * dstR) / 255;
                 dstG = srcG + ((255 - srcA) * dstG) / 255;
                 dstB = srcB + ((255 - srcA) * dstB) / 255;
                 dstA = srcA + ((255 - srcA) * dstA) / 255;
                 break;
+            case SDL_COPY_PREMULTIPLIED:
+                dstR = srcR + ((255 - srcA) * dstR) / 255; if (dstR > 255) dstR = 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255; if (dstG > 255) dstG = 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255; if (dstB > 255) dstB = 255;
+                dstA = srcA + ((255 - srcA) * dstA) / 255;
+                break;
             case SDL_COPY_ADD:
                 dstR = srcR + dstR; if (dstR > 255) dstR = 255;
                 dstG = srcG + dstG; if (dstG > 255) dstG = 255;
@@ -4422,6 +4794,12 @@ static void SDL_Blit_RGBA8888_BGR888_Modulate_Blend(SDL_BlitInfo *info)
             if (flags & SDL_COPY_MODULATE_ALPHA) {
                 srcA = (srcA * modulateA) / 255;
             }
+            if ((flags & (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) == (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) {
+                /* Premultiplied color fades along with its alpha */
+                srcR = (srcR * modulateA) / 255;
+                srcG = (srcG * modulateA) / 255;
+                srcB = (srcB * modulateA) / 255;
+            }
             if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
                 /* This goes away if we ever use premultiplied alpha */
                 if (srcA < 255) {
@@ -4430,13 +4808,19 @@ static void SDL_Blit_RGBA8888_BGR888_Modulate_Blend(SDL_BlitInfo *info)
                     srcB = (srcB * srcA) / 255;
                 }
             }
-            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
             case SDL_COPY_BLEND:
                 dstR = srcR + ((255 - srcA) * dstR) / 255;
                 dstG = srcG + ((255 - srcA) * dstG) / 255;
                 dstB = srcB + ((255 - srcA) * dstB) / 255;
                 dstA = srcA + ((255 - srcA) * dstA) / 255;
                 break;
+            case SDL_COPY_PREMULTIPLIED:
+                dstR = srcR + ((255 - srcA) * dstR) / 255; if (dstR > 255) dstR = 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255; if (dstG > 255) dstG = 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255; if (dstB > 255) dstB = 255;
+                dstA = srcA + ((255 - srcA) * dstA) / 255;
+                break;
             case SDL_COPY_ADD:
                 dstR = srcR + dstR; if (dstR > 255) dstR = 255;
                 dstG = srcG + dstG; if (dstG > 255) dstG = 255;
@@ -4508,6 +4892,12 @@ static void SDL_Blit_RGBA8888_BGR888_Modulate_Blend_Scale(SDL_BlitInfo *info)
             if (flags & SDL_COPY_MODULATE_ALPHA) {
                 srcA = (srcA * modulateA) / 255;
             }
+            if ((flags & (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) == (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) {
+                /* Premultiplied color fades along with its alpha */
+                srcR = (srcR * modulateA) / 255;
+                srcG = (srcG * modulateA) / 255;
+                srcB = (srcB * modulateA) / 255;
+            }
             if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
                 /* This goes away if we ever use premultiplied alpha */
                 if (srcA < 255) {
@@ -4516,13 +4906,19 @@ static void SDL_Blit_RGBA8888_BGR888_Modulate_Blend_Scale(SDL_BlitInfo *info)
                     srcB = (srcB * srcA) / 255;
                 }
             }
-            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
             case SDL_COPY_BLEND:
                 dstR = srcR + ((255 - srcA) * dstR) / 255;
                 dstG = srcG + ((255 - srcA) * dstG) / 255;
                 dstB = srcB + ((255 - srcA) * dstB) / 255;
                 dstA = srcA + ((255 - srcA) * dstA) / 255;
                 break;
+            case SDL_COPY_PREMULTIPLIED:
+                dstR = srcR + ((255 - srcA) * dstR) / 255; if (dstR > 255) dstR = 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255; if (dstG > 255) dstG = 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255; if (dstB > 255) dstB = 255;
+                dstA = srcA + ((255 - srcA) * dstA) / 255;
+                break;
             case SDL_COPY_ADD:
                 dstR = srcR + dstR; if (dstR > 255) dstR = 255;
                 dstG = srcG + dstG; if (dstG > 255) dstG = 255;
@@ -4612,13 +5008,19 @@ static void SDL_Blit_RGBA8888_ARGB8888_Blend(SDL_BlitInfo *info)
                     srcB = (srcB * srcA) / 255;
                 }
             }
-            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
             case SDL_COPY_BLEND:
                 dstR = srcR + ((255 - srcA) * dstR) / 255;
                 dstG = srcG + ((255 - srcA) * dstG) / 255;
                 dstB = srcB + ((255 - srcA) * dstB) / 255;
                 dstA = srcA + ((255 - srcA) * dstA) / 255;
                 break;
+            case SDL_COPY_PREMULTIPLIED:
+                dstR = srcR + ((255 - srcA) * dstR) / 255; if (dstR > 255) dstR = 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255; if (dstG > 255) dstG = 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255; if (dstB > 255) dstB = 255;
+                dstA = srcA + ((255 - srcA) * dstA) / 255;
+                break;
             case SDL_COPY_ADD:
                 dstR = srcR + dstR; if (dstR > 255) dstR = 255;
                 dstG = srcG + dstG; if (dstG > 255) dstG = 255;
@@ -4686,13 +5088,19 @@ static void SDL_Blit_RGBA8888_ARGB8888_Blend_Scale(SDL_BlitInfo *info)
                     srcB = (srcB * srcA) / 255;
                 }
             }
-            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
             case SDL_COPY_BLEND:
                 dstR = srcR + ((255 - srcA) * dstR) / 255;
                 dstG = srcG + ((255 - srcA) * dstG) / 255;
                 dstB = srcB + ((255 - srcA) * dstB) / 255;
                 dstA = srcA + ((255 - srcA) * dstA) / 255;
                 break;
+            case SDL_COPY_PREMULTIPLIED:
+                dstR = srcR + ((255 - srcA) * dstR) / 255; if (dstR > 255) dstR = 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255; if (dstG > 255) dstG = 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255; if (dstB > 255) dstB = 255;
+                dstA = srcA + ((255 - srcA) * dstA) / 255;
+                break;
             case SDL_COPY_ADD:
                 dstR = srcR + dstR; if (dstR > 255) dstR = 255;
                 dstG = srcG + dstG; if (dstG > 255) dstG = 255;
@@ -4834,6 +5242,12 @@ static void SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend(SDL_BlitInfo *info)
             if (flags & SDL_COPY_MODULATE_ALPHA) {
                 srcA = (srcA * modulateA) / 255;
             }
+            if ((flags & (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) == (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) {
+                /* Premultiplied color fades along with its alpha */
+                srcR = (srcR * modulateA) / 255;
+                srcG = (srcG * modulateA) / 255;
+                srcB = (srcB * modulateA) / 255;
+            }
             if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
                 /* This goes away if we ever use premultiplied alpha */
                 if (srcA < 255) {
@@ -4842,13 +5256,19 @@ static void SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend(SDL_BlitInfo *info)
                     srcB = (srcB * srcA) / 255;
                 }
             }
-            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
             case SDL_COPY_BLEND:
                 dstR = srcR + ((255 - srcA) * dstR) / 255;
                 dstG = srcG + ((255 - srcA) * dstG) / 255;
                 dstB = srcB + ((255 - srcA) * dstB) / 255;
                 dstA = srcA + ((255 - srcA) * dstA) / 255;
                 break;
+            case SDL_COPY_PREMULTIPLIED:
+                dstR = srcR + ((255 - srcA) * dstR) / 255; if (dstR > 255) dstR = 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255; if (dstG > 255) dstG = 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255; if (dstB > 255) dstB = 255;
+                dstA = srcA + ((255 - srcA) * dstA) / 255;
+                break;
             case SDL_COPY_ADD:
                 dstR = srcR + dstR; if (dstR > 255) dstR = 255;
                 dstG = srcG + dstG; if (dstG > 255) dstG = 255;
@@ -4920,6 +5340,12 @@ static void SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
             if (flags & SDL_COPY_MODULATE_ALPHA) {
                 srcA = (srcA * modulateA) / 255;
             }
+            if ((flags & (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) == (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) {
+                /* Premultiplied color fades along with its alpha */
+                srcR = (srcR * modulateA) / 255;
+                srcG = (srcG * modulateA) / 255;
+                srcB = (srcB * modulateA) / 255;
+            }
             if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
                 /* This goes away if we ever use premultiplied alpha */
                 if (srcA < 255) {
@@ -4928,13 +5354,19 @@ static void SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
                     srcB = (srcB * srcA) / 255;
                 }
             }
-            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
             case SDL_COPY_BLEND:
                 dstR = srcR + ((255 - srcA) * dstR) / 255;
                 dstG = srcG + ((255 - srcA) * dstG) / 255;
                 dstB = srcB + ((255 - srcA) * dstB) / 255;
                 dstA = srcA + ((255 - srcA) * dstA) / 255;
                 break;
+            case SDL_COPY_PREMULTIPLIED:
+                dstR = srcR + ((255 - srcA) * dstR) / 255; if (dstR > 255) dstR = 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255; if (dstG > 255) dstG = 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255; if (dstB > 255) dstB = 255;
+                dstA = srcA + ((255 - srcA) * dstA) / 255;
+                break;
             case SDL_COPY_ADD:
                 dstR = srcR + dstR; if (dstR > 255) dstR = 255;
                 dstG = srcG + dstG; if (dstG > 255) dstG = 255;
@@ -5024,13 +5456,19 @@ static void SDL_Blit_ABGR8888_RGB888_Blend(SDL_BlitInfo *info)
                     srcB = (srcB * srcA) / 255;
                 }
             }
-            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
             case SDL_COPY_BLEND:
                 dstR = srcR + ((255 - srcA) * dstR) / 255;
                 dstG = srcG + ((255 - srcA) * dstG) / 255;
                 dstB = srcB + ((255 - srcA) * dstB) / 255;
                 dstA = srcA + ((255 - srcA) * dstA) / 255;
                 break;
+            case SDL_COPY_PREMULTIPLIED:
+                dstR = srcR + ((255 - srcA) * dstR) / 255; if (dstR > 255) dstR = 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255; if (dstG > 255) dstG = 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255; if (dstB > 255) dstB = 255;
+                dstA = srcA + ((255 - srcA) * dstA) / 255;
+                break;
             case SDL_COPY_ADD:
                 dstR = srcR + dstR; if (dstR > 255) dstR = 255;
                 dstG = srcG + dstG; if (dstG > 255) dstG = 255;
@@ -5098,13 +5536,19 @@ static void SDL_Blit_ABGR8888_RGB888_Blend_Scale(SDL_BlitInfo *info)
                     srcB = (srcB * srcA) / 255;
                 }
             }
-            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
             case SDL_COPY_BLEND:
                 dstR = srcR + ((255 - srcA) * dstR) / 255;
                 dstG = srcG + ((255 - srcA) * dstG) / 255;
                 dstB = srcB + ((255 - srcA) * dstB) / 255;
                 dstA = srcA + ((255 - srcA) * dstA) / 255;
                 break;
+            case SDL_COPY_PREMULTIPLIED:
+                dstR = srcR + ((255 - srcA) * dstR) / 255; if (dstR > 255) dstR = 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255; if (dstG > 255) dstG = 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255; if (dstB > 255) dstB = 255;
+                dstA = srcA + ((255 - srcA) * dstA) / 255;
+                break;
             case SDL_COPY_ADD:
                 dstR = srcR + dstR; if (dstR > 255) dstR = 255;
                 dstG = srcG + dstG; if (dstG > 255) dstG = 255;
@@ -5246,6 +5690,12 @@ static void SDL_Blit_ABGR8888_RGB888_Modulate_Blend(SDL_BlitInfo *info)
             if (flags & SDL_COPY_MODULATE_ALPHA) {
                 srcA = (srcA * modulateA) / 255;
             }
+            if ((flags & (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) == (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) {
+                /* Premultiplied color fades along with its alpha */
+                srcR = (srcR * modulateA) / 255;
+                srcG = (srcG * modulateA) / 255;
+                srcB = (srcB * modulateA) / 255;
+            }
             if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
                 /* This goes away if we ever use premultiplied alpha */
                 if (srcA < 255) {
@@ -5254,13 +5704,19 @@ static void SDL_Blit_ABGR8888_RGB888_Modulate_Blend(SDL_BlitInfo *info)
                     srcB = (srcB * srcA) / 255;
                 }
             }
-            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
             case SDL_COPY_BLEND:
                 dstR = srcR + ((255 - srcA) * dstR) / 255;
                 dstG = srcG + ((255 - srcA) * dstG) / 255;
                 dstB = srcB + ((255 - srcA) * dstB) / 255;
                 dstA = srcA + ((255 - srcA) * dstA) / 255;
                 break;
+            case SDL_COPY_PREMULTIPLIED:
+                dstR = srcR + ((255 - srcA) * dstR) / 255; if (dstR > 255) dstR = 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255; if (dstG > 255) dstG = 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255; if (dstB > 255) dstB = 255;
+                dstA = srcA + ((255 - srcA) * dstA) / 255;
+                break;
             case SDL_COPY_ADD:
                 dstR = srcR + dstR; if (dstR > 255) dstR = 255;
                 dstG = srcG + dstG; if (dstG > 255) dstG = 255;
@@ -5332,6 +5788,12 @@ static void SDL_Blit_ABGR8888_RGB888_Modulate_Blend_Scale(SDL_BlitInfo *info)
             if (flags & SDL_COPY_MODULATE_ALPHA) {
                 srcA = (srcA * modulateA) / 255;
             }
+            if ((flags & (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) == (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) {
+                /* Premultiplied color fades along with its alpha */
+                srcR = (srcR * modulateA) / 255;
+                srcG = (srcG * modulateA) / 255;
+                srcB = (srcB * modulateA) / 255;
+            }
             if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
                 /* This goes away if we ever use premultiplied alpha */
                 if (srcA < 255) {
@@ -5340,13 +5802,19 @@ static void SDL_Blit_ABGR8888_RGB888_Modulate_Blend_Scale(SDL_BlitInfo *info)
                     srcB = (srcB * srcA) / 255;
                 }
             }
-            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
             case SDL_COPY_BLEND:
                 dstR = srcR + ((255 - srcA) * dstR) / 255;
                 dstG = srcG + ((255 - srcA) * dstG) / 255;
                 dstB = srcB + ((255 - srcA) * dstB) / 255;
                 dstA = srcA + ((255 - srcA) * dstA) / 255;
                 break;
+            case SDL_COPY_PREMULTIPLIED:
+                dstR = srcR + ((255 - srcA) * dstR) / 255; if (dstR > 255) dstR = 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255; if (dstG > 255) dstG = 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255; if (dstB > 255) dstB = 255;
+                dstA = srcA + ((255 - srcA) * dstA) / 255;
+                break;
             case SDL_COPY_ADD:
                 dstR = srcR + dstR; if (dstR > 255) dstR = 255;
                 dstG = srcG + dstG; if (dstG > 255) dstG = 255;
@@ -5436,13 +5904,19 @@ static void SDL_Blit_ABGR8888_BGR888_Blend(SDL_BlitInfo *info)
                     srcB = (srcB * srcA) / 255;
                 }
             }
-            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
             case SDL_COPY_BLEND:
                 dstR = srcR + ((255 - srcA) * dstR) / 255;
                 dstG = srcG + ((255 - srcA) * dstG) / 255;
                 dstB = srcB + ((255 - srcA) * dstB) / 255;
                 dstA = srcA + ((255 - srcA) * dstA) / 255;
                 break;
+            case SDL_COPY_PREMULTIPLIED:
+                dstR = srcR + ((255 - srcA) * dstR) / 255; if (dstR > 255) dstR = 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255; if (dstG > 255) dstG = 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255; if (dstB > 255) dstB = 255;
+                dstA = srcA + ((255 - srcA) * dstA) / 255;
+                break;
             case SDL_COPY_ADD:
                 dstR = srcR + dstR; if (dstR > 255) dstR = 255;
                 dstG = srcG + dstG; if (dstG > 255) dstG = 255;
@@ -5510,13 +5984,19 @@ static void SDL_Blit_ABGR8888_BGR888_Blend_Scale(SDL_BlitInfo *info)
                     srcB = (srcB * srcA) / 255;
                 }
             }
-            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
             case SDL_COPY_BLEND:
                 dstR = srcR + ((255 - srcA) * dstR) / 255;
                 dstG = srcG + ((255 - srcA) * dstG) / 255;
                 dstB = srcB + ((255 - srcA) * dstB) / 255;
                 dstA = srcA + ((255 - srcA) * dstA) / 255;
                 break;
+            case SDL_COPY_PREMULTIPLIED:
+                dstR = srcR + ((255 - srcA) * dstR) / 255; if (dstR > 255) dstR = 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255; if (dstG > 255) dstG = 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255; if (dstB > 255) dstB = 255;
+                dstA = srcA + ((255 - srcA) * dstA) / 255;
+                break;
             case SDL_COPY_ADD:
                 dstR = srcR + dstR; if (dstR > 255) dstR = 255;
                 dstG = srcG + dstG; if (dstG > 255) dstG = 255;
@@ -5658,6 +6138,12 @@ static void SDL_Blit_ABGR8888_BGR888_Modulate_Blend(SDL_BlitInfo *info)
             if (flags & SDL_COPY_MODULATE_ALPHA) {
                 srcA = (srcA * modulateA) / 255;
             }
+            if ((flags & (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) == (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) {
+                /* Premultiplied color fades along with its alpha */
+                srcR = (srcR * modulateA) / 255;
+                srcG = (srcG * modulateA) / 255;
+                srcB = (srcB * modulateA) / 255;
+            }
             if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
                 /* This goes away if we ever use premultiplied alpha */
                 if (srcA < 255) {
@@ -5666,13 +6152,19 @@ static void SDL_Blit_ABGR8888_BGR888_Modulate_Blend(SDL_BlitInfo *info)
                     srcB = (srcB * srcA) / 255;
                 }
             }
-            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
             case SDL_COPY_BLEND:
                 dstR = srcR + ((255 - srcA) * dstR) / 255;
                 dstG = srcG + ((255 - srcA) * dstG) / 255;
                 dstB = srcB + ((255 - srcA) * dstB) / 255;
                 dstA = srcA + ((255 - srcA) * dstA) / 255;
                 break;
+            case SDL_COPY_PREMULTIPLIED:
+                dstR = srcR + ((255 - srcA) * dstR) / 255; if (dstR > 255) dstR = 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255; if (dstG > 255) dstG = 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255; if (dstB > 255) dstB = 255;
+                dstA = srcA + ((255 - srcA) * dstA) / 255;
+                break;
             case SDL_COPY_ADD:
                 dstR = srcR + dstR; if (dstR > 255) dstR = 255;
                 dstG = srcG + dstG; if (dstG > 255) dstG = 255;
@@ -5744,6 +6236,12 @@ static void SDL_Blit_ABGR8888_BGR888_Modulate_Blend_Scale(SDL_BlitInfo *info)
             if (flags & SDL_COPY_MODULATE_ALPHA) {
                 srcA = (srcA * modulateA) / 255;
             }
+            if ((flags & (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) == (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) {
+                /* Premultiplied color fades along with its alpha */
+                srcR = (srcR * modulateA) / 255;
+                srcG = (srcG * modulateA) / 255;
+                srcB = (srcB * modulateA) / 255;
+            }
             if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
                 /* This goes away if we ever use premultiplied alpha */
                 if (srcA < 255) {
@@ -5752,13 +6250,19 @@ static void SDL_Blit_ABGR8888_BGR888_Modulate_Blend_Scale(SDL_BlitInfo *info)
                     srcB = (srcB * srcA) / 255;
                 }
             }
-            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
             case SDL_COPY_BLEND:
                 dstR = srcR + ((255 - srcA) * dstR) / 255;
                 dstG = srcG + ((255 - srcA) * dstG) / 255;
                 dstB = srcB + ((255 - srcA) * dstB) / 255;
                 dstA = srcA + ((255 - srcA) * dstA) / 255;
                 break;
+            case SDL_COPY_PREMULTIPLIED:
+                dstR = srcR + ((255 - srcA) * dstR) / 255; if (dstR > 255) dstR = 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255; if (dstG > 255) dstG = 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255; if (dstB > 255) dstB = 255;
+                dstA = srcA + ((255 - srcA) * dstA) / 255;
+                break;
             case SDL_COPY_ADD:
                 dstR = srcR + dstR; if (dstR > 255) dstR = 255;
                 dstG = srcG + dstG; if (dstG > 255) dstG = 255;
@@ -5848,13 +6352,19 @@ static void SDL_Blit_ABGR8888_ARGB8888_Blend(SDL_BlitInfo *info)
                     srcB = (srcB * srcA) / 255;
                 }
             }
-            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
             case SDL_COPY_BLEND:
                 dstR = srcR + ((255 - srcA) * dstR) / 255;
                 dstG = srcG + ((255 - srcA) * dstG) / 255;
                 dstB = srcB + ((255 - srcA) * dstB) / 255;
                 dstA = srcA + ((255 - srcA) * dstA) / 255;
                 break;
+            case SDL_COPY_PREMULTIPLIED:
+                dstR = srcR + ((255 - srcA) * dstR) / 255; if (dstR > 255) dstR = 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255; if (dstG > 255) dstG = 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255; if (dstB > 255) dstB = 255;
+                dstA = srcA + ((255 - srcA) * dstA) / 255;
+                break;
             case SDL_COPY_ADD:
                 dstR = srcR + dstR; if (dstR > 255) dstR = 255;
                 dstG = srcG + dstG; if (dstG > 255) dstG = 255;
@@ -5922,13 +6432,19 @@ static void SDL_Blit_ABGR8888_ARGB8888_Blend_Scale(SDL_BlitInfo *info)
                     srcB = (srcB * srcA) / 255;
                 }
             }
-            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
             case SDL_COPY_BLEND:
                 dstR = srcR + ((255 - srcA) * dstR) / 255;
                 dstG = srcG + ((255 - srcA) * dstG) / 255;
                 dstB = srcB + ((255 - srcA) * dstB) / 255;
                 dstA = srcA + ((255 - srcA) * dstA) / 255;
                 break;
+            case SDL_COPY_PREMULTIPLIED:
+                dstR = srcR + ((255 - srcA) * dstR) / 255; if (dstR > 255) dstR = 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255; if (dstG > 255) dstG = 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255; if (dstB > 255) dstB = 255;
+                dstA = srcA + ((255 - srcA) * dstA) / 255;
+                break;
             case SDL_COPY_ADD:
                 dstR = srcR + dstR; if (dstR > 255) dstR = 255;
                 dstG = srcG + dstG; if (dstG > 255) dstG = 255;
@@ -6070,6 +6586,12 @@ static void SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend(SDL_BlitInfo *info)
             if (flags & SDL_COPY_MODULATE_ALPHA) {
                 srcA = (srcA * modulateA) / 255;
             }
+            if ((flags & (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) == (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) {
+                /* Premultiplied color fades along with its alpha */
+                srcR = (srcR * modulateA) / 255;
+                srcG = (srcG * modulateA) / 255;
+                srcB = (srcB * modulateA) / 255;
+            }
             if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
                 /* This goes away if we ever use premultiplied alpha */
                 if (srcA < 255) {
@@ -6078,13 +6600,19 @@ static void SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend(SDL_BlitInfo *info)
                     srcB = (srcB * srcA) / 255;
                 }
             }
-            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
             case SDL_COPY_BLEND:
                 dstR = srcR + ((255 - srcA) * dstR) / 255;
                 dstG = srcG + ((255 - srcA) * dstG) / 255;
                 dstB = srcB + ((255 - srcA) * dstB) / 255;
                 dstA = srcA + ((255 - srcA) * dstA) / 255;
                 break;
+            case SDL_COPY_PREMULTIPLIED:
+                dstR = srcR + ((255 - srcA) * dstR) / 255; if (dstR > 255) dstR = 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255; if (dstG > 255) dstG = 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255; if (dstB > 255) dstB = 255;
+                dstA = srcA + ((255 - srcA) * dstA) / 255;
+                break;
             case SDL_COPY_ADD:
                 dstR = srcR + dstR; if (dstR > 255) dstR = 255;
                 dstG = srcG + dstG; if (dstG > 255) dstG = 255;
@@ -6156,6 +6684,12 @@ static void SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
             if (flags & SDL_COPY_MODULATE_ALPHA) {
                 srcA = (srcA * modulateA) / 255;
             }
+            if ((flags & (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) == (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) {
+                /* Premultiplied color fades along with its alpha */
+                srcR = (srcR * modulateA) / 255;
+                srcG = (srcG * modulateA) / 255;
+                srcB = (srcB * modulateA) / 255;
+            }
             if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
                 /* This goes away if we ever use premultiplied alpha */
                 if (srcA < 255) {
@@ -6164,13 +6698,19 @@ static void SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
                     srcB = (srcB * srcA) / 255;
                 }
             }
-            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
             case SDL_COPY_BLEND:
                 dstR = srcR + ((255 - srcA) * dstR) / 255;
                 dstG = srcG + ((255 - srcA) * dstG) / 255;
                 dstB = srcB + ((255 - srcA) * dstB) / 255;
                 dstA = srcA + ((255 - srcA) * dstA) / 255;
                 break;
+            case SDL_COPY_PREMULTIPLIED:
+                dstR = srcR + ((255 - srcA) * dstR) / 255; if (dstR > 255) dstR = 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255; if (dstG > 255) dstG = 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255; if (dstB > 255) dstB = 255;
+                dstA = srcA + ((255 - srcA) * dstA) / 255;
+                break;
             case SDL_COPY_ADD:
                 dstR = srcR + dstR; if (dstR > 255) dstR = 255;
                 dstG = srcG + dstG; if (dstG > 255) dstG = 255;
@@ -6260,13 +6800,19 @@ static void SDL_Blit_BGRA8888_RGB888_Blend(SDL_BlitInfo *info)
                     srcB = (srcB * srcA) / 255;
                 }
             }
-            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
             case SDL_COPY_BLEND:
                 dstR = srcR + ((255 - srcA) * dstR) / 255;
                 dstG = srcG + ((255 - srcA) * dstG) / 255;
                 dstB = srcB + ((255 - srcA) * dstB) / 255;
                 dstA = srcA + ((255 - srcA) * dstA) / 255;
                 break;
+            case SDL_COPY_PREMULTIPLIED:
+                dstR = srcR + ((255 - srcA) * dstR) / 255; if (dstR > 255) dstR = 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255; if (dstG > 255) dstG = 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255; if (dstB > 255) dstB = 255;
+                dstA = srcA + ((255 - srcA) * dstA) / 255;
+                break;
             case SDL_COPY_ADD:
                 dstR = srcR + dstR; if (dstR > 255) dstR = 255;
                 dstG = srcG + dstG; if (dstG > 255) dstG = 255;
@@ -6334,13 +6880,19 @@ static void SDL_Blit_BGRA8888_RGB888_Blend_Scale(SDL_BlitInfo *info)
                     srcB = (srcB * srcA) / 255;
                 }
             }
-            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
             case SDL_COPY_BLEND:
                 dstR = srcR + ((255 - srcA) * dstR) / 255;
                 dstG = srcG + ((255 - srcA) * dstG) / 255;
                 dstB = srcB + ((255 - srcA) * dstB) / 255;
                 dstA = srcA + ((255 - srcA) * dstA) / 255;
                 break;
+            case SDL_COPY_PREMULTIPLIED:
+                dstR = srcR + ((255 - srcA) * dstR) / 255; if (dstR > 255) dstR = 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255; if (dstG > 255) dstG = 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255; if (dstB > 255) dstB = 255;
+                dstA = srcA + ((255 - srcA) * dstA) / 255;
+                break;
             case SDL_COPY_ADD:
                 dstR = srcR + dstR; if (dstR > 255) dstR = 255;
                 dstG = srcG + dstG; if (dstG > 255) dstG = 255;
@@ -6482,6 +7034,12 @@ static void SDL_Blit_BGRA8888_RGB888_Modulate_Blend(SDL_BlitInfo *info)
             if (flags & SDL_COPY_MODULATE_ALPHA) {
                 srcA = (srcA * modulateA) / 255;
             }
+            if ((flags & (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) == (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) {
+                /* Premultiplied color fades along with its alpha */
+                srcR = (srcR * modulateA) / 255;
+                srcG = (srcG * modulateA) / 255;
+                srcB = (srcB * modulateA) / 255;
+            }
             if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
                 /* This goes away if we ever use premultiplied alpha */
                 if (srcA < 255) {
@@ -6490,13 +7048,19 @@ static void SDL_Blit_BGRA8888_RGB888_Modulate_Blend(SDL_BlitInfo *info)
                     srcB = (srcB * srcA) / 255;
                 }
             }
-            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
             case SDL_COPY_BLEND:
                 dstR = srcR + ((255 - srcA) * dstR) / 255;
                 dstG = srcG + ((255 - srcA) * dstG) / 255;
                 dstB = srcB + ((255 - srcA) * dstB) / 255;
                 dstA = srcA + ((255 - srcA) * dstA) / 255;
                 break;
+            case SDL_COPY_PREMULTIPLIED:
+                dstR = srcR + ((255 - srcA) * dstR) / 255; if (dstR > 255) dstR = 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255; if (dstG > 255) dstG = 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255; if (dstB > 255) dstB = 255;
+                dstA = srcA + ((255 - srcA) * dstA) / 255;
+                break;
             case SDL_COPY_ADD:
                 dstR = srcR + dstR; if (dstR > 255) dstR = 255;
                 dstG = srcG + dstG; if (dstG > 255) dstG = 255;
@@ -6568,6 +7132,12 @@ static void SDL_Blit_BGRA8888_RGB888_Modulate_Blend_Scale(SDL_BlitInfo *info)
             if (flags & SDL_COPY_MODULATE_ALPHA) {
                 srcA = (srcA * modulateA) / 255;
             }
+            if ((flags & (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) == (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) {
+                /* Premultiplied color fades along with its alpha */
+                srcR = (srcR * modulateA) / 255;
+                srcG = (srcG * modulateA) / 255;
+                srcB = (srcB * modulateA) / 255;
+            }
             if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
                 /* This goes away if we ever use premultiplied alpha */
                 if (srcA < 255) {
@@ -6576,13 +7146,19 @@ static void SDL_Blit_BGRA8888_RGB888_Modulate_Blend_Scale(SDL_BlitInfo *info)
                     srcB = (srcB * srcA) / 255;
                 }
             }
-            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
             case SDL_COPY_BLEND:
                 dstR = srcR + ((255 - srcA) * dstR) / 255;
                 dstG = srcG + ((255 - srcA) * dstG) / 255;
                 dstB = srcB + ((255 - srcA) * dstB) / 255;
                 dstA = srcA + ((255 - srcA) * dstA) / 255;
                 break;
+            case SDL_COPY_PREMULTIPLIED:
+                dstR = srcR + ((255 - srcA) * dstR) / 255; if (dstR > 255) dstR = 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255; if (dstG > 255) dstG = 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255; if (dstB > 255) dstB = 255;
+                dstA = srcA + ((255 - srcA) * dstA) / 255;
+                break;
             case SDL_COPY_ADD:
                 dstR = srcR + dstR; if (dstR > 255) dstR = 255;
                 dstG = srcG + dstG; if (dstG > 255) dstG = 255;
@@ -6672,13 +7248,19 @@ static void SDL_Blit_BGRA8888_BGR888_Blend(SDL_BlitInfo *info)
                     srcB = (srcB * srcA) / 255;
                 }
             }
-            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
             case SDL_COPY_BLEND:
                 dstR = srcR + ((255 - srcA) * dstR) / 255;
                 dstG = srcG + ((255 - srcA) * dstG) / 255;
                 dstB = srcB + ((255 - srcA) * dstB) / 255;
                 dstA = srcA + ((255 - srcA) * dstA) / 255;
                 break;
+            case SDL_COPY_PREMULTIPLIED:
+                dstR = srcR + ((255 - srcA) * dstR) / 255; if (dstR > 255) dstR = 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255; if (dstG > 255) dstG = 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255; if (dstB > 255) dstB = 255;
+                dstA = srcA + ((255 - srcA) * dstA) / 255;
+                break;
             case SDL_COPY_ADD:
                 dstR = srcR + dstR; if (dstR > 255) dstR = 255;
                 dstG = srcG + dstG; if (dstG > 255) dstG = 255;
@@ -6746,13 +7328,19 @@ static void SDL_Blit_BGRA8888_BGR888_Blend_Scale(SDL_BlitInfo *info)
                     srcB = (srcB * srcA) / 255;
                 }
             }
-            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
             case SDL_COPY_BLEND:
                 dstR = srcR + ((255 - srcA) * dstR) / 255;
                 dstG = srcG + ((255 - srcA) * dstG) / 255;
                 dstB = srcB + ((255 - srcA) * dstB) / 255;
                 dstA = srcA + ((255 - srcA) * dstA) / 255;
                 break;
+            case SDL_COPY_PREMULTIPLIED:
+                dstR = srcR + ((255 - srcA) * dstR) / 255; if (dstR > 255) dstR = 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255; if (dstG > 255) dstG = 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255; if (dstB > 255) dstB = 255;
+                dstA = srcA + ((255 - srcA) * dstA) / 255;
+                break;
             case SDL_COPY_ADD:
                 dstR = srcR + dstR; if (dstR > 255) dstR = 255;
                 dstG = srcG + dstG; if (dstG > 255) dstG = 255;
@@ -6894,6 +7482,12 @@ static void SDL_Blit_BGRA8888_BGR888_Modulate_Blend(SDL_BlitInfo *info)
             if (flags & SDL_COPY_MODULATE_ALPHA) {
                 srcA = (srcA * modulateA) / 255;
             }
+            if ((flags & (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) == (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) {
+                /* Premultiplied color fades along with its alpha */
+                srcR = (srcR * modulateA) / 255;
+                srcG = (srcG * modulateA) / 255;
+                srcB = (srcB * modulateA) / 255;
+            }
             if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
                 /* This goes away if we ever use premultiplied alpha */
                 if (srcA < 255) {
@@ -6902,13 +7496,19 @@ static void SDL_Blit_BGRA8888_BGR888_Modulate_Blend(SDL_BlitInfo *info)
                     srcB = (srcB * srcA) / 255;
                 }
             }
-            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
             case SDL_COPY_BLEND:
                 dstR = srcR + ((255 - srcA) * dstR) / 255;
                 dstG = srcG + ((255 - srcA) * dstG) / 255;
                 dstB = srcB + ((255 - srcA) * dstB) / 255;
                 dstA = srcA + ((255 - srcA) * dstA) / 255;
                 break;
+            case SDL_COPY_PREMULTIPLIED:
+                dstR = srcR + ((255 - srcA) * dstR) / 255; if (dstR > 255) dstR = 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255; if (dstG > 255) dstG = 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255; if (dstB > 255) dstB = 255;
+                dstA = srcA + ((255 - srcA) * dstA) / 255;
+                break;
             case SDL_COPY_ADD:
                 dstR = srcR + dstR; if (dstR > 255) dstR = 255;
                 dstG = srcG + dstG; if (dstG > 255) dstG = 255;
@@ -6980,6 +7580,12 @@ static void SDL_Blit_BGRA8888_BGR888_Modulate_Blend_Scale(SDL_BlitInfo *info)
             if (flags & SDL_COPY_MODULATE_ALPHA) {
                 srcA = (srcA * modulateA) / 255;
             }
+            if ((flags & (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) == (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) {
+                /* Premultiplied color fades along with its alpha */
+                srcR = (srcR * modulateA) / 255;
+                srcG = (srcG * modulateA) / 255;
+                srcB = (srcB * modulateA) / 255;
+            }
             if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
                 /* This goes away if we ever use premultiplied alpha */
                 if (srcA < 255) {
@@ -6988,13 +7594,19 @@ static void SDL_Blit_BGRA8888_BGR888_Modulate_Blend_Scale(SDL_BlitInfo *info)
                     srcB = (srcB * srcA) / 255;
                 }
             }
-            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
             case SDL_COPY_BLEND:
                 dstR = srcR + ((255 - srcA) * dstR) / 255;
                 dstG = srcG + ((255 - srcA) * dstG) / 255;
                 dstB = srcB + ((255 - srcA) * dstB) / 255;
                 dstA = srcA + ((255 - srcA) * dstA) / 255;
                 break;
+            case SDL_COPY_PREMULTIPLIED:
+                dstR = srcR + ((255 - srcA) * dstR) / 255; if (dstR > 255) dstR = 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255; if (dstG > 255) dstG = 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255; if (dstB > 255) dstB = 255;
+                dstA = srcA + ((255 - srcA) * dstA) / 255;
+                break;
             case SDL_COPY_ADD:
                 dstR = srcR + dstR; if (dstR > 255) dstR = 255;
                 dstG = srcG + dstG; if (dstG > 255) dstG = 255;
@@ -7084,13 +7696,19 @@ static void SDL_Blit_BGRA8888_ARGB8888_Blend(SDL_BlitInfo *info)
                     srcB = (srcB * srcA) / 255;
                 }
             }
-            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
             case SDL_COPY_BLEND:
                 dstR = srcR + ((255 - srcA) * dstR) / 255;
                 dstG = srcG + ((255 - srcA) * dstG) / 255;
                 dstB = srcB + ((255 - srcA) * dstB) / 255;
                 dstA = srcA + ((255 - srcA) * dstA) / 255;
                 break;
+            case SDL_COPY_PREMULTIPLIED:
+                dstR = srcR + ((255 - srcA) * dstR) / 255; if (dstR > 255) dstR = 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255; if (dstG > 255) dstG = 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255; if (dstB > 255) dstB = 255;
+                dstA = srcA + ((255 - srcA) * dstA) / 255;
+                break;
             case SDL_COPY_ADD:
                 dstR = srcR + dstR; if (dstR > 255) dstR = 255;
                 dstG = srcG + dstG; if (dstG > 255) dstG = 255;
@@ -7158,13 +7776,19 @@ static void SDL_Blit_BGRA8888_ARGB8888_Blend_Scale(SDL_BlitInfo *info)
                     srcB = (srcB * srcA) / 255;
                 }
             }
-            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
             case SDL_COPY_BLEND:
                 dstR = srcR + ((255 - srcA) * dstR) / 255;
                 dstG = srcG + ((255 - srcA) * dstG) / 255;
                 dstB = srcB + ((255 - srcA) * dstB) / 255;
                 dstA = srcA + ((255 - srcA) * dstA) / 255;
                 break;
+            case SDL_COPY_PREMULTIPLIED:
+                dstR = srcR + ((255 - srcA) * dstR) / 255; if (dstR > 255) dstR = 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255; if (dstG > 255) dstG = 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255; if (dstB > 255) dstB = 255;
+                dstA = srcA + ((255 - srcA) * dstA) / 255;
+                break;
             case SDL_COPY_ADD:
                 dstR = srcR + dstR; if (dstR > 255) dstR = 255;
                 dstG = srcG + dstG; if (dstG > 255) dstG = 255;
@@ -7306,6 +7930,12 @@ static void SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend(SDL_BlitInfo *info)
             if (flags & SDL_COPY_MODULATE_ALPHA) {
                 srcA = (srcA * modulateA) / 255;
             }
+            if ((flags & (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) == (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) {
+                /* Premultiplied color fades along with its alpha */
+                srcR = (srcR * modulateA) / 255;
+                srcG = (srcG * modulateA) / 255;
+                srcB = (srcB * modulateA) / 255;
+            }
             if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
                 /* This goes away if we ever use premultiplied alpha */
                 if (srcA < 255) {
@@ -7314,13 +7944,19 @@ static void SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend(SDL_BlitInfo *info)
                     srcB = (srcB * srcA) / 255;
                 }
             }
-            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
             case SDL_COPY_BLEND:
                 dstR = srcR + ((255 - srcA) * dstR) / 255;
                 dstG = srcG + ((255 - srcA) * dstG) / 255;
                 dstB = srcB + ((255 - srcA) * dstB) / 255;
                 dstA = srcA + ((255 - srcA) * dstA) / 255;
                 break;
+            case SDL_COPY_PREMULTIPLIED:
+                dstR = srcR + ((255 - srcA) * dstR) / 255; if (dstR > 255) dstR = 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255; if (dstG > 255) dstG = 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255; if (dstB > 255) dstB = 255;
+                dstA = srcA + ((255 - srcA) * dstA) / 255;
+                break;
             case SDL_COPY_ADD:
                 dstR = srcR + dstR; if (dstR > 255) dstR = 255;
                 dstG = srcG + dstG; if (dstG > 255) dstG = 255;
@@ -7392,6 +8028,12 @@ static void SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
             if (flags & SDL_COPY_MODULATE_ALPHA) {
                 srcA = (srcA * modulateA) / 255;
             }
+            if ((flags & (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) == (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) {
+                /* Premultiplied color fades along with its alpha */
+                srcR = (srcR * modulateA) / 255;
+                srcG = (srcG * modulateA) / 255;
+                srcB = (srcB * modulateA) / 255;
+            }
             if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
                 /* This goes away if we ever use premultiplied alpha */
                 if (srcA < 255) {
@@ -7400,13 +8042,19 @@ static void SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
                     srcB = (srcB * srcA) / 255;
                 }
             }
-            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
             case SDL_COPY_BLEND:
                 dstR = srcR + ((255 - srcA) * dstR) / 255;
                 dstG = srcG + ((255 - srcA) * dstG) / 255;
                 dstB = srcB + ((255 - srcA) * dstB) / 255;
                 dstA = srcA + ((255 - srcA) * dstA) / 255;
                 break;
+            case SDL_COPY_PREMULTIPLIED:
+                dstR = srcR + ((255 - srcA) * dstR) / 255; if (dstR > 255) dstR = 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255; if (dstG > 255) dstG = 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255; if (dstB > 255) dstB = 255;
+                dstA = srcA + ((255 - srcA) * dstA) / 255;
+                break;
             case SDL_COPY_ADD:
                 dstR = srcR + dstR; if (dstR > 255) dstR = 255;
                 dstG = srcG + dstG; if (dstG > 255) dstG = 255;
@@ -7428,133 +8076,8738 @@ static void SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     }
 }
 
+/* The SIMD blitters work on two pixels at a time, widened to 16 bits per
+   channel and laid out like the destination format. Lanes are numbered by
+   bit offset / 8 within a pixel, so lane 3 is the top byte. Every result
+   is bit-exact with the scalar blitters above, x / 255 is computed as
+   (x + 1 + (x >> 8)) >> 8, which is exact for 0 <= x <= 255 * 255.
+ */
+#if defined(__SSE2__)
+#define SDL_BLIT_AUTO_SIMD      1
+#define SDL_BLIT_AUTO_SIMD_CPU  SDL_CPU_SSE2
+
+typedef __m128i SIMD_Vec;
+
+#define SIMD_SET(l0, l1, l2, l3) \
+    _mm_set_epi16((short)(l3), (short)(l2), (short)(l1), (short)(l0), \
+                  (short)(l3), (short)(l2), (short)(l1), (short)(l0))
+#define SIMD_LOAD(p) \
+    _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *)(p)), _mm_setzero_si128())
+#define SIMD_STORE(p, v) \
+    _mm_storel_epi64((__m128i *)(p), _mm_packus_epi16((v), (v)))
+#define SIMD_PERM(v, l0, l1, l2, l3) \
+    _mm_shufflehi_epi16(_mm_shufflelo_epi16((v), _MM_SHUFFLE(l3, l2, l1, l0)), \
+                        _MM_SHUFFLE(l3, l2, l1, l0))
+#define SIMD_ADD(a, b)      _mm_add_epi16((a), (b))
+#define SIMD_SUB(a, b)      _mm_sub_epi16((a), (b))
+#define SIMD_MUL(a, b)      _mm_mullo_epi16((a), (b))
+#define SIMD_MIN(a, b)      _mm_min_epi16((a), (b))
+#define SIMD_AND(a, b)      _mm_and_si128((a), (b))
+#define SIMD_OR(a, b)       _mm_or_si128((a), (b))
+#define SIMD_ANDNOT(m, v)   _mm_andnot_si128((m), (v))
+#define SIMD_SHR8(v)        _mm_srli_epi16((v), 8)
+
+#elif (defined(__ARM_NEON__) || defined(__ARM_NEON)) && SDL_BYTEORDER == SDL_LIL_ENDIAN
+#include <arm_neon.h>
+#define SDL_BLIT_AUTO_SIMD      1
+#define SDL_BLIT_AUTO_SIMD_CPU  SDL_CPU_NEON
+
+typedef uint16x8_t SIMD_Vec;
+
+static SDL_INLINE SIMD_Vec
+SIMD_Set(Uint16 l0, Uint16 l1, Uint16 l2, Uint16 l3)
+{
+    const Uint16 lanes[8] = { l0, l1, l2, l3, l0, l1, l2, l3 };
+    return vld1q_u16(lanes);
+}
+
+static SDL_INLINE SIMD_Vec
+SIMD_Perm(SIMD_Vec v, uint8x8_t index)
+{
+    const uint8x16_t bytes = vreinterpretq_u8_u16(v);
+    return vreinterpretq_u16_u8(vcombine_u8(vtbl1_u8(vget_low_u8(bytes), index),
+                                            vtbl1_u8(vget_high_u8(bytes), index)));
+}
+
+#define SIMD_SET(l0, l1, l2, l3) SIMD_Set((l0), (l1), (l2), (l3))
+#define SIMD_LOAD(p)        vmovl_u8(vld1_u8((const uint8_t *)(p)))
+#define SIMD_STORE(p, v)    vst1_u8((uint8_t *)(p), vqmovn_u16(v))
+#define SIMD_PERM_BYTE(l, i) ((Uint64)(2 * (l) + ((i) & 1)) << (8 * (i)))
+#define SIMD_PERM(v, l0, l1, l2, l3) \
+    SIMD_Perm((v), vcreate_u8(SIMD_PERM_BYTE(l0, 0) | SIMD_PERM_BYTE(l0, 1) | \
+                              SIMD_PERM_BYTE(l1, 2) | SIMD_PERM_BYTE(l1, 3) | \
+                              SIMD_PERM_BYTE(l2, 4) | SIMD_PERM_BYTE(l2, 5) | \
+                              SIMD_PERM_BYTE(l3, 6) | SIMD_PERM_BYTE(l3, 7)))
+#define SIMD_ADD(a, b)      vaddq_u16((a), (b))
+#define SIMD_SUB(a, b)      vsubq_u16((a), (b))
+#define SIMD_MUL(a, b)      vmulq_u16((a), (b))
+#define SIMD_MIN(a, b)      vminq_u16((a), (b))
+#define SIMD_AND(a, b)      vandq_u16((a), (b))
+#define SIMD_OR(a, b)       vorrq_u16((a), (b))
+#define SIMD_ANDNOT(m, v)   vbicq_u16((v), (m))
+#define SIMD_SHR8(v)        vshrq_n_u16((v), 8)
+
+#elif SDL_ALTIVEC_BLITTERS && SDL_BYTEORDER == SDL_BIG_ENDIAN
+#ifdef HAVE_ALTIVEC_H
+#include <altivec.h>
+#endif
+#define SDL_BLIT_AUTO_SIMD      1
+#define SDL_BLIT_AUTO_SIMD_CPU  SDL_CPU_ALTIVEC
+
+typedef vector unsigned short SIMD_Vec;
+
+/* On big-endian machines lane l of a pixel is vector element 3 - l */
+static SDL_INLINE SIMD_Vec
+SIMD_Set(Uint16 l0, Uint16 l1, Uint16 l2, Uint16 l3)
+{
+    DECLARE_ALIGNED(Uint16, lanes[8], 16);
+    lanes[0] = lanes[4] = l3;
+    lanes[1] = lanes[5] = l2;
+    lanes[2] = lanes[6] = l1;
+    lanes[3] = lanes[7] = l0;
+    return vec_ld(0, lanes);
+}
+
+static SDL_INLINE SIMD_Vec
+SIMD_Load(const Uint32 *p)
+{
+    DECLARE_ALIGNED(Uint32, pixels[4], 16);
+    pixels[0] = p[0];
+    pixels[1] = p[1];
+    return (SIMD_Vec) vec_mergeh(vec_splat_u8(0), vec_ld(0, (const Uint8 *) pixels));
+}
+
+static SDL_INLINE void
+SIMD_Store(Uint32 *p, SIMD_Vec v)
+{
+    DECLARE_ALIGNED(Uint32, pixels[4], 16);
+    vec_st(vec_packsu(v, v), 0, (Uint8 *) pixels);
+    p[0] = pixels[0];
+    p[1] = pixels[1];
+}
+
+#define SIMD_SET(l0, l1, l2, l3) SIMD_Set((l0), (l1), (l2), (l3))
+#define SIMD_LOAD(p)        SIMD_Load(p)
+#define SIMD_STORE(p, v)    SIMD_Store((p), (v))
+#define SIMD_PERM_INDEX(l0, l1, l2, l3, o) \
+    2 * (3 - (l3)) + (o), 2 * (3 - (l3)) + 1 + (o), \
+    2 * (3 - (l2)) + (o), 2 * (3 - (l2)) + 1 + (o), \
+    2 * (3 - (l1)) + (o), 2 * (3 - (l1)) + 1 + (o), \
+    2 * (3 - (l0)) + (o), 2 * (3 - (l0)) + 1 + (o)
+#define SIMD_PERM(v, l0, l1, l2, l3) \
+    vec_perm((v), (v), (vector unsigned char) { SIMD_PERM_INDEX(l0, l1, l2, l3, 0), \
+                                                SIMD_PERM_INDEX(l0, l1, l2, l3, 8) })
+#define SIMD_ADD(a, b)      vec_add((a), (b))
+#define SIMD_SUB(a, b)      vec_sub((a), (b))
+#define SIMD_MUL(a, b)      vec_mladd((a), (b), vec_splat_u16(0))
+#define SIMD_MIN(a, b)      vec_min((a), (b))
+#define SIMD_AND(a, b)      vec_and((a), (b))
+#define SIMD_OR(a, b)       vec_or((a), (b))
+#define SIMD_ANDNOT(m, v)   vec_andc((v), (m))
+#define SIMD_SHR8(v)        vec_sr((v), vec_splat_u16(8))
+#endif
+
+#if SDL_BLIT_AUTO_SIMD
+static SDL_INLINE SIMD_Vec
+SIMD_Div255(SIMD_Vec v)
+{
+    return SIMD_SHR8(SIMD_ADD(SIMD_ADD(v, SIMD_SET(1, 1, 1, 1)), SIMD_SHR8(v)));
+}
+
+/* Take the lanes in (mask) from (a) and the others from (b) */
+#define SIMD_SELECT(mask, a, b) SIMD_OR(SIMD_AND((mask), (a)), SIMD_ANDNOT((mask), (b)))
+
+static void SDL_Blit_RGB888_RGB888_Scale_SIMD(SDL_BlitInfo *info)
+{
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const SIMD_Vec opaque = SIMD_SET(0, 0, 0, 0xFF);
+    SIMD_Vec srcpixel;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        srcrow = info->src + (srcy * info->src_pitch);
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = pixels;
+            Uint32 *d = (n == 1) ? &pixels[2] : dst;
+            int i;
+            for (i = 0; i < 2; ++i) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                pixels[i] = *(const Uint32 *)(srcrow + (srcx * 4));
+                if (n == 1) {
+                    break;
+                }
+                posx += incx;
+            }
+            if (n == 1) {
+                pixels[1] = pixels[0];
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_OR(srcpixel, opaque);
+            srcpixel = SIMD_ANDNOT(alphamask, srcpixel);
+            SIMD_STORE(d, srcpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            dst += 2;
+            n -= 2;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGB888_RGB888_Blend_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const SIMD_Vec opaque = SIMD_SET(0, 0, 0, 0xFF);
+    const SIMD_Vec v255 = SIMD_SET(0xFF, 0xFF, 0xFF, 0xFF);
+    SIMD_Vec srcpixel;
+    SIMD_Vec srcA, dstpixel;
+
+    while (info->dst_h--) {
+        const Uint32 *srcrow = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = srcrow;
+            Uint32 *d = dst;
+            if (n == 1) {
+                pixels[0] = pixels[1] = *srcrow;
+                pixels[2] = pixels[3] = *dst;
+                src = &pixels[0];
+                d = &pixels[2];
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_OR(srcpixel, opaque);
+            srcA = SIMD_PERM(srcpixel, 3, 3, 3, 3);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, srcA)));
+            }
+            dstpixel = SIMD_LOAD(d);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
+            case SDL_COPY_BLEND:
+            case SDL_COPY_PREMULTIPLIED:
+                /* Premultiplied overflow saturates in SIMD_STORE */
+                dstpixel = SIMD_ADD(srcpixel, SIMD_Div255(SIMD_MUL(SIMD_SUB(v255, srcA), dstpixel)));
+                break;
+            case SDL_COPY_ADD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_MIN(SIMD_ADD(srcpixel, dstpixel), v255));
+                break;
+            case SDL_COPY_MOD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_Div255(SIMD_MUL(srcpixel, dstpixel)));
+                break;
+            }
+            dstpixel = SIMD_ANDNOT(alphamask, dstpixel);
+            SIMD_STORE(d, dstpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            srcrow += 2;
+            dst += 2;
+            n -= 2;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGB888_RGB888_Blend_Scale_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const SIMD_Vec opaque = SIMD_SET(0, 0, 0, 0xFF);
+    const SIMD_Vec v255 = SIMD_SET(0xFF, 0xFF, 0xFF, 0xFF);
+    SIMD_Vec srcpixel;
+    SIMD_Vec srcA, dstpixel;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        srcrow = info->src + (srcy * info->src_pitch);
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = pixels;
+            Uint32 *d = (n == 1) ? &pixels[2] : dst;
+            int i;
+            for (i = 0; i < 2; ++i) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                pixels[i] = *(const Uint32 *)(srcrow + (srcx * 4));
+                if (n == 1) {
+                    break;
+                }
+                posx += incx;
+            }
+            if (n == 1) {
+                pixels[1] = pixels[0];
+                pixels[2] = pixels[3] = *dst;
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_OR(srcpixel, opaque);
+            srcA = SIMD_PERM(srcpixel, 3, 3, 3, 3);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, srcA)));
+            }
+            dstpixel = SIMD_LOAD(d);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
+            case SDL_COPY_BLEND:
+            case SDL_COPY_PREMULTIPLIED:
+                /* Premultiplied overflow saturates in SIMD_STORE */
+                dstpixel = SIMD_ADD(srcpixel, SIMD_Div255(SIMD_MUL(SIMD_SUB(v255, srcA), dstpixel)));
+                break;
+            case SDL_COPY_ADD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_MIN(SIMD_ADD(srcpixel, dstpixel), v255));
+                break;
+            case SDL_COPY_MOD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_Div255(SIMD_MUL(srcpixel, dstpixel)));
+                break;
+            }
+            dstpixel = SIMD_ANDNOT(alphamask, dstpixel);
+            SIMD_STORE(d, dstpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            dst += 2;
+            n -= 2;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGB888_RGB888_Modulate_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const SIMD_Vec opaque = SIMD_SET(0, 0, 0, 0xFF);
+    const Uint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Uint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Uint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Uint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const SIMD_Vec modulate = SIMD_SET(modulateB, modulateG, modulateR, modulateA);
+    SIMD_Vec srcpixel;
+
+    while (info->dst_h--) {
+        const Uint32 *srcrow = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = srcrow;
+            Uint32 *d = dst;
+            if (n == 1) {
+                pixels[0] = pixels[1] = *srcrow;
+                src = &pixels[0];
+                d = &pixels[2];
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_OR(srcpixel, opaque);
+            srcpixel = SIMD_Div255(SIMD_MUL(srcpixel, modulate));
+            srcpixel = SIMD_ANDNOT(alphamask, srcpixel);
+            SIMD_STORE(d, srcpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            srcrow += 2;
+            dst += 2;
+            n -= 2;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGB888_RGB888_Modulate_Scale_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const SIMD_Vec opaque = SIMD_SET(0, 0, 0, 0xFF);
+    const Uint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Uint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Uint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Uint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const SIMD_Vec modulate = SIMD_SET(modulateB, modulateG, modulateR, modulateA);
+    SIMD_Vec srcpixel;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        srcrow = info->src + (srcy * info->src_pitch);
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = pixels;
+            Uint32 *d = (n == 1) ? &pixels[2] : dst;
+            int i;
+            for (i = 0; i < 2; ++i) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                pixels[i] = *(const Uint32 *)(srcrow + (srcx * 4));
+                if (n == 1) {
+                    break;
+                }
+                posx += incx;
+            }
+            if (n == 1) {
+                pixels[1] = pixels[0];
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_OR(srcpixel, opaque);
+            srcpixel = SIMD_Div255(SIMD_MUL(srcpixel, modulate));
+            srcpixel = SIMD_ANDNOT(alphamask, srcpixel);
+            SIMD_STORE(d, srcpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            dst += 2;
+            n -= 2;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGB888_RGB888_Modulate_Blend_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const SIMD_Vec opaque = SIMD_SET(0, 0, 0, 0xFF);
+    const SIMD_Vec v255 = SIMD_SET(0xFF, 0xFF, 0xFF, 0xFF);
+    const Uint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Uint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Uint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Uint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const SIMD_Vec modulate = SIMD_SET(modulateB, modulateG, modulateR, modulateA);
+    const SIMD_Vec modulateAlpha = SIMD_SET(modulateA, modulateA, modulateA, modulateA);
+    SIMD_Vec srcpixel;
+    SIMD_Vec srcA, dstpixel;
+
+    while (info->dst_h--) {
+        const Uint32 *srcrow = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = srcrow;
+            Uint32 *d = dst;
+            if (n == 1) {
+                pixels[0] = pixels[1] = *srcrow;
+                pixels[2] = pixels[3] = *dst;
+                src = &pixels[0];
+                d = &pixels[2];
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_OR(srcpixel, opaque);
+            srcpixel = SIMD_Div255(SIMD_MUL(srcpixel, modulate));
+            if ((flags & (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) == (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, modulateAlpha)));
+            }
+            srcA = SIMD_PERM(srcpixel, 3, 3, 3, 3);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, srcA)));
+            }
+            dstpixel = SIMD_LOAD(d);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
+            case SDL_COPY_BLEND:
+            case SDL_COPY_PREMULTIPLIED:
+                /* Premultiplied overflow saturates in SIMD_STORE */
+                dstpixel = SIMD_ADD(srcpixel, SIMD_Div255(SIMD_MUL(SIMD_SUB(v255, srcA), dstpixel)));
+                break;
+            case SDL_COPY_ADD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_MIN(SIMD_ADD(srcpixel, dstpixel), v255));
+                break;
+            case SDL_COPY_MOD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_Div255(SIMD_MUL(srcpixel, dstpixel)));
+                break;
+            }
+            dstpixel = SIMD_ANDNOT(alphamask, dstpixel);
+            SIMD_STORE(d, dstpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            srcrow += 2;
+            dst += 2;
+            n -= 2;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGB888_RGB888_Modulate_Blend_Scale_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const SIMD_Vec opaque = SIMD_SET(0, 0, 0, 0xFF);
+    const SIMD_Vec v255 = SIMD_SET(0xFF, 0xFF, 0xFF, 0xFF);
+    const Uint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Uint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Uint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Uint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const SIMD_Vec modulate = SIMD_SET(modulateB, modulateG, modulateR, modulateA);
+    const SIMD_Vec modulateAlpha = SIMD_SET(modulateA, modulateA, modulateA, modulateA);
+    SIMD_Vec srcpixel;
+    SIMD_Vec srcA, dstpixel;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        srcrow = info->src + (srcy * info->src_pitch);
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = pixels;
+            Uint32 *d = (n == 1) ? &pixels[2] : dst;
+            int i;
+            for (i = 0; i < 2; ++i) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                pixels[i] = *(const Uint32 *)(srcrow + (srcx * 4));
+                if (n == 1) {
+                    break;
+                }
+                posx += incx;
+            }
+            if (n == 1) {
+                pixels[1] = pixels[0];
+                pixels[2] = pixels[3] = *dst;
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_OR(srcpixel, opaque);
+            srcpixel = SIMD_Div255(SIMD_MUL(srcpixel, modulate));
+            if ((flags & (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) == (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, modulateAlpha)));
+            }
+            srcA = SIMD_PERM(srcpixel, 3, 3, 3, 3);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, srcA)));
+            }
+            dstpixel = SIMD_LOAD(d);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
+            case SDL_COPY_BLEND:
+            case SDL_COPY_PREMULTIPLIED:
+                /* Premultiplied overflow saturates in SIMD_STORE */
+                dstpixel = SIMD_ADD(srcpixel, SIMD_Div255(SIMD_MUL(SIMD_SUB(v255, srcA), dstpixel)));
+                break;
+            case SDL_COPY_ADD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_MIN(SIMD_ADD(srcpixel, dstpixel), v255));
+                break;
+            case SDL_COPY_MOD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_Div255(SIMD_MUL(srcpixel, dstpixel)));
+                break;
+            }
+            dstpixel = SIMD_ANDNOT(alphamask, dstpixel);
+            SIMD_STORE(d, dstpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            dst += 2;
+            n -= 2;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGB888_BGR888_Scale_SIMD(SDL_BlitInfo *info)
+{
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const SIMD_Vec opaque = SIMD_SET(0, 0, 0, 0xFF);
+    SIMD_Vec srcpixel;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        srcrow = info->src + (srcy * info->src_pitch);
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = pixels;
+            Uint32 *d = (n == 1) ? &pixels[2] : dst;
+            int i;
+            for (i = 0; i < 2; ++i) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                pixels[i] = *(const Uint32 *)(srcrow + (srcx * 4));
+                if (n == 1) {
+                    break;
+                }
+                posx += incx;
+            }
+            if (n == 1) {
+                pixels[1] = pixels[0];
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_PERM(srcpixel, 2, 1, 0, 3);
+            srcpixel = SIMD_OR(srcpixel, opaque);
+            srcpixel = SIMD_ANDNOT(alphamask, srcpixel);
+            SIMD_STORE(d, srcpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            dst += 2;
+            n -= 2;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGB888_BGR888_Blend_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const SIMD_Vec opaque = SIMD_SET(0, 0, 0, 0xFF);
+    const SIMD_Vec v255 = SIMD_SET(0xFF, 0xFF, 0xFF, 0xFF);
+    SIMD_Vec srcpixel;
+    SIMD_Vec srcA, dstpixel;
+
+    while (info->dst_h--) {
+        const Uint32 *srcrow = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = srcrow;
+            Uint32 *d = dst;
+            if (n == 1) {
+                pixels[0] = pixels[1] = *srcrow;
+                pixels[2] = pixels[3] = *dst;
+                src = &pixels[0];
+                d = &pixels[2];
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_PERM(srcpixel, 2, 1, 0, 3);
+            srcpixel = SIMD_OR(srcpixel, opaque);
+            srcA = SIMD_PERM(srcpixel, 3, 3, 3, 3);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, srcA)));
+            }
+            dstpixel = SIMD_LOAD(d);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
+            case SDL_COPY_BLEND:
+            case SDL_COPY_PREMULTIPLIED:
+                /* Premultiplied overflow saturates in SIMD_STORE */
+                dstpixel = SIMD_ADD(srcpixel, SIMD_Div255(SIMD_MUL(SIMD_SUB(v255, srcA), dstpixel)));
+                break;
+            case SDL_COPY_ADD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_MIN(SIMD_ADD(srcpixel, dstpixel), v255));
+                break;
+            case SDL_COPY_MOD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_Div255(SIMD_MUL(srcpixel, dstpixel)));
+                break;
+            }
+            dstpixel = SIMD_ANDNOT(alphamask, dstpixel);
+            SIMD_STORE(d, dstpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            srcrow += 2;
+            dst += 2;
+            n -= 2;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGB888_BGR888_Blend_Scale_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const SIMD_Vec opaque = SIMD_SET(0, 0, 0, 0xFF);
+    const SIMD_Vec v255 = SIMD_SET(0xFF, 0xFF, 0xFF, 0xFF);
+    SIMD_Vec srcpixel;
+    SIMD_Vec srcA, dstpixel;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        srcrow = info->src + (srcy * info->src_pitch);
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = pixels;
+            Uint32 *d = (n == 1) ? &pixels[2] : dst;
+            int i;
+            for (i = 0; i < 2; ++i) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                pixels[i] = *(const Uint32 *)(srcrow + (srcx * 4));
+                if (n == 1) {
+                    break;
+                }
+                posx += incx;
+            }
+            if (n == 1) {
+                pixels[1] = pixels[0];
+                pixels[2] = pixels[3] = *dst;
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_PERM(srcpixel, 2, 1, 0, 3);
+            srcpixel = SIMD_OR(srcpixel, opaque);
+            srcA = SIMD_PERM(srcpixel, 3, 3, 3, 3);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, srcA)));
+            }
+            dstpixel = SIMD_LOAD(d);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
+            case SDL_COPY_BLEND:
+            case SDL_COPY_PREMULTIPLIED:
+                /* Premultiplied overflow saturates in SIMD_STORE */
+                dstpixel = SIMD_ADD(srcpixel, SIMD_Div255(SIMD_MUL(SIMD_SUB(v255, srcA), dstpixel)));
+                break;
+            case SDL_COPY_ADD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_MIN(SIMD_ADD(srcpixel, dstpixel), v255));
+                break;
+            case SDL_COPY_MOD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_Div255(SIMD_MUL(srcpixel, dstpixel)));
+                break;
+            }
+            dstpixel = SIMD_ANDNOT(alphamask, dstpixel);
+            SIMD_STORE(d, dstpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            dst += 2;
+            n -= 2;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGB888_BGR888_Modulate_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const SIMD_Vec opaque = SIMD_SET(0, 0, 0, 0xFF);
+    const Uint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Uint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Uint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Uint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const SIMD_Vec modulate = SIMD_SET(modulateR, modulateG, modulateB, modulateA);
+    SIMD_Vec srcpixel;
+
+    while (info->dst_h--) {
+        const Uint32 *srcrow = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = srcrow;
+            Uint32 *d = dst;
+            if (n == 1) {
+                pixels[0] = pixels[1] = *srcrow;
+                src = &pixels[0];
+                d = &pixels[2];
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_PERM(srcpixel, 2, 1, 0, 3);
+            srcpixel = SIMD_OR(srcpixel, opaque);
+            srcpixel = SIMD_Div255(SIMD_MUL(srcpixel, modulate));
+            srcpixel = SIMD_ANDNOT(alphamask, srcpixel);
+            SIMD_STORE(d, srcpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            srcrow += 2;
+            dst += 2;
+            n -= 2;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGB888_BGR888_Modulate_Scale_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const SIMD_Vec opaque = SIMD_SET(0, 0, 0, 0xFF);
+    const Uint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Uint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Uint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Uint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const SIMD_Vec modulate = SIMD_SET(modulateR, modulateG, modulateB, modulateA);
+    SIMD_Vec srcpixel;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        srcrow = info->src + (srcy * info->src_pitch);
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = pixels;
+            Uint32 *d = (n == 1) ? &pixels[2] : dst;
+            int i;
+            for (i = 0; i < 2; ++i) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                pixels[i] = *(const Uint32 *)(srcrow + (srcx * 4));
+                if (n == 1) {
+                    break;
+                }
+                posx += incx;
+            }
+            if (n == 1) {
+                pixels[1] = pixels[0];
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_PERM(srcpixel, 2, 1, 0, 3);
+            srcpixel = SIMD_OR(srcpixel, opaque);
+            srcpixel = SIMD_Div255(SIMD_MUL(srcpixel, modulate));
+            srcpixel = SIMD_ANDNOT(alphamask, srcpixel);
+            SIMD_STORE(d, srcpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            dst += 2;
+            n -= 2;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGB888_BGR888_Modulate_Blend_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const SIMD_Vec opaque = SIMD_SET(0, 0, 0, 0xFF);
+    const SIMD_Vec v255 = SIMD_SET(0xFF, 0xFF, 0xFF, 0xFF);
+    const Uint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Uint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Uint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Uint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const SIMD_Vec modulate = SIMD_SET(modulateR, modulateG, modulateB, modulateA);
+    const SIMD_Vec modulateAlpha = SIMD_SET(modulateA, modulateA, modulateA, modulateA);
+    SIMD_Vec srcpixel;
+    SIMD_Vec srcA, dstpixel;
+
+    while (info->dst_h--) {
+        const Uint32 *srcrow = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = srcrow;
+            Uint32 *d = dst;
+            if (n == 1) {
+                pixels[0] = pixels[1] = *srcrow;
+                pixels[2] = pixels[3] = *dst;
+                src = &pixels[0];
+                d = &pixels[2];
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_PERM(srcpixel, 2, 1, 0, 3);
+            srcpixel = SIMD_OR(srcpixel, opaque);
+            srcpixel = SIMD_Div255(SIMD_MUL(srcpixel, modulate));
+            if ((flags & (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) == (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, modulateAlpha)));
+            }
+            srcA = SIMD_PERM(srcpixel, 3, 3, 3, 3);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, srcA)));
+            }
+            dstpixel = SIMD_LOAD(d);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
+            case SDL_COPY_BLEND:
+            case SDL_COPY_PREMULTIPLIED:
+                /* Premultiplied overflow saturates in SIMD_STORE */
+                dstpixel = SIMD_ADD(srcpixel, SIMD_Div255(SIMD_MUL(SIMD_SUB(v255, srcA), dstpixel)));
+                break;
+            case SDL_COPY_ADD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_MIN(SIMD_ADD(srcpixel, dstpixel), v255));
+                break;
+            case SDL_COPY_MOD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_Div255(SIMD_MUL(srcpixel, dstpixel)));
+                break;
+            }
+            dstpixel = SIMD_ANDNOT(alphamask, dstpixel);
+            SIMD_STORE(d, dstpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            srcrow += 2;
+            dst += 2;
+            n -= 2;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGB888_BGR888_Modulate_Blend_Scale_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const SIMD_Vec opaque = SIMD_SET(0, 0, 0, 0xFF);
+    const SIMD_Vec v255 = SIMD_SET(0xFF, 0xFF, 0xFF, 0xFF);
+    const Uint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Uint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Uint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Uint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const SIMD_Vec modulate = SIMD_SET(modulateR, modulateG, modulateB, modulateA);
+    const SIMD_Vec modulateAlpha = SIMD_SET(modulateA, modulateA, modulateA, modulateA);
+    SIMD_Vec srcpixel;
+    SIMD_Vec srcA, dstpixel;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        srcrow = info->src + (srcy * info->src_pitch);
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = pixels;
+            Uint32 *d = (n == 1) ? &pixels[2] : dst;
+            int i;
+            for (i = 0; i < 2; ++i) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                pixels[i] = *(const Uint32 *)(srcrow + (srcx * 4));
+                if (n == 1) {
+                    break;
+                }
+                posx += incx;
+            }
+            if (n == 1) {
+                pixels[1] = pixels[0];
+                pixels[2] = pixels[3] = *dst;
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_PERM(srcpixel, 2, 1, 0, 3);
+            srcpixel = SIMD_OR(srcpixel, opaque);
+            srcpixel = SIMD_Div255(SIMD_MUL(srcpixel, modulate));
+            if ((flags & (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) == (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, modulateAlpha)));
+            }
+            srcA = SIMD_PERM(srcpixel, 3, 3, 3, 3);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, srcA)));
+            }
+            dstpixel = SIMD_LOAD(d);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
+            case SDL_COPY_BLEND:
+            case SDL_COPY_PREMULTIPLIED:
+                /* Premultiplied overflow saturates in SIMD_STORE */
+                dstpixel = SIMD_ADD(srcpixel, SIMD_Div255(SIMD_MUL(SIMD_SUB(v255, srcA), dstpixel)));
+                break;
+            case SDL_COPY_ADD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_MIN(SIMD_ADD(srcpixel, dstpixel), v255));
+                break;
+            case SDL_COPY_MOD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_Div255(SIMD_MUL(srcpixel, dstpixel)));
+                break;
+            }
+            dstpixel = SIMD_ANDNOT(alphamask, dstpixel);
+            SIMD_STORE(d, dstpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            dst += 2;
+            n -= 2;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGB888_ARGB8888_Scale_SIMD(SDL_BlitInfo *info)
+{
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const SIMD_Vec opaque = SIMD_SET(0, 0, 0, 0xFF);
+    SIMD_Vec srcpixel;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        srcrow = info->src + (srcy * info->src_pitch);
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = pixels;
+            Uint32 *d = (n == 1) ? &pixels[2] : dst;
+            int i;
+            for (i = 0; i < 2; ++i) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                pixels[i] = *(const Uint32 *)(srcrow + (srcx * 4));
+                if (n == 1) {
+                    break;
+                }
+                posx += incx;
+            }
+            if (n == 1) {
+                pixels[1] = pixels[0];
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_OR(srcpixel, opaque);
+            SIMD_STORE(d, srcpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            dst += 2;
+            n -= 2;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGB888_ARGB8888_Blend_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const SIMD_Vec opaque = SIMD_SET(0, 0, 0, 0xFF);
+    const SIMD_Vec v255 = SIMD_SET(0xFF, 0xFF, 0xFF, 0xFF);
+    SIMD_Vec srcpixel;
+    SIMD_Vec srcA, dstpixel;
+
+    while (info->dst_h--) {
+        const Uint32 *srcrow = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = srcrow;
+            Uint32 *d = dst;
+            if (n == 1) {
+                pixels[0] = pixels[1] = *srcrow;
+                pixels[2] = pixels[3] = *dst;
+                src = &pixels[0];
+                d = &pixels[2];
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_OR(srcpixel, opaque);
+            srcA = SIMD_PERM(srcpixel, 3, 3, 3, 3);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, srcA)));
+            }
+            dstpixel = SIMD_LOAD(d);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
+            case SDL_COPY_BLEND:
+            case SDL_COPY_PREMULTIPLIED:
+                /* Premultiplied overflow saturates in SIMD_STORE */
+                dstpixel = SIMD_ADD(srcpixel, SIMD_Div255(SIMD_MUL(SIMD_SUB(v255, srcA), dstpixel)));
+                break;
+            case SDL_COPY_ADD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_MIN(SIMD_ADD(srcpixel, dstpixel), v255));
+                break;
+            case SDL_COPY_MOD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_Div255(SIMD_MUL(srcpixel, dstpixel)));
+                break;
+            }
+            SIMD_STORE(d, dstpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            srcrow += 2;
+            dst += 2;
+            n -= 2;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGB888_ARGB8888_Blend_Scale_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const SIMD_Vec opaque = SIMD_SET(0, 0, 0, 0xFF);
+    const SIMD_Vec v255 = SIMD_SET(0xFF, 0xFF, 0xFF, 0xFF);
+    SIMD_Vec srcpixel;
+    SIMD_Vec srcA, dstpixel;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        srcrow = info->src + (srcy * info->src_pitch);
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = pixels;
+            Uint32 *d = (n == 1) ? &pixels[2] : dst;
+            int i;
+            for (i = 0; i < 2; ++i) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                pixels[i] = *(const Uint32 *)(srcrow + (srcx * 4));
+                if (n == 1) {
+                    break;
+                }
+                posx += incx;
+            }
+            if (n == 1) {
+                pixels[1] = pixels[0];
+                pixels[2] = pixels[3] = *dst;
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_OR(srcpixel, opaque);
+            srcA = SIMD_PERM(srcpixel, 3, 3, 3, 3);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, srcA)));
+            }
+            dstpixel = SIMD_LOAD(d);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
+            case SDL_COPY_BLEND:
+            case SDL_COPY_PREMULTIPLIED:
+                /* Premultiplied overflow saturates in SIMD_STORE */
+                dstpixel = SIMD_ADD(srcpixel, SIMD_Div255(SIMD_MUL(SIMD_SUB(v255, srcA), dstpixel)));
+                break;
+            case SDL_COPY_ADD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_MIN(SIMD_ADD(srcpixel, dstpixel), v255));
+                break;
+            case SDL_COPY_MOD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_Div255(SIMD_MUL(srcpixel, dstpixel)));
+                break;
+            }
+            SIMD_STORE(d, dstpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            dst += 2;
+            n -= 2;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGB888_ARGB8888_Modulate_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const SIMD_Vec opaque = SIMD_SET(0, 0, 0, 0xFF);
+    const Uint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Uint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Uint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Uint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const SIMD_Vec modulate = SIMD_SET(modulateB, modulateG, modulateR, modulateA);
+    SIMD_Vec srcpixel;
+
+    while (info->dst_h--) {
+        const Uint32 *srcrow = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = srcrow;
+            Uint32 *d = dst;
+            if (n == 1) {
+                pixels[0] = pixels[1] = *srcrow;
+                src = &pixels[0];
+                d = &pixels[2];
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_OR(srcpixel, opaque);
+            srcpixel = SIMD_Div255(SIMD_MUL(srcpixel, modulate));
+            SIMD_STORE(d, srcpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            srcrow += 2;
+            dst += 2;
+            n -= 2;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGB888_ARGB8888_Modulate_Scale_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const SIMD_Vec opaque = SIMD_SET(0, 0, 0, 0xFF);
+    const Uint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Uint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Uint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Uint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const SIMD_Vec modulate = SIMD_SET(modulateB, modulateG, modulateR, modulateA);
+    SIMD_Vec srcpixel;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        srcrow = info->src + (srcy * info->src_pitch);
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = pixels;
+            Uint32 *d = (n == 1) ? &pixels[2] : dst;
+            int i;
+            for (i = 0; i < 2; ++i) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                pixels[i] = *(const Uint32 *)(srcrow + (srcx * 4));
+                if (n == 1) {
+                    break;
+                }
+                posx += incx;
+            }
+            if (n == 1) {
+                pixels[1] = pixels[0];
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_OR(srcpixel, opaque);
+            srcpixel = SIMD_Div255(SIMD_MUL(srcpixel, modulate));
+            SIMD_STORE(d, srcpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            dst += 2;
+            n -= 2;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGB888_ARGB8888_Modulate_Blend_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const SIMD_Vec opaque = SIMD_SET(0, 0, 0, 0xFF);
+    const SIMD_Vec v255 = SIMD_SET(0xFF, 0xFF, 0xFF, 0xFF);
+    const Uint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Uint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Uint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Uint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const SIMD_Vec modulate = SIMD_SET(modulateB, modulateG, modulateR, modulateA);
+    const SIMD_Vec modulateAlpha = SIMD_SET(modulateA, modulateA, modulateA, modulateA);
+    SIMD_Vec srcpixel;
+    SIMD_Vec srcA, dstpixel;
+
+    while (info->dst_h--) {
+        const Uint32 *srcrow = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = srcrow;
+            Uint32 *d = dst;
+            if (n == 1) {
+                pixels[0] = pixels[1] = *srcrow;
+                pixels[2] = pixels[3] = *dst;
+                src = &pixels[0];
+                d = &pixels[2];
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_OR(srcpixel, opaque);
+            srcpixel = SIMD_Div255(SIMD_MUL(srcpixel, modulate));
+            if ((flags & (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) == (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, modulateAlpha)));
+            }
+            srcA = SIMD_PERM(srcpixel, 3, 3, 3, 3);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, srcA)));
+            }
+            dstpixel = SIMD_LOAD(d);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
+            case SDL_COPY_BLEND:
+            case SDL_COPY_PREMULTIPLIED:
+                /* Premultiplied overflow saturates in SIMD_STORE */
+                dstpixel = SIMD_ADD(srcpixel, SIMD_Div255(SIMD_MUL(SIMD_SUB(v255, srcA), dstpixel)));
+                break;
+            case SDL_COPY_ADD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_MIN(SIMD_ADD(srcpixel, dstpixel), v255));
+                break;
+            case SDL_COPY_MOD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_Div255(SIMD_MUL(srcpixel, dstpixel)));
+                break;
+            }
+            SIMD_STORE(d, dstpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            srcrow += 2;
+            dst += 2;
+            n -= 2;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGB888_ARGB8888_Modulate_Blend_Scale_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const SIMD_Vec opaque = SIMD_SET(0, 0, 0, 0xFF);
+    const SIMD_Vec v255 = SIMD_SET(0xFF, 0xFF, 0xFF, 0xFF);
+    const Uint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Uint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Uint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Uint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const SIMD_Vec modulate = SIMD_SET(modulateB, modulateG, modulateR, modulateA);
+    const SIMD_Vec modulateAlpha = SIMD_SET(modulateA, modulateA, modulateA, modulateA);
+    SIMD_Vec srcpixel;
+    SIMD_Vec srcA, dstpixel;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        srcrow = info->src + (srcy * info->src_pitch);
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = pixels;
+            Uint32 *d = (n == 1) ? &pixels[2] : dst;
+            int i;
+            for (i = 0; i < 2; ++i) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                pixels[i] = *(const Uint32 *)(srcrow + (srcx * 4));
+                if (n == 1) {
+                    break;
+                }
+                posx += incx;
+            }
+            if (n == 1) {
+                pixels[1] = pixels[0];
+                pixels[2] = pixels[3] = *dst;
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_OR(srcpixel, opaque);
+            srcpixel = SIMD_Div255(SIMD_MUL(srcpixel, modulate));
+            if ((flags & (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) == (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, modulateAlpha)));
+            }
+            srcA = SIMD_PERM(srcpixel, 3, 3, 3, 3);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, srcA)));
+            }
+            dstpixel = SIMD_LOAD(d);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
+            case SDL_COPY_BLEND:
+            case SDL_COPY_PREMULTIPLIED:
+                /* Premultiplied overflow saturates in SIMD_STORE */
+                dstpixel = SIMD_ADD(srcpixel, SIMD_Div255(SIMD_MUL(SIMD_SUB(v255, srcA), dstpixel)));
+                break;
+            case SDL_COPY_ADD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_MIN(SIMD_ADD(srcpixel, dstpixel), v255));
+                break;
+            case SDL_COPY_MOD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_Div255(SIMD_MUL(srcpixel, dstpixel)));
+                break;
+            }
+            SIMD_STORE(d, dstpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            dst += 2;
+            n -= 2;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGR888_RGB888_Scale_SIMD(SDL_BlitInfo *info)
+{
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const SIMD_Vec opaque = SIMD_SET(0, 0, 0, 0xFF);
+    SIMD_Vec srcpixel;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        srcrow = info->src + (srcy * info->src_pitch);
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = pixels;
+            Uint32 *d = (n == 1) ? &pixels[2] : dst;
+            int i;
+            for (i = 0; i < 2; ++i) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                pixels[i] = *(const Uint32 *)(srcrow + (srcx * 4));
+                if (n == 1) {
+                    break;
+                }
+                posx += incx;
+            }
+            if (n == 1) {
+                pixels[1] = pixels[0];
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_PERM(srcpixel, 2, 1, 0, 3);
+            srcpixel = SIMD_OR(srcpixel, opaque);
+            srcpixel = SIMD_ANDNOT(alphamask, srcpixel);
+            SIMD_STORE(d, srcpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            dst += 2;
+            n -= 2;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGR888_RGB888_Blend_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const SIMD_Vec opaque = SIMD_SET(0, 0, 0, 0xFF);
+    const SIMD_Vec v255 = SIMD_SET(0xFF, 0xFF, 0xFF, 0xFF);
+    SIMD_Vec srcpixel;
+    SIMD_Vec srcA, dstpixel;
+
+    while (info->dst_h--) {
+        const Uint32 *srcrow = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = srcrow;
+            Uint32 *d = dst;
+            if (n == 1) {
+                pixels[0] = pixels[1] = *srcrow;
+                pixels[2] = pixels[3] = *dst;
+                src = &pixels[0];
+                d = &pixels[2];
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_PERM(srcpixel, 2, 1, 0, 3);
+            srcpixel = SIMD_OR(srcpixel, opaque);
+            srcA = SIMD_PERM(srcpixel, 3, 3, 3, 3);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, srcA)));
+            }
+            dstpixel = SIMD_LOAD(d);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
+            case SDL_COPY_BLEND:
+            case SDL_COPY_PREMULTIPLIED:
+                /* Premultiplied overflow saturates in SIMD_STORE */
+                dstpixel = SIMD_ADD(srcpixel, SIMD_Div255(SIMD_MUL(SIMD_SUB(v255, srcA), dstpixel)));
+                break;
+            case SDL_COPY_ADD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_MIN(SIMD_ADD(srcpixel, dstpixel), v255));
+                break;
+            case SDL_COPY_MOD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_Div255(SIMD_MUL(srcpixel, dstpixel)));
+                break;
+            }
+            dstpixel = SIMD_ANDNOT(alphamask, dstpixel);
+            SIMD_STORE(d, dstpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            srcrow += 2;
+            dst += 2;
+            n -= 2;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGR888_RGB888_Blend_Scale_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const SIMD_Vec opaque = SIMD_SET(0, 0, 0, 0xFF);
+    const SIMD_Vec v255 = SIMD_SET(0xFF, 0xFF, 0xFF, 0xFF);
+    SIMD_Vec srcpixel;
+    SIMD_Vec srcA, dstpixel;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        srcrow = info->src + (srcy * info->src_pitch);
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = pixels;
+            Uint32 *d = (n == 1) ? &pixels[2] : dst;
+            int i;
+            for (i = 0; i < 2; ++i) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                pixels[i] = *(const Uint32 *)(srcrow + (srcx * 4));
+                if (n == 1) {
+                    break;
+                }
+                posx += incx;
+            }
+            if (n == 1) {
+                pixels[1] = pixels[0];
+                pixels[2] = pixels[3] = *dst;
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_PERM(srcpixel, 2, 1, 0, 3);
+            srcpixel = SIMD_OR(srcpixel, opaque);
+            srcA = SIMD_PERM(srcpixel, 3, 3, 3, 3);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, srcA)));
+            }
+            dstpixel = SIMD_LOAD(d);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
+            case SDL_COPY_BLEND:
+            case SDL_COPY_PREMULTIPLIED:
+                /* Premultiplied overflow saturates in SIMD_STORE */
+                dstpixel = SIMD_ADD(srcpixel, SIMD_Div255(SIMD_MUL(SIMD_SUB(v255, srcA), dstpixel)));
+                break;
+            case SDL_COPY_ADD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_MIN(SIMD_ADD(srcpixel, dstpixel), v255));
+                break;
+            case SDL_COPY_MOD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_Div255(SIMD_MUL(srcpixel, dstpixel)));
+                break;
+            }
+            dstpixel = SIMD_ANDNOT(alphamask, dstpixel);
+            SIMD_STORE(d, dstpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            dst += 2;
+            n -= 2;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGR888_RGB888_Modulate_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const SIMD_Vec opaque = SIMD_SET(0, 0, 0, 0xFF);
+    const Uint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Uint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Uint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Uint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const SIMD_Vec modulate = SIMD_SET(modulateB, modulateG, modulateR, modulateA);
+    SIMD_Vec srcpixel;
+
+    while (info->dst_h--) {
+        const Uint32 *srcrow = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = srcrow;
+            Uint32 *d = dst;
+            if (n == 1) {
+                pixels[0] = pixels[1] = *srcrow;
+                src = &pixels[0];
+                d = &pixels[2];
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_PERM(srcpixel, 2, 1, 0, 3);
+            srcpixel = SIMD_OR(srcpixel, opaque);
+            srcpixel = SIMD_Div255(SIMD_MUL(srcpixel, modulate));
+            srcpixel = SIMD_ANDNOT(alphamask, srcpixel);
+            SIMD_STORE(d, srcpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            srcrow += 2;
+            dst += 2;
+            n -= 2;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGR888_RGB888_Modulate_Scale_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const SIMD_Vec opaque = SIMD_SET(0, 0, 0, 0xFF);
+    const Uint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Uint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Uint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Uint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const SIMD_Vec modulate = SIMD_SET(modulateB, modulateG, modulateR, modulateA);
+    SIMD_Vec srcpixel;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        srcrow = info->src + (srcy * info->src_pitch);
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = pixels;
+            Uint32 *d = (n == 1) ? &pixels[2] : dst;
+            int i;
+            for (i = 0; i < 2; ++i) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                pixels[i] = *(const Uint32 *)(srcrow + (srcx * 4));
+                if (n == 1) {
+                    break;
+                }
+                posx += incx;
+            }
+            if (n == 1) {
+                pixels[1] = pixels[0];
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_PERM(srcpixel, 2, 1, 0, 3);
+            srcpixel = SIMD_OR(srcpixel, opaque);
+            srcpixel = SIMD_Div255(SIMD_MUL(srcpixel, modulate));
+            srcpixel = SIMD_ANDNOT(alphamask, srcpixel);
+            SIMD_STORE(d, srcpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            dst += 2;
+            n -= 2;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGR888_RGB888_Modulate_Blend_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const SIMD_Vec opaque = SIMD_SET(0, 0, 0, 0xFF);
+    const SIMD_Vec v255 = SIMD_SET(0xFF, 0xFF, 0xFF, 0xFF);
+    const Uint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Uint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Uint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Uint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const SIMD_Vec modulate = SIMD_SET(modulateB, modulateG, modulateR, modulateA);
+    const SIMD_Vec modulateAlpha = SIMD_SET(modulateA, modulateA, modulateA, modulateA);
+    SIMD_Vec srcpixel;
+    SIMD_Vec srcA, dstpixel;
+
+    while (info->dst_h--) {
+        const Uint32 *srcrow = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = srcrow;
+            Uint32 *d = dst;
+            if (n == 1) {
+                pixels[0] = pixels[1] = *srcrow;
+                pixels[2] = pixels[3] = *dst;
+                src = &pixels[0];
+                d = &pixels[2];
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_PERM(srcpixel, 2, 1, 0, 3);
+            srcpixel = SIMD_OR(srcpixel, opaque);
+            srcpixel = SIMD_Div255(SIMD_MUL(srcpixel, modulate));
+            if ((flags & (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) == (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, modulateAlpha)));
+            }
+            srcA = SIMD_PERM(srcpixel, 3, 3, 3, 3);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, srcA)));
+            }
+            dstpixel = SIMD_LOAD(d);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
+            case SDL_COPY_BLEND:
+            case SDL_COPY_PREMULTIPLIED:
+                /* Premultiplied overflow saturates in SIMD_STORE */
+                dstpixel = SIMD_ADD(srcpixel, SIMD_Div255(SIMD_MUL(SIMD_SUB(v255, srcA), dstpixel)));
+                break;
+            case SDL_COPY_ADD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_MIN(SIMD_ADD(srcpixel, dstpixel), v255));
+                break;
+            case SDL_COPY_MOD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_Div255(SIMD_MUL(srcpixel, dstpixel)));
+                break;
+            }
+            dstpixel = SIMD_ANDNOT(alphamask, dstpixel);
+            SIMD_STORE(d, dstpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            srcrow += 2;
+            dst += 2;
+            n -= 2;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGR888_RGB888_Modulate_Blend_Scale_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const SIMD_Vec opaque = SIMD_SET(0, 0, 0, 0xFF);
+    const SIMD_Vec v255 = SIMD_SET(0xFF, 0xFF, 0xFF, 0xFF);
+    const Uint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Uint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Uint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Uint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const SIMD_Vec modulate = SIMD_SET(modulateB, modulateG, modulateR, modulateA);
+    const SIMD_Vec modulateAlpha = SIMD_SET(modulateA, modulateA, modulateA, modulateA);
+    SIMD_Vec srcpixel;
+    SIMD_Vec srcA, dstpixel;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        srcrow = info->src + (srcy * info->src_pitch);
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = pixels;
+            Uint32 *d = (n == 1) ? &pixels[2] : dst;
+            int i;
+            for (i = 0; i < 2; ++i) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                pixels[i] = *(const Uint32 *)(srcrow + (srcx * 4));
+                if (n == 1) {
+                    break;
+                }
+                posx += incx;
+            }
+            if (n == 1) {
+                pixels[1] = pixels[0];
+                pixels[2] = pixels[3] = *dst;
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_PERM(srcpixel, 2, 1, 0, 3);
+            srcpixel = SIMD_OR(srcpixel, opaque);
+            srcpixel = SIMD_Div255(SIMD_MUL(srcpixel, modulate));
+            if ((flags & (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) == (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, modulateAlpha)));
+            }
+            srcA = SIMD_PERM(srcpixel, 3, 3, 3, 3);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, srcA)));
+            }
+            dstpixel = SIMD_LOAD(d);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
+            case SDL_COPY_BLEND:
+            case SDL_COPY_PREMULTIPLIED:
+                /* Premultiplied overflow saturates in SIMD_STORE */
+                dstpixel = SIMD_ADD(srcpixel, SIMD_Div255(SIMD_MUL(SIMD_SUB(v255, srcA), dstpixel)));
+                break;
+            case SDL_COPY_ADD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_MIN(SIMD_ADD(srcpixel, dstpixel), v255));
+                break;
+            case SDL_COPY_MOD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_Div255(SIMD_MUL(srcpixel, dstpixel)));
+                break;
+            }
+            dstpixel = SIMD_ANDNOT(alphamask, dstpixel);
+            SIMD_STORE(d, dstpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            dst += 2;
+            n -= 2;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGR888_BGR888_Scale_SIMD(SDL_BlitInfo *info)
+{
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const SIMD_Vec opaque = SIMD_SET(0, 0, 0, 0xFF);
+    SIMD_Vec srcpixel;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        srcrow = info->src + (srcy * info->src_pitch);
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = pixels;
+            Uint32 *d = (n == 1) ? &pixels[2] : dst;
+            int i;
+            for (i = 0; i < 2; ++i) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                pixels[i] = *(const Uint32 *)(srcrow + (srcx * 4));
+                if (n == 1) {
+                    break;
+                }
+                posx += incx;
+            }
+            if (n == 1) {
+                pixels[1] = pixels[0];
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_OR(srcpixel, opaque);
+            srcpixel = SIMD_ANDNOT(alphamask, srcpixel);
+            SIMD_STORE(d, srcpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            dst += 2;
+            n -= 2;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGR888_BGR888_Blend_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const SIMD_Vec opaque = SIMD_SET(0, 0, 0, 0xFF);
+    const SIMD_Vec v255 = SIMD_SET(0xFF, 0xFF, 0xFF, 0xFF);
+    SIMD_Vec srcpixel;
+    SIMD_Vec srcA, dstpixel;
+
+    while (info->dst_h--) {
+        const Uint32 *srcrow = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = srcrow;
+            Uint32 *d = dst;
+            if (n == 1) {
+                pixels[0] = pixels[1] = *srcrow;
+                pixels[2] = pixels[3] = *dst;
+                src = &pixels[0];
+                d = &pixels[2];
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_OR(srcpixel, opaque);
+            srcA = SIMD_PERM(srcpixel, 3, 3, 3, 3);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, srcA)));
+            }
+            dstpixel = SIMD_LOAD(d);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
+            case SDL_COPY_BLEND:
+            case SDL_COPY_PREMULTIPLIED:
+                /* Premultiplied overflow saturates in SIMD_STORE */
+                dstpixel = SIMD_ADD(srcpixel, SIMD_Div255(SIMD_MUL(SIMD_SUB(v255, srcA), dstpixel)));
+                break;
+            case SDL_COPY_ADD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_MIN(SIMD_ADD(srcpixel, dstpixel), v255));
+                break;
+            case SDL_COPY_MOD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_Div255(SIMD_MUL(srcpixel, dstpixel)));
+                break;
+            }
+            dstpixel = SIMD_ANDNOT(alphamask, dstpixel);
+            SIMD_STORE(d, dstpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            srcrow += 2;
+            dst += 2;
+            n -= 2;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGR888_BGR888_Blend_Scale_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const SIMD_Vec opaque = SIMD_SET(0, 0, 0, 0xFF);
+    const SIMD_Vec v255 = SIMD_SET(0xFF, 0xFF, 0xFF, 0xFF);
+    SIMD_Vec srcpixel;
+    SIMD_Vec srcA, dstpixel;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        srcrow = info->src + (srcy * info->src_pitch);
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = pixels;
+            Uint32 *d = (n == 1) ? &pixels[2] : dst;
+            int i;
+            for (i = 0; i < 2; ++i) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                pixels[i] = *(const Uint32 *)(srcrow + (srcx * 4));
+                if (n == 1) {
+                    break;
+                }
+                posx += incx;
+            }
+            if (n == 1) {
+                pixels[1] = pixels[0];
+                pixels[2] = pixels[3] = *dst;
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_OR(srcpixel, opaque);
+            srcA = SIMD_PERM(srcpixel, 3, 3, 3, 3);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, srcA)));
+            }
+            dstpixel = SIMD_LOAD(d);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
+            case SDL_COPY_BLEND:
+            case SDL_COPY_PREMULTIPLIED:
+                /* Premultiplied overflow saturates in SIMD_STORE */
+                dstpixel = SIMD_ADD(srcpixel, SIMD_Div255(SIMD_MUL(SIMD_SUB(v255, srcA), dstpixel)));
+                break;
+            case SDL_COPY_ADD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_MIN(SIMD_ADD(srcpixel, dstpixel), v255));
+                break;
+            case SDL_COPY_MOD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_Div255(SIMD_MUL(srcpixel, dstpixel)));
+                break;
+            }
+            dstpixel = SIMD_ANDNOT(alphamask, dstpixel);
+            SIMD_STORE(d, dstpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            dst += 2;
+            n -= 2;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGR888_BGR888_Modulate_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const SIMD_Vec opaque = SIMD_SET(0, 0, 0, 0xFF);
+    const Uint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Uint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Uint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Uint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const SIMD_Vec modulate = SIMD_SET(modulateR, modulateG, modulateB, modulateA);
+    SIMD_Vec srcpixel;
+
+    while (info->dst_h--) {
+        const Uint32 *srcrow = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = srcrow;
+            Uint32 *d = dst;
+            if (n == 1) {
+                pixels[0] = pixels[1] = *srcrow;
+                src = &pixels[0];
+                d = &pixels[2];
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_OR(srcpixel, opaque);
+            srcpixel = SIMD_Div255(SIMD_MUL(srcpixel, modulate));
+            srcpixel = SIMD_ANDNOT(alphamask, srcpixel);
+            SIMD_STORE(d, srcpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            srcrow += 2;
+            dst += 2;
+            n -= 2;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGR888_BGR888_Modulate_Scale_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const SIMD_Vec opaque = SIMD_SET(0, 0, 0, 0xFF);
+    const Uint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Uint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Uint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Uint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const SIMD_Vec modulate = SIMD_SET(modulateR, modulateG, modulateB, modulateA);
+    SIMD_Vec srcpixel;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        srcrow = info->src + (srcy * info->src_pitch);
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = pixels;
+            Uint32 *d = (n == 1) ? &pixels[2] : dst;
+            int i;
+            for (i = 0; i < 2; ++i) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                pixels[i] = *(const Uint32 *)(srcrow + (srcx * 4));
+                if (n == 1) {
+                    break;
+                }
+                posx += incx;
+            }
+            if (n == 1) {
+                pixels[1] = pixels[0];
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_OR(srcpixel, opaque);
+            srcpixel = SIMD_Div255(SIMD_MUL(srcpixel, modulate));
+            srcpixel = SIMD_ANDNOT(alphamask, srcpixel);
+            SIMD_STORE(d, srcpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            dst += 2;
+            n -= 2;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGR888_BGR888_Modulate_Blend_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const SIMD_Vec opaque = SIMD_SET(0, 0, 0, 0xFF);
+    const SIMD_Vec v255 = SIMD_SET(0xFF, 0xFF, 0xFF, 0xFF);
+    const Uint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Uint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Uint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Uint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const SIMD_Vec modulate = SIMD_SET(modulateR, modulateG, modulateB, modulateA);
+    const SIMD_Vec modulateAlpha = SIMD_SET(modulateA, modulateA, modulateA, modulateA);
+    SIMD_Vec srcpixel;
+    SIMD_Vec srcA, dstpixel;
+
+    while (info->dst_h--) {
+        const Uint32 *srcrow = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = srcrow;
+            Uint32 *d = dst;
+            if (n == 1) {
+                pixels[0] = pixels[1] = *srcrow;
+                pixels[2] = pixels[3] = *dst;
+                src = &pixels[0];
+                d = &pixels[2];
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_OR(srcpixel, opaque);
+            srcpixel = SIMD_Div255(SIMD_MUL(srcpixel, modulate));
+            if ((flags & (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) == (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, modulateAlpha)));
+            }
+            srcA = SIMD_PERM(srcpixel, 3, 3, 3, 3);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, srcA)));
+            }
+            dstpixel = SIMD_LOAD(d);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
+            case SDL_COPY_BLEND:
+            case SDL_COPY_PREMULTIPLIED:
+                /* Premultiplied overflow saturates in SIMD_STORE */
+                dstpixel = SIMD_ADD(srcpixel, SIMD_Div255(SIMD_MUL(SIMD_SUB(v255, srcA), dstpixel)));
+                break;
+            case SDL_COPY_ADD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_MIN(SIMD_ADD(srcpixel, dstpixel), v255));
+                break;
+            case SDL_COPY_MOD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_Div255(SIMD_MUL(srcpixel, dstpixel)));
+                break;
+            }
+            dstpixel = SIMD_ANDNOT(alphamask, dstpixel);
+            SIMD_STORE(d, dstpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            srcrow += 2;
+            dst += 2;
+            n -= 2;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGR888_BGR888_Modulate_Blend_Scale_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const SIMD_Vec opaque = SIMD_SET(0, 0, 0, 0xFF);
+    const SIMD_Vec v255 = SIMD_SET(0xFF, 0xFF, 0xFF, 0xFF);
+    const Uint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Uint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Uint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Uint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const SIMD_Vec modulate = SIMD_SET(modulateR, modulateG, modulateB, modulateA);
+    const SIMD_Vec modulateAlpha = SIMD_SET(modulateA, modulateA, modulateA, modulateA);
+    SIMD_Vec srcpixel;
+    SIMD_Vec srcA, dstpixel;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        srcrow = info->src + (srcy * info->src_pitch);
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = pixels;
+            Uint32 *d = (n == 1) ? &pixels[2] : dst;
+            int i;
+            for (i = 0; i < 2; ++i) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                pixels[i] = *(const Uint32 *)(srcrow + (srcx * 4));
+                if (n == 1) {
+                    break;
+                }
+                posx += incx;
+            }
+            if (n == 1) {
+                pixels[1] = pixels[0];
+                pixels[2] = pixels[3] = *dst;
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_OR(srcpixel, opaque);
+            srcpixel = SIMD_Div255(SIMD_MUL(srcpixel, modulate));
+            if ((flags & (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) == (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, modulateAlpha)));
+            }
+            srcA = SIMD_PERM(srcpixel, 3, 3, 3, 3);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, srcA)));
+            }
+            dstpixel = SIMD_LOAD(d);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
+            case SDL_COPY_BLEND:
+            case SDL_COPY_PREMULTIPLIED:
+                /* Premultiplied overflow saturates in SIMD_STORE */
+                dstpixel = SIMD_ADD(srcpixel, SIMD_Div255(SIMD_MUL(SIMD_SUB(v255, srcA), dstpixel)));
+                break;
+            case SDL_COPY_ADD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_MIN(SIMD_ADD(srcpixel, dstpixel), v255));
+                break;
+            case SDL_COPY_MOD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_Div255(SIMD_MUL(srcpixel, dstpixel)));
+                break;
+            }
+            dstpixel = SIMD_ANDNOT(alphamask, dstpixel);
+            SIMD_STORE(d, dstpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            dst += 2;
+            n -= 2;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGR888_ARGB8888_Scale_SIMD(SDL_BlitInfo *info)
+{
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const SIMD_Vec opaque = SIMD_SET(0, 0, 0, 0xFF);
+    SIMD_Vec srcpixel;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        srcrow = info->src + (srcy * info->src_pitch);
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = pixels;
+            Uint32 *d = (n == 1) ? &pixels[2] : dst;
+            int i;
+            for (i = 0; i < 2; ++i) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                pixels[i] = *(const Uint32 *)(srcrow + (srcx * 4));
+                if (n == 1) {
+                    break;
+                }
+                posx += incx;
+            }
+            if (n == 1) {
+                pixels[1] = pixels[0];
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_PERM(srcpixel, 2, 1, 0, 3);
+            srcpixel = SIMD_OR(srcpixel, opaque);
+            SIMD_STORE(d, srcpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            dst += 2;
+            n -= 2;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGR888_ARGB8888_Blend_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const SIMD_Vec opaque = SIMD_SET(0, 0, 0, 0xFF);
+    const SIMD_Vec v255 = SIMD_SET(0xFF, 0xFF, 0xFF, 0xFF);
+    SIMD_Vec srcpixel;
+    SIMD_Vec srcA, dstpixel;
+
+    while (info->dst_h--) {
+        const Uint32 *srcrow = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = srcrow;
+            Uint32 *d = dst;
+            if (n == 1) {
+                pixels[0] = pixels[1] = *srcrow;
+                pixels[2] = pixels[3] = *dst;
+                src = &pixels[0];
+                d = &pixels[2];
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_PERM(srcpixel, 2, 1, 0, 3);
+            srcpixel = SIMD_OR(srcpixel, opaque);
+            srcA = SIMD_PERM(srcpixel, 3, 3, 3, 3);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, srcA)));
+            }
+            dstpixel = SIMD_LOAD(d);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
+            case SDL_COPY_BLEND:
+            case SDL_COPY_PREMULTIPLIED:
+                /* Premultiplied overflow saturates in SIMD_STORE */
+                dstpixel = SIMD_ADD(srcpixel, SIMD_Div255(SIMD_MUL(SIMD_SUB(v255, srcA), dstpixel)));
+                break;
+            case SDL_COPY_ADD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_MIN(SIMD_ADD(srcpixel, dstpixel), v255));
+                break;
+            case SDL_COPY_MOD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_Div255(SIMD_MUL(srcpixel, dstpixel)));
+                break;
+            }
+            SIMD_STORE(d, dstpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            srcrow += 2;
+            dst += 2;
+            n -= 2;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGR888_ARGB8888_Blend_Scale_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const SIMD_Vec opaque = SIMD_SET(0, 0, 0, 0xFF);
+    const SIMD_Vec v255 = SIMD_SET(0xFF, 0xFF, 0xFF, 0xFF);
+    SIMD_Vec srcpixel;
+    SIMD_Vec srcA, dstpixel;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        srcrow = info->src + (srcy * info->src_pitch);
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = pixels;
+            Uint32 *d = (n == 1) ? &pixels[2] : dst;
+            int i;
+            for (i = 0; i < 2; ++i) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                pixels[i] = *(const Uint32 *)(srcrow + (srcx * 4));
+                if (n == 1) {
+                    break;
+                }
+                posx += incx;
+            }
+            if (n == 1) {
+                pixels[1] = pixels[0];
+                pixels[2] = pixels[3] = *dst;
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_PERM(srcpixel, 2, 1, 0, 3);
+            srcpixel = SIMD_OR(srcpixel, opaque);
+            srcA = SIMD_PERM(srcpixel, 3, 3, 3, 3);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, srcA)));
+            }
+            dstpixel = SIMD_LOAD(d);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
+            case SDL_COPY_BLEND:
+            case SDL_COPY_PREMULTIPLIED:
+                /* Premultiplied overflow saturates in SIMD_STORE */
+                dstpixel = SIMD_ADD(srcpixel, SIMD_Div255(SIMD_MUL(SIMD_SUB(v255, srcA), dstpixel)));
+                break;
+            case SDL_COPY_ADD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_MIN(SIMD_ADD(srcpixel, dstpixel), v255));
+                break;
+            case SDL_COPY_MOD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_Div255(SIMD_MUL(srcpixel, dstpixel)));
+                break;
+            }
+            SIMD_STORE(d, dstpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            dst += 2;
+            n -= 2;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGR888_ARGB8888_Modulate_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const SIMD_Vec opaque = SIMD_SET(0, 0, 0, 0xFF);
+    const Uint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Uint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Uint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Uint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const SIMD_Vec modulate = SIMD_SET(modulateB, modulateG, modulateR, modulateA);
+    SIMD_Vec srcpixel;
+
+    while (info->dst_h--) {
+        const Uint32 *srcrow = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = srcrow;
+            Uint32 *d = dst;
+            if (n == 1) {
+                pixels[0] = pixels[1] = *srcrow;
+                src = &pixels[0];
+                d = &pixels[2];
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_PERM(srcpixel, 2, 1, 0, 3);
+            srcpixel = SIMD_OR(srcpixel, opaque);
+            srcpixel = SIMD_Div255(SIMD_MUL(srcpixel, modulate));
+            SIMD_STORE(d, srcpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            srcrow += 2;
+            dst += 2;
+            n -= 2;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGR888_ARGB8888_Modulate_Scale_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const SIMD_Vec opaque = SIMD_SET(0, 0, 0, 0xFF);
+    const Uint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Uint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Uint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Uint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const SIMD_Vec modulate = SIMD_SET(modulateB, modulateG, modulateR, modulateA);
+    SIMD_Vec srcpixel;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        srcrow = info->src + (srcy * info->src_pitch);
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = pixels;
+            Uint32 *d = (n == 1) ? &pixels[2] : dst;
+            int i;
+            for (i = 0; i < 2; ++i) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                pixels[i] = *(const Uint32 *)(srcrow + (srcx * 4));
+                if (n == 1) {
+                    break;
+                }
+                posx += incx;
+            }
+            if (n == 1) {
+                pixels[1] = pixels[0];
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_PERM(srcpixel, 2, 1, 0, 3);
+            srcpixel = SIMD_OR(srcpixel, opaque);
+            srcpixel = SIMD_Div255(SIMD_MUL(srcpixel, modulate));
+            SIMD_STORE(d, srcpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            dst += 2;
+            n -= 2;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGR888_ARGB8888_Modulate_Blend_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const SIMD_Vec opaque = SIMD_SET(0, 0, 0, 0xFF);
+    const SIMD_Vec v255 = SIMD_SET(0xFF, 0xFF, 0xFF, 0xFF);
+    const Uint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Uint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Uint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Uint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const SIMD_Vec modulate = SIMD_SET(modulateB, modulateG, modulateR, modulateA);
+    const SIMD_Vec modulateAlpha = SIMD_SET(modulateA, modulateA, modulateA, modulateA);
+    SIMD_Vec srcpixel;
+    SIMD_Vec srcA, dstpixel;
+
+    while (info->dst_h--) {
+        const Uint32 *srcrow = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = srcrow;
+            Uint32 *d = dst;
+            if (n == 1) {
+                pixels[0] = pixels[1] = *srcrow;
+                pixels[2] = pixels[3] = *dst;
+                src = &pixels[0];
+                d = &pixels[2];
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_PERM(srcpixel, 2, 1, 0, 3);
+            srcpixel = SIMD_OR(srcpixel, opaque);
+            srcpixel = SIMD_Div255(SIMD_MUL(srcpixel, modulate));
+            if ((flags & (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) == (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, modulateAlpha)));
+            }
+            srcA = SIMD_PERM(srcpixel, 3, 3, 3, 3);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, srcA)));
+            }
+            dstpixel = SIMD_LOAD(d);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
+            case SDL_COPY_BLEND:
+            case SDL_COPY_PREMULTIPLIED:
+                /* Premultiplied overflow saturates in SIMD_STORE */
+                dstpixel = SIMD_ADD(srcpixel, SIMD_Div255(SIMD_MUL(SIMD_SUB(v255, srcA), dstpixel)));
+                break;
+            case SDL_COPY_ADD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_MIN(SIMD_ADD(srcpixel, dstpixel), v255));
+                break;
+            case SDL_COPY_MOD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_Div255(SIMD_MUL(srcpixel, dstpixel)));
+                break;
+            }
+            SIMD_STORE(d, dstpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            srcrow += 2;
+            dst += 2;
+            n -= 2;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGR888_ARGB8888_Modulate_Blend_Scale_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const SIMD_Vec opaque = SIMD_SET(0, 0, 0, 0xFF);
+    const SIMD_Vec v255 = SIMD_SET(0xFF, 0xFF, 0xFF, 0xFF);
+    const Uint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Uint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Uint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Uint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const SIMD_Vec modulate = SIMD_SET(modulateB, modulateG, modulateR, modulateA);
+    const SIMD_Vec modulateAlpha = SIMD_SET(modulateA, modulateA, modulateA, modulateA);
+    SIMD_Vec srcpixel;
+    SIMD_Vec srcA, dstpixel;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        srcrow = info->src + (srcy * info->src_pitch);
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = pixels;
+            Uint32 *d = (n == 1) ? &pixels[2] : dst;
+            int i;
+            for (i = 0; i < 2; ++i) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                pixels[i] = *(const Uint32 *)(srcrow + (srcx * 4));
+                if (n == 1) {
+                    break;
+                }
+                posx += incx;
+            }
+            if (n == 1) {
+                pixels[1] = pixels[0];
+                pixels[2] = pixels[3] = *dst;
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_PERM(srcpixel, 2, 1, 0, 3);
+            srcpixel = SIMD_OR(srcpixel, opaque);
+            srcpixel = SIMD_Div255(SIMD_MUL(srcpixel, modulate));
+            if ((flags & (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) == (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, modulateAlpha)));
+            }
+            srcA = SIMD_PERM(srcpixel, 3, 3, 3, 3);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, srcA)));
+            }
+            dstpixel = SIMD_LOAD(d);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
+            case SDL_COPY_BLEND:
+            case SDL_COPY_PREMULTIPLIED:
+                /* Premultiplied overflow saturates in SIMD_STORE */
+                dstpixel = SIMD_ADD(srcpixel, SIMD_Div255(SIMD_MUL(SIMD_SUB(v255, srcA), dstpixel)));
+                break;
+            case SDL_COPY_ADD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_MIN(SIMD_ADD(srcpixel, dstpixel), v255));
+                break;
+            case SDL_COPY_MOD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_Div255(SIMD_MUL(srcpixel, dstpixel)));
+                break;
+            }
+            SIMD_STORE(d, dstpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            dst += 2;
+            n -= 2;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ARGB8888_RGB888_Scale_SIMD(SDL_BlitInfo *info)
+{
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    SIMD_Vec srcpixel;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        srcrow = info->src + (srcy * info->src_pitch);
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = pixels;
+            Uint32 *d = (n == 1) ? &pixels[2] : dst;
+            int i;
+            for (i = 0; i < 2; ++i) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                pixels[i] = *(const Uint32 *)(srcrow + (srcx * 4));
+                if (n == 1) {
+                    break;
+                }
+                posx += incx;
+            }
+            if (n == 1) {
+                pixels[1] = pixels[0];
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_ANDNOT(alphamask, srcpixel);
+            SIMD_STORE(d, srcpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            dst += 2;
+            n -= 2;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ARGB8888_RGB888_Blend_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const SIMD_Vec v255 = SIMD_SET(0xFF, 0xFF, 0xFF, 0xFF);
+    SIMD_Vec srcpixel;
+    SIMD_Vec srcA, dstpixel;
+
+    while (info->dst_h--) {
+        const Uint32 *srcrow = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = srcrow;
+            Uint32 *d = dst;
+            if (n == 1) {
+                pixels[0] = pixels[1] = *srcrow;
+                pixels[2] = pixels[3] = *dst;
+                src = &pixels[0];
+                d = &pixels[2];
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcA = SIMD_PERM(srcpixel, 3, 3, 3, 3);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, srcA)));
+            }
+            dstpixel = SIMD_LOAD(d);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
+            case SDL_COPY_BLEND:
+            case SDL_COPY_PREMULTIPLIED:
+                /* Premultiplied overflow saturates in SIMD_STORE */
+                dstpixel = SIMD_ADD(srcpixel, SIMD_Div255(SIMD_MUL(SIMD_SUB(v255, srcA), dstpixel)));
+                break;
+            case SDL_COPY_ADD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_MIN(SIMD_ADD(srcpixel, dstpixel), v255));
+                break;
+            case SDL_COPY_MOD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_Div255(SIMD_MUL(srcpixel, dstpixel)));
+                break;
+            }
+            dstpixel = SIMD_ANDNOT(alphamask, dstpixel);
+            SIMD_STORE(d, dstpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            srcrow += 2;
+            dst += 2;
+            n -= 2;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ARGB8888_RGB888_Blend_Scale_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const SIMD_Vec v255 = SIMD_SET(0xFF, 0xFF, 0xFF, 0xFF);
+    SIMD_Vec srcpixel;
+    SIMD_Vec srcA, dstpixel;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        srcrow = info->src + (srcy * info->src_pitch);
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = pixels;
+            Uint32 *d = (n == 1) ? &pixels[2] : dst;
+            int i;
+            for (i = 0; i < 2; ++i) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                pixels[i] = *(const Uint32 *)(srcrow + (srcx * 4));
+                if (n == 1) {
+                    break;
+                }
+                posx += incx;
+            }
+            if (n == 1) {
+                pixels[1] = pixels[0];
+                pixels[2] = pixels[3] = *dst;
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcA = SIMD_PERM(srcpixel, 3, 3, 3, 3);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, srcA)));
+            }
+            dstpixel = SIMD_LOAD(d);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
+            case SDL_COPY_BLEND:
+            case SDL_COPY_PREMULTIPLIED:
+                /* Premultiplied overflow saturates in SIMD_STORE */
+                dstpixel = SIMD_ADD(srcpixel, SIMD_Div255(SIMD_MUL(SIMD_SUB(v255, srcA), dstpixel)));
+                break;
+            case SDL_COPY_ADD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_MIN(SIMD_ADD(srcpixel, dstpixel), v255));
+                break;
+            case SDL_COPY_MOD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_Div255(SIMD_MUL(srcpixel, dstpixel)));
+                break;
+            }
+            dstpixel = SIMD_ANDNOT(alphamask, dstpixel);
+            SIMD_STORE(d, dstpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            dst += 2;
+            n -= 2;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ARGB8888_RGB888_Modulate_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const Uint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Uint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Uint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Uint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const SIMD_Vec modulate = SIMD_SET(modulateB, modulateG, modulateR, modulateA);
+    SIMD_Vec srcpixel;
+
+    while (info->dst_h--) {
+        const Uint32 *srcrow = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = srcrow;
+            Uint32 *d = dst;
+            if (n == 1) {
+                pixels[0] = pixels[1] = *srcrow;
+                src = &pixels[0];
+                d = &pixels[2];
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_Div255(SIMD_MUL(srcpixel, modulate));
+            srcpixel = SIMD_ANDNOT(alphamask, srcpixel);
+            SIMD_STORE(d, srcpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            srcrow += 2;
+            dst += 2;
+            n -= 2;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ARGB8888_RGB888_Modulate_Scale_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const Uint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Uint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Uint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Uint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const SIMD_Vec modulate = SIMD_SET(modulateB, modulateG, modulateR, modulateA);
+    SIMD_Vec srcpixel;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        srcrow = info->src + (srcy * info->src_pitch);
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = pixels;
+            Uint32 *d = (n == 1) ? &pixels[2] : dst;
+            int i;
+            for (i = 0; i < 2; ++i) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                pixels[i] = *(const Uint32 *)(srcrow + (srcx * 4));
+                if (n == 1) {
+                    break;
+                }
+                posx += incx;
+            }
+            if (n == 1) {
+                pixels[1] = pixels[0];
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_Div255(SIMD_MUL(srcpixel, modulate));
+            srcpixel = SIMD_ANDNOT(alphamask, srcpixel);
+            SIMD_STORE(d, srcpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            dst += 2;
+            n -= 2;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ARGB8888_RGB888_Modulate_Blend_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const SIMD_Vec v255 = SIMD_SET(0xFF, 0xFF, 0xFF, 0xFF);
+    const Uint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Uint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Uint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Uint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const SIMD_Vec modulate = SIMD_SET(modulateB, modulateG, modulateR, modulateA);
+    const SIMD_Vec modulateAlpha = SIMD_SET(modulateA, modulateA, modulateA, modulateA);
+    SIMD_Vec srcpixel;
+    SIMD_Vec srcA, dstpixel;
+
+    while (info->dst_h--) {
+        const Uint32 *srcrow = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = srcrow;
+            Uint32 *d = dst;
+            if (n == 1) {
+                pixels[0] = pixels[1] = *srcrow;
+                pixels[2] = pixels[3] = *dst;
+                src = &pixels[0];
+                d = &pixels[2];
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_Div255(SIMD_MUL(srcpixel, modulate));
+            if ((flags & (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) == (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, modulateAlpha)));
+            }
+            srcA = SIMD_PERM(srcpixel, 3, 3, 3, 3);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, srcA)));
+            }
+            dstpixel = SIMD_LOAD(d);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
+            case SDL_COPY_BLEND:
+            case SDL_COPY_PREMULTIPLIED:
+                /* Premultiplied overflow saturates in SIMD_STORE */
+                dstpixel = SIMD_ADD(srcpixel, SIMD_Div255(SIMD_MUL(SIMD_SUB(v255, srcA), dstpixel)));
+                break;
+            case SDL_COPY_ADD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_MIN(SIMD_ADD(srcpixel, dstpixel), v255));
+                break;
+            case SDL_COPY_MOD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_Div255(SIMD_MUL(srcpixel, dstpixel)));
+                break;
+            }
+            dstpixel = SIMD_ANDNOT(alphamask, dstpixel);
+            SIMD_STORE(d, dstpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            srcrow += 2;
+            dst += 2;
+            n -= 2;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ARGB8888_RGB888_Modulate_Blend_Scale_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const SIMD_Vec v255 = SIMD_SET(0xFF, 0xFF, 0xFF, 0xFF);
+    const Uint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Uint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Uint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Uint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const SIMD_Vec modulate = SIMD_SET(modulateB, modulateG, modulateR, modulateA);
+    const SIMD_Vec modulateAlpha = SIMD_SET(modulateA, modulateA, modulateA, modulateA);
+    SIMD_Vec srcpixel;
+    SIMD_Vec srcA, dstpixel;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        srcrow = info->src + (srcy * info->src_pitch);
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = pixels;
+            Uint32 *d = (n == 1) ? &pixels[2] : dst;
+            int i;
+            for (i = 0; i < 2; ++i) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                pixels[i] = *(const Uint32 *)(srcrow + (srcx * 4));
+                if (n == 1) {
+                    break;
+                }
+                posx += incx;
+            }
+            if (n == 1) {
+                pixels[1] = pixels[0];
+                pixels[2] = pixels[3] = *dst;
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_Div255(SIMD_MUL(srcpixel, modulate));
+            if ((flags & (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) == (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, modulateAlpha)));
+            }
+            srcA = SIMD_PERM(srcpixel, 3, 3, 3, 3);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, srcA)));
+            }
+            dstpixel = SIMD_LOAD(d);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
+            case SDL_COPY_BLEND:
+            case SDL_COPY_PREMULTIPLIED:
+                /* Premultiplied overflow saturates in SIMD_STORE */
+                dstpixel = SIMD_ADD(srcpixel, SIMD_Div255(SIMD_MUL(SIMD_SUB(v255, srcA), dstpixel)));
+                break;
+            case SDL_COPY_ADD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_MIN(SIMD_ADD(srcpixel, dstpixel), v255));
+                break;
+            case SDL_COPY_MOD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_Div255(SIMD_MUL(srcpixel, dstpixel)));
+                break;
+            }
+            dstpixel = SIMD_ANDNOT(alphamask, dstpixel);
+            SIMD_STORE(d, dstpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            dst += 2;
+            n -= 2;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ARGB8888_BGR888_Scale_SIMD(SDL_BlitInfo *info)
+{
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    SIMD_Vec srcpixel;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        srcrow = info->src + (srcy * info->src_pitch);
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = pixels;
+            Uint32 *d = (n == 1) ? &pixels[2] : dst;
+            int i;
+            for (i = 0; i < 2; ++i) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                pixels[i] = *(const Uint32 *)(srcrow + (srcx * 4));
+                if (n == 1) {
+                    break;
+                }
+                posx += incx;
+            }
+            if (n == 1) {
+                pixels[1] = pixels[0];
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_PERM(srcpixel, 2, 1, 0, 3);
+            srcpixel = SIMD_ANDNOT(alphamask, srcpixel);
+            SIMD_STORE(d, srcpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            dst += 2;
+            n -= 2;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ARGB8888_BGR888_Blend_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const SIMD_Vec v255 = SIMD_SET(0xFF, 0xFF, 0xFF, 0xFF);
+    SIMD_Vec srcpixel;
+    SIMD_Vec srcA, dstpixel;
+
+    while (info->dst_h--) {
+        const Uint32 *srcrow = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = srcrow;
+            Uint32 *d = dst;
+            if (n == 1) {
+                pixels[0] = pixels[1] = *srcrow;
+                pixels[2] = pixels[3] = *dst;
+                src = &pixels[0];
+                d = &pixels[2];
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_PERM(srcpixel, 2, 1, 0, 3);
+            srcA = SIMD_PERM(srcpixel, 3, 3, 3, 3);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, srcA)));
+            }
+            dstpixel = SIMD_LOAD(d);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
+            case SDL_COPY_BLEND:
+            case SDL_COPY_PREMULTIPLIED:
+                /* Premultiplied overflow saturates in SIMD_STORE */
+                dstpixel = SIMD_ADD(srcpixel, SIMD_Div255(SIMD_MUL(SIMD_SUB(v255, srcA), dstpixel)));
+                break;
+            case SDL_COPY_ADD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_MIN(SIMD_ADD(srcpixel, dstpixel), v255));
+                break;
+            case SDL_COPY_MOD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_Div255(SIMD_MUL(srcpixel, dstpixel)));
+                break;
+            }
+            dstpixel = SIMD_ANDNOT(alphamask, dstpixel);
+            SIMD_STORE(d, dstpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            srcrow += 2;
+            dst += 2;
+            n -= 2;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ARGB8888_BGR888_Blend_Scale_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const SIMD_Vec v255 = SIMD_SET(0xFF, 0xFF, 0xFF, 0xFF);
+    SIMD_Vec srcpixel;
+    SIMD_Vec srcA, dstpixel;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        srcrow = info->src + (srcy * info->src_pitch);
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = pixels;
+            Uint32 *d = (n == 1) ? &pixels[2] : dst;
+            int i;
+            for (i = 0; i < 2; ++i) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                pixels[i] = *(const Uint32 *)(srcrow + (srcx * 4));
+                if (n == 1) {
+                    break;
+                }
+                posx += incx;
+            }
+            if (n == 1) {
+                pixels[1] = pixels[0];
+                pixels[2] = pixels[3] = *dst;
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_PERM(srcpixel, 2, 1, 0, 3);
+            srcA = SIMD_PERM(srcpixel, 3, 3, 3, 3);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, srcA)));
+            }
+            dstpixel = SIMD_LOAD(d);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
+            case SDL_COPY_BLEND:
+            case SDL_COPY_PREMULTIPLIED:
+                /* Premultiplied overflow saturates in SIMD_STORE */
+                dstpixel = SIMD_ADD(srcpixel, SIMD_Div255(SIMD_MUL(SIMD_SUB(v255, srcA), dstpixel)));
+                break;
+            case SDL_COPY_ADD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_MIN(SIMD_ADD(srcpixel, dstpixel), v255));
+                break;
+            case SDL_COPY_MOD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_Div255(SIMD_MUL(srcpixel, dstpixel)));
+                break;
+            }
+            dstpixel = SIMD_ANDNOT(alphamask, dstpixel);
+            SIMD_STORE(d, dstpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            dst += 2;
+            n -= 2;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ARGB8888_BGR888_Modulate_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const Uint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Uint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Uint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Uint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const SIMD_Vec modulate = SIMD_SET(modulateR, modulateG, modulateB, modulateA);
+    SIMD_Vec srcpixel;
+
+    while (info->dst_h--) {
+        const Uint32 *srcrow = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = srcrow;
+            Uint32 *d = dst;
+            if (n == 1) {
+                pixels[0] = pixels[1] = *srcrow;
+                src = &pixels[0];
+                d = &pixels[2];
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_PERM(srcpixel, 2, 1, 0, 3);
+            srcpixel = SIMD_Div255(SIMD_MUL(srcpixel, modulate));
+            srcpixel = SIMD_ANDNOT(alphamask, srcpixel);
+            SIMD_STORE(d, srcpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            srcrow += 2;
+            dst += 2;
+            n -= 2;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ARGB8888_BGR888_Modulate_Scale_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const Uint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Uint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Uint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Uint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const SIMD_Vec modulate = SIMD_SET(modulateR, modulateG, modulateB, modulateA);
+    SIMD_Vec srcpixel;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        srcrow = info->src + (srcy * info->src_pitch);
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = pixels;
+            Uint32 *d = (n == 1) ? &pixels[2] : dst;
+            int i;
+            for (i = 0; i < 2; ++i) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                pixels[i] = *(const Uint32 *)(srcrow + (srcx * 4));
+                if (n == 1) {
+                    break;
+                }
+                posx += incx;
+            }
+            if (n == 1) {
+                pixels[1] = pixels[0];
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_PERM(srcpixel, 2, 1, 0, 3);
+            srcpixel = SIMD_Div255(SIMD_MUL(srcpixel, modulate));
+            srcpixel = SIMD_ANDNOT(alphamask, srcpixel);
+            SIMD_STORE(d, srcpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            dst += 2;
+            n -= 2;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ARGB8888_BGR888_Modulate_Blend_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const SIMD_Vec v255 = SIMD_SET(0xFF, 0xFF, 0xFF, 0xFF);
+    const Uint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Uint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Uint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Uint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const SIMD_Vec modulate = SIMD_SET(modulateR, modulateG, modulateB, modulateA);
+    const SIMD_Vec modulateAlpha = SIMD_SET(modulateA, modulateA, modulateA, modulateA);
+    SIMD_Vec srcpixel;
+    SIMD_Vec srcA, dstpixel;
+
+    while (info->dst_h--) {
+        const Uint32 *srcrow = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = srcrow;
+            Uint32 *d = dst;
+            if (n == 1) {
+                pixels[0] = pixels[1] = *srcrow;
+                pixels[2] = pixels[3] = *dst;
+                src = &pixels[0];
+                d = &pixels[2];
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_PERM(srcpixel, 2, 1, 0, 3);
+            srcpixel = SIMD_Div255(SIMD_MUL(srcpixel, modulate));
+            if ((flags & (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) == (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, modulateAlpha)));
+            }
+            srcA = SIMD_PERM(srcpixel, 3, 3, 3, 3);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, srcA)));
+            }
+            dstpixel = SIMD_LOAD(d);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
+            case SDL_COPY_BLEND:
+            case SDL_COPY_PREMULTIPLIED:
+                /* Premultiplied overflow saturates in SIMD_STORE */
+                dstpixel = SIMD_ADD(srcpixel, SIMD_Div255(SIMD_MUL(SIMD_SUB(v255, srcA), dstpixel)));
+                break;
+            case SDL_COPY_ADD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_MIN(SIMD_ADD(srcpixel, dstpixel), v255));
+                break;
+            case SDL_COPY_MOD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_Div255(SIMD_MUL(srcpixel, dstpixel)));
+                break;
+            }
+            dstpixel = SIMD_ANDNOT(alphamask, dstpixel);
+            SIMD_STORE(d, dstpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            srcrow += 2;
+            dst += 2;
+            n -= 2;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ARGB8888_BGR888_Modulate_Blend_Scale_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const SIMD_Vec v255 = SIMD_SET(0xFF, 0xFF, 0xFF, 0xFF);
+    const Uint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Uint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Uint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Uint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const SIMD_Vec modulate = SIMD_SET(modulateR, modulateG, modulateB, modulateA);
+    const SIMD_Vec modulateAlpha = SIMD_SET(modulateA, modulateA, modulateA, modulateA);
+    SIMD_Vec srcpixel;
+    SIMD_Vec srcA, dstpixel;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        srcrow = info->src + (srcy * info->src_pitch);
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = pixels;
+            Uint32 *d = (n == 1) ? &pixels[2] : dst;
+            int i;
+            for (i = 0; i < 2; ++i) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                pixels[i] = *(const Uint32 *)(srcrow + (srcx * 4));
+                if (n == 1) {
+                    break;
+                }
+                posx += incx;
+            }
+            if (n == 1) {
+                pixels[1] = pixels[0];
+                pixels[2] = pixels[3] = *dst;
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_PERM(srcpixel, 2, 1, 0, 3);
+            srcpixel = SIMD_Div255(SIMD_MUL(srcpixel, modulate));
+            if ((flags & (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) == (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, modulateAlpha)));
+            }
+            srcA = SIMD_PERM(srcpixel, 3, 3, 3, 3);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, srcA)));
+            }
+            dstpixel = SIMD_LOAD(d);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
+            case SDL_COPY_BLEND:
+            case SDL_COPY_PREMULTIPLIED:
+                /* Premultiplied overflow saturates in SIMD_STORE */
+                dstpixel = SIMD_ADD(srcpixel, SIMD_Div255(SIMD_MUL(SIMD_SUB(v255, srcA), dstpixel)));
+                break;
+            case SDL_COPY_ADD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_MIN(SIMD_ADD(srcpixel, dstpixel), v255));
+                break;
+            case SDL_COPY_MOD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_Div255(SIMD_MUL(srcpixel, dstpixel)));
+                break;
+            }
+            dstpixel = SIMD_ANDNOT(alphamask, dstpixel);
+            SIMD_STORE(d, dstpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            dst += 2;
+            n -= 2;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ARGB8888_ARGB8888_Scale_SIMD(SDL_BlitInfo *info)
+{
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    SIMD_Vec srcpixel;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        srcrow = info->src + (srcy * info->src_pitch);
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = pixels;
+            Uint32 *d = (n == 1) ? &pixels[2] : dst;
+            int i;
+            for (i = 0; i < 2; ++i) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                pixels[i] = *(const Uint32 *)(srcrow + (srcx * 4));
+                if (n == 1) {
+                    break;
+                }
+                posx += incx;
+            }
+            if (n == 1) {
+                pixels[1] = pixels[0];
+            }
+            srcpixel = SIMD_LOAD(src);
+            SIMD_STORE(d, srcpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            dst += 2;
+            n -= 2;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ARGB8888_ARGB8888_Blend_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const SIMD_Vec v255 = SIMD_SET(0xFF, 0xFF, 0xFF, 0xFF);
+    SIMD_Vec srcpixel;
+    SIMD_Vec srcA, dstpixel;
+
+    while (info->dst_h--) {
+        const Uint32 *srcrow = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = srcrow;
+            Uint32 *d = dst;
+            if (n == 1) {
+                pixels[0] = pixels[1] = *srcrow;
+                pixels[2] = pixels[3] = *dst;
+                src = &pixels[0];
+                d = &pixels[2];
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcA = SIMD_PERM(srcpixel, 3, 3, 3, 3);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, srcA)));
+            }
+            dstpixel = SIMD_LOAD(d);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
+            case SDL_COPY_BLEND:
+            case SDL_COPY_PREMULTIPLIED:
+                /* Premultiplied overflow saturates in SIMD_STORE */
+                dstpixel = SIMD_ADD(srcpixel, SIMD_Div255(SIMD_MUL(SIMD_SUB(v255, srcA), dstpixel)));
+                break;
+            case SDL_COPY_ADD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_MIN(SIMD_ADD(srcpixel, dstpixel), v255));
+                break;
+            case SDL_COPY_MOD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_Div255(SIMD_MUL(srcpixel, dstpixel)));
+                break;
+            }
+            SIMD_STORE(d, dstpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            srcrow += 2;
+            dst += 2;
+            n -= 2;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ARGB8888_ARGB8888_Blend_Scale_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const SIMD_Vec v255 = SIMD_SET(0xFF, 0xFF, 0xFF, 0xFF);
+    SIMD_Vec srcpixel;
+    SIMD_Vec srcA, dstpixel;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        srcrow = info->src + (srcy * info->src_pitch);
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = pixels;
+            Uint32 *d = (n == 1) ? &pixels[2] : dst;
+            int i;
+            for (i = 0; i < 2; ++i) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                pixels[i] = *(const Uint32 *)(srcrow + (srcx * 4));
+                if (n == 1) {
+                    break;
+                }
+                posx += incx;
+            }
+            if (n == 1) {
+                pixels[1] = pixels[0];
+                pixels[2] = pixels[3] = *dst;
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcA = SIMD_PERM(srcpixel, 3, 3, 3, 3);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, srcA)));
+            }
+            dstpixel = SIMD_LOAD(d);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
+            case SDL_COPY_BLEND:
+            case SDL_COPY_PREMULTIPLIED:
+                /* Premultiplied overflow saturates in SIMD_STORE */
+                dstpixel = SIMD_ADD(srcpixel, SIMD_Div255(SIMD_MUL(SIMD_SUB(v255, srcA), dstpixel)));
+                break;
+            case SDL_COPY_ADD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_MIN(SIMD_ADD(srcpixel, dstpixel), v255));
+                break;
+            case SDL_COPY_MOD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_Div255(SIMD_MUL(srcpixel, dstpixel)));
+                break;
+            }
+            SIMD_STORE(d, dstpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            dst += 2;
+            n -= 2;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ARGB8888_ARGB8888_Modulate_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const Uint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Uint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Uint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Uint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const SIMD_Vec modulate = SIMD_SET(modulateB, modulateG, modulateR, modulateA);
+    SIMD_Vec srcpixel;
+
+    while (info->dst_h--) {
+        const Uint32 *srcrow = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = srcrow;
+            Uint32 *d = dst;
+            if (n == 1) {
+                pixels[0] = pixels[1] = *srcrow;
+                src = &pixels[0];
+                d = &pixels[2];
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_Div255(SIMD_MUL(srcpixel, modulate));
+            SIMD_STORE(d, srcpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            srcrow += 2;
+            dst += 2;
+            n -= 2;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ARGB8888_ARGB8888_Modulate_Scale_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const Uint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Uint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Uint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Uint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const SIMD_Vec modulate = SIMD_SET(modulateB, modulateG, modulateR, modulateA);
+    SIMD_Vec srcpixel;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        srcrow = info->src + (srcy * info->src_pitch);
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = pixels;
+            Uint32 *d = (n == 1) ? &pixels[2] : dst;
+            int i;
+            for (i = 0; i < 2; ++i) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                pixels[i] = *(const Uint32 *)(srcrow + (srcx * 4));
+                if (n == 1) {
+                    break;
+                }
+                posx += incx;
+            }
+            if (n == 1) {
+                pixels[1] = pixels[0];
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_Div255(SIMD_MUL(srcpixel, modulate));
+            SIMD_STORE(d, srcpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            dst += 2;
+            n -= 2;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const SIMD_Vec v255 = SIMD_SET(0xFF, 0xFF, 0xFF, 0xFF);
+    const Uint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Uint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Uint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Uint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const SIMD_Vec modulate = SIMD_SET(modulateB, modulateG, modulateR, modulateA);
+    const SIMD_Vec modulateAlpha = SIMD_SET(modulateA, modulateA, modulateA, modulateA);
+    SIMD_Vec srcpixel;
+    SIMD_Vec srcA, dstpixel;
+
+    while (info->dst_h--) {
+        const Uint32 *srcrow = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = srcrow;
+            Uint32 *d = dst;
+            if (n == 1) {
+                pixels[0] = pixels[1] = *srcrow;
+                pixels[2] = pixels[3] = *dst;
+                src = &pixels[0];
+                d = &pixels[2];
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_Div255(SIMD_MUL(srcpixel, modulate));
+            if ((flags & (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) == (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, modulateAlpha)));
+            }
+            srcA = SIMD_PERM(srcpixel, 3, 3, 3, 3);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, srcA)));
+            }
+            dstpixel = SIMD_LOAD(d);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
+            case SDL_COPY_BLEND:
+            case SDL_COPY_PREMULTIPLIED:
+                /* Premultiplied overflow saturates in SIMD_STORE */
+                dstpixel = SIMD_ADD(srcpixel, SIMD_Div255(SIMD_MUL(SIMD_SUB(v255, srcA), dstpixel)));
+                break;
+            case SDL_COPY_ADD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_MIN(SIMD_ADD(srcpixel, dstpixel), v255));
+                break;
+            case SDL_COPY_MOD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_Div255(SIMD_MUL(srcpixel, dstpixel)));
+                break;
+            }
+            SIMD_STORE(d, dstpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            srcrow += 2;
+            dst += 2;
+            n -= 2;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_Scale_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const SIMD_Vec v255 = SIMD_SET(0xFF, 0xFF, 0xFF, 0xFF);
+    const Uint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Uint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Uint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Uint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const SIMD_Vec modulate = SIMD_SET(modulateB, modulateG, modulateR, modulateA);
+    const SIMD_Vec modulateAlpha = SIMD_SET(modulateA, modulateA, modulateA, modulateA);
+    SIMD_Vec srcpixel;
+    SIMD_Vec srcA, dstpixel;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        srcrow = info->src + (srcy * info->src_pitch);
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = pixels;
+            Uint32 *d = (n == 1) ? &pixels[2] : dst;
+            int i;
+            for (i = 0; i < 2; ++i) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                pixels[i] = *(const Uint32 *)(srcrow + (srcx * 4));
+                if (n == 1) {
+                    break;
+                }
+                posx += incx;
+            }
+            if (n == 1) {
+                pixels[1] = pixels[0];
+                pixels[2] = pixels[3] = *dst;
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_Div255(SIMD_MUL(srcpixel, modulate));
+            if ((flags & (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) == (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, modulateAlpha)));
+            }
+            srcA = SIMD_PERM(srcpixel, 3, 3, 3, 3);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, srcA)));
+            }
+            dstpixel = SIMD_LOAD(d);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
+            case SDL_COPY_BLEND:
+            case SDL_COPY_PREMULTIPLIED:
+                /* Premultiplied overflow saturates in SIMD_STORE */
+                dstpixel = SIMD_ADD(srcpixel, SIMD_Div255(SIMD_MUL(SIMD_SUB(v255, srcA), dstpixel)));
+                break;
+            case SDL_COPY_ADD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_MIN(SIMD_ADD(srcpixel, dstpixel), v255));
+                break;
+            case SDL_COPY_MOD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_Div255(SIMD_MUL(srcpixel, dstpixel)));
+                break;
+            }
+            SIMD_STORE(d, dstpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            dst += 2;
+            n -= 2;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGBA8888_RGB888_Scale_SIMD(SDL_BlitInfo *info)
+{
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    SIMD_Vec srcpixel;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        srcrow = info->src + (srcy * info->src_pitch);
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = pixels;
+            Uint32 *d = (n == 1) ? &pixels[2] : dst;
+            int i;
+            for (i = 0; i < 2; ++i) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                pixels[i] = *(const Uint32 *)(srcrow + (srcx * 4));
+                if (n == 1) {
+                    break;
+                }
+                posx += incx;
+            }
+            if (n == 1) {
+                pixels[1] = pixels[0];
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_PERM(srcpixel, 1, 2, 3, 0);
+            srcpixel = SIMD_ANDNOT(alphamask, srcpixel);
+            SIMD_STORE(d, srcpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            dst += 2;
+            n -= 2;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGBA8888_RGB888_Blend_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const SIMD_Vec v255 = SIMD_SET(0xFF, 0xFF, 0xFF, 0xFF);
+    SIMD_Vec srcpixel;
+    SIMD_Vec srcA, dstpixel;
+
+    while (info->dst_h--) {
+        const Uint32 *srcrow = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = srcrow;
+            Uint32 *d = dst;
+            if (n == 1) {
+                pixels[0] = pixels[1] = *srcrow;
+                pixels[2] = pixels[3] = *dst;
+                src = &pixels[0];
+                d = &pixels[2];
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_PERM(srcpixel, 1, 2, 3, 0);
+            srcA = SIMD_PERM(srcpixel, 3, 3, 3, 3);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, srcA)));
+            }
+            dstpixel = SIMD_LOAD(d);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
+            case SDL_COPY_BLEND:
+            case SDL_COPY_PREMULTIPLIED:
+                /* Premultiplied overflow saturates in SIMD_STORE */
+                dstpixel = SIMD_ADD(srcpixel, SIMD_Div255(SIMD_MUL(SIMD_SUB(v255, srcA), dstpixel)));
+                break;
+            case SDL_COPY_ADD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_MIN(SIMD_ADD(srcpixel, dstpixel), v255));
+                break;
+            case SDL_COPY_MOD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_Div255(SIMD_MUL(srcpixel, dstpixel)));
+                break;
+            }
+            dstpixel = SIMD_ANDNOT(alphamask, dstpixel);
+            SIMD_STORE(d, dstpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            srcrow += 2;
+            dst += 2;
+            n -= 2;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGBA8888_RGB888_Blend_Scale_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const SIMD_Vec v255 = SIMD_SET(0xFF, 0xFF, 0xFF, 0xFF);
+    SIMD_Vec srcpixel;
+    SIMD_Vec srcA, dstpixel;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        srcrow = info->src + (srcy * info->src_pitch);
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = pixels;
+            Uint32 *d = (n == 1) ? &pixels[2] : dst;
+            int i;
+            for (i = 0; i < 2; ++i) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                pixels[i] = *(const Uint32 *)(srcrow + (srcx * 4));
+                if (n == 1) {
+                    break;
+                }
+                posx += incx;
+            }
+            if (n == 1) {
+                pixels[1] = pixels[0];
+                pixels[2] = pixels[3] = *dst;
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_PERM(srcpixel, 1, 2, 3, 0);
+            srcA = SIMD_PERM(srcpixel, 3, 3, 3, 3);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, srcA)));
+            }
+            dstpixel = SIMD_LOAD(d);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
+            case SDL_COPY_BLEND:
+            case SDL_COPY_PREMULTIPLIED:
+                /* Premultiplied overflow saturates in SIMD_STORE */
+                dstpixel = SIMD_ADD(srcpixel, SIMD_Div255(SIMD_MUL(SIMD_SUB(v255, srcA), dstpixel)));
+                break;
+            case SDL_COPY_ADD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_MIN(SIMD_ADD(srcpixel, dstpixel), v255));
+                break;
+            case SDL_COPY_MOD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_Div255(SIMD_MUL(srcpixel, dstpixel)));
+                break;
+            }
+            dstpixel = SIMD_ANDNOT(alphamask, dstpixel);
+            SIMD_STORE(d, dstpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            dst += 2;
+            n -= 2;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGBA8888_RGB888_Modulate_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const Uint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Uint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Uint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Uint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const SIMD_Vec modulate = SIMD_SET(modulateB, modulateG, modulateR, modulateA);
+    SIMD_Vec srcpixel;
+
+    while (info->dst_h--) {
+        const Uint32 *srcrow = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = srcrow;
+            Uint32 *d = dst;
+            if (n == 1) {
+                pixels[0] = pixels[1] = *srcrow;
+                src = &pixels[0];
+                d = &pixels[2];
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_PERM(srcpixel, 1, 2, 3, 0);
+            srcpixel = SIMD_Div255(SIMD_MUL(srcpixel, modulate));
+            srcpixel = SIMD_ANDNOT(alphamask, srcpixel);
+            SIMD_STORE(d, srcpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            srcrow += 2;
+            dst += 2;
+            n -= 2;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGBA8888_RGB888_Modulate_Scale_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const Uint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Uint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Uint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Uint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const SIMD_Vec modulate = SIMD_SET(modulateB, modulateG, modulateR, modulateA);
+    SIMD_Vec srcpixel;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        srcrow = info->src + (srcy * info->src_pitch);
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = pixels;
+            Uint32 *d = (n == 1) ? &pixels[2] : dst;
+            int i;
+            for (i = 0; i < 2; ++i) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                pixels[i] = *(const Uint32 *)(srcrow + (srcx * 4));
+                if (n == 1) {
+                    break;
+                }
+                posx += incx;
+            }
+            if (n == 1) {
+                pixels[1] = pixels[0];
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_PERM(srcpixel, 1, 2, 3, 0);
+            srcpixel = SIMD_Div255(SIMD_MUL(srcpixel, modulate));
+            srcpixel = SIMD_ANDNOT(alphamask, srcpixel);
+            SIMD_STORE(d, srcpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            dst += 2;
+            n -= 2;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGBA8888_RGB888_Modulate_Blend_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const SIMD_Vec v255 = SIMD_SET(0xFF, 0xFF, 0xFF, 0xFF);
+    const Uint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Uint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Uint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Uint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const SIMD_Vec modulate = SIMD_SET(modulateB, modulateG, modulateR, modulateA);
+    const SIMD_Vec modulateAlpha = SIMD_SET(modulateA, modulateA, modulateA, modulateA);
+    SIMD_Vec srcpixel;
+    SIMD_Vec srcA, dstpixel;
+
+    while (info->dst_h--) {
+        const Uint32 *srcrow = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = srcrow;
+            Uint32 *d = dst;
+            if (n == 1) {
+                pixels[0] = pixels[1] = *srcrow;
+                pixels[2] = pixels[3] = *dst;
+                src = &pixels[0];
+                d = &pixels[2];
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_PERM(srcpixel, 1, 2, 3, 0);
+            srcpixel = SIMD_Div255(SIMD_MUL(srcpixel, modulate));
+            if ((flags & (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) == (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, modulateAlpha)));
+            }
+            srcA = SIMD_PERM(srcpixel, 3, 3, 3, 3);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, srcA)));
+            }
+            dstpixel = SIMD_LOAD(d);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
+            case SDL_COPY_BLEND:
+            case SDL_COPY_PREMULTIPLIED:
+                /* Premultiplied overflow saturates in SIMD_STORE */
+                dstpixel = SIMD_ADD(srcpixel, SIMD_Div255(SIMD_MUL(SIMD_SUB(v255, srcA), dstpixel)));
+                break;
+            case SDL_COPY_ADD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_MIN(SIMD_ADD(srcpixel, dstpixel), v255));
+                break;
+            case SDL_COPY_MOD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_Div255(SIMD_MUL(srcpixel, dstpixel)));
+                break;
+            }
+            dstpixel = SIMD_ANDNOT(alphamask, dstpixel);
+            SIMD_STORE(d, dstpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            srcrow += 2;
+            dst += 2;
+            n -= 2;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGBA8888_RGB888_Modulate_Blend_Scale_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const SIMD_Vec v255 = SIMD_SET(0xFF, 0xFF, 0xFF, 0xFF);
+    const Uint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Uint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Uint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Uint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const SIMD_Vec modulate = SIMD_SET(modulateB, modulateG, modulateR, modulateA);
+    const SIMD_Vec modulateAlpha = SIMD_SET(modulateA, modulateA, modulateA, modulateA);
+    SIMD_Vec srcpixel;
+    SIMD_Vec srcA, dstpixel;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        srcrow = info->src + (srcy * info->src_pitch);
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = pixels;
+            Uint32 *d = (n == 1) ? &pixels[2] : dst;
+            int i;
+            for (i = 0; i < 2; ++i) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                pixels[i] = *(const Uint32 *)(srcrow + (srcx * 4));
+                if (n == 1) {
+                    break;
+                }
+                posx += incx;
+            }
+            if (n == 1) {
+                pixels[1] = pixels[0];
+                pixels[2] = pixels[3] = *dst;
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_PERM(srcpixel, 1, 2, 3, 0);
+            srcpixel = SIMD_Div255(SIMD_MUL(srcpixel, modulate));
+            if ((flags & (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) == (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, modulateAlpha)));
+            }
+            srcA = SIMD_PERM(srcpixel, 3, 3, 3, 3);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, srcA)));
+            }
+            dstpixel = SIMD_LOAD(d);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
+            case SDL_COPY_BLEND:
+            case SDL_COPY_PREMULTIPLIED:
+                /* Premultiplied overflow saturates in SIMD_STORE */
+                dstpixel = SIMD_ADD(srcpixel, SIMD_Div255(SIMD_MUL(SIMD_SUB(v255, srcA), dstpixel)));
+                break;
+            case SDL_COPY_ADD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_MIN(SIMD_ADD(srcpixel, dstpixel), v255));
+                break;
+            case SDL_COPY_MOD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_Div255(SIMD_MUL(srcpixel, dstpixel)));
+                break;
+            }
+            dstpixel = SIMD_ANDNOT(alphamask, dstpixel);
+            SIMD_STORE(d, dstpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            dst += 2;
+            n -= 2;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGBA8888_BGR888_Scale_SIMD(SDL_BlitInfo *info)
+{
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    SIMD_Vec srcpixel;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        srcrow = info->src + (srcy * info->src_pitch);
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = pixels;
+            Uint32 *d = (n == 1) ? &pixels[2] : dst;
+            int i;
+            for (i = 0; i < 2; ++i) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                pixels[i] = *(const Uint32 *)(srcrow + (srcx * 4));
+                if (n == 1) {
+                    break;
+                }
+                posx += incx;
+            }
+            if (n == 1) {
+                pixels[1] = pixels[0];
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_PERM(srcpixel, 3, 2, 1, 0);
+            srcpixel = SIMD_ANDNOT(alphamask, srcpixel);
+            SIMD_STORE(d, srcpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            dst += 2;
+            n -= 2;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGBA8888_BGR888_Blend_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const SIMD_Vec v255 = SIMD_SET(0xFF, 0xFF, 0xFF, 0xFF);
+    SIMD_Vec srcpixel;
+    SIMD_Vec srcA, dstpixel;
+
+    while (info->dst_h--) {
+        const Uint32 *srcrow = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = srcrow;
+            Uint32 *d = dst;
+            if (n == 1) {
+                pixels[0] = pixels[1] = *srcrow;
+                pixels[2] = pixels[3] = *dst;
+                src = &pixels[0];
+                d = &pixels[2];
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_PERM(srcpixel, 3, 2, 1, 0);
+            srcA = SIMD_PERM(srcpixel, 3, 3, 3, 3);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, srcA)));
+            }
+            dstpixel = SIMD_LOAD(d);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
+            case SDL_COPY_BLEND:
+            case SDL_COPY_PREMULTIPLIED:
+                /* Premultiplied overflow saturates in SIMD_STORE */
+                dstpixel = SIMD_ADD(srcpixel, SIMD_Div255(SIMD_MUL(SIMD_SUB(v255, srcA), dstpixel)));
+                break;
+            case SDL_COPY_ADD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_MIN(SIMD_ADD(srcpixel, dstpixel), v255));
+                break;
+            case SDL_COPY_MOD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_Div255(SIMD_MUL(srcpixel, dstpixel)));
+                break;
+            }
+            dstpixel = SIMD_ANDNOT(alphamask, dstpixel);
+            SIMD_STORE(d, dstpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            srcrow += 2;
+            dst += 2;
+            n -= 2;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGBA8888_BGR888_Blend_Scale_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const SIMD_Vec v255 = SIMD_SET(0xFF, 0xFF, 0xFF, 0xFF);
+    SIMD_Vec srcpixel;
+    SIMD_Vec srcA, dstpixel;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        srcrow = info->src + (srcy * info->src_pitch);
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = pixels;
+            Uint32 *d = (n == 1) ? &pixels[2] : dst;
+            int i;
+            for (i = 0; i < 2; ++i) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                pixels[i] = *(const Uint32 *)(srcrow + (srcx * 4));
+                if (n == 1) {
+                    break;
+                }
+                posx += incx;
+            }
+            if (n == 1) {
+                pixels[1] = pixels[0];
+                pixels[2] = pixels[3] = *dst;
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_PERM(srcpixel, 3, 2, 1, 0);
+            srcA = SIMD_PERM(srcpixel, 3, 3, 3, 3);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, srcA)));
+            }
+            dstpixel = SIMD_LOAD(d);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
+            case SDL_COPY_BLEND:
+            case SDL_COPY_PREMULTIPLIED:
+                /* Premultiplied overflow saturates in SIMD_STORE */
+                dstpixel = SIMD_ADD(srcpixel, SIMD_Div255(SIMD_MUL(SIMD_SUB(v255, srcA), dstpixel)));
+                break;
+            case SDL_COPY_ADD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_MIN(SIMD_ADD(srcpixel, dstpixel), v255));
+                break;
+            case SDL_COPY_MOD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_Div255(SIMD_MUL(srcpixel, dstpixel)));
+                break;
+            }
+            dstpixel = SIMD_ANDNOT(alphamask, dstpixel);
+            SIMD_STORE(d, dstpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            dst += 2;
+            n -= 2;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGBA8888_BGR888_Modulate_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const Uint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Uint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Uint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Uint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const SIMD_Vec modulate = SIMD_SET(modulateR, modulateG, modulateB, modulateA);
+    SIMD_Vec srcpixel;
+
+    while (info->dst_h--) {
+        const Uint32 *srcrow = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = srcrow;
+            Uint32 *d = dst;
+            if (n == 1) {
+                pixels[0] = pixels[1] = *srcrow;
+                src = &pixels[0];
+                d = &pixels[2];
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_PERM(srcpixel, 3, 2, 1, 0);
+            srcpixel = SIMD_Div255(SIMD_MUL(srcpixel, modulate));
+            srcpixel = SIMD_ANDNOT(alphamask, srcpixel);
+            SIMD_STORE(d, srcpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            srcrow += 2;
+            dst += 2;
+            n -= 2;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGBA8888_BGR888_Modulate_Scale_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const Uint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Uint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Uint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Uint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const SIMD_Vec modulate = SIMD_SET(modulateR, modulateG, modulateB, modulateA);
+    SIMD_Vec srcpixel;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        srcrow = info->src + (srcy * info->src_pitch);
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = pixels;
+            Uint32 *d = (n == 1) ? &pixels[2] : dst;
+            int i;
+            for (i = 0; i < 2; ++i) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                pixels[i] = *(const Uint32 *)(srcrow + (srcx * 4));
+                if (n == 1) {
+                    break;
+                }
+                posx += incx;
+            }
+            if (n == 1) {
+                pixels[1] = pixels[0];
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_PERM(srcpixel, 3, 2, 1, 0);
+            srcpixel = SIMD_Div255(SIMD_MUL(srcpixel, modulate));
+            srcpixel = SIMD_ANDNOT(alphamask, srcpixel);
+            SIMD_STORE(d, srcpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            dst += 2;
+            n -= 2;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGBA8888_BGR888_Modulate_Blend_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const SIMD_Vec v255 = SIMD_SET(0xFF, 0xFF, 0xFF, 0xFF);
+    const Uint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Uint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Uint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Uint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const SIMD_Vec modulate = SIMD_SET(modulateR, modulateG, modulateB, modulateA);
+    const SIMD_Vec modulateAlpha = SIMD_SET(modulateA, modulateA, modulateA, modulateA);
+    SIMD_Vec srcpixel;
+    SIMD_Vec srcA, dstpixel;
+
+    while (info->dst_h--) {
+        const Uint32 *srcrow = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = srcrow;
+            Uint32 *d = dst;
+            if (n == 1) {
+                pixels[0] = pixels[1] = *srcrow;
+                pixels[2] = pixels[3] = *dst;
+                src = &pixels[0];
+                d = &pixels[2];
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_PERM(srcpixel, 3, 2, 1, 0);
+            srcpixel = SIMD_Div255(SIMD_MUL(srcpixel, modulate));
+            if ((flags & (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) == (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, modulateAlpha)));
+            }
+            srcA = SIMD_PERM(srcpixel, 3, 3, 3, 3);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, srcA)));
+            }
+            dstpixel = SIMD_LOAD(d);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
+            case SDL_COPY_BLEND:
+            case SDL_COPY_PREMULTIPLIED:
+                /* Premultiplied overflow saturates in SIMD_STORE */
+                dstpixel = SIMD_ADD(srcpixel, SIMD_Div255(SIMD_MUL(SIMD_SUB(v255, srcA), dstpixel)));
+                break;
+            case SDL_COPY_ADD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_MIN(SIMD_ADD(srcpixel, dstpixel), v255));
+                break;
+            case SDL_COPY_MOD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_Div255(SIMD_MUL(srcpixel, dstpixel)));
+                break;
+            }
+            dstpixel = SIMD_ANDNOT(alphamask, dstpixel);
+            SIMD_STORE(d, dstpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            srcrow += 2;
+            dst += 2;
+            n -= 2;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGBA8888_BGR888_Modulate_Blend_Scale_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const SIMD_Vec v255 = SIMD_SET(0xFF, 0xFF, 0xFF, 0xFF);
+    const Uint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Uint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Uint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Uint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const SIMD_Vec modulate = SIMD_SET(modulateR, modulateG, modulateB, modulateA);
+    const SIMD_Vec modulateAlpha = SIMD_SET(modulateA, modulateA, modulateA, modulateA);
+    SIMD_Vec srcpixel;
+    SIMD_Vec srcA, dstpixel;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        srcrow = info->src + (srcy * info->src_pitch);
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = pixels;
+            Uint32 *d = (n == 1) ? &pixels[2] : dst;
+            int i;
+            for (i = 0; i < 2; ++i) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                pixels[i] = *(const Uint32 *)(srcrow + (srcx * 4));
+                if (n == 1) {
+                    break;
+                }
+                posx += incx;
+            }
+            if (n == 1) {
+                pixels[1] = pixels[0];
+                pixels[2] = pixels[3] = *dst;
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_PERM(srcpixel, 3, 2, 1, 0);
+            srcpixel = SIMD_Div255(SIMD_MUL(srcpixel, modulate));
+            if ((flags & (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) == (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, modulateAlpha)));
+            }
+            srcA = SIMD_PERM(srcpixel, 3, 3, 3, 3);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, srcA)));
+            }
+            dstpixel = SIMD_LOAD(d);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
+            case SDL_COPY_BLEND:
+            case SDL_COPY_PREMULTIPLIED:
+                /* Premultiplied overflow saturates in SIMD_STORE */
+                dstpixel = SIMD_ADD(srcpixel, SIMD_Div255(SIMD_MUL(SIMD_SUB(v255, srcA), dstpixel)));
+                break;
+            case SDL_COPY_ADD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_MIN(SIMD_ADD(srcpixel, dstpixel), v255));
+                break;
+            case SDL_COPY_MOD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_Div255(SIMD_MUL(srcpixel, dstpixel)));
+                break;
+            }
+            dstpixel = SIMD_ANDNOT(alphamask, dstpixel);
+            SIMD_STORE(d, dstpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            dst += 2;
+            n -= 2;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGBA8888_ARGB8888_Scale_SIMD(SDL_BlitInfo *info)
+{
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    SIMD_Vec srcpixel;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        srcrow = info->src + (srcy * info->src_pitch);
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = pixels;
+            Uint32 *d = (n == 1) ? &pixels[2] : dst;
+            int i;
+            for (i = 0; i < 2; ++i) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                pixels[i] = *(const Uint32 *)(srcrow + (srcx * 4));
+                if (n == 1) {
+                    break;
+                }
+                posx += incx;
+            }
+            if (n == 1) {
+                pixels[1] = pixels[0];
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_PERM(srcpixel, 1, 2, 3, 0);
+            SIMD_STORE(d, srcpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            dst += 2;
+            n -= 2;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGBA8888_ARGB8888_Blend_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const SIMD_Vec v255 = SIMD_SET(0xFF, 0xFF, 0xFF, 0xFF);
+    SIMD_Vec srcpixel;
+    SIMD_Vec srcA, dstpixel;
+
+    while (info->dst_h--) {
+        const Uint32 *srcrow = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = srcrow;
+            Uint32 *d = dst;
+            if (n == 1) {
+                pixels[0] = pixels[1] = *srcrow;
+                pixels[2] = pixels[3] = *dst;
+                src = &pixels[0];
+                d = &pixels[2];
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_PERM(srcpixel, 1, 2, 3, 0);
+            srcA = SIMD_PERM(srcpixel, 3, 3, 3, 3);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, srcA)));
+            }
+            dstpixel = SIMD_LOAD(d);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
+            case SDL_COPY_BLEND:
+            case SDL_COPY_PREMULTIPLIED:
+                /* Premultiplied overflow saturates in SIMD_STORE */
+                dstpixel = SIMD_ADD(srcpixel, SIMD_Div255(SIMD_MUL(SIMD_SUB(v255, srcA), dstpixel)));
+                break;
+            case SDL_COPY_ADD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_MIN(SIMD_ADD(srcpixel, dstpixel), v255));
+                break;
+            case SDL_COPY_MOD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_Div255(SIMD_MUL(srcpixel, dstpixel)));
+                break;
+            }
+            SIMD_STORE(d, dstpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            srcrow += 2;
+            dst += 2;
+            n -= 2;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGBA8888_ARGB8888_Blend_Scale_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const SIMD_Vec v255 = SIMD_SET(0xFF, 0xFF, 0xFF, 0xFF);
+    SIMD_Vec srcpixel;
+    SIMD_Vec srcA, dstpixel;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        srcrow = info->src + (srcy * info->src_pitch);
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = pixels;
+            Uint32 *d = (n == 1) ? &pixels[2] : dst;
+            int i;
+            for (i = 0; i < 2; ++i) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                pixels[i] = *(const Uint32 *)(srcrow + (srcx * 4));
+                if (n == 1) {
+                    break;
+                }
+                posx += incx;
+            }
+            if (n == 1) {
+                pixels[1] = pixels[0];
+                pixels[2] = pixels[3] = *dst;
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_PERM(srcpixel, 1, 2, 3, 0);
+            srcA = SIMD_PERM(srcpixel, 3, 3, 3, 3);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, srcA)));
+            }
+            dstpixel = SIMD_LOAD(d);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
+            case SDL_COPY_BLEND:
+            case SDL_COPY_PREMULTIPLIED:
+                /* Premultiplied overflow saturates in SIMD_STORE */
+                dstpixel = SIMD_ADD(srcpixel, SIMD_Div255(SIMD_MUL(SIMD_SUB(v255, srcA), dstpixel)));
+                break;
+            case SDL_COPY_ADD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_MIN(SIMD_ADD(srcpixel, dstpixel), v255));
+                break;
+            case SDL_COPY_MOD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_Div255(SIMD_MUL(srcpixel, dstpixel)));
+                break;
+            }
+            SIMD_STORE(d, dstpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            dst += 2;
+            n -= 2;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGBA8888_ARGB8888_Modulate_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const Uint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Uint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Uint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Uint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const SIMD_Vec modulate = SIMD_SET(modulateB, modulateG, modulateR, modulateA);
+    SIMD_Vec srcpixel;
+
+    while (info->dst_h--) {
+        const Uint32 *srcrow = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = srcrow;
+            Uint32 *d = dst;
+            if (n == 1) {
+                pixels[0] = pixels[1] = *srcrow;
+                src = &pixels[0];
+                d = &pixels[2];
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_PERM(srcpixel, 1, 2, 3, 0);
+            srcpixel = SIMD_Div255(SIMD_MUL(srcpixel, modulate));
+            SIMD_STORE(d, srcpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            srcrow += 2;
+            dst += 2;
+            n -= 2;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGBA8888_ARGB8888_Modulate_Scale_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const Uint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Uint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Uint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Uint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const SIMD_Vec modulate = SIMD_SET(modulateB, modulateG, modulateR, modulateA);
+    SIMD_Vec srcpixel;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        srcrow = info->src + (srcy * info->src_pitch);
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = pixels;
+            Uint32 *d = (n == 1) ? &pixels[2] : dst;
+            int i;
+            for (i = 0; i < 2; ++i) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                pixels[i] = *(const Uint32 *)(srcrow + (srcx * 4));
+                if (n == 1) {
+                    break;
+                }
+                posx += incx;
+            }
+            if (n == 1) {
+                pixels[1] = pixels[0];
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_PERM(srcpixel, 1, 2, 3, 0);
+            srcpixel = SIMD_Div255(SIMD_MUL(srcpixel, modulate));
+            SIMD_STORE(d, srcpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            dst += 2;
+            n -= 2;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const SIMD_Vec v255 = SIMD_SET(0xFF, 0xFF, 0xFF, 0xFF);
+    const Uint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Uint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Uint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Uint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const SIMD_Vec modulate = SIMD_SET(modulateB, modulateG, modulateR, modulateA);
+    const SIMD_Vec modulateAlpha = SIMD_SET(modulateA, modulateA, modulateA, modulateA);
+    SIMD_Vec srcpixel;
+    SIMD_Vec srcA, dstpixel;
+
+    while (info->dst_h--) {
+        const Uint32 *srcrow = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = srcrow;
+            Uint32 *d = dst;
+            if (n == 1) {
+                pixels[0] = pixels[1] = *srcrow;
+                pixels[2] = pixels[3] = *dst;
+                src = &pixels[0];
+                d = &pixels[2];
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_PERM(srcpixel, 1, 2, 3, 0);
+            srcpixel = SIMD_Div255(SIMD_MUL(srcpixel, modulate));
+            if ((flags & (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) == (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, modulateAlpha)));
+            }
+            srcA = SIMD_PERM(srcpixel, 3, 3, 3, 3);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, srcA)));
+            }
+            dstpixel = SIMD_LOAD(d);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
+            case SDL_COPY_BLEND:
+            case SDL_COPY_PREMULTIPLIED:
+                /* Premultiplied overflow saturates in SIMD_STORE */
+                dstpixel = SIMD_ADD(srcpixel, SIMD_Div255(SIMD_MUL(SIMD_SUB(v255, srcA), dstpixel)));
+                break;
+            case SDL_COPY_ADD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_MIN(SIMD_ADD(srcpixel, dstpixel), v255));
+                break;
+            case SDL_COPY_MOD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_Div255(SIMD_MUL(srcpixel, dstpixel)));
+                break;
+            }
+            SIMD_STORE(d, dstpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            srcrow += 2;
+            dst += 2;
+            n -= 2;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_Scale_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const SIMD_Vec v255 = SIMD_SET(0xFF, 0xFF, 0xFF, 0xFF);
+    const Uint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Uint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Uint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Uint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const SIMD_Vec modulate = SIMD_SET(modulateB, modulateG, modulateR, modulateA);
+    const SIMD_Vec modulateAlpha = SIMD_SET(modulateA, modulateA, modulateA, modulateA);
+    SIMD_Vec srcpixel;
+    SIMD_Vec srcA, dstpixel;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        srcrow = info->src + (srcy * info->src_pitch);
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = pixels;
+            Uint32 *d = (n == 1) ? &pixels[2] : dst;
+            int i;
+            for (i = 0; i < 2; ++i) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                pixels[i] = *(const Uint32 *)(srcrow + (srcx * 4));
+                if (n == 1) {
+                    break;
+                }
+                posx += incx;
+            }
+            if (n == 1) {
+                pixels[1] = pixels[0];
+                pixels[2] = pixels[3] = *dst;
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_PERM(srcpixel, 1, 2, 3, 0);
+            srcpixel = SIMD_Div255(SIMD_MUL(srcpixel, modulate));
+            if ((flags & (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) == (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, modulateAlpha)));
+            }
+            srcA = SIMD_PERM(srcpixel, 3, 3, 3, 3);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, srcA)));
+            }
+            dstpixel = SIMD_LOAD(d);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
+            case SDL_COPY_BLEND:
+            case SDL_COPY_PREMULTIPLIED:
+                /* Premultiplied overflow saturates in SIMD_STORE */
+                dstpixel = SIMD_ADD(srcpixel, SIMD_Div255(SIMD_MUL(SIMD_SUB(v255, srcA), dstpixel)));
+                break;
+            case SDL_COPY_ADD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_MIN(SIMD_ADD(srcpixel, dstpixel), v255));
+                break;
+            case SDL_COPY_MOD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_Div255(SIMD_MUL(srcpixel, dstpixel)));
+                break;
+            }
+            SIMD_STORE(d, dstpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            dst += 2;
+            n -= 2;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ABGR8888_RGB888_Scale_SIMD(SDL_BlitInfo *info)
+{
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    SIMD_Vec srcpixel;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        srcrow = info->src + (srcy * info->src_pitch);
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = pixels;
+            Uint32 *d = (n == 1) ? &pixels[2] : dst;
+            int i;
+            for (i = 0; i < 2; ++i) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                pixels[i] = *(const Uint32 *)(srcrow + (srcx * 4));
+                if (n == 1) {
+                    break;
+                }
+                posx += incx;
+            }
+            if (n == 1) {
+                pixels[1] = pixels[0];
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_PERM(srcpixel, 2, 1, 0, 3);
+            srcpixel = SIMD_ANDNOT(alphamask, srcpixel);
+            SIMD_STORE(d, srcpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            dst += 2;
+            n -= 2;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ABGR8888_RGB888_Blend_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const SIMD_Vec v255 = SIMD_SET(0xFF, 0xFF, 0xFF, 0xFF);
+    SIMD_Vec srcpixel;
+    SIMD_Vec srcA, dstpixel;
+
+    while (info->dst_h--) {
+        const Uint32 *srcrow = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = srcrow;
+            Uint32 *d = dst;
+            if (n == 1) {
+                pixels[0] = pixels[1] = *srcrow;
+                pixels[2] = pixels[3] = *dst;
+                src = &pixels[0];
+                d = &pixels[2];
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_PERM(srcpixel, 2, 1, 0, 3);
+            srcA = SIMD_PERM(srcpixel, 3, 3, 3, 3);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, srcA)));
+            }
+            dstpixel = SIMD_LOAD(d);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
+            case SDL_COPY_BLEND:
+            case SDL_COPY_PREMULTIPLIED:
+                /* Premultiplied overflow saturates in SIMD_STORE */
+                dstpixel = SIMD_ADD(srcpixel, SIMD_Div255(SIMD_MUL(SIMD_SUB(v255, srcA), dstpixel)));
+                break;
+            case SDL_COPY_ADD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_MIN(SIMD_ADD(srcpixel, dstpixel), v255));
+                break;
+            case SDL_COPY_MOD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_Div255(SIMD_MUL(srcpixel, dstpixel)));
+                break;
+            }
+            dstpixel = SIMD_ANDNOT(alphamask, dstpixel);
+            SIMD_STORE(d, dstpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            srcrow += 2;
+            dst += 2;
+            n -= 2;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ABGR8888_RGB888_Blend_Scale_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const SIMD_Vec v255 = SIMD_SET(0xFF, 0xFF, 0xFF, 0xFF);
+    SIMD_Vec srcpixel;
+    SIMD_Vec srcA, dstpixel;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        srcrow = info->src + (srcy * info->src_pitch);
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = pixels;
+            Uint32 *d = (n == 1) ? &pixels[2] : dst;
+            int i;
+            for (i = 0; i < 2; ++i) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                pixels[i] = *(const Uint32 *)(srcrow + (srcx * 4));
+                if (n == 1) {
+                    break;
+                }
+                posx += incx;
+            }
+            if (n == 1) {
+                pixels[1] = pixels[0];
+                pixels[2] = pixels[3] = *dst;
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_PERM(srcpixel, 2, 1, 0, 3);
+            srcA = SIMD_PERM(srcpixel, 3, 3, 3, 3);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, srcA)));
+            }
+            dstpixel = SIMD_LOAD(d);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
+            case SDL_COPY_BLEND:
+            case SDL_COPY_PREMULTIPLIED:
+                /* Premultiplied overflow saturates in SIMD_STORE */
+                dstpixel = SIMD_ADD(srcpixel, SIMD_Div255(SIMD_MUL(SIMD_SUB(v255, srcA), dstpixel)));
+                break;
+            case SDL_COPY_ADD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_MIN(SIMD_ADD(srcpixel, dstpixel), v255));
+                break;
+            case SDL_COPY_MOD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_Div255(SIMD_MUL(srcpixel, dstpixel)));
+                break;
+            }
+            dstpixel = SIMD_ANDNOT(alphamask, dstpixel);
+            SIMD_STORE(d, dstpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            dst += 2;
+            n -= 2;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ABGR8888_RGB888_Modulate_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const Uint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Uint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Uint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Uint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const SIMD_Vec modulate = SIMD_SET(modulateB, modulateG, modulateR, modulateA);
+    SIMD_Vec srcpixel;
+
+    while (info->dst_h--) {
+        const Uint32 *srcrow = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = srcrow;
+            Uint32 *d = dst;
+            if (n == 1) {
+                pixels[0] = pixels[1] = *srcrow;
+                src = &pixels[0];
+                d = &pixels[2];
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_PERM(srcpixel, 2, 1, 0, 3);
+            srcpixel = SIMD_Div255(SIMD_MUL(srcpixel, modulate));
+            srcpixel = SIMD_ANDNOT(alphamask, srcpixel);
+            SIMD_STORE(d, srcpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            srcrow += 2;
+            dst += 2;
+            n -= 2;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ABGR8888_RGB888_Modulate_Scale_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const Uint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Uint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Uint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Uint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const SIMD_Vec modulate = SIMD_SET(modulateB, modulateG, modulateR, modulateA);
+    SIMD_Vec srcpixel;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        srcrow = info->src + (srcy * info->src_pitch);
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = pixels;
+            Uint32 *d = (n == 1) ? &pixels[2] : dst;
+            int i;
+            for (i = 0; i < 2; ++i) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                pixels[i] = *(const Uint32 *)(srcrow + (srcx * 4));
+                if (n == 1) {
+                    break;
+                }
+                posx += incx;
+            }
+            if (n == 1) {
+                pixels[1] = pixels[0];
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_PERM(srcpixel, 2, 1, 0, 3);
+            srcpixel = SIMD_Div255(SIMD_MUL(srcpixel, modulate));
+            srcpixel = SIMD_ANDNOT(alphamask, srcpixel);
+            SIMD_STORE(d, srcpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            dst += 2;
+            n -= 2;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ABGR8888_RGB888_Modulate_Blend_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const SIMD_Vec v255 = SIMD_SET(0xFF, 0xFF, 0xFF, 0xFF);
+    const Uint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Uint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Uint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Uint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const SIMD_Vec modulate = SIMD_SET(modulateB, modulateG, modulateR, modulateA);
+    const SIMD_Vec modulateAlpha = SIMD_SET(modulateA, modulateA, modulateA, modulateA);
+    SIMD_Vec srcpixel;
+    SIMD_Vec srcA, dstpixel;
+
+    while (info->dst_h--) {
+        const Uint32 *srcrow = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = srcrow;
+            Uint32 *d = dst;
+            if (n == 1) {
+                pixels[0] = pixels[1] = *srcrow;
+                pixels[2] = pixels[3] = *dst;
+                src = &pixels[0];
+                d = &pixels[2];
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_PERM(srcpixel, 2, 1, 0, 3);
+            srcpixel = SIMD_Div255(SIMD_MUL(srcpixel, modulate));
+            if ((flags & (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) == (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, modulateAlpha)));
+            }
+            srcA = SIMD_PERM(srcpixel, 3, 3, 3, 3);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, srcA)));
+            }
+            dstpixel = SIMD_LOAD(d);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
+            case SDL_COPY_BLEND:
+            case SDL_COPY_PREMULTIPLIED:
+                /* Premultiplied overflow saturates in SIMD_STORE */
+                dstpixel = SIMD_ADD(srcpixel, SIMD_Div255(SIMD_MUL(SIMD_SUB(v255, srcA), dstpixel)));
+                break;
+            case SDL_COPY_ADD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_MIN(SIMD_ADD(srcpixel, dstpixel), v255));
+                break;
+            case SDL_COPY_MOD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_Div255(SIMD_MUL(srcpixel, dstpixel)));
+                break;
+            }
+            dstpixel = SIMD_ANDNOT(alphamask, dstpixel);
+            SIMD_STORE(d, dstpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            srcrow += 2;
+            dst += 2;
+            n -= 2;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ABGR8888_RGB888_Modulate_Blend_Scale_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const SIMD_Vec v255 = SIMD_SET(0xFF, 0xFF, 0xFF, 0xFF);
+    const Uint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Uint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Uint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Uint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const SIMD_Vec modulate = SIMD_SET(modulateB, modulateG, modulateR, modulateA);
+    const SIMD_Vec modulateAlpha = SIMD_SET(modulateA, modulateA, modulateA, modulateA);
+    SIMD_Vec srcpixel;
+    SIMD_Vec srcA, dstpixel;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        srcrow = info->src + (srcy * info->src_pitch);
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = pixels;
+            Uint32 *d = (n == 1) ? &pixels[2] : dst;
+            int i;
+            for (i = 0; i < 2; ++i) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                pixels[i] = *(const Uint32 *)(srcrow + (srcx * 4));
+                if (n == 1) {
+                    break;
+                }
+                posx += incx;
+            }
+            if (n == 1) {
+                pixels[1] = pixels[0];
+                pixels[2] = pixels[3] = *dst;
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_PERM(srcpixel, 2, 1, 0, 3);
+            srcpixel = SIMD_Div255(SIMD_MUL(srcpixel, modulate));
+            if ((flags & (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) == (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, modulateAlpha)));
+            }
+            srcA = SIMD_PERM(srcpixel, 3, 3, 3, 3);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, srcA)));
+            }
+            dstpixel = SIMD_LOAD(d);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
+            case SDL_COPY_BLEND:
+            case SDL_COPY_PREMULTIPLIED:
+                /* Premultiplied overflow saturates in SIMD_STORE */
+                dstpixel = SIMD_ADD(srcpixel, SIMD_Div255(SIMD_MUL(SIMD_SUB(v255, srcA), dstpixel)));
+                break;
+            case SDL_COPY_ADD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_MIN(SIMD_ADD(srcpixel, dstpixel), v255));
+                break;
+            case SDL_COPY_MOD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_Div255(SIMD_MUL(srcpixel, dstpixel)));
+                break;
+            }
+            dstpixel = SIMD_ANDNOT(alphamask, dstpixel);
+            SIMD_STORE(d, dstpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            dst += 2;
+            n -= 2;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ABGR8888_BGR888_Scale_SIMD(SDL_BlitInfo *info)
+{
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    SIMD_Vec srcpixel;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        srcrow = info->src + (srcy * info->src_pitch);
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = pixels;
+            Uint32 *d = (n == 1) ? &pixels[2] : dst;
+            int i;
+            for (i = 0; i < 2; ++i) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                pixels[i] = *(const Uint32 *)(srcrow + (srcx * 4));
+                if (n == 1) {
+                    break;
+                }
+                posx += incx;
+            }
+            if (n == 1) {
+                pixels[1] = pixels[0];
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_ANDNOT(alphamask, srcpixel);
+            SIMD_STORE(d, srcpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            dst += 2;
+            n -= 2;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ABGR8888_BGR888_Blend_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const SIMD_Vec v255 = SIMD_SET(0xFF, 0xFF, 0xFF, 0xFF);
+    SIMD_Vec srcpixel;
+    SIMD_Vec srcA, dstpixel;
+
+    while (info->dst_h--) {
+        const Uint32 *srcrow = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = srcrow;
+            Uint32 *d = dst;
+            if (n == 1) {
+                pixels[0] = pixels[1] = *srcrow;
+                pixels[2] = pixels[3] = *dst;
+                src = &pixels[0];
+                d = &pixels[2];
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcA = SIMD_PERM(srcpixel, 3, 3, 3, 3);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, srcA)));
+            }
+            dstpixel = SIMD_LOAD(d);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
+            case SDL_COPY_BLEND:
+            case SDL_COPY_PREMULTIPLIED:
+                /* Premultiplied overflow saturates in SIMD_STORE */
+                dstpixel = SIMD_ADD(srcpixel, SIMD_Div255(SIMD_MUL(SIMD_SUB(v255, srcA), dstpixel)));
+                break;
+            case SDL_COPY_ADD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_MIN(SIMD_ADD(srcpixel, dstpixel), v255));
+                break;
+            case SDL_COPY_MOD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_Div255(SIMD_MUL(srcpixel, dstpixel)));
+                break;
+            }
+            dstpixel = SIMD_ANDNOT(alphamask, dstpixel);
+            SIMD_STORE(d, dstpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            srcrow += 2;
+            dst += 2;
+            n -= 2;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ABGR8888_BGR888_Blend_Scale_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const SIMD_Vec v255 = SIMD_SET(0xFF, 0xFF, 0xFF, 0xFF);
+    SIMD_Vec srcpixel;
+    SIMD_Vec srcA, dstpixel;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        srcrow = info->src + (srcy * info->src_pitch);
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = pixels;
+            Uint32 *d = (n == 1) ? &pixels[2] : dst;
+            int i;
+            for (i = 0; i < 2; ++i) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                pixels[i] = *(const Uint32 *)(srcrow + (srcx * 4));
+                if (n == 1) {
+                    break;
+                }
+                posx += incx;
+            }
+            if (n == 1) {
+                pixels[1] = pixels[0];
+                pixels[2] = pixels[3] = *dst;
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcA = SIMD_PERM(srcpixel, 3, 3, 3, 3);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, srcA)));
+            }
+            dstpixel = SIMD_LOAD(d);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
+            case SDL_COPY_BLEND:
+            case SDL_COPY_PREMULTIPLIED:
+                /* Premultiplied overflow saturates in SIMD_STORE */
+                dstpixel = SIMD_ADD(srcpixel, SIMD_Div255(SIMD_MUL(SIMD_SUB(v255, srcA), dstpixel)));
+                break;
+            case SDL_COPY_ADD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_MIN(SIMD_ADD(srcpixel, dstpixel), v255));
+                break;
+            case SDL_COPY_MOD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_Div255(SIMD_MUL(srcpixel, dstpixel)));
+                break;
+            }
+            dstpixel = SIMD_ANDNOT(alphamask, dstpixel);
+            SIMD_STORE(d, dstpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            dst += 2;
+            n -= 2;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ABGR8888_BGR888_Modulate_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const Uint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Uint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Uint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Uint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const SIMD_Vec modulate = SIMD_SET(modulateR, modulateG, modulateB, modulateA);
+    SIMD_Vec srcpixel;
+
+    while (info->dst_h--) {
+        const Uint32 *srcrow = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = srcrow;
+            Uint32 *d = dst;
+            if (n == 1) {
+                pixels[0] = pixels[1] = *srcrow;
+                src = &pixels[0];
+                d = &pixels[2];
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_Div255(SIMD_MUL(srcpixel, modulate));
+            srcpixel = SIMD_ANDNOT(alphamask, srcpixel);
+            SIMD_STORE(d, srcpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            srcrow += 2;
+            dst += 2;
+            n -= 2;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ABGR8888_BGR888_Modulate_Scale_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const Uint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Uint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Uint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Uint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const SIMD_Vec modulate = SIMD_SET(modulateR, modulateG, modulateB, modulateA);
+    SIMD_Vec srcpixel;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        srcrow = info->src + (srcy * info->src_pitch);
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = pixels;
+            Uint32 *d = (n == 1) ? &pixels[2] : dst;
+            int i;
+            for (i = 0; i < 2; ++i) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                pixels[i] = *(const Uint32 *)(srcrow + (srcx * 4));
+                if (n == 1) {
+                    break;
+                }
+                posx += incx;
+            }
+            if (n == 1) {
+                pixels[1] = pixels[0];
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_Div255(SIMD_MUL(srcpixel, modulate));
+            srcpixel = SIMD_ANDNOT(alphamask, srcpixel);
+            SIMD_STORE(d, srcpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            dst += 2;
+            n -= 2;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ABGR8888_BGR888_Modulate_Blend_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const SIMD_Vec v255 = SIMD_SET(0xFF, 0xFF, 0xFF, 0xFF);
+    const Uint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Uint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Uint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Uint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const SIMD_Vec modulate = SIMD_SET(modulateR, modulateG, modulateB, modulateA);
+    const SIMD_Vec modulateAlpha = SIMD_SET(modulateA, modulateA, modulateA, modulateA);
+    SIMD_Vec srcpixel;
+    SIMD_Vec srcA, dstpixel;
+
+    while (info->dst_h--) {
+        const Uint32 *srcrow = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = srcrow;
+            Uint32 *d = dst;
+            if (n == 1) {
+                pixels[0] = pixels[1] = *srcrow;
+                pixels[2] = pixels[3] = *dst;
+                src = &pixels[0];
+                d = &pixels[2];
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_Div255(SIMD_MUL(srcpixel, modulate));
+            if ((flags & (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) == (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, modulateAlpha)));
+            }
+            srcA = SIMD_PERM(srcpixel, 3, 3, 3, 3);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, srcA)));
+            }
+            dstpixel = SIMD_LOAD(d);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
+            case SDL_COPY_BLEND:
+            case SDL_COPY_PREMULTIPLIED:
+                /* Premultiplied overflow saturates in SIMD_STORE */
+                dstpixel = SIMD_ADD(srcpixel, SIMD_Div255(SIMD_MUL(SIMD_SUB(v255, srcA), dstpixel)));
+                break;
+            case SDL_COPY_ADD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_MIN(SIMD_ADD(srcpixel, dstpixel), v255));
+                break;
+            case SDL_COPY_MOD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_Div255(SIMD_MUL(srcpixel, dstpixel)));
+                break;
+            }
+            dstpixel = SIMD_ANDNOT(alphamask, dstpixel);
+            SIMD_STORE(d, dstpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            srcrow += 2;
+            dst += 2;
+            n -= 2;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ABGR8888_BGR888_Modulate_Blend_Scale_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const SIMD_Vec v255 = SIMD_SET(0xFF, 0xFF, 0xFF, 0xFF);
+    const Uint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Uint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Uint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Uint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const SIMD_Vec modulate = SIMD_SET(modulateR, modulateG, modulateB, modulateA);
+    const SIMD_Vec modulateAlpha = SIMD_SET(modulateA, modulateA, modulateA, modulateA);
+    SIMD_Vec srcpixel;
+    SIMD_Vec srcA, dstpixel;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        srcrow = info->src + (srcy * info->src_pitch);
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = pixels;
+            Uint32 *d = (n == 1) ? &pixels[2] : dst;
+            int i;
+            for (i = 0; i < 2; ++i) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                pixels[i] = *(const Uint32 *)(srcrow + (srcx * 4));
+                if (n == 1) {
+                    break;
+                }
+                posx += incx;
+            }
+            if (n == 1) {
+                pixels[1] = pixels[0];
+                pixels[2] = pixels[3] = *dst;
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_Div255(SIMD_MUL(srcpixel, modulate));
+            if ((flags & (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) == (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, modulateAlpha)));
+            }
+            srcA = SIMD_PERM(srcpixel, 3, 3, 3, 3);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, srcA)));
+            }
+            dstpixel = SIMD_LOAD(d);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
+            case SDL_COPY_BLEND:
+            case SDL_COPY_PREMULTIPLIED:
+                /* Premultiplied overflow saturates in SIMD_STORE */
+                dstpixel = SIMD_ADD(srcpixel, SIMD_Div255(SIMD_MUL(SIMD_SUB(v255, srcA), dstpixel)));
+                break;
+            case SDL_COPY_ADD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_MIN(SIMD_ADD(srcpixel, dstpixel), v255));
+                break;
+            case SDL_COPY_MOD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_Div255(SIMD_MUL(srcpixel, dstpixel)));
+                break;
+            }
+            dstpixel = SIMD_ANDNOT(alphamask, dstpixel);
+            SIMD_STORE(d, dstpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            dst += 2;
+            n -= 2;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ABGR8888_ARGB8888_Scale_SIMD(SDL_BlitInfo *info)
+{
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    SIMD_Vec srcpixel;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        srcrow = info->src + (srcy * info->src_pitch);
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = pixels;
+            Uint32 *d = (n == 1) ? &pixels[2] : dst;
+            int i;
+            for (i = 0; i < 2; ++i) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                pixels[i] = *(const Uint32 *)(srcrow + (srcx * 4));
+                if (n == 1) {
+                    break;
+                }
+                posx += incx;
+            }
+            if (n == 1) {
+                pixels[1] = pixels[0];
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_PERM(srcpixel, 2, 1, 0, 3);
+            SIMD_STORE(d, srcpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            dst += 2;
+            n -= 2;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ABGR8888_ARGB8888_Blend_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const SIMD_Vec v255 = SIMD_SET(0xFF, 0xFF, 0xFF, 0xFF);
+    SIMD_Vec srcpixel;
+    SIMD_Vec srcA, dstpixel;
+
+    while (info->dst_h--) {
+        const Uint32 *srcrow = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = srcrow;
+            Uint32 *d = dst;
+            if (n == 1) {
+                pixels[0] = pixels[1] = *srcrow;
+                pixels[2] = pixels[3] = *dst;
+                src = &pixels[0];
+                d = &pixels[2];
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_PERM(srcpixel, 2, 1, 0, 3);
+            srcA = SIMD_PERM(srcpixel, 3, 3, 3, 3);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, srcA)));
+            }
+            dstpixel = SIMD_LOAD(d);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
+            case SDL_COPY_BLEND:
+            case SDL_COPY_PREMULTIPLIED:
+                /* Premultiplied overflow saturates in SIMD_STORE */
+                dstpixel = SIMD_ADD(srcpixel, SIMD_Div255(SIMD_MUL(SIMD_SUB(v255, srcA), dstpixel)));
+                break;
+            case SDL_COPY_ADD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_MIN(SIMD_ADD(srcpixel, dstpixel), v255));
+                break;
+            case SDL_COPY_MOD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_Div255(SIMD_MUL(srcpixel, dstpixel)));
+                break;
+            }
+            SIMD_STORE(d, dstpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            srcrow += 2;
+            dst += 2;
+            n -= 2;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ABGR8888_ARGB8888_Blend_Scale_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const SIMD_Vec v255 = SIMD_SET(0xFF, 0xFF, 0xFF, 0xFF);
+    SIMD_Vec srcpixel;
+    SIMD_Vec srcA, dstpixel;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        srcrow = info->src + (srcy * info->src_pitch);
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = pixels;
+            Uint32 *d = (n == 1) ? &pixels[2] : dst;
+            int i;
+            for (i = 0; i < 2; ++i) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                pixels[i] = *(const Uint32 *)(srcrow + (srcx * 4));
+                if (n == 1) {
+                    break;
+                }
+                posx += incx;
+            }
+            if (n == 1) {
+                pixels[1] = pixels[0];
+                pixels[2] = pixels[3] = *dst;
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_PERM(srcpixel, 2, 1, 0, 3);
+            srcA = SIMD_PERM(srcpixel, 3, 3, 3, 3);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, srcA)));
+            }
+            dstpixel = SIMD_LOAD(d);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
+            case SDL_COPY_BLEND:
+            case SDL_COPY_PREMULTIPLIED:
+                /* Premultiplied overflow saturates in SIMD_STORE */
+                dstpixel = SIMD_ADD(srcpixel, SIMD_Div255(SIMD_MUL(SIMD_SUB(v255, srcA), dstpixel)));
+                break;
+            case SDL_COPY_ADD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_MIN(SIMD_ADD(srcpixel, dstpixel), v255));
+                break;
+            case SDL_COPY_MOD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_Div255(SIMD_MUL(srcpixel, dstpixel)));
+                break;
+            }
+            SIMD_STORE(d, dstpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            dst += 2;
+            n -= 2;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ABGR8888_ARGB8888_Modulate_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const Uint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Uint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Uint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Uint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const SIMD_Vec modulate = SIMD_SET(modulateB, modulateG, modulateR, modulateA);
+    SIMD_Vec srcpixel;
+
+    while (info->dst_h--) {
+        const Uint32 *srcrow = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = srcrow;
+            Uint32 *d = dst;
+            if (n == 1) {
+                pixels[0] = pixels[1] = *srcrow;
+                src = &pixels[0];
+                d = &pixels[2];
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_PERM(srcpixel, 2, 1, 0, 3);
+            srcpixel = SIMD_Div255(SIMD_MUL(srcpixel, modulate));
+            SIMD_STORE(d, srcpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            srcrow += 2;
+            dst += 2;
+            n -= 2;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ABGR8888_ARGB8888_Modulate_Scale_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const Uint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Uint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Uint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Uint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const SIMD_Vec modulate = SIMD_SET(modulateB, modulateG, modulateR, modulateA);
+    SIMD_Vec srcpixel;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        srcrow = info->src + (srcy * info->src_pitch);
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = pixels;
+            Uint32 *d = (n == 1) ? &pixels[2] : dst;
+            int i;
+            for (i = 0; i < 2; ++i) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                pixels[i] = *(const Uint32 *)(srcrow + (srcx * 4));
+                if (n == 1) {
+                    break;
+                }
+                posx += incx;
+            }
+            if (n == 1) {
+                pixels[1] = pixels[0];
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_PERM(srcpixel, 2, 1, 0, 3);
+            srcpixel = SIMD_Div255(SIMD_MUL(srcpixel, modulate));
+            SIMD_STORE(d, srcpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            dst += 2;
+            n -= 2;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const SIMD_Vec v255 = SIMD_SET(0xFF, 0xFF, 0xFF, 0xFF);
+    const Uint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Uint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Uint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Uint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const SIMD_Vec modulate = SIMD_SET(modulateB, modulateG, modulateR, modulateA);
+    const SIMD_Vec modulateAlpha = SIMD_SET(modulateA, modulateA, modulateA, modulateA);
+    SIMD_Vec srcpixel;
+    SIMD_Vec srcA, dstpixel;
+
+    while (info->dst_h--) {
+        const Uint32 *srcrow = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = srcrow;
+            Uint32 *d = dst;
+            if (n == 1) {
+                pixels[0] = pixels[1] = *srcrow;
+                pixels[2] = pixels[3] = *dst;
+                src = &pixels[0];
+                d = &pixels[2];
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_PERM(srcpixel, 2, 1, 0, 3);
+            srcpixel = SIMD_Div255(SIMD_MUL(srcpixel, modulate));
+            if ((flags & (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) == (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, modulateAlpha)));
+            }
+            srcA = SIMD_PERM(srcpixel, 3, 3, 3, 3);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, srcA)));
+            }
+            dstpixel = SIMD_LOAD(d);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
+            case SDL_COPY_BLEND:
+            case SDL_COPY_PREMULTIPLIED:
+                /* Premultiplied overflow saturates in SIMD_STORE */
+                dstpixel = SIMD_ADD(srcpixel, SIMD_Div255(SIMD_MUL(SIMD_SUB(v255, srcA), dstpixel)));
+                break;
+            case SDL_COPY_ADD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_MIN(SIMD_ADD(srcpixel, dstpixel), v255));
+                break;
+            case SDL_COPY_MOD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_Div255(SIMD_MUL(srcpixel, dstpixel)));
+                break;
+            }
+            SIMD_STORE(d, dstpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            srcrow += 2;
+            dst += 2;
+            n -= 2;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_Scale_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const SIMD_Vec v255 = SIMD_SET(0xFF, 0xFF, 0xFF, 0xFF);
+    const Uint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Uint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Uint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Uint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const SIMD_Vec modulate = SIMD_SET(modulateB, modulateG, modulateR, modulateA);
+    const SIMD_Vec modulateAlpha = SIMD_SET(modulateA, modulateA, modulateA, modulateA);
+    SIMD_Vec srcpixel;
+    SIMD_Vec srcA, dstpixel;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        srcrow = info->src + (srcy * info->src_pitch);
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = pixels;
+            Uint32 *d = (n == 1) ? &pixels[2] : dst;
+            int i;
+            for (i = 0; i < 2; ++i) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                pixels[i] = *(const Uint32 *)(srcrow + (srcx * 4));
+                if (n == 1) {
+                    break;
+                }
+                posx += incx;
+            }
+            if (n == 1) {
+                pixels[1] = pixels[0];
+                pixels[2] = pixels[3] = *dst;
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_PERM(srcpixel, 2, 1, 0, 3);
+            srcpixel = SIMD_Div255(SIMD_MUL(srcpixel, modulate));
+            if ((flags & (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) == (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, modulateAlpha)));
+            }
+            srcA = SIMD_PERM(srcpixel, 3, 3, 3, 3);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, srcA)));
+            }
+            dstpixel = SIMD_LOAD(d);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
+            case SDL_COPY_BLEND:
+            case SDL_COPY_PREMULTIPLIED:
+                /* Premultiplied overflow saturates in SIMD_STORE */
+                dstpixel = SIMD_ADD(srcpixel, SIMD_Div255(SIMD_MUL(SIMD_SUB(v255, srcA), dstpixel)));
+                break;
+            case SDL_COPY_ADD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_MIN(SIMD_ADD(srcpixel, dstpixel), v255));
+                break;
+            case SDL_COPY_MOD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_Div255(SIMD_MUL(srcpixel, dstpixel)));
+                break;
+            }
+            SIMD_STORE(d, dstpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            dst += 2;
+            n -= 2;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGRA8888_RGB888_Scale_SIMD(SDL_BlitInfo *info)
+{
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    SIMD_Vec srcpixel;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        srcrow = info->src + (srcy * info->src_pitch);
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = pixels;
+            Uint32 *d = (n == 1) ? &pixels[2] : dst;
+            int i;
+            for (i = 0; i < 2; ++i) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                pixels[i] = *(const Uint32 *)(srcrow + (srcx * 4));
+                if (n == 1) {
+                    break;
+                }
+                posx += incx;
+            }
+            if (n == 1) {
+                pixels[1] = pixels[0];
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_PERM(srcpixel, 3, 2, 1, 0);
+            srcpixel = SIMD_ANDNOT(alphamask, srcpixel);
+            SIMD_STORE(d, srcpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            dst += 2;
+            n -= 2;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGRA8888_RGB888_Blend_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const SIMD_Vec v255 = SIMD_SET(0xFF, 0xFF, 0xFF, 0xFF);
+    SIMD_Vec srcpixel;
+    SIMD_Vec srcA, dstpixel;
+
+    while (info->dst_h--) {
+        const Uint32 *srcrow = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = srcrow;
+            Uint32 *d = dst;
+            if (n == 1) {
+                pixels[0] = pixels[1] = *srcrow;
+                pixels[2] = pixels[3] = *dst;
+                src = &pixels[0];
+                d = &pixels[2];
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_PERM(srcpixel, 3, 2, 1, 0);
+            srcA = SIMD_PERM(srcpixel, 3, 3, 3, 3);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, srcA)));
+            }
+            dstpixel = SIMD_LOAD(d);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
+            case SDL_COPY_BLEND:
+            case SDL_COPY_PREMULTIPLIED:
+                /* Premultiplied overflow saturates in SIMD_STORE */
+                dstpixel = SIMD_ADD(srcpixel, SIMD_Div255(SIMD_MUL(SIMD_SUB(v255, srcA), dstpixel)));
+                break;
+            case SDL_COPY_ADD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_MIN(SIMD_ADD(srcpixel, dstpixel), v255));
+                break;
+            case SDL_COPY_MOD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_Div255(SIMD_MUL(srcpixel, dstpixel)));
+                break;
+            }
+            dstpixel = SIMD_ANDNOT(alphamask, dstpixel);
+            SIMD_STORE(d, dstpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            srcrow += 2;
+            dst += 2;
+            n -= 2;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGRA8888_RGB888_Blend_Scale_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const SIMD_Vec v255 = SIMD_SET(0xFF, 0xFF, 0xFF, 0xFF);
+    SIMD_Vec srcpixel;
+    SIMD_Vec srcA, dstpixel;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        srcrow = info->src + (srcy * info->src_pitch);
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = pixels;
+            Uint32 *d = (n == 1) ? &pixels[2] : dst;
+            int i;
+            for (i = 0; i < 2; ++i) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                pixels[i] = *(const Uint32 *)(srcrow + (srcx * 4));
+                if (n == 1) {
+                    break;
+                }
+                posx += incx;
+            }
+            if (n == 1) {
+                pixels[1] = pixels[0];
+                pixels[2] = pixels[3] = *dst;
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_PERM(srcpixel, 3, 2, 1, 0);
+            srcA = SIMD_PERM(srcpixel, 3, 3, 3, 3);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, srcA)));
+            }
+            dstpixel = SIMD_LOAD(d);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
+            case SDL_COPY_BLEND:
+            case SDL_COPY_PREMULTIPLIED:
+                /* Premultiplied overflow saturates in SIMD_STORE */
+                dstpixel = SIMD_ADD(srcpixel, SIMD_Div255(SIMD_MUL(SIMD_SUB(v255, srcA), dstpixel)));
+                break;
+            case SDL_COPY_ADD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_MIN(SIMD_ADD(srcpixel, dstpixel), v255));
+                break;
+            case SDL_COPY_MOD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_Div255(SIMD_MUL(srcpixel, dstpixel)));
+                break;
+            }
+            dstpixel = SIMD_ANDNOT(alphamask, dstpixel);
+            SIMD_STORE(d, dstpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            dst += 2;
+            n -= 2;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGRA8888_RGB888_Modulate_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const Uint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Uint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Uint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Uint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const SIMD_Vec modulate = SIMD_SET(modulateB, modulateG, modulateR, modulateA);
+    SIMD_Vec srcpixel;
+
+    while (info->dst_h--) {
+        const Uint32 *srcrow = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = srcrow;
+            Uint32 *d = dst;
+            if (n == 1) {
+                pixels[0] = pixels[1] = *srcrow;
+                src = &pixels[0];
+                d = &pixels[2];
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_PERM(srcpixel, 3, 2, 1, 0);
+            srcpixel = SIMD_Div255(SIMD_MUL(srcpixel, modulate));
+            srcpixel = SIMD_ANDNOT(alphamask, srcpixel);
+            SIMD_STORE(d, srcpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            srcrow += 2;
+            dst += 2;
+            n -= 2;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGRA8888_RGB888_Modulate_Scale_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const Uint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Uint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Uint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Uint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const SIMD_Vec modulate = SIMD_SET(modulateB, modulateG, modulateR, modulateA);
+    SIMD_Vec srcpixel;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        srcrow = info->src + (srcy * info->src_pitch);
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = pixels;
+            Uint32 *d = (n == 1) ? &pixels[2] : dst;
+            int i;
+            for (i = 0; i < 2; ++i) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                pixels[i] = *(const Uint32 *)(srcrow + (srcx * 4));
+                if (n == 1) {
+                    break;
+                }
+                posx += incx;
+            }
+            if (n == 1) {
+                pixels[1] = pixels[0];
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_PERM(srcpixel, 3, 2, 1, 0);
+            srcpixel = SIMD_Div255(SIMD_MUL(srcpixel, modulate));
+            srcpixel = SIMD_ANDNOT(alphamask, srcpixel);
+            SIMD_STORE(d, srcpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            dst += 2;
+            n -= 2;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGRA8888_RGB888_Modulate_Blend_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const SIMD_Vec v255 = SIMD_SET(0xFF, 0xFF, 0xFF, 0xFF);
+    const Uint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Uint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Uint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Uint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const SIMD_Vec modulate = SIMD_SET(modulateB, modulateG, modulateR, modulateA);
+    const SIMD_Vec modulateAlpha = SIMD_SET(modulateA, modulateA, modulateA, modulateA);
+    SIMD_Vec srcpixel;
+    SIMD_Vec srcA, dstpixel;
+
+    while (info->dst_h--) {
+        const Uint32 *srcrow = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = srcrow;
+            Uint32 *d = dst;
+            if (n == 1) {
+                pixels[0] = pixels[1] = *srcrow;
+                pixels[2] = pixels[3] = *dst;
+                src = &pixels[0];
+                d = &pixels[2];
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_PERM(srcpixel, 3, 2, 1, 0);
+            srcpixel = SIMD_Div255(SIMD_MUL(srcpixel, modulate));
+            if ((flags & (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) == (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, modulateAlpha)));
+            }
+            srcA = SIMD_PERM(srcpixel, 3, 3, 3, 3);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, srcA)));
+            }
+            dstpixel = SIMD_LOAD(d);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
+            case SDL_COPY_BLEND:
+            case SDL_COPY_PREMULTIPLIED:
+                /* Premultiplied overflow saturates in SIMD_STORE */
+                dstpixel = SIMD_ADD(srcpixel, SIMD_Div255(SIMD_MUL(SIMD_SUB(v255, srcA), dstpixel)));
+                break;
+            case SDL_COPY_ADD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_MIN(SIMD_ADD(srcpixel, dstpixel), v255));
+                break;
+            case SDL_COPY_MOD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_Div255(SIMD_MUL(srcpixel, dstpixel)));
+                break;
+            }
+            dstpixel = SIMD_ANDNOT(alphamask, dstpixel);
+            SIMD_STORE(d, dstpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            srcrow += 2;
+            dst += 2;
+            n -= 2;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGRA8888_RGB888_Modulate_Blend_Scale_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const SIMD_Vec v255 = SIMD_SET(0xFF, 0xFF, 0xFF, 0xFF);
+    const Uint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Uint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Uint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Uint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const SIMD_Vec modulate = SIMD_SET(modulateB, modulateG, modulateR, modulateA);
+    const SIMD_Vec modulateAlpha = SIMD_SET(modulateA, modulateA, modulateA, modulateA);
+    SIMD_Vec srcpixel;
+    SIMD_Vec srcA, dstpixel;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        srcrow = info->src + (srcy * info->src_pitch);
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = pixels;
+            Uint32 *d = (n == 1) ? &pixels[2] : dst;
+            int i;
+            for (i = 0; i < 2; ++i) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                pixels[i] = *(const Uint32 *)(srcrow + (srcx * 4));
+                if (n == 1) {
+                    break;
+                }
+                posx += incx;
+            }
+            if (n == 1) {
+                pixels[1] = pixels[0];
+                pixels[2] = pixels[3] = *dst;
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_PERM(srcpixel, 3, 2, 1, 0);
+            srcpixel = SIMD_Div255(SIMD_MUL(srcpixel, modulate));
+            if ((flags & (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) == (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, modulateAlpha)));
+            }
+            srcA = SIMD_PERM(srcpixel, 3, 3, 3, 3);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, srcA)));
+            }
+            dstpixel = SIMD_LOAD(d);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
+            case SDL_COPY_BLEND:
+            case SDL_COPY_PREMULTIPLIED:
+                /* Premultiplied overflow saturates in SIMD_STORE */
+                dstpixel = SIMD_ADD(srcpixel, SIMD_Div255(SIMD_MUL(SIMD_SUB(v255, srcA), dstpixel)));
+                break;
+            case SDL_COPY_ADD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_MIN(SIMD_ADD(srcpixel, dstpixel), v255));
+                break;
+            case SDL_COPY_MOD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_Div255(SIMD_MUL(srcpixel, dstpixel)));
+                break;
+            }
+            dstpixel = SIMD_ANDNOT(alphamask, dstpixel);
+            SIMD_STORE(d, dstpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            dst += 2;
+            n -= 2;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGRA8888_BGR888_Scale_SIMD(SDL_BlitInfo *info)
+{
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    SIMD_Vec srcpixel;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        srcrow = info->src + (srcy * info->src_pitch);
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = pixels;
+            Uint32 *d = (n == 1) ? &pixels[2] : dst;
+            int i;
+            for (i = 0; i < 2; ++i) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                pixels[i] = *(const Uint32 *)(srcrow + (srcx * 4));
+                if (n == 1) {
+                    break;
+                }
+                posx += incx;
+            }
+            if (n == 1) {
+                pixels[1] = pixels[0];
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_PERM(srcpixel, 1, 2, 3, 0);
+            srcpixel = SIMD_ANDNOT(alphamask, srcpixel);
+            SIMD_STORE(d, srcpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            dst += 2;
+            n -= 2;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGRA8888_BGR888_Blend_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const SIMD_Vec v255 = SIMD_SET(0xFF, 0xFF, 0xFF, 0xFF);
+    SIMD_Vec srcpixel;
+    SIMD_Vec srcA, dstpixel;
+
+    while (info->dst_h--) {
+        const Uint32 *srcrow = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = srcrow;
+            Uint32 *d = dst;
+            if (n == 1) {
+                pixels[0] = pixels[1] = *srcrow;
+                pixels[2] = pixels[3] = *dst;
+                src = &pixels[0];
+                d = &pixels[2];
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_PERM(srcpixel, 1, 2, 3, 0);
+            srcA = SIMD_PERM(srcpixel, 3, 3, 3, 3);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, srcA)));
+            }
+            dstpixel = SIMD_LOAD(d);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
+            case SDL_COPY_BLEND:
+            case SDL_COPY_PREMULTIPLIED:
+                /* Premultiplied overflow saturates in SIMD_STORE */
+                dstpixel = SIMD_ADD(srcpixel, SIMD_Div255(SIMD_MUL(SIMD_SUB(v255, srcA), dstpixel)));
+                break;
+            case SDL_COPY_ADD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_MIN(SIMD_ADD(srcpixel, dstpixel), v255));
+                break;
+            case SDL_COPY_MOD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_Div255(SIMD_MUL(srcpixel, dstpixel)));
+                break;
+            }
+            dstpixel = SIMD_ANDNOT(alphamask, dstpixel);
+            SIMD_STORE(d, dstpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            srcrow += 2;
+            dst += 2;
+            n -= 2;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGRA8888_BGR888_Blend_Scale_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const SIMD_Vec v255 = SIMD_SET(0xFF, 0xFF, 0xFF, 0xFF);
+    SIMD_Vec srcpixel;
+    SIMD_Vec srcA, dstpixel;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        srcrow = info->src + (srcy * info->src_pitch);
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = pixels;
+            Uint32 *d = (n == 1) ? &pixels[2] : dst;
+            int i;
+            for (i = 0; i < 2; ++i) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                pixels[i] = *(const Uint32 *)(srcrow + (srcx * 4));
+                if (n == 1) {
+                    break;
+                }
+                posx += incx;
+            }
+            if (n == 1) {
+                pixels[1] = pixels[0];
+                pixels[2] = pixels[3] = *dst;
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_PERM(srcpixel, 1, 2, 3, 0);
+            srcA = SIMD_PERM(srcpixel, 3, 3, 3, 3);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, srcA)));
+            }
+            dstpixel = SIMD_LOAD(d);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
+            case SDL_COPY_BLEND:
+            case SDL_COPY_PREMULTIPLIED:
+                /* Premultiplied overflow saturates in SIMD_STORE */
+                dstpixel = SIMD_ADD(srcpixel, SIMD_Div255(SIMD_MUL(SIMD_SUB(v255, srcA), dstpixel)));
+                break;
+            case SDL_COPY_ADD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_MIN(SIMD_ADD(srcpixel, dstpixel), v255));
+                break;
+            case SDL_COPY_MOD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_Div255(SIMD_MUL(srcpixel, dstpixel)));
+                break;
+            }
+            dstpixel = SIMD_ANDNOT(alphamask, dstpixel);
+            SIMD_STORE(d, dstpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            dst += 2;
+            n -= 2;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGRA8888_BGR888_Modulate_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const Uint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Uint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Uint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Uint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const SIMD_Vec modulate = SIMD_SET(modulateR, modulateG, modulateB, modulateA);
+    SIMD_Vec srcpixel;
+
+    while (info->dst_h--) {
+        const Uint32 *srcrow = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = srcrow;
+            Uint32 *d = dst;
+            if (n == 1) {
+                pixels[0] = pixels[1] = *srcrow;
+                src = &pixels[0];
+                d = &pixels[2];
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_PERM(srcpixel, 1, 2, 3, 0);
+            srcpixel = SIMD_Div255(SIMD_MUL(srcpixel, modulate));
+            srcpixel = SIMD_ANDNOT(alphamask, srcpixel);
+            SIMD_STORE(d, srcpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            srcrow += 2;
+            dst += 2;
+            n -= 2;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGRA8888_BGR888_Modulate_Scale_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const Uint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Uint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Uint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Uint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const SIMD_Vec modulate = SIMD_SET(modulateR, modulateG, modulateB, modulateA);
+    SIMD_Vec srcpixel;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        srcrow = info->src + (srcy * info->src_pitch);
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = pixels;
+            Uint32 *d = (n == 1) ? &pixels[2] : dst;
+            int i;
+            for (i = 0; i < 2; ++i) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                pixels[i] = *(const Uint32 *)(srcrow + (srcx * 4));
+                if (n == 1) {
+                    break;
+                }
+                posx += incx;
+            }
+            if (n == 1) {
+                pixels[1] = pixels[0];
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_PERM(srcpixel, 1, 2, 3, 0);
+            srcpixel = SIMD_Div255(SIMD_MUL(srcpixel, modulate));
+            srcpixel = SIMD_ANDNOT(alphamask, srcpixel);
+            SIMD_STORE(d, srcpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            dst += 2;
+            n -= 2;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGRA8888_BGR888_Modulate_Blend_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const SIMD_Vec v255 = SIMD_SET(0xFF, 0xFF, 0xFF, 0xFF);
+    const Uint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Uint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Uint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Uint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const SIMD_Vec modulate = SIMD_SET(modulateR, modulateG, modulateB, modulateA);
+    const SIMD_Vec modulateAlpha = SIMD_SET(modulateA, modulateA, modulateA, modulateA);
+    SIMD_Vec srcpixel;
+    SIMD_Vec srcA, dstpixel;
+
+    while (info->dst_h--) {
+        const Uint32 *srcrow = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = srcrow;
+            Uint32 *d = dst;
+            if (n == 1) {
+                pixels[0] = pixels[1] = *srcrow;
+                pixels[2] = pixels[3] = *dst;
+                src = &pixels[0];
+                d = &pixels[2];
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_PERM(srcpixel, 1, 2, 3, 0);
+            srcpixel = SIMD_Div255(SIMD_MUL(srcpixel, modulate));
+            if ((flags & (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) == (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, modulateAlpha)));
+            }
+            srcA = SIMD_PERM(srcpixel, 3, 3, 3, 3);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, srcA)));
+            }
+            dstpixel = SIMD_LOAD(d);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
+            case SDL_COPY_BLEND:
+            case SDL_COPY_PREMULTIPLIED:
+                /* Premultiplied overflow saturates in SIMD_STORE */
+                dstpixel = SIMD_ADD(srcpixel, SIMD_Div255(SIMD_MUL(SIMD_SUB(v255, srcA), dstpixel)));
+                break;
+            case SDL_COPY_ADD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_MIN(SIMD_ADD(srcpixel, dstpixel), v255));
+                break;
+            case SDL_COPY_MOD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_Div255(SIMD_MUL(srcpixel, dstpixel)));
+                break;
+            }
+            dstpixel = SIMD_ANDNOT(alphamask, dstpixel);
+            SIMD_STORE(d, dstpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            srcrow += 2;
+            dst += 2;
+            n -= 2;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGRA8888_BGR888_Modulate_Blend_Scale_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const SIMD_Vec v255 = SIMD_SET(0xFF, 0xFF, 0xFF, 0xFF);
+    const Uint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Uint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Uint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Uint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const SIMD_Vec modulate = SIMD_SET(modulateR, modulateG, modulateB, modulateA);
+    const SIMD_Vec modulateAlpha = SIMD_SET(modulateA, modulateA, modulateA, modulateA);
+    SIMD_Vec srcpixel;
+    SIMD_Vec srcA, dstpixel;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        srcrow = info->src + (srcy * info->src_pitch);
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = pixels;
+            Uint32 *d = (n == 1) ? &pixels[2] : dst;
+            int i;
+            for (i = 0; i < 2; ++i) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                pixels[i] = *(const Uint32 *)(srcrow + (srcx * 4));
+                if (n == 1) {
+                    break;
+                }
+                posx += incx;
+            }
+            if (n == 1) {
+                pixels[1] = pixels[0];
+                pixels[2] = pixels[3] = *dst;
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_PERM(srcpixel, 1, 2, 3, 0);
+            srcpixel = SIMD_Div255(SIMD_MUL(srcpixel, modulate));
+            if ((flags & (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) == (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, modulateAlpha)));
+            }
+            srcA = SIMD_PERM(srcpixel, 3, 3, 3, 3);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, srcA)));
+            }
+            dstpixel = SIMD_LOAD(d);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
+            case SDL_COPY_BLEND:
+            case SDL_COPY_PREMULTIPLIED:
+                /* Premultiplied overflow saturates in SIMD_STORE */
+                dstpixel = SIMD_ADD(srcpixel, SIMD_Div255(SIMD_MUL(SIMD_SUB(v255, srcA), dstpixel)));
+                break;
+            case SDL_COPY_ADD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_MIN(SIMD_ADD(srcpixel, dstpixel), v255));
+                break;
+            case SDL_COPY_MOD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_Div255(SIMD_MUL(srcpixel, dstpixel)));
+                break;
+            }
+            dstpixel = SIMD_ANDNOT(alphamask, dstpixel);
+            SIMD_STORE(d, dstpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            dst += 2;
+            n -= 2;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGRA8888_ARGB8888_Scale_SIMD(SDL_BlitInfo *info)
+{
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    SIMD_Vec srcpixel;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        srcrow = info->src + (srcy * info->src_pitch);
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = pixels;
+            Uint32 *d = (n == 1) ? &pixels[2] : dst;
+            int i;
+            for (i = 0; i < 2; ++i) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                pixels[i] = *(const Uint32 *)(srcrow + (srcx * 4));
+                if (n == 1) {
+                    break;
+                }
+                posx += incx;
+            }
+            if (n == 1) {
+                pixels[1] = pixels[0];
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_PERM(srcpixel, 3, 2, 1, 0);
+            SIMD_STORE(d, srcpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            dst += 2;
+            n -= 2;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGRA8888_ARGB8888_Blend_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const SIMD_Vec v255 = SIMD_SET(0xFF, 0xFF, 0xFF, 0xFF);
+    SIMD_Vec srcpixel;
+    SIMD_Vec srcA, dstpixel;
+
+    while (info->dst_h--) {
+        const Uint32 *srcrow = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = srcrow;
+            Uint32 *d = dst;
+            if (n == 1) {
+                pixels[0] = pixels[1] = *srcrow;
+                pixels[2] = pixels[3] = *dst;
+                src = &pixels[0];
+                d = &pixels[2];
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_PERM(srcpixel, 3, 2, 1, 0);
+            srcA = SIMD_PERM(srcpixel, 3, 3, 3, 3);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, srcA)));
+            }
+            dstpixel = SIMD_LOAD(d);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
+            case SDL_COPY_BLEND:
+            case SDL_COPY_PREMULTIPLIED:
+                /* Premultiplied overflow saturates in SIMD_STORE */
+                dstpixel = SIMD_ADD(srcpixel, SIMD_Div255(SIMD_MUL(SIMD_SUB(v255, srcA), dstpixel)));
+                break;
+            case SDL_COPY_ADD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_MIN(SIMD_ADD(srcpixel, dstpixel), v255));
+                break;
+            case SDL_COPY_MOD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_Div255(SIMD_MUL(srcpixel, dstpixel)));
+                break;
+            }
+            SIMD_STORE(d, dstpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            srcrow += 2;
+            dst += 2;
+            n -= 2;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGRA8888_ARGB8888_Blend_Scale_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const SIMD_Vec v255 = SIMD_SET(0xFF, 0xFF, 0xFF, 0xFF);
+    SIMD_Vec srcpixel;
+    SIMD_Vec srcA, dstpixel;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        srcrow = info->src + (srcy * info->src_pitch);
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = pixels;
+            Uint32 *d = (n == 1) ? &pixels[2] : dst;
+            int i;
+            for (i = 0; i < 2; ++i) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                pixels[i] = *(const Uint32 *)(srcrow + (srcx * 4));
+                if (n == 1) {
+                    break;
+                }
+                posx += incx;
+            }
+            if (n == 1) {
+                pixels[1] = pixels[0];
+                pixels[2] = pixels[3] = *dst;
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_PERM(srcpixel, 3, 2, 1, 0);
+            srcA = SIMD_PERM(srcpixel, 3, 3, 3, 3);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, srcA)));
+            }
+            dstpixel = SIMD_LOAD(d);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
+            case SDL_COPY_BLEND:
+            case SDL_COPY_PREMULTIPLIED:
+                /* Premultiplied overflow saturates in SIMD_STORE */
+                dstpixel = SIMD_ADD(srcpixel, SIMD_Div255(SIMD_MUL(SIMD_SUB(v255, srcA), dstpixel)));
+                break;
+            case SDL_COPY_ADD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_MIN(SIMD_ADD(srcpixel, dstpixel), v255));
+                break;
+            case SDL_COPY_MOD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_Div255(SIMD_MUL(srcpixel, dstpixel)));
+                break;
+            }
+            SIMD_STORE(d, dstpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            dst += 2;
+            n -= 2;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGRA8888_ARGB8888_Modulate_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const Uint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Uint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Uint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Uint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const SIMD_Vec modulate = SIMD_SET(modulateB, modulateG, modulateR, modulateA);
+    SIMD_Vec srcpixel;
+
+    while (info->dst_h--) {
+        const Uint32 *srcrow = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = srcrow;
+            Uint32 *d = dst;
+            if (n == 1) {
+                pixels[0] = pixels[1] = *srcrow;
+                src = &pixels[0];
+                d = &pixels[2];
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_PERM(srcpixel, 3, 2, 1, 0);
+            srcpixel = SIMD_Div255(SIMD_MUL(srcpixel, modulate));
+            SIMD_STORE(d, srcpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            srcrow += 2;
+            dst += 2;
+            n -= 2;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGRA8888_ARGB8888_Modulate_Scale_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const Uint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Uint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Uint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Uint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const SIMD_Vec modulate = SIMD_SET(modulateB, modulateG, modulateR, modulateA);
+    SIMD_Vec srcpixel;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        srcrow = info->src + (srcy * info->src_pitch);
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = pixels;
+            Uint32 *d = (n == 1) ? &pixels[2] : dst;
+            int i;
+            for (i = 0; i < 2; ++i) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                pixels[i] = *(const Uint32 *)(srcrow + (srcx * 4));
+                if (n == 1) {
+                    break;
+                }
+                posx += incx;
+            }
+            if (n == 1) {
+                pixels[1] = pixels[0];
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_PERM(srcpixel, 3, 2, 1, 0);
+            srcpixel = SIMD_Div255(SIMD_MUL(srcpixel, modulate));
+            SIMD_STORE(d, srcpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            dst += 2;
+            n -= 2;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const SIMD_Vec v255 = SIMD_SET(0xFF, 0xFF, 0xFF, 0xFF);
+    const Uint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Uint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Uint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Uint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const SIMD_Vec modulate = SIMD_SET(modulateB, modulateG, modulateR, modulateA);
+    const SIMD_Vec modulateAlpha = SIMD_SET(modulateA, modulateA, modulateA, modulateA);
+    SIMD_Vec srcpixel;
+    SIMD_Vec srcA, dstpixel;
+
+    while (info->dst_h--) {
+        const Uint32 *srcrow = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = srcrow;
+            Uint32 *d = dst;
+            if (n == 1) {
+                pixels[0] = pixels[1] = *srcrow;
+                pixels[2] = pixels[3] = *dst;
+                src = &pixels[0];
+                d = &pixels[2];
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_PERM(srcpixel, 3, 2, 1, 0);
+            srcpixel = SIMD_Div255(SIMD_MUL(srcpixel, modulate));
+            if ((flags & (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) == (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, modulateAlpha)));
+            }
+            srcA = SIMD_PERM(srcpixel, 3, 3, 3, 3);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, srcA)));
+            }
+            dstpixel = SIMD_LOAD(d);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
+            case SDL_COPY_BLEND:
+            case SDL_COPY_PREMULTIPLIED:
+                /* Premultiplied overflow saturates in SIMD_STORE */
+                dstpixel = SIMD_ADD(srcpixel, SIMD_Div255(SIMD_MUL(SIMD_SUB(v255, srcA), dstpixel)));
+                break;
+            case SDL_COPY_ADD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_MIN(SIMD_ADD(srcpixel, dstpixel), v255));
+                break;
+            case SDL_COPY_MOD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_Div255(SIMD_MUL(srcpixel, dstpixel)));
+                break;
+            }
+            SIMD_STORE(d, dstpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            srcrow += 2;
+            dst += 2;
+            n -= 2;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_Scale_SIMD(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const SIMD_Vec alphamask = SIMD_SET(0, 0, 0, 0xFFFF);
+    const SIMD_Vec v255 = SIMD_SET(0xFF, 0xFF, 0xFF, 0xFF);
+    const Uint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Uint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Uint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Uint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const SIMD_Vec modulate = SIMD_SET(modulateB, modulateG, modulateR, modulateA);
+    const SIMD_Vec modulateAlpha = SIMD_SET(modulateA, modulateA, modulateA, modulateA);
+    SIMD_Vec srcpixel;
+    SIMD_Vec srcA, dstpixel;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        srcrow = info->src + (srcy * info->src_pitch);
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = pixels;
+            Uint32 *d = (n == 1) ? &pixels[2] : dst;
+            int i;
+            for (i = 0; i < 2; ++i) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                pixels[i] = *(const Uint32 *)(srcrow + (srcx * 4));
+                if (n == 1) {
+                    break;
+                }
+                posx += incx;
+            }
+            if (n == 1) {
+                pixels[1] = pixels[0];
+                pixels[2] = pixels[3] = *dst;
+            }
+            srcpixel = SIMD_LOAD(src);
+            srcpixel = SIMD_PERM(srcpixel, 3, 2, 1, 0);
+            srcpixel = SIMD_Div255(SIMD_MUL(srcpixel, modulate));
+            if ((flags & (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) == (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, modulateAlpha)));
+            }
+            srcA = SIMD_PERM(srcpixel, 3, 3, 3, 3);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, srcA)));
+            }
+            dstpixel = SIMD_LOAD(d);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
+            case SDL_COPY_BLEND:
+            case SDL_COPY_PREMULTIPLIED:
+                /* Premultiplied overflow saturates in SIMD_STORE */
+                dstpixel = SIMD_ADD(srcpixel, SIMD_Div255(SIMD_MUL(SIMD_SUB(v255, srcA), dstpixel)));
+                break;
+            case SDL_COPY_ADD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_MIN(SIMD_ADD(srcpixel, dstpixel), v255));
+                break;
+            case SDL_COPY_MOD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_Div255(SIMD_MUL(srcpixel, dstpixel)));
+                break;
+            }
+            SIMD_STORE(d, dstpixel);
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+            dst += 2;
+            n -= 2;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+#endif /* SDL_BLIT_AUTO_SIMD */
+
 SDL_BlitFuncEntry SDL_GeneratedBlitFuncTable[] = {
+#if SDL_BLIT_AUTO_SIMD
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_RGB888_RGB888_Scale_SIMD },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_RGB888_RGB888_Blend_SIMD },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED | SDL_COPY_NEAREST), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_RGB888_RGB888_Blend_Scale_SIMD },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_RGB888_RGB888_Modulate_SIMD },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_RGB888_RGB888_Modulate_Scale_SIMD },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_RGB888_RGB888_Modulate_Blend_SIMD },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED | SDL_COPY_NEAREST), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_RGB888_RGB888_Modulate_Blend_Scale_SIMD },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_RGB888_BGR888_Scale_SIMD },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_RGB888_BGR888_Blend_SIMD },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED | SDL_COPY_NEAREST), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_RGB888_BGR888_Blend_Scale_SIMD },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_RGB888_BGR888_Modulate_SIMD },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_RGB888_BGR888_Modulate_Scale_SIMD },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_RGB888_BGR888_Modulate_Blend_SIMD },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED | SDL_COPY_NEAREST), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_RGB888_BGR888_Modulate_Blend_Scale_SIMD },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_RGB888_ARGB8888_Scale_SIMD },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_RGB888_ARGB8888_Blend_SIMD },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED | SDL_COPY_NEAREST), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_RGB888_ARGB8888_Blend_Scale_SIMD },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_RGB888_ARGB8888_Modulate_SIMD },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_RGB888_ARGB8888_Modulate_Scale_SIMD },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_RGB888_ARGB8888_Modulate_Blend_SIMD },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED | SDL_COPY_NEAREST), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_RGB888_ARGB8888_Modulate_Blend_Scale_SIMD },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_BGR888_RGB888_Scale_SIMD },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_BGR888_RGB888_Blend_SIMD },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED | SDL_COPY_NEAREST), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_BGR888_RGB888_Blend_Scale_SIMD },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_BGR888_RGB888_Modulate_SIMD },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_BGR888_RGB888_Modulate_Scale_SIMD },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_BGR888_RGB888_Modulate_Blend_SIMD },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED | SDL_COPY_NEAREST), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_BGR888_RGB888_Modulate_Blend_Scale_SIMD },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_BGR888_BGR888_Scale_SIMD },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_BGR888_BGR888_Blend_SIMD },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED | SDL_COPY_NEAREST), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_BGR888_BGR888_Blend_Scale_SIMD },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_BGR888_BGR888_Modulate_SIMD },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_BGR888_BGR888_Modulate_Scale_SIMD },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_BGR888_BGR888_Modulate_Blend_SIMD },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED | SDL_COPY_NEAREST), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_BGR888_BGR888_Modulate_Blend_Scale_SIMD },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_BGR888_ARGB8888_Scale_SIMD },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_BGR888_ARGB8888_Blend_SIMD },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED | SDL_COPY_NEAREST), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_BGR888_ARGB8888_Blend_Scale_SIMD },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_BGR888_ARGB8888_Modulate_SIMD },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_BGR888_ARGB8888_Modulate_Scale_SIMD },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_BGR888_ARGB8888_Modulate_Blend_SIMD },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED | SDL_COPY_NEAREST), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_BGR888_ARGB8888_Modulate_Blend_Scale_SIMD },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_ARGB8888_RGB888_Scale_SIMD },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_ARGB8888_RGB888_Blend_SIMD },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED | SDL_COPY_NEAREST), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_ARGB8888_RGB888_Blend_Scale_SIMD },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_ARGB8888_RGB888_Modulate_SIMD },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_ARGB8888_RGB888_Modulate_Scale_SIMD },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_ARGB8888_RGB888_Modulate_Blend_SIMD },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED | SDL_COPY_NEAREST), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_ARGB8888_RGB888_Modulate_Blend_Scale_SIMD },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_ARGB8888_BGR888_Scale_SIMD },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_ARGB8888_BGR888_Blend_SIMD },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED | SDL_COPY_NEAREST), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_ARGB8888_BGR888_Blend_Scale_SIMD },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_ARGB8888_BGR888_Modulate_SIMD },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_ARGB8888_BGR888_Modulate_Scale_SIMD },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_ARGB8888_BGR888_Modulate_Blend_SIMD },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED | SDL_COPY_NEAREST), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_ARGB8888_BGR888_Modulate_Blend_Scale_SIMD },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_ARGB8888_ARGB8888_Scale_SIMD },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_ARGB8888_ARGB8888_Blend_SIMD },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED | SDL_COPY_NEAREST), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_ARGB8888_ARGB8888_Blend_Scale_SIMD },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_ARGB8888_ARGB8888_Modulate_SIMD },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_ARGB8888_ARGB8888_Modulate_Scale_SIMD },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_SIMD },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED | SDL_COPY_NEAREST), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_Scale_SIMD },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_RGBA8888_RGB888_Scale_SIMD },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_RGBA8888_RGB888_Blend_SIMD },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED | SDL_COPY_NEAREST), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_RGBA8888_RGB888_Blend_Scale_SIMD },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_RGBA8888_RGB888_Modulate_SIMD },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_RGBA8888_RGB888_Modulate_Scale_SIMD },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_RGBA8888_RGB888_Modulate_Blend_SIMD },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED | SDL_COPY_NEAREST), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_RGBA8888_RGB888_Modulate_Blend_Scale_SIMD },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_RGBA8888_BGR888_Scale_SIMD },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_RGBA8888_BGR888_Blend_SIMD },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED | SDL_COPY_NEAREST), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_RGBA8888_BGR888_Blend_Scale_SIMD },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_RGBA8888_BGR888_Modulate_SIMD },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_RGBA8888_BGR888_Modulate_Scale_SIMD },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_RGBA8888_BGR888_Modulate_Blend_SIMD },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED | SDL_COPY_NEAREST), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_RGBA8888_BGR888_Modulate_Blend_Scale_SIMD },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_RGBA8888_ARGB8888_Scale_SIMD },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_RGBA8888_ARGB8888_Blend_SIMD },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED | SDL_COPY_NEAREST), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_RGBA8888_ARGB8888_Blend_Scale_SIMD },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_RGBA8888_ARGB8888_Modulate_SIMD },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_RGBA8888_ARGB8888_Modulate_Scale_SIMD },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_SIMD },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED | SDL_COPY_NEAREST), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_Scale_SIMD },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_ABGR8888_RGB888_Scale_SIMD },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_ABGR8888_RGB888_Blend_SIMD },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED | SDL_COPY_NEAREST), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_ABGR8888_RGB888_Blend_Scale_SIMD },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_ABGR8888_RGB888_Modulate_SIMD },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_ABGR8888_RGB888_Modulate_Scale_SIMD },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_ABGR8888_RGB888_Modulate_Blend_SIMD },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED | SDL_COPY_NEAREST), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_ABGR8888_RGB888_Modulate_Blend_Scale_SIMD },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_ABGR8888_BGR888_Scale_SIMD },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_ABGR8888_BGR888_Blend_SIMD },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED | SDL_COPY_NEAREST), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_ABGR8888_BGR888_Blend_Scale_SIMD },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_ABGR8888_BGR888_Modulate_SIMD },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_ABGR8888_BGR888_Modulate_Scale_SIMD },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_ABGR8888_BGR888_Modulate_Blend_SIMD },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED | SDL_COPY_NEAREST), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_ABGR8888_BGR888_Modulate_Blend_Scale_SIMD },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_ABGR8888_ARGB8888_Scale_SIMD },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_ABGR8888_ARGB8888_Blend_SIMD },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED | SDL_COPY_NEAREST), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_ABGR8888_ARGB8888_Blend_Scale_SIMD },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_ABGR8888_ARGB8888_Modulate_SIMD },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_ABGR8888_ARGB8888_Modulate_Scale_SIMD },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_SIMD },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED | SDL_COPY_NEAREST), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_Scale_SIMD },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_BGRA8888_RGB888_Scale_SIMD },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_BGRA8888_RGB888_Blend_SIMD },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED | SDL_COPY_NEAREST), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_BGRA8888_RGB888_Blend_Scale_SIMD },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_BGRA8888_RGB888_Modulate_SIMD },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_BGRA8888_RGB888_Modulate_Scale_SIMD },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_BGRA8888_RGB888_Modulate_Blend_SIMD },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED | SDL_COPY_NEAREST), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_BGRA8888_RGB888_Modulate_Blend_Scale_SIMD },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_BGRA8888_BGR888_Scale_SIMD },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_BGRA8888_BGR888_Blend_SIMD },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED | SDL_COPY_NEAREST), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_BGRA8888_BGR888_Blend_Scale_SIMD },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_BGRA8888_BGR888_Modulate_SIMD },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_BGRA8888_BGR888_Modulate_Scale_SIMD },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_BGRA8888_BGR888_Modulate_Blend_SIMD },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED | SDL_COPY_NEAREST), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_BGRA8888_BGR888_Modulate_Blend_Scale_SIMD },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_BGRA8888_ARGB8888_Scale_SIMD },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_BGRA8888_ARGB8888_Blend_SIMD },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED | SDL_COPY_NEAREST), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_BGRA8888_ARGB8888_Blend_Scale_SIMD },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_BGRA8888_ARGB8888_Modulate_SIMD },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_BGRA8888_ARGB8888_Modulate_Scale_SIMD },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_SIMD },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED | SDL_COPY_NEAREST), SDL_BLIT_AUTO_SIMD_CPU, SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_Scale_SIMD },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_RGB888_Scale },
-    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_RGB888_RGB888_Blend },
-    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_RGB888_Blend_Scale },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED), SDL_CPU_ANY, SDL_Blit_RGB888_RGB888_Blend },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_RGB888_Blend_Scale },
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_RGB888_RGB888_Modulate },
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_RGB888_Modulate_Scale },
-    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_RGB888_RGB888_Modulate_Blend },
-    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_RGB888_Modulate_Blend_Scale },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED), SDL_CPU_ANY, SDL_Blit_RGB888_RGB888_Modulate_Blend },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_RGB888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_BGR888_Scale },
-    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_RGB888_BGR888_Blend },
-    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_BGR888_Blend_Scale },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED), SDL_CPU_ANY, SDL_Blit_RGB888_BGR888_Blend },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_BGR888_Blend_Scale },
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_RGB888_BGR888_Modulate },
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_BGR888_Modulate_Scale },
-    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_RGB888_BGR888_Modulate_Blend },
-    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_BGR888_Modulate_Blend_Scale },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED), SDL_CPU_ANY, SDL_Blit_RGB888_BGR888_Modulate_Blend },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_BGR888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_ARGB8888_Scale },
-    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_RGB888_ARGB8888_Blend },
-    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_ARGB8888_Blend_Scale },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED), SDL_CPU_ANY, SDL_Blit_RGB888_ARGB8888_Blend },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_ARGB8888_Blend_Scale },
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_RGB888_ARGB8888_Modulate },
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_ARGB8888_Modulate_Scale },
-    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_RGB888_ARGB8888_Modulate_Blend },
-    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_ARGB8888_Modulate_Blend_Scale },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED), SDL_CPU_ANY, SDL_Blit_RGB888_ARGB8888_Modulate_Blend },
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_ARGB8888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_RGB888_Scale },
-    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_BGR888_RGB888_Blend },
-    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_RGB888_Blend_Scale },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED), SDL_CPU_ANY, SDL_Blit_BGR888_RGB888_Blend },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_RGB888_Blend_Scale },
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_BGR888_RGB888_Modulate },
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_RGB888_Modulate_Scale },
-    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_BGR888_RGB888_Modulate_Blend },
-    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_RGB888_Modulate_Blend_Scale },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED), SDL_CPU_ANY, SDL_Blit_BGR888_RGB888_Modulate_Blend },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_RGB888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_BGR888_Scale },
-    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_BGR888_BGR888_Blend },
-    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_BGR888_Blend_Scale },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED), SDL_CPU_ANY, SDL_Blit_BGR888_BGR888_Blend },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_BGR888_Blend_Scale },
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_BGR888_BGR888_Modulate },
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_BGR888_Modulate_Scale },
-    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_BGR888_BGR888_Modulate_Blend },
-    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_BGR888_Modulate_Blend_Scale },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED), SDL_CPU_ANY, SDL_Blit_BGR888_BGR888_Modulate_Blend },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_BGR888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_ARGB8888_Scale },
-    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_BGR888_ARGB8888_Blend },
-    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_ARGB8888_Blend_Scale },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED), SDL_CPU_ANY, SDL_Blit_BGR888_ARGB8888_Blend },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_ARGB8888_Blend_Scale },
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_BGR888_ARGB8888_Modulate },
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_ARGB8888_Modulate_Scale },
-    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_BGR888_ARGB8888_Modulate_Blend },
-    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_ARGB8888_Modulate_Blend_Scale },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED), SDL_CPU_ANY, SDL_Blit_BGR888_ARGB8888_Modulate_Blend },
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_ARGB8888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_RGB888_Scale },
-    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_ARGB8888_RGB888_Blend },
-    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_RGB888_Blend_Scale },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED), SDL_CPU_ANY, SDL_Blit_ARGB8888_RGB888_Blend },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_RGB888_Blend_Scale },
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_ARGB8888_RGB888_Modulate },
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_RGB888_Modulate_Scale },
-    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_ARGB8888_RGB888_Modulate_Blend },
-    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_RGB888_Modulate_Blend_Scale },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED), SDL_CPU_ANY, SDL_Blit_ARGB8888_RGB888_Modulate_Blend },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_RGB888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_BGR888_Scale },
-    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_ARGB8888_BGR888_Blend },
-    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_BGR888_Blend_Scale },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED), SDL_CPU_ANY, SDL_Blit_ARGB8888_BGR888_Blend },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_BGR888_Blend_Scale },
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_ARGB8888_BGR888_Modulate },
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_BGR888_Modulate_Scale },
-    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_ARGB8888_BGR888_Modulate_Blend },
-    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_BGR888_Modulate_Blend_Scale },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED), SDL_CPU_ANY, SDL_Blit_ARGB8888_BGR888_Modulate_Blend },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_BGR888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_ARGB8888_Scale },
-    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_ARGB8888_ARGB8888_Blend },
-    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_ARGB8888_Blend_Scale },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED), SDL_CPU_ANY, SDL_Blit_ARGB8888_ARGB8888_Blend },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_ARGB8888_Blend_Scale },
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_ARGB8888_ARGB8888_Modulate },
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_ARGB8888_Modulate_Scale },
-    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend },
-    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_Scale },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED), SDL_CPU_ANY, SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_RGB888_Scale },
-    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_RGBA8888_RGB888_Blend },
-    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_RGB888_Blend_Scale },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED), SDL_CPU_ANY, SDL_Blit_RGBA8888_RGB888_Blend },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_RGB888_Blend_Scale },
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_RGBA8888_RGB888_Modulate },
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_RGB888_Modulate_Scale },
-    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_RGBA8888_RGB888_Modulate_Blend },
-    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_RGB888_Modulate_Blend_Scale },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED), SDL_CPU_ANY, SDL_Blit_RGBA8888_RGB888_Modulate_Blend },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_RGB888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_BGR888_Scale },
-    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_RGBA8888_BGR888_Blend },
-    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_BGR888_Blend_Scale },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED), SDL_CPU_ANY, SDL_Blit_RGBA8888_BGR888_Blend },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_BGR888_Blend_Scale },
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_RGBA8888_BGR888_Modulate },
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_BGR888_Modulate_Scale },
-    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_RGBA8888_BGR888_Modulate_Blend },
-    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_BGR888_Modulate_Blend_Scale },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED), SDL_CPU_ANY, SDL_Blit_RGBA8888_BGR888_Modulate_Blend },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_BGR888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_ARGB8888_Scale },
-    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_RGBA8888_ARGB8888_Blend },
-    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_ARGB8888_Blend_Scale },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED), SDL_CPU_ANY, SDL_Blit_RGBA8888_ARGB8888_Blend },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_ARGB8888_Blend_Scale },
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_RGBA8888_ARGB8888_Modulate },
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_ARGB8888_Modulate_Scale },
-    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend },
-    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_Scale },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED), SDL_CPU_ANY, SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_RGB888_Scale },
-    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_ABGR8888_RGB888_Blend },
-    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_RGB888_Blend_Scale },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED), SDL_CPU_ANY, SDL_Blit_ABGR8888_RGB888_Blend },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_RGB888_Blend_Scale },
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_ABGR8888_RGB888_Modulate },
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_RGB888_Modulate_Scale },
-    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_ABGR8888_RGB888_Modulate_Blend },
-    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_RGB888_Modulate_Blend_Scale },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED), SDL_CPU_ANY, SDL_Blit_ABGR8888_RGB888_Modulate_Blend },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_RGB888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_BGR888_Scale },
-    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_ABGR8888_BGR888_Blend },
-    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_BGR888_Blend_Scale },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED), SDL_CPU_ANY, SDL_Blit_ABGR8888_BGR888_Blend },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_BGR888_Blend_Scale },
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_ABGR8888_BGR888_Modulate },
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_BGR888_Modulate_Scale },
-    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_ABGR8888_BGR888_Modulate_Blend },
-    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_BGR888_Modulate_Blend_Scale },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED), SDL_CPU_ANY, SDL_Blit_ABGR8888_BGR888_Modulate_Blend },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_BGR888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_ARGB8888_Scale },
-    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_ABGR8888_ARGB8888_Blend },
-    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_ARGB8888_Blend_Scale },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED), SDL_CPU_ANY, SDL_Blit_ABGR8888_ARGB8888_Blend },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_ARGB8888_Blend_Scale },
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_ABGR8888_ARGB8888_Modulate },
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_ARGB8888_Modulate_Scale },
-    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend },
-    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_Scale },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED), SDL_CPU_ANY, SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_RGB888_Scale },
-    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_BGRA8888_RGB888_Blend },
-    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_RGB888_Blend_Scale },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED), SDL_CPU_ANY, SDL_Blit_BGRA8888_RGB888_Blend },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_RGB888_Blend_Scale },
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_BGRA8888_RGB888_Modulate },
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_RGB888_Modulate_Scale },
-    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_BGRA8888_RGB888_Modulate_Blend },
-    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_RGB888_Modulate_Blend_Scale },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED), SDL_CPU_ANY, SDL_Blit_BGRA8888_RGB888_Modulate_Blend },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_RGB888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_BGR888_Scale },
-    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_BGRA8888_BGR888_Blend },
-    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_BGR888_Blend_Scale },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED), SDL_CPU_ANY, SDL_Blit_BGRA8888_BGR888_Blend },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_BGR888_Blend_Scale },
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_BGRA8888_BGR888_Modulate },
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_BGR888_Modulate_Scale },
-    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_BGRA8888_BGR888_Modulate_Blend },
-    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_BGR888_Modulate_Blend_Scale },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED), SDL_CPU_ANY, SDL_Blit_BGRA8888_BGR888_Modulate_Blend },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_BGR888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_ARGB8888_Scale },
-    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_BGRA8888_ARGB8888_Blend },
-    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_ARGB8888_Blend_Scale },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED), SDL_CPU_ANY, SDL_Blit_BGRA8888_ARGB8888_Blend },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_ARGB8888_Blend_Scale },
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_BGRA8888_ARGB8888_Modulate },
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_ARGB8888_Modulate_Scale },
-    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD), SDL_CPU_ANY, SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend },
-    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_Scale },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED), SDL_CPU_ANY, SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_Scale },
     { 0, 0, 0, 0, NULL }
 };
 
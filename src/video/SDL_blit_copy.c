@@ -117,6 +117,12 @@ SDL_BlitCopy(SDL_BlitInfo * info)
         return;
     }
 
+    /* Rows that follow each other in both surfaces are a single copy */
+    if (w == srcskip && w == dstskip) {
+        w *= h;
+        h = 1;
+    }
+
 #ifdef __SSE__
     if (SDL_HasSSE() &&
         !((uintptr_t) src & 15) && !(srcskip & 15) &&
@@ -107,6 +107,12 @@ SDL_Blit_Slow(SDL_BlitInfo * info)
             }
             if (flags & SDL_COPY_MODULATE_ALPHA) {
                 srcA = (srcA * modulateA) / 255;
+                if (flags & SDL_COPY_PREMULTIPLIED) {
+                    /* Premultiplied color fades along with its alpha */
+                    srcR = (srcR * modulateA) / 255;
+                    srcG = (srcG * modulateA) / 255;
+                    srcB = (srcB * modulateA) / 255;
+                }
             }
             if (flags & (SDL_COPY_BLEND | SDL_COPY_ADD)) {
                 /* This goes away if we ever use premultiplied alpha */
@@ -116,7 +122,8 @@ SDL_Blit_Slow(SDL_BlitInfo * info)
                     srcB = (srcB * srcA) / 255;
                 }
             }
-            switch (flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD)) {
+            switch (flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD |
+                             SDL_COPY_PREMULTIPLIED)) {
             case 0:
                 dstR = srcR;
                 dstG = srcG;
@@ -128,6 +135,18 @@ SDL_Blit_Slow(SDL_BlitInfo * info)
                 dstG = srcG + ((255 - srcA) * dstG) / 255;
                 dstB = srcB + ((255 - srcA) * dstB) / 255;
                 break;
+            case SDL_COPY_PREMULTIPLIED:
+                dstR = srcR + ((255 - srcA) * dstR) / 255;
+                if (dstR > 255)
+                    dstR = 255;
+                dstG = srcG + ((255 - srcA) * dstG) / 255;
+                if (dstG > 255)
+                    dstG = 255;
+                dstB = srcB + ((255 - srcA) * dstB) / 255;
+                if (dstB > 255)
+                    dstB = 255;
+                dstA = srcA + ((255 - srcA) * dstA) / 255;
+                break;
             case SDL_COPY_ADD:
                 dstR = srcR + dstR;
                 if (dstR > 255)
@@ -0,0 +1,485 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2014 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "../SDL_internal.h"
+
+/* Recording presented frames to a stream from a writer thread */
+
+#include "SDL_video.h"
+#include "SDL_thread.h"
+#include "SDL_capture_c.h"
+
+
+typedef struct
+{
+    void *pixels;
+    size_t size;
+    int w, h;
+    int pitch;
+} SDL_CaptureFrame;
+
+struct SDL_FrameCapture
+{
+    SDL_RWops *dst;
+    int freedst;
+    SDL_CaptureFormat format;
+    int fps;
+    SDL_CapturePolicy policy;
+    SDL_FrameCapture **owner;
+
+    SDL_Thread *thread;
+    SDL_mutex *lock;
+    SDL_cond *cond;
+    SDL_bool quit;
+
+    /* Frames are queued in a ring, from 'head' on */
+    SDL_CaptureFrame *frames;
+    int num_frames;
+    int head;
+    int count;
+
+    /* The size of raw and Y4M streams, once the first frame is queued */
+    int w, h;
+
+    /* Only used by the writer */
+    Uint8 *scratch;
+    size_t scratch_size;
+    SDL_bool header_written;
+
+    Uint32 written;
+    Uint32 dropped;
+    int status;
+    char error[256];
+};
+
+
+static int
+SDL_WriteCaptureData(SDL_FrameCapture * capture, const void *data, size_t size)
+{
+    if (SDL_RWwrite(capture->dst, data, size, 1) != 1) {
+        return SDL_SetError("Couldn't write captured frame");
+    }
+    return 0;
+}
+
+static Uint8 *
+SDL_GetCaptureScratch(SDL_FrameCapture * capture, size_t size)
+{
+    if (capture->scratch_size < size) {
+        SDL_free(capture->scratch);
+        capture->scratch = (Uint8 *) SDL_malloc(size);
+        if (!capture->scratch) {
+            capture->scratch_size = 0;
+            SDL_OutOfMemory();
+            return NULL;
+        }
+        capture->scratch_size = size;
+    }
+    return capture->scratch;
+}
+
+static int
+SDL_WriteRawFrame(SDL_FrameCapture * capture, const SDL_CaptureFrame * frame)
+{
+    const int pitch = frame->w * 3;
+    Uint8 *rgb;
+
+    rgb = SDL_GetCaptureScratch(capture, (size_t) pitch * frame->h);
+    if (!rgb) {
+        return -1;
+    }
+    if (SDL_ConvertPixels(frame->w, frame->h,
+                          SDL_CAPTURE_PIXELFORMAT, frame->pixels, frame->pitch,
+                          SDL_PIXELFORMAT_RGB24, rgb, pitch) < 0) {
+        return -1;
+    }
+    return SDL_WriteCaptureData(capture, rgb, (size_t) pitch * frame->h);
+}
+
+/* BT.601 studio range, chroma from the average of each 2x2 block */
+#define CAPTURE_Y(r, g, b)  (Uint8)(((66 * (r) + 129 * (g) + 25 * (b) + 128) >> 8) + 16)
+#define CAPTURE_U(r, g, b)  (Uint8)((-38 * (r) - 74 * (g) + 112 * (b) + 32896) >> 8)
+#define CAPTURE_V(r, g, b)  (Uint8)((112 * (r) - 94 * (g) - 18 * (b) + 32896) >> 8)
+
+static int
+SDL_WriteY4MFrame(SDL_FrameCapture * capture, const SDL_CaptureFrame * frame)
+{
+    static const char frame_header[] = "FRAME\n";
+    const int w = frame->w, h = frame->h;
+    const int cw = (w + 1) / 2, ch = (h + 1) / 2;
+    const size_t size = (size_t) w * h + 2 * (size_t) cw * ch;
+    const Uint32 *row0, *row1;
+    Uint8 *yplane, *uplane, *vplane;
+    Uint32 p[4];
+    int x, y, x1, r, g, b;
+
+    if (!capture->header_written) {
+        char header[128];
+
+        SDL_snprintf(header, sizeof(header),
+                     "YUV4MPEG2 W%d H%d F%d:1 Ip A1:1 C420jpeg\n",
+                     w, h, capture->fps);
+        if (SDL_WriteCaptureData(capture, header, SDL_strlen(header)) < 0) {
+            return -1;
+        }
+        capture->header_written = SDL_TRUE;
+    }
+
+    yplane = SDL_GetCaptureScratch(capture, size);
+    if (!yplane) {
+        return -1;
+    }
+    uplane = yplane + w * h;
+    vplane = uplane + cw * ch;
+
+    for (y = 0; y < h; ++y) {
+        row0 = (const Uint32 *) ((const Uint8 *) frame->pixels + y * frame->pitch);
+        for (x = 0; x < w; ++x) {
+            r = (row0[x] >> 16) & 0xFF;
+            g = (row0[x] >> 8) & 0xFF;
+            b = row0[x] & 0xFF;
+            *yplane++ = CAPTURE_Y(r, g, b);
+        }
+    }
+
+    /* An odd last row or column is averaged with itself */
+    for (y = 0; y < ch; ++y) {
+        row0 = (const Uint32 *) ((const Uint8 *) frame->pixels + (2 * y) * frame->pitch);
+        row1 = (2 * y + 1 < h) ? (const Uint32 *) ((const Uint8 *) row0 + frame->pitch) : row0;
+        for (x = 0; x < cw; ++x) {
+            x1 = (2 * x + 1 < w) ? 2 * x + 1 : 2 * x;
+            p[0] = row0[2 * x];
+            p[1] = row0[x1];
+            p[2] = row1[2 * x];
+            p[3] = row1[x1];
+            r = (((p[0] >> 16) & 0xFF) + ((p[1] >> 16) & 0xFF) +
+                 ((p[2] >> 16) & 0xFF) + ((p[3] >> 16) & 0xFF) + 2) >> 2;
+            g = (((p[0] >> 8) & 0xFF) + ((p[1] >> 8) & 0xFF) +
+                 ((p[2] >> 8) & 0xFF) + ((p[3] >> 8) & 0xFF) + 2) >> 2;
+            b = ((p[0] & 0xFF) + (p[1] & 0xFF) +
+                 (p[2] & 0xFF) + (p[3] & 0xFF) + 2) >> 2;
+            *uplane++ = CAPTURE_U(r, g, b);
+            *vplane++ = CAPTURE_V(r, g, b);
+        }
+    }
+
+    if (SDL_WriteCaptureData(capture, frame_header, sizeof(frame_header) - 1) < 0) {
+        return -1;
+    }
+    return SDL_WriteCaptureData(capture, capture->scratch, size);
+}
+
+static int
+SDL_WriteBMPFrame(SDL_FrameCapture * capture, const SDL_CaptureFrame * frame)
+{
+    SDL_Surface *surface;
+    int bpp, status;
+    Uint32 Rmask, Gmask, Bmask, Amask;
+
+    SDL_PixelFormatEnumToMasks(SDL_CAPTURE_PIXELFORMAT,
+                               &bpp, &Rmask, &Gmask, &Bmask, &Amask);
+    surface = SDL_CreateRGBSurfaceFrom(frame->pixels, frame->w, frame->h,
+                                       bpp, frame->pitch,
+                                       Rmask, Gmask, Bmask, Amask);
+    if (!surface) {
+        return -1;
+    }
+    status = SDL_SaveBMP_RW(surface, capture->dst, 0);
+    SDL_FreeSurface(surface);
+    return status;
+}
+
+static int
+SDL_FrameCaptureThread(void *data)
+{
+    SDL_FrameCapture *capture = (SDL_FrameCapture *) data;
+    SDL_CaptureFrame *frame;
+    int status;
+
+    SDL_LockMutex(capture->lock);
+    for ( ; ; ) {
+        while (!capture->quit && capture->count == 0) {
+            SDL_CondWait(capture->cond, capture->lock);
+        }
+        /* Frames still queued are written before quitting */
+        if (capture->count == 0) {
+            break;
+        }
+
+        frame = &capture->frames[capture->head];
+        status = capture->status;
+        SDL_UnlockMutex(capture->lock);
+
+        /* Once writing failed the stream is of no use, drop the rest */
+        if (status == 0) {
+            switch (capture->format) {
+            case SDL_CAPTURE_RAW:
+                status = SDL_WriteRawFrame(capture, frame);
+                break;
+            case SDL_CAPTURE_Y4M:
+                status = SDL_WriteY4MFrame(capture, frame);
+                break;
+            case SDL_CAPTURE_BMP:
+                status = SDL_WriteBMPFrame(capture, frame);
+                break;
+            }
+        }
+
+        SDL_LockMutex(capture->lock);
+        if (status < 0) {
+            if (capture->status == 0) {
+                capture->status = -1;
+                SDL_strlcpy(capture->error, SDL_GetError(), sizeof(capture->error));
+            }
+            ++capture->dropped;
+        } else {
+            ++capture->written;
+        }
+        capture->head = (capture->head + 1) % capture->num_frames;
+        --capture->count;
+        SDL_CondSignal(capture->cond);
+    }
+    SDL_UnlockMutex(capture->lock);
+    return 0;
+}
+
+SDL_FrameCapture *
+SDL_CreateFrameCapture(SDL_RWops * dst, int freedst, SDL_CaptureFormat format,
+                       int fps, int queue_length, SDL_CapturePolicy policy)
+{
+    SDL_FrameCapture *capture = NULL;
+
+    if (!dst) {
+        SDL_InvalidParamError("dst");
+        return NULL;
+    }
+    if (format != SDL_CAPTURE_RAW &&
+        format != SDL_CAPTURE_Y4M &&
+        format != SDL_CAPTURE_BMP) {
+        SDL_InvalidParamError("format");
+        goto error;
+    }
+    if (format == SDL_CAPTURE_Y4M && fps <= 0) {
+        SDL_InvalidParamError("fps");
+        goto error;
+    }
+    if (queue_length <= 0) {
+        SDL_InvalidParamError("queue_length");
+        goto error;
+    }
+    if (policy != SDL_CAPTURE_DROP && policy != SDL_CAPTURE_WAIT) {
+        SDL_InvalidParamError("policy");
+        goto error;
+    }
+
+    capture = (SDL_FrameCapture *) SDL_calloc(1, sizeof(*capture));
+    if (!capture) {
+        SDL_OutOfMemory();
+        goto error;
+    }
+    capture->dst = dst;
+    capture->freedst = freedst;
+    capture->format = format;
+    capture->fps = fps;
+    capture->policy = policy;
+    capture->num_frames = queue_length;
+    capture->frames = (SDL_CaptureFrame *) SDL_calloc(queue_length, sizeof(*capture->frames));
+    if (!capture->frames) {
+        SDL_OutOfMemory();
+        goto error;
+    }
+
+    capture->lock = SDL_CreateMutex();
+    capture->cond = SDL_CreateCond();
+    if (capture->lock && capture->cond) {
+        capture->thread = SDL_CreateThread(SDL_FrameCaptureThread, "SDLCapture", capture);
+    }
+    if (!capture->thread) {
+        goto error;
+    }
+    return capture;
+
+  error:
+    if (capture) {
+        if (capture->cond) {
+            SDL_DestroyCond(capture->cond);
+        }
+        if (capture->lock) {
+            SDL_DestroyMutex(capture->lock);
+        }
+        SDL_free(capture->frames);
+        SDL_free(capture);
+    }
+    if (freedst) {
+        SDL_RWclose(dst);
+    }
+    return NULL;
+}
+
+void
+SDL_AttachFrameCapture(SDL_FrameCapture ** owner, SDL_FrameCapture * capture)
+{
+    if (*owner) {
+        (*owner)->owner = NULL;
+        *owner = NULL;
+    }
+    if (capture) {
+        if (capture->owner) {
+            *capture->owner = NULL;
+        }
+        capture->owner = owner;
+        *owner = capture;
+    }
+}
+
+void *
+SDL_AcquireCaptureFrame(SDL_FrameCapture * capture, int w, int h, int *pitch)
+{
+    SDL_CaptureFrame *frame;
+    size_t size;
+
+    SDL_LockMutex(capture->lock);
+    if (capture->format != SDL_CAPTURE_BMP) {
+        if (!capture->w) {
+            capture->w = w;
+            capture->h = h;
+        }
+        if (w != capture->w || h != capture->h) {
+            ++capture->dropped;
+            SDL_UnlockMutex(capture->lock);
+            return NULL;
+        }
+    }
+    while (capture->count == capture->num_frames) {
+        if (capture->policy == SDL_CAPTURE_DROP) {
+            ++capture->dropped;
+            SDL_UnlockMutex(capture->lock);
+            return NULL;
+        }
+        SDL_CondWait(capture->cond, capture->lock);
+    }
+    /* The writer doesn't touch the frame after the last one queued */
+    frame = &capture->frames[(capture->head + capture->count) % capture->num_frames];
+    SDL_UnlockMutex(capture->lock);
+
+    frame->w = w;
+    frame->h = h;
+    frame->pitch = w * SDL_BYTESPERPIXEL(SDL_CAPTURE_PIXELFORMAT);
+    size = (size_t) frame->pitch * h;
+    if (frame->size < size) {
+        SDL_free(frame->pixels);
+        frame->pixels = SDL_malloc(size);
+        if (!frame->pixels) {
+            frame->size = 0;
+            SDL_SubmitCaptureFrame(capture, SDL_FALSE);
+            return NULL;
+        }
+        frame->size = size;
+    }
+    *pitch = frame->pitch;
+    return frame->pixels;
+}
+
+void
+SDL_SubmitCaptureFrame(SDL_FrameCapture * capture, SDL_bool filled)
+{
+    SDL_LockMutex(capture->lock);
+    if (filled) {
+        ++capture->count;
+        SDL_CondSignal(capture->cond);
+    } else {
+        ++capture->dropped;
+    }
+    SDL_UnlockMutex(capture->lock);
+}
+
+void
+SDL_CaptureSurface(SDL_FrameCapture * capture, SDL_Surface * surface)
+{
+    void *pixels;
+    int pitch;
+
+    pixels = SDL_AcquireCaptureFrame(capture, surface->w, surface->h, &pitch);
+    if (!pixels) {
+        return;
+    }
+    SDL_SubmitCaptureFrame(capture,
+        SDL_ConvertPixels(surface->w, surface->h,
+                          surface->format->format, surface->pixels, surface->pitch,
+                          SDL_CAPTURE_PIXELFORMAT, pixels, pitch) == 0);
+}
+
+void
+SDL_GetFrameCaptureStats(SDL_FrameCapture * capture, Uint32 * written, Uint32 * dropped)
+{
+    if (!capture) {
+        SDL_InvalidParamError("capture");
+        return;
+    }
+
+    SDL_LockMutex(capture->lock);
+    if (written) {
+        *written = capture->written;
+    }
+    if (dropped) {
+        *dropped = capture->dropped;
+    }
+    SDL_UnlockMutex(capture->lock);
+}
+
+int
+SDL_CloseFrameCapture(SDL_FrameCapture * capture)
+{
+    int i, status;
+
+    if (!capture) {
+        return SDL_InvalidParamError("capture");
+    }
+
+    if (capture->owner) {
+        *capture->owner = NULL;
+    }
+
+    SDL_LockMutex(capture->lock);
+    capture->quit = SDL_TRUE;
+    SDL_CondSignal(capture->cond);
+    SDL_UnlockMutex(capture->lock);
+    SDL_WaitThread(capture->thread, NULL);
+
+    status = capture->status;
+    if (status < 0) {
+        SDL_SetError("%s", capture->error);
+    }
+    if (capture->freedst && SDL_RWclose(capture->dst) < 0) {
+        status = -1;
+    }
+
+    SDL_DestroyCond(capture->cond);
+    SDL_DestroyMutex(capture->lock);
+    for (i = 0; i < capture->num_frames; ++i) {
+        SDL_free(capture->frames[i].pixels);
+    }
+    SDL_free(capture->frames);
+    SDL_free(capture->scratch);
+    SDL_free(capture);
+    return status;
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -0,0 +1,52 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2014 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "../SDL_internal.h"
+
+#ifndef _SDL_capture_c_h
+#define _SDL_capture_c_h
+
+#include "SDL_capture.h"
+
+/* Useful functions and variables from SDL_capture.c */
+
+/* The format frames are queued in */
+#define SDL_CAPTURE_PIXELFORMAT SDL_PIXELFORMAT_RGB888
+
+/* Sets the capture recording into 'owner', the capture field of a window or
+   renderer, after taking it from what it was recording before.  A NULL
+   capture clears the field.
+ */
+extern void SDL_AttachFrameCapture(SDL_FrameCapture ** owner, SDL_FrameCapture * capture);
+
+/* Returns a frame of w x h pixels to fill in, or NULL if the frame is
+   dropped.  Every frame returned is handed back to SDL_SubmitCaptureFrame(),
+   with 'filled' false if it couldn't be filled in after all.  Submitting
+   a frame that wasn't filled in also counts frames dropped without one.
+ */
+extern void *SDL_AcquireCaptureFrame(SDL_FrameCapture * capture, int w, int h, int *pitch);
+extern void SDL_SubmitCaptureFrame(SDL_FrameCapture * capture, SDL_bool filled);
+
+/* Queues the contents of the surface */
+extern void SDL_CaptureSurface(SDL_FrameCapture * capture, SDL_Surface * surface);
+
+#endif /* _SDL_capture_c_h */
+
+/* vi: set ts=4 sw=4 expandtab: */
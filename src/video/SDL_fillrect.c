@@ -24,6 +24,10 @@
 #include "SDL_blit.h"
 
 
+/* Fills of at least this many bytes go around the cache with streaming
+   stores, smaller ones are likely to be read back soon */
+#define SDL_FILLRECT_STREAM_THRESHOLD   (4 * 1024 * 1024)
+
 #ifdef __SSE__
 /* *INDENT-OFF* */
 
@@ -45,21 +49,38 @@
     c128 = *(__m128 *)cccc;
 #endif
 
-#define SSE_WORK \
+#define SSE_STORE_WORK(store) \
     for (i = n / 64; i--;) { \
-        _mm_stream_ps((float *)(p+0), c128); \
-        _mm_stream_ps((float *)(p+16), c128); \
-        _mm_stream_ps((float *)(p+32), c128); \
-        _mm_stream_ps((float *)(p+48), c128); \
+        store((float *)(p+0), c128); \
+        store((float *)(p+16), c128); \
+        store((float *)(p+32), c128); \
+        store((float *)(p+48), c128); \
         p += 64; \
     }
 
-#define SSE_END
+/* Streaming stores are only fast when they write whole cache lines */
+#define SSE_WORK \
+    if (stream) { \
+        while (((uintptr_t)p & 63) && n >= 16) { \
+            _mm_store_ps((float *)p, c128); \
+            p += 16; \
+            n -= 16; \
+        } \
+        SSE_STORE_WORK(_mm_stream_ps); \
+    } else { \
+        SSE_STORE_WORK(_mm_store_ps); \
+    }
+
+#define SSE_END \
+    if (stream) { \
+        _mm_sfence(); \
+    }
 
 #define DEFINE_SSE_FILLRECT(bpp, type) \
 static void \
 SDL_FillRect##bpp##SSE(Uint8 *pixels, int pitch, Uint32 color, int w, int h) \
 { \
+    const SDL_bool stream = (w * bpp * h >= SDL_FILLRECT_STREAM_THRESHOLD); \
     int i, n; \
     Uint8 *p = NULL; \
  \
@@ -98,6 +119,7 @@ SDL_FillRect##bpp##SSE(Uint8 *pixels, int pitch, Uint32 color, int w, int h) \
 static void
 SDL_FillRect1SSE(Uint8 *pixels, int pitch, Uint32 color, int w, int h)
 {
+    const SDL_bool stream = (w * h >= SDL_FILLRECT_STREAM_THRESHOLD);
     int i, n;
     Uint8 *p = NULL;
     
@@ -129,9 +151,104 @@ SDL_FillRect1SSE(Uint8 *pixels, int pitch, Uint32 color, int w, int h)
 DEFINE_SSE_FILLRECT(2, Uint16)
 DEFINE_SSE_FILLRECT(4, Uint32)
 
+/* 16 pixels of 3 bytes are exactly three vectors, and stepping 3 bytes at
+   a time always reaches a 16 byte boundary within 16 pixels.  The 48 byte
+   stride doesn't line up with cache lines, so this doesn't stream. */
+static void
+SDL_FillRect3SSE(Uint8 *pixels, int pitch, const Uint8 *pattern, int w, int h)
+{
+    const __m128 c0 = _mm_loadu_ps((const float *)(pattern + 0));
+    const __m128 c1 = _mm_loadu_ps((const float *)(pattern + 16));
+    const __m128 c2 = _mm_loadu_ps((const float *)(pattern + 32));
+    int i, n;
+    Uint8 *p = NULL;
+
+    while (h--) {
+        n = w;
+        p = pixels;
+
+        if (n >= 32) {
+            while ((uintptr_t)p & 15) {
+                p[0] = pattern[0];
+                p[1] = pattern[1];
+                p[2] = pattern[2];
+                p += 3;
+                --n;
+            }
+            for (i = n / 16; i--;) {
+                _mm_store_ps((float *)(p+0), c0);
+                _mm_store_ps((float *)(p+16), c1);
+                _mm_store_ps((float *)(p+32), c2);
+                p += 48;
+            }
+            n &= 15;
+        }
+        for (; n >= 16; n -= 16) {
+            SDL_memcpy(p, pattern, 48);
+            p += 48;
+        }
+        SDL_memcpy(p, pattern, n * 3);
+        pixels += pitch;
+    }
+}
+
 /* *INDENT-ON* */
 #endif /* __SSE__ */
 
+#if SDL_NEON_BLITTERS
+/* 'color' is replicated to 32 bits, so 1, 2 and 4 byte pixels are all a
+   fill of 'n' bytes with the same 16 byte vector */
+static void
+SDL_FillRectNEON(Uint8 *pixels, int pitch, Uint32 color, int n, int h)
+{
+    const uint8x16_t c = vreinterpretq_u8_u32(vdupq_n_u32(color));
+    Uint8 tail[16];
+    int i;
+    Uint8 *p = NULL;
+
+    vst1q_u8(tail, c);
+    while (h--) {
+        p = pixels;
+
+        for (i = n; i >= 64; i -= 64) {
+            vst1q_u8(p+0, c);
+            vst1q_u8(p+16, c);
+            vst1q_u8(p+32, c);
+            vst1q_u8(p+48, c);
+            p += 64;
+        }
+        for (; i >= 16; i -= 16) {
+            vst1q_u8(p, c);
+            p += 16;
+        }
+        SDL_memcpy(p, tail, i);
+        pixels += pitch;
+    }
+}
+
+static void
+SDL_FillRect3NEON(Uint8 *pixels, int pitch, const Uint8 *pattern, int w, int h)
+{
+    uint8x16x3_t c;
+    int n;
+    Uint8 *p = NULL;
+
+    c.val[0] = vdupq_n_u8(pattern[0]);
+    c.val[1] = vdupq_n_u8(pattern[1]);
+    c.val[2] = vdupq_n_u8(pattern[2]);
+    while (h--) {
+        p = pixels;
+
+        for (n = w; n >= 16; n -= 16) {
+            vst3q_u8(p, c);
+            p += 48;
+        }
+        SDL_memcpy(p, pattern, n * 3);
+        pixels += pitch;
+    }
+}
+#endif /* SDL_NEON_BLITTERS */
+
 static void
 SDL_FillRect1(Uint8 * pixels, int pitch, Uint32 color, int w, int h)
 {
@@ -196,11 +313,8 @@ SDL_FillRect2(Uint8 * pixels, int pitch, Uint32 color, int w, int h)
 }
 
 static void
-SDL_FillRect3(Uint8 * pixels, int pitch, Uint32 color, int w, int h)
+SDL_FillRect3(Uint8 * pixels, int pitch, const Uint8 *pattern, int w, int h)
 {
-    Uint8 r = (Uint8) ((color >> 16) & 0xFF);
-    Uint8 g = (Uint8) ((color >> 8) & 0xFF);
-    Uint8 b = (Uint8) (color & 0xFF);
     int n;
     Uint8 *p = NULL;
 
@@ -208,11 +322,12 @@ SDL_FillRect3(Uint8 * pixels, int pitch, Uint32 color, int w, int h)
         n = w;
         p = pixels;
 
-        while (n--) {
-            *p++ = r;
-            *p++ = g;
-            *p++ = b;
+        /* Sixteen pixels at a time, straight from the pattern */
+        for (; n >= 16; n -= 16) {
+            SDL_memcpy(p, pattern, 48);
+            p += 48;
         }
+        SDL_memcpy(p, pattern, n * 3);
         pixels += pitch;
     }
 }
@@ -226,42 +341,27 @@ SDL_FillRect4(Uint8 * pixels, int pitch, Uint32 color, int w, int h)
     }
 }
 
-/* 
- * This function performs a fast fill of the given rectangle with 'color'
+/*
+ * Fill a rectangle that is already clipped to the surface
  */
-int
-SDL_FillRect(SDL_Surface * dst, const SDL_Rect * rect, Uint32 color)
+static void
+SDL_FillClippedRect(SDL_Surface * dst, const SDL_Rect * rect, Uint32 color)
 {
-    SDL_Rect clipped;
     Uint8 *pixels;
-
-    if (!dst) {
-        return SDL_SetError("Passed NULL destination surface");
-    }
-
-    /* This function doesn't work on surfaces < 8 bpp */
-    if (dst->format->BitsPerPixel < 8) {
-        return SDL_SetError("SDL_FillRect(): Unsupported surface format");
-    }
-
-    /* If 'rect' == NULL, then fill the whole surface */
-    if (rect) {
-        /* Perform clipping */
-        if (!SDL_IntersectRect(rect, &dst->clip_rect, &clipped)) {
-            return 0;
-        }
-        rect = &clipped;
-    } else {
-        rect = &dst->clip_rect;
-    }
-
-    /* Perform software fill */
-    if (!dst->pixels) {
-        return SDL_SetError("SDL_FillRect(): You must lock the surface");
-    }
+    int w, h;
 
     pixels = (Uint8 *) dst->pixels + rect->y * dst->pitch +
                                      rect->x * dst->format->BytesPerPixel;
+    w = rect->w;
+    h = rect->h;
+
+    /* Aligned surfaces own the padding at the end of their rows, so a fill
+       across the whole width is a single aligned span through the padding */
+    if ((dst->flags & SDL_SIMD_ALIGNED) && rect->x == 0 && w == dst->w &&
+        h > 1 && dst->format->BytesPerPixel != 3) {
+        w = (dst->pitch / dst->format->BytesPerPixel) * h;
+        h = 1;
+    }
 
     switch (dst->format->BytesPerPixel) {
     case 1:
@@ -270,11 +370,15 @@ SDL_FillRect(SDL_Surface * dst, const SDL_Rect * rect, Uint32 color)
             color |= (color << 16);
 #ifdef __SSE__
             if (SDL_HasSSE()) {
-                SDL_FillRect1SSE(pixels, dst->pitch, color, rect->w, rect->h);
+                SDL_FillRect1SSE(pixels, dst->pitch, color, w, h);
                 break;
             }
 #endif
-            SDL_FillRect1(pixels, dst->pitch, color, rect->w, rect->h);
+#if SDL_NEON_BLITTERS
+            SDL_FillRectNEON(pixels, dst->pitch, color, w, h);
+            break;
+#endif
+            SDL_FillRect1(pixels, dst->pitch, color, w, h);
             break;
         }
 
@@ -283,18 +387,46 @@ SDL_FillRect(SDL_Surface * dst, const SDL_Rect * rect, Uint32 color)
             color |= (color << 16);
 #ifdef __SSE__
             if (SDL_HasSSE()) {
-                SDL_FillRect2SSE(pixels, dst->pitch, color, rect->w, rect->h);
+                SDL_FillRect2SSE(pixels, dst->pitch, color, w, h);
                 break;
             }
 #endif
-            SDL_FillRect2(pixels, dst->pitch, color, rect->w, rect->h);
+#if SDL_NEON_BLITTERS
+            SDL_FillRectNEON(pixels, dst->pitch, color, w * 2, h);
+            break;
+#endif
+            SDL_FillRect2(pixels, dst->pitch, color, w, h);
             break;
         }
 
     case 3:
-        /* 24-bit RGB is a slow path, at least for now. */
         {
-            SDL_FillRect3(pixels, dst->pitch, color, rect->w, rect->h);
+            /* 16 pixels worth of the color in memory order */
+            Uint8 pattern[48];
+            int i;
+
+            for (i = 0; i < 48; i += 3) {
+#if SDL_BYTEORDER == SDL_LIL_ENDIAN
+                pattern[i + 0] = (Uint8) (color & 0xFF);
+                pattern[i + 1] = (Uint8) ((color >> 8) & 0xFF);
+                pattern[i + 2] = (Uint8) ((color >> 16) & 0xFF);
+#else
+                pattern[i + 0] = (Uint8) ((color >> 16) & 0xFF);
+                pattern[i + 1] = (Uint8) ((color >> 8) & 0xFF);
+                pattern[i + 2] = (Uint8) (color & 0xFF);
+#endif
+            }
+#ifdef __SSE__
+            if (SDL_HasSSE()) {
+                SDL_FillRect3SSE(pixels, dst->pitch, pattern, w, h);
+                break;
+            }
+#endif
+#if SDL_NEON_BLITTERS
+            SDL_FillRect3NEON(pixels, dst->pitch, pattern, w, h);
+            break;
+#endif
+            SDL_FillRect3(pixels, dst->pitch, pattern, w, h);
             break;
         }
 
@@ -302,34 +434,181 @@ SDL_FillRect(SDL_Surface * dst, const SDL_Rect * rect, Uint32 color)
         {
 #ifdef __SSE__
             if (SDL_HasSSE()) {
-                SDL_FillRect4SSE(pixels, dst->pitch, color, rect->w, rect->h);
+                SDL_FillRect4SSE(pixels, dst->pitch, color, w, h);
                 break;
             }
 #endif
-            SDL_FillRect4(pixels, dst->pitch, color, rect->w, rect->h);
+#if SDL_NEON_BLITTERS
+            SDL_FillRectNEON(pixels, dst->pitch, color, w * 4, h);
+            break;
+#endif
+            SDL_FillRect4(pixels, dst->pitch, color, w, h);
             break;
         }
     }
+}
+
+/* 
+ * This function performs a fast fill of the given rectangle with 'color'
+ */
+int
+SDL_FillRect(SDL_Surface * dst, const SDL_Rect * rect, Uint32 color)
+{
+    SDL_Rect clipped;
+
+    if (!dst) {
+        return SDL_SetError("Passed NULL destination surface");
+    }
+
+    /* This function doesn't work on surfaces < 8 bpp */
+    if (dst->format->BitsPerPixel < 8) {
+        return SDL_SetError("SDL_FillRect(): Unsupported surface format");
+    }
+
+    /* If 'rect' == NULL, then fill the whole surface */
+    if (rect) {
+        /* Perform clipping */
+        if (!SDL_IntersectRect(rect, &dst->clip_rect, &clipped)) {
+            return 0;
+        }
+        rect = &clipped;
+    } else {
+        rect = &dst->clip_rect;
+    }
+
+    /* Perform software fill */
+    if (!dst->pixels) {
+        return SDL_SetError("SDL_FillRect(): You must lock the surface");
+    }
+
+    SDL_DAMAGE_RECT(dst, rect);
+    SDL_FillClippedRect(dst, rect, color);
 
     /* We're done! */
     return 0;
 }
 
+/* Rects are merged in batches, which bounds the work spent merging */
+#define SDL_FILLRECTS_BATCH 64
+
+static int
+SDL_CompareFillEdges(const void *a, const void *b)
+{
+    return *(const int *)a - *(const int *)b;
+}
+
+static int
+SDL_CompareFillSpans(const void *a, const void *b)
+{
+    return ((const SDL_Rect *)a)->x - ((const SDL_Rect *)b)->x;
+}
+
+/*
+ * Fill a batch of clipped rects, merging overlapping and adjacent ones so
+ * every pixel is written once.  The rects are cut into horizontal bands
+ * at their top and bottom edges, and within a band the rects covering it
+ * are joined into spans.
+ */
+static void
+SDL_FillClippedRects(SDL_Surface * dst, const SDL_Rect * rects, int count,
+                     Uint32 color)
+{
+    int edges[SDL_FILLRECTS_BATCH * 2];
+    SDL_Rect spans[SDL_FILLRECTS_BATCH];
+    SDL_Rect *span;
+    int nspans;
+    int i, j, y0, y1;
+
+    if (count == 1) {
+        SDL_FillClippedRect(dst, &rects[0], color);
+        return;
+    }
+
+    for (i = 0; i < count; ++i) {
+        edges[i * 2 + 0] = rects[i].y;
+        edges[i * 2 + 1] = rects[i].y + rects[i].h;
+    }
+    SDL_qsort(edges, count * 2, sizeof(edges[0]), SDL_CompareFillEdges);
+
+    for (i = 0; i < count * 2 - 1; ++i) {
+        y0 = edges[i];
+        y1 = edges[i + 1];
+        if (y0 == y1) {
+            continue;
+        }
+
+        /* Collect the rects covering this band */
+        nspans = 0;
+        for (j = 0; j < count; ++j) {
+            if (rects[j].y <= y0 && rects[j].y + rects[j].h >= y1) {
+                spans[nspans].x = rects[j].x;
+                spans[nspans].w = rects[j].w;
+                ++nspans;
+            }
+        }
+        if (nspans > 1) {
+            SDL_qsort(spans, nspans, sizeof(spans[0]), SDL_CompareFillSpans);
+        }
+
+        /* Join the ones that touch and fill the result */
+        span = &spans[0];
+        span->y = y0;
+        span->h = y1 - y0;
+        for (j = 1; j <= nspans; ++j) {
+            if (j < nspans && spans[j].x <= span->x + span->w) {
+                span->w = SDL_max(span->w, spans[j].x + spans[j].w - span->x);
+                continue;
+            }
+            SDL_FillClippedRect(dst, span, color);
+            if (j < nspans) {
+                span = &spans[j];
+                span->y = y0;
+                span->h = y1 - y0;
+            }
+        }
+    }
+}
+
 int
 SDL_FillRects(SDL_Surface * dst, const SDL_Rect * rects, int count,
               Uint32 color)
 {
-    int i;
-    int status = 0;
+    SDL_Rect batch[SDL_FILLRECTS_BATCH];
+    int i, n;
+
+    if (!dst) {
+        return SDL_SetError("Passed NULL destination surface");
+    }
+
+    /* This function doesn't work on surfaces < 8 bpp */
+    if (dst->format->BitsPerPixel < 8) {
+        return SDL_SetError("SDL_FillRects(): Unsupported surface format");
+    }
 
     if (!rects) {
         return SDL_SetError("SDL_FillRects() passed NULL rects");
     }
 
+    /* Perform software fill */
+    if (!dst->pixels) {
+        return SDL_SetError("SDL_FillRects(): You must lock the surface");
+    }
+
+    n = 0;
     for (i = 0; i < count; ++i) {
-        status += SDL_FillRect(dst, &rects[i], color);
+        if (!SDL_IntersectRect(&rects[i], &dst->clip_rect, &batch[n])) {
+            continue;
+        }
+        SDL_DAMAGE_RECT(dst, &batch[n]);
+        if (++n == SDL_FILLRECTS_BATCH) {
+            SDL_FillClippedRects(dst, batch, n, color);
+            n = 0;
+        }
     }
-    return status;
+    if (n > 0) {
+        SDL_FillClippedRects(dst, batch, n, color);
+    }
+    return 0;
 }
 
 /* vi: set ts=4 sw=4 expandtab: */
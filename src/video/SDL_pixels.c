@@ -22,7 +22,9 @@
 
 /* General (mostly internal) pixel/color manipulation routines for SDL */
 
+#include "SDL_atomic.h"
 #include "SDL_endian.h"
+#include "SDL_hints.h"
 #include "SDL_video.h"
 #include "SDL_sysvideo.h"
 #include "SDL_blit.h"
@@ -122,6 +124,8 @@ SDL_GetPixelFormatName(Uint32 format)
     CASE(SDL_PIXELFORMAT_YUY2)
     CASE(SDL_PIXELFORMAT_UYVY)
     CASE(SDL_PIXELFORMAT_YVYU)
+    CASE(SDL_PIXELFORMAT_NV12)
+    CASE(SDL_PIXELFORMAT_NV21)
 #undef CASE
     default:
         return "SDL_PIXELFORMAT_UNKNOWN";
@@ -611,9 +615,44 @@ SDL_FreeFormat(SDL_PixelFormat *format)
     SDL_free(format);
 }
 
+/*
+ * Inverse colormap used by SDL_FindColor() to narrow the nearest color search.
+ * The RGB cube is split into cells, and each cell lazily records the palette
+ * entries that can be nearest to some color inside it, in index order.
+ */
+#define INVMAP_BITS         4
+#define INVMAP_SHIFT        (8 - INVMAP_BITS)
+#define INVMAP_MASK         ((1 << INVMAP_BITS) - 1)
+#define INVMAP_CELLS        (1 << (3 * INVMAP_BITS))
+#define INVMAP_MIN_COLORS   16  /* smaller palettes are searched directly */
+
+typedef struct SDL_InverseColormap
+{
+    SDL_SpinLock lock;
+    Uint32 version;             /* palette version the cells were built for */
+    int ncolors;
+    SDL_bool usable;            /* all entries share one alpha value */
+    Uint16 count[INVMAP_CELLS]; /* candidates in each cell, 0 if not built */
+    Uint32 offset[INVMAP_CELLS];
+    Uint8 *candidates;
+    int ncandidates;
+    int maxcandidates;
+} SDL_InverseColormap;
+
+/* Palettes from SDL_AllocPalette() keep their colors and inverse colormap
+   in the same allocation, right after the public structure. */
+typedef struct SDL_PaletteData
+{
+    SDL_Palette palette;
+    SDL_InverseColormap *invmap;
+} SDL_PaletteData;
+
+#define PALETTE_COLORS(data)    ((SDL_Color *) ((data) + 1))
+
 SDL_Palette *
 SDL_AllocPalette(int ncolors)
 {
+    SDL_PaletteData *data;
     SDL_Palette *palette;
 
     /* Input validation */
@@ -622,17 +661,15 @@ SDL_AllocPalette(int ncolors)
       return NULL;
     }
 
-    palette = (SDL_Palette *) SDL_malloc(sizeof(*palette));
-    if (!palette) {
+    data = (SDL_PaletteData *)
+        SDL_malloc(sizeof(*data) + ncolors * sizeof(SDL_Color));
+    if (!data) {
         SDL_OutOfMemory();
         return NULL;
     }
-    palette->colors =
-        (SDL_Color *) SDL_malloc(ncolors * sizeof(*palette->colors));
-    if (!palette->colors) {
-        SDL_free(palette);
-        return NULL;
-    }
+    data->invmap = NULL;
+    palette = &data->palette;
+    palette->colors = PALETTE_COLORS(data);
     palette->ncolors = ncolors;
     palette->version = 1;
     palette->refcount = 1;
@@ -700,6 +737,8 @@ SDL_SetPaletteColors(SDL_Palette * palette, const SDL_Color * colors,
 void
 SDL_FreePalette(SDL_Palette * palette)
 {
+    SDL_PaletteData *data = (SDL_PaletteData *) palette;
+
     if (!palette) {
         SDL_InvalidParamError("palette");
         return;
@@ -707,7 +746,15 @@ SDL_FreePalette(SDL_Palette * palette)
     if (--palette->refcount > 0) {
         return;
     }
-    SDL_free(palette->colors);
+    /* The application may have replaced the colors.  As in
+       GetInverseColormap(), only palettes still using their own colors can
+       have an inverse colormap */
+    if (palette->colors != PALETTE_COLORS(data)) {
+        SDL_free(palette->colors);
+    } else if (data->invmap) {
+        SDL_free(data->invmap->candidates);
+        SDL_free(data->invmap);
+    }
     SDL_free(palette);
 }
 
@@ -763,19 +810,230 @@ SDL_CalculatePitch(SDL_Surface * surface)
     return (pitch);
 }
 
+/* Aligned pixels start on a cache line, the pitch alignment may be smaller */
+#define SDL_SURFACE_BASE_ALIGNMENT  64
+
+/*
+ * Get the pitch alignment for a new surface, or 0 if it isn't aligned
+ */
+int
+SDL_GetSurfaceAlignment(Uint32 flags)
+{
+    const char *hint = SDL_GetHint(SDL_HINT_SURFACE_ALIGNMENT);
+    int align = hint ? SDL_atoi(hint) : 0;
+
+    if (align == 16 || align == 32 || align == 64) {
+        return align;
+    }
+    if (!(flags & SDL_SIMD_ALIGNED)) {
+        return 0;
+    }
+    return SDL_HasAVX() ? 32 : 16;
+}
+
+/*
+ * Allocate the pixels of a surface, honoring SDL_SIMD_ALIGNED
+ */
+void *
+SDL_AllocSurfacePixels(SDL_Surface * surface)
+{
+    const size_t size = (size_t) surface->h * surface->pitch;
+    Uint8 *block, *pixels;
+
+    if (!(surface->flags & SDL_SIMD_ALIGNED)) {
+        return SDL_malloc(size);
+    }
+
+    /* Keep the real allocation just in front of the aligned pixels */
+    block = (Uint8 *) SDL_malloc(size + sizeof(void *) + SDL_SURFACE_BASE_ALIGNMENT - 1);
+    if (!block) {
+        return NULL;
+    }
+    pixels = block + sizeof(void *);
+    pixels += (SDL_SURFACE_BASE_ALIGNMENT - ((uintptr_t) pixels & (SDL_SURFACE_BASE_ALIGNMENT - 1))) & (SDL_SURFACE_BASE_ALIGNMENT - 1);
+    ((void **) pixels)[-1] = block;
+    return pixels;
+}
+
+/*
+ * Free pixels allocated with SDL_AllocSurfacePixels()
+ */
+void
+SDL_FreeSurfacePixels(SDL_Surface * surface)
+{
+    if (!surface->pixels) {
+        return;
+    }
+    if (surface->flags & SDL_SIMD_ALIGNED) {
+        SDL_free(((void **) surface->pixels)[-1]);
+    } else {
+        SDL_free(surface->pixels);
+    }
+}
+
 /*
  * Match an RGB value to a particular palette index
  */
+static SDL_InverseColormap *
+GetInverseColormap(SDL_Palette * pal)
+{
+    SDL_PaletteData *data = (SDL_PaletteData *) pal;
+    SDL_InverseColormap *invmap;
+
+    /* Palettes built by the application have nowhere to keep one */
+    if (pal->colors != PALETTE_COLORS(data) ||
+        pal->ncolors <= INVMAP_MIN_COLORS || pal->ncolors > 256) {
+        return NULL;
+    }
+
+    invmap = (SDL_InverseColormap *) SDL_AtomicGetPtr((void **) &data->invmap);
+    if (!invmap) {
+        invmap = (SDL_InverseColormap *) SDL_calloc(1, sizeof(*invmap));
+        if (!invmap) {
+            return NULL;
+        }
+        if (!SDL_AtomicCASPtr((void **) &data->invmap, NULL, invmap)) {
+            /* Another thread got there first */
+            SDL_free(invmap);
+            invmap = (SDL_InverseColormap *) SDL_AtomicGetPtr((void **) &data->invmap);
+        }
+    }
+    return invmap;
+}
+
+static void
+ResetInverseColormap(const SDL_Palette * pal, SDL_InverseColormap * invmap)
+{
+    int i;
+
+    invmap->version = pal->version;
+    invmap->ncolors = pal->ncolors;
+    invmap->usable = SDL_TRUE;
+    for (i = 1; i < pal->ncolors; ++i) {
+        if (pal->colors[i].a != pal->colors[0].a) {
+            /* The alpha distance would reorder the RGB neighbours */
+            invmap->usable = SDL_FALSE;
+            break;
+        }
+    }
+    SDL_memset(invmap->count, 0, sizeof(invmap->count));
+    invmap->ncandidates = 0;
+}
+
+/* Squared distance from v to the nearest and farthest point of [lo, hi] */
+#define AXIS_MIN(v, lo, hi) \
+    ((v) < (lo) ? ((lo) - (v)) * ((lo) - (v)) : \
+     (v) > (hi) ? ((v) - (hi)) * ((v) - (hi)) : 0)
+#define AXIS_MAX(v, lo, hi) \
+    ((v) - (lo) > (hi) - (v) ? ((v) - (lo)) * ((v) - (lo)) : \
+                               ((hi) - (v)) * ((hi) - (v)))
+
+static int
+BuildInverseColormapCell(const SDL_Palette * pal,
+                         SDL_InverseColormap * invmap, int cell)
+{
+    int rlo = ((cell >> (2 * INVMAP_BITS)) & INVMAP_MASK) << INVMAP_SHIFT;
+    int glo = ((cell >> INVMAP_BITS) & INVMAP_MASK) << INVMAP_SHIFT;
+    int blo = (cell & INVMAP_MASK) << INVMAP_SHIFT;
+    int rhi = rlo + (1 << INVMAP_SHIFT) - 1;
+    int ghi = glo + (1 << INVMAP_SHIFT) - 1;
+    int bhi = blo + (1 << INVMAP_SHIFT) - 1;
+    int mindist[256];
+    int limit = 3 * 256 * 256;  /* beyond any distance in the cube */
+    int count = 0;
+    int i;
+    Uint8 *list;
+
+    /* An entry can only be nearest somewhere in the cell if its closest
+       point is no farther than the farthest point of every other entry. */
+    for (i = 0; i < pal->ncolors; ++i) {
+        const SDL_Color *c = &pal->colors[i];
+        int maxdist = AXIS_MAX(c->r, rlo, rhi) + AXIS_MAX(c->g, glo, ghi) +
+                      AXIS_MAX(c->b, blo, bhi);
+        mindist[i] = AXIS_MIN(c->r, rlo, rhi) + AXIS_MIN(c->g, glo, ghi) +
+                     AXIS_MIN(c->b, blo, bhi);
+        if (maxdist < limit) {
+            limit = maxdist;
+        }
+    }
+    for (i = 0; i < pal->ncolors; ++i) {
+        if (mindist[i] <= limit) {
+            ++count;
+        }
+    }
+
+    if (invmap->ncandidates + count > invmap->maxcandidates) {
+        int size = SDL_max(invmap->maxcandidates * 2, invmap->ncandidates + count);
+        list = (Uint8 *) SDL_realloc(invmap->candidates, size);
+        if (!list) {
+            return -1;
+        }
+        invmap->candidates = list;
+        invmap->maxcandidates = size;
+    }
+
+    list = invmap->candidates + invmap->ncandidates;
+    for (i = 0; i < pal->ncolors; ++i) {
+        if (mindist[i] <= limit) {
+            *list++ = (Uint8) i;
+        }
+    }
+    invmap->offset[cell] = invmap->ncandidates;
+    invmap->count[cell] = (Uint16) count;
+    invmap->ncandidates += count;
+    return 0;
+}
+
 Uint8
 SDL_FindColor(SDL_Palette * pal, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
 {
     /* Do colorspace distance matching */
+    SDL_InverseColormap *invmap;
     unsigned int smallest;
     unsigned int distance;
     int rd, gd, bd, ad;
     int i;
     Uint8 pixel = 0;
 
+    invmap = GetInverseColormap(pal);
+    if (invmap) {
+        int cell = ((r >> INVMAP_SHIFT) << (2 * INVMAP_BITS)) |
+                   ((g >> INVMAP_SHIFT) << INVMAP_BITS) | (b >> INVMAP_SHIFT);
+
+        SDL_AtomicLock(&invmap->lock);
+        if (invmap->version != pal->version ||
+            invmap->ncolors != pal->ncolors) {
+            ResetInverseColormap(pal, invmap);
+        }
+        if (invmap->usable && (invmap->count[cell] ||
+            BuildInverseColormapCell(pal, invmap, cell) == 0)) {
+            const Uint8 *list = invmap->candidates + invmap->offset[cell];
+            int count = invmap->count[cell];
+
+            /* Every entry shares the same alpha, so it can't change which
+               one is nearest; the candidates are in index order, so ties
+               resolve the same way as the full search below. */
+            smallest = ~0;
+            for (i = 0; i < count; ++i) {
+                const SDL_Color *c = &pal->colors[list[i]];
+                rd = c->r - r;
+                gd = c->g - g;
+                bd = c->b - b;
+                distance = (rd * rd) + (gd * gd) + (bd * bd);
+                if (distance < smallest) {
+                    pixel = list[i];
+                    if (distance == 0) {
+                        break;
+                    }
+                    smallest = distance;
+                }
+            }
+            SDL_AtomicUnlock(&invmap->lock);
+            return (pixel);
+        }
+        SDL_AtomicUnlock(&invmap->lock);
+    }
+
     smallest = ~0;
     for (i = 0; i < pal->ncolors; ++i) {
         rd = pal->colors[i].r - r;
@@ -1078,6 +1336,7 @@ SDL_FreeBlitMap(SDL_BlitMap * map)
 {
     if (map) {
         SDL_InvalidateMap(map);
+        SDL_FreeStretchCache(map->stretch);
         SDL_free(map);
     }
 }
@@ -35,6 +35,9 @@ extern void SDL_FreeBlitMap(SDL_BlitMap * map);
 
 /* Miscellaneous functions */
 extern int SDL_CalculatePitch(SDL_Surface * surface);
+extern int SDL_GetSurfaceAlignment(Uint32 flags);
+extern void *SDL_AllocSurfacePixels(SDL_Surface * surface);
+extern void SDL_FreeSurfacePixels(SDL_Surface * surface);
 extern void SDL_DitherColors(SDL_Color * colors, int bpp);
 extern Uint8 SDL_FindColor(SDL_Palette * pal, Uint8 r, Uint8 g, Uint8 b, Uint8 a);
 
@@ -522,4 +522,60 @@ SDL_GetSpanEnclosingRect(int width, int height,
     return SDL_FALSE;
 }
 
+/* Presenting a rectangle costs about as much as this many pixels on top of
+   its area, so rectangles are merged when that wastes fewer pixels */
+#define DAMAGE_RECT_COST    4096
+
+void
+SDL_AddDamageRect(SDL_DamageRegion * region, const SDL_Rect * rect)
+{
+    SDL_Rect bounds, r, u;
+    int i, best, cost, bestcost;
+
+    bounds.x = 0;
+    bounds.y = 0;
+    bounds.w = region->w;
+    bounds.h = region->h;
+    if (!SDL_IntersectRect(rect, &bounds, &r)) {
+        return;
+    }
+
+    /* Merge with the rectangle that wastes the fewest pixels, and keep
+       going with the result, until that's worse than one more rectangle */
+    for (;;) {
+        best = -1;
+        bestcost = 0;
+        for (i = 0; i < region->numrects; ++i) {
+            const SDL_Rect *d = &region->rects[i];
+
+            SDL_UnionRect(d, &r, &u);
+            cost = u.w * u.h - d->w * d->h - r.w * r.h;
+            if (best < 0 || cost < bestcost) {
+                best = i;
+                bestcost = cost;
+            }
+        }
+        if (best < 0 ||
+            (bestcost > DAMAGE_RECT_COST && region->numrects < SDL_MAX_DAMAGE_RECTS)) {
+            break;
+        }
+        SDL_UnionRect(&region->rects[best], &r, &r);
+        region->rects[best] = region->rects[--region->numrects];
+    }
+    region->rects[region->numrects++] = r;
+}
+
+void
+SDL_AddDamagePoints(SDL_DamageRegion * region, const SDL_Point * points,
+                    int count, const SDL_Rect * clip)
+{
+    SDL_Rect rect;
+
+    /* Lines may cross the clip rectangle with both ends outside of it */
+    if (SDL_EnclosePoints(points, count, NULL, &rect) &&
+        SDL_IntersectRect(&rect, clip, &rect)) {
+        SDL_AddDamageRect(region, &rect);
+    }
+}
+
 /* vi: set ts=4 sw=4 expandtab: */
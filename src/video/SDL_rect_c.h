@@ -20,6 +20,26 @@
 */
 #include "../SDL_internal.h"
 
+#ifndef _SDL_rect_c_h
+#define _SDL_rect_c_h
+
 extern SDL_bool SDL_GetSpanEnclosingRect(int width, int height, int numrects, const SDL_Rect * rects, SDL_Rect *span);
 
+/* The areas written to a surface since it was last presented, kept as a few
+   rectangles that are merged whenever that's cheaper than pushing them
+   separately.  See SDL_HINT_WINDOW_SURFACE_DAMAGE. */
+#define SDL_MAX_DAMAGE_RECTS    16
+
+typedef struct SDL_DamageRegion
+{
+    int w, h;
+    int numrects;
+    SDL_Rect rects[SDL_MAX_DAMAGE_RECTS];
+} SDL_DamageRegion;
+
+extern void SDL_AddDamageRect(SDL_DamageRegion * region, const SDL_Rect * rect);
+extern void SDL_AddDamagePoints(SDL_DamageRegion * region, const SDL_Point * points, int count, const SDL_Rect * clip);
+
+#endif /* _SDL_rect_c_h */
+
 /* vi: set ts=4 sw=4 expandtab: */
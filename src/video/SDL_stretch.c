@@ -196,80 +196,94 @@ copy_row3(Uint8 * src, int src_w, Uint8 * dst, int dst_w)
     }
 }
 
-/* Perform a stretch blit between two surfaces of the same format.
-   NOTE:  This function is not safe to call from multiple threads!
-*/
-int
-SDL_SoftStretch(SDL_Surface * src, const SDL_Rect * srcrect,
-                SDL_Surface * dst, const SDL_Rect * dstrect)
+/* Check the formats and rectangles of a stretch blit and lock the surfaces,
+   NULL rectangles are replaced with the full surface */
+static int
+SetupStretch(SDL_Surface * src, const SDL_Rect ** srcrect, SDL_Rect * full_src,
+             SDL_Surface * dst, const SDL_Rect ** dstrect, SDL_Rect * full_dst,
+             int *src_locked, int *dst_locked)
 {
-    int src_locked;
-    int dst_locked;
-    int pos, inc;
-    int dst_maxrow;
-    int src_row, dst_row;
-    Uint8 *srcp = NULL;
-    Uint8 *dstp;
-    SDL_Rect full_src;
-    SDL_Rect full_dst;
-#ifdef USE_ASM_STRETCH
-    SDL_bool use_asm = SDL_TRUE;
-#ifdef __GNUC__
-    int u1, u2;
-#endif
-#endif /* USE_ASM_STRETCH */
-    const int bpp = dst->format->BytesPerPixel;
-
     if (src->format->format != dst->format->format) {
         return SDL_SetError("Only works with same format surfaces");
     }
 
     /* Verify the blit rectangles */
-    if (srcrect) {
-        if ((srcrect->x < 0) || (srcrect->y < 0) ||
-            ((srcrect->x + srcrect->w) > src->w) ||
-            ((srcrect->y + srcrect->h) > src->h)) {
+    if (*srcrect) {
+        if (((*srcrect)->x < 0) || ((*srcrect)->y < 0) ||
+            (((*srcrect)->x + (*srcrect)->w) > src->w) ||
+            (((*srcrect)->y + (*srcrect)->h) > src->h)) {
             return SDL_SetError("Invalid source blit rectangle");
         }
     } else {
-        full_src.x = 0;
-        full_src.y = 0;
-        full_src.w = src->w;
-        full_src.h = src->h;
-        srcrect = &full_src;
-    }
-    if (dstrect) {
-        if ((dstrect->x < 0) || (dstrect->y < 0) ||
-            ((dstrect->x + dstrect->w) > dst->w) ||
-            ((dstrect->y + dstrect->h) > dst->h)) {
+        full_src->x = 0;
+        full_src->y = 0;
+        full_src->w = src->w;
+        full_src->h = src->h;
+        *srcrect = full_src;
+    }
+    if (*dstrect) {
+        if (((*dstrect)->x < 0) || ((*dstrect)->y < 0) ||
+            (((*dstrect)->x + (*dstrect)->w) > dst->w) ||
+            (((*dstrect)->y + (*dstrect)->h) > dst->h)) {
             return SDL_SetError("Invalid destination blit rectangle");
         }
     } else {
-        full_dst.x = 0;
-        full_dst.y = 0;
-        full_dst.w = dst->w;
-        full_dst.h = dst->h;
-        dstrect = &full_dst;
+        full_dst->x = 0;
+        full_dst->y = 0;
+        full_dst->w = dst->w;
+        full_dst->h = dst->h;
+        *dstrect = full_dst;
     }
 
     /* Lock the destination if it's in hardware */
-    dst_locked = 0;
+    *dst_locked = 0;
     if (SDL_MUSTLOCK(dst)) {
         if (SDL_LockSurface(dst) < 0) {
             return SDL_SetError("Unable to lock destination surface");
         }
-        dst_locked = 1;
+        *dst_locked = 1;
     }
     /* Lock the source if it's in hardware */
-    src_locked = 0;
+    *src_locked = 0;
     if (SDL_MUSTLOCK(src)) {
         if (SDL_LockSurface(src) < 0) {
-            if (dst_locked) {
+            if (*dst_locked) {
                 SDL_UnlockSurface(dst);
             }
             return SDL_SetError("Unable to lock source surface");
         }
-        src_locked = 1;
+        *src_locked = 1;
+    }
+    return 0;
+}
+
+/* Perform a stretch blit between two surfaces of the same format.
+   NOTE:  This function is not safe to call from multiple threads!
+*/
+int
+SDL_SoftStretch(SDL_Surface * src, const SDL_Rect * srcrect,
+                SDL_Surface * dst, const SDL_Rect * dstrect)
+{
+    int src_locked;
+    int dst_locked;
+    int pos, inc;
+    int dst_maxrow;
+    int src_row, dst_row;
+    Uint8 *srcp = NULL;
+    Uint8 *dstp;
+    SDL_Rect full_src;
+    SDL_Rect full_dst;
+#ifdef USE_ASM_STRETCH
+    SDL_bool use_asm = SDL_TRUE;
+#ifdef __GNUC__
+    int u1, u2;
+#endif
+#endif /* USE_ASM_STRETCH */
+    const int bpp = dst->format->BytesPerPixel;
+
+    if (SetupStretch(src, &srcrect, &full_src, dst, &dstrect, &full_dst,
+                     &src_locked, &dst_locked) < 0) {
+        return -1;
     }
 
     /* Set up the data... */
@@ -350,4 +364,460 @@ SDL_SoftStretch(SDL_Surface * src, const SDL_Rect * srcrect,
     return (0);
 }
 
+/* Bilinear stretching works on one 16-bit lane per channel: the horizontal
+   pass weights the two neighbouring source pixels, leaving the channel
+   value multiplied by LINEAR_ONE, and the vertical pass blends two of those
+   rows and rounds back to the channel range.
+ */
+#define LINEAR_BITS     7
+#define LINEAR_ONE      (1 << LINEAR_BITS)
+#define LINEAR_ROUND    (1 << (2 * LINEAR_BITS - 1))
+
+typedef struct
+{
+    int p0, p1;     /* left/top and right/bottom sample */
+    int frac;       /* weight of p1, 0 .. LINEAR_ONE-1 */
+} LinearSample;
+
+/* Map destination pixel centers onto the source, clamping at the edges */
+static void
+ComputeLinearSamples(int src_len, int dst_len, LinearSample * samples)
+{
+    const int inc = (src_len << 16) / dst_len;
+    int pos = (inc >> 1) - 0x8000;
+    int i;
+
+    for (i = 0; i < dst_len; ++i, pos += inc) {
+        LinearSample *sample = &samples[i];
+        if (pos <= 0) {
+            sample->p0 = sample->p1 = 0;
+            sample->frac = 0;
+        } else if ((pos >> 16) >= src_len - 1) {
+            sample->p0 = sample->p1 = src_len - 1;
+            sample->frac = 0;
+        } else {
+            sample->p0 = pos >> 16;
+            sample->p1 = sample->p0 + 1;
+            sample->frac = (pos >> (16 - LINEAR_BITS)) & (LINEAR_ONE - 1);
+        }
+    }
+}
+
+/* Horizontal pass for 32-bit pixels, any channel order */
+static void
+LinearRow4(const Uint8 * src, const LinearSample * samples, int dst_w,
+           Uint16 * row)
+{
+    int i = 0;
+
+#ifdef __SSE2__
+    if (SDL_HasSSE2()) {
+        const Uint32 *src32 = (const Uint32 *) src;
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i one = _mm_set1_epi16(LINEAR_ONE);
+        for (; i + 2 <= dst_w; i += 2) {
+            const LinearSample *s = &samples[i];
+            __m128i p0 = _mm_unpacklo_epi8(
+                _mm_unpacklo_epi32(_mm_cvtsi32_si128(src32[s[0].p0]),
+                                   _mm_cvtsi32_si128(src32[s[1].p0])), zero);
+            __m128i p1 = _mm_unpacklo_epi8(
+                _mm_unpacklo_epi32(_mm_cvtsi32_si128(src32[s[0].p1]),
+                                   _mm_cvtsi32_si128(src32[s[1].p1])), zero);
+            __m128i w = _mm_set_epi16(s[1].frac, s[1].frac, s[1].frac, s[1].frac,
+                                      s[0].frac, s[0].frac, s[0].frac, s[0].frac);
+            __m128i h = _mm_add_epi16(_mm_mullo_epi16(p0, _mm_sub_epi16(one, w)),
+                                      _mm_mullo_epi16(p1, w));
+            _mm_storeu_si128((__m128i *) (row + i * 4), h);
+        }
+    }
+#endif
+    for (; i < dst_w; ++i) {
+        const Uint8 *p0 = src + samples[i].p0 * 4;
+        const Uint8 *p1 = src + samples[i].p1 * 4;
+        const int w = samples[i].frac;
+        Uint16 *h = row + i * 4;
+        h[0] = (Uint16) (p0[0] * (LINEAR_ONE - w) + p1[0] * w);
+        h[1] = (Uint16) (p0[1] * (LINEAR_ONE - w) + p1[1] * w);
+        h[2] = (Uint16) (p0[2] * (LINEAR_ONE - w) + p1[2] * w);
+        h[3] = (Uint16) (p0[3] * (LINEAR_ONE - w) + p1[3] * w);
+    }
+}
+
+/* Horizontal pass for 16-bit pixels, channels are unpacked with the masks */
+static void
+LinearRow2(const Uint16 * src, const LinearSample * samples, int dst_w,
+           const SDL_PixelFormat * fmt, Uint16 * row)
+{
+    const Uint32 Rmask = fmt->Rmask, Gmask = fmt->Gmask;
+    const Uint32 Bmask = fmt->Bmask, Amask = fmt->Amask;
+    const int Rshift = fmt->Rshift, Gshift = fmt->Gshift;
+    const int Bshift = fmt->Bshift, Ashift = fmt->Ashift;
+    int i;
+
+    for (i = 0; i < dst_w; ++i) {
+        const Uint32 p0 = src[samples[i].p0];
+        const Uint32 p1 = src[samples[i].p1];
+        const int w = samples[i].frac;
+        Uint16 *h = row + i * 4;
+        h[0] = (Uint16) (((p0 & Rmask) >> Rshift) * (LINEAR_ONE - w) +
+                         ((p1 & Rmask) >> Rshift) * w);
+        h[1] = (Uint16) (((p0 & Gmask) >> Gshift) * (LINEAR_ONE - w) +
+                         ((p1 & Gmask) >> Gshift) * w);
+        h[2] = (Uint16) (((p0 & Bmask) >> Bshift) * (LINEAR_ONE - w) +
+                         ((p1 & Bmask) >> Bshift) * w);
+        h[3] = (Uint16) (((p0 & Amask) >> Ashift) * (LINEAR_ONE - w) +
+                         ((p1 & Amask) >> Ashift) * w);
+    }
+}
+
+/* Vertical pass, blends 'n' lanes of two horizontally filtered rows into
+   either 16-bit lanes or, for 32-bit pixels, straight into the bytes */
+static void
+LinearBlendRows(const Uint16 * row0, const Uint16 * row1, int frac,
+                Uint16 * out, Uint8 * out8, int n)
+{
+    int i = 0;
+
+#ifdef __SSE2__
+    if (SDL_HasSSE2()) {
+        const __m128i w = _mm_set1_epi32((frac << 16) | (LINEAR_ONE - frac));
+        const __m128i round = _mm_set1_epi32(LINEAR_ROUND);
+        for (; i + 8 <= n; i += 8) {
+            __m128i a = _mm_loadu_si128((const __m128i *) (row0 + i));
+            __m128i b = _mm_loadu_si128((const __m128i *) (row1 + i));
+            __m128i lo = _mm_madd_epi16(_mm_unpacklo_epi16(a, b), w);
+            __m128i hi = _mm_madd_epi16(_mm_unpackhi_epi16(a, b), w);
+            lo = _mm_srli_epi32(_mm_add_epi32(lo, round), 2 * LINEAR_BITS);
+            hi = _mm_srli_epi32(_mm_add_epi32(hi, round), 2 * LINEAR_BITS);
+            lo = _mm_packs_epi32(lo, hi);
+            if (out8) {
+                _mm_storel_epi64((__m128i *) (out8 + i),
+                                 _mm_packus_epi16(lo, lo));
+            } else {
+                _mm_storeu_si128((__m128i *) (out + i), lo);
+            }
+        }
+    }
+#elif SDL_NEON_BLITTERS
+    {
+        const uint16x4_t w0 = vdup_n_u16(LINEAR_ONE - frac);
+        const uint16x4_t w1 = vdup_n_u16(frac);
+        for (; i + 8 <= n; i += 8) {
+            uint16x8_t a = vld1q_u16(row0 + i);
+            uint16x8_t b = vld1q_u16(row1 + i);
+            uint32x4_t lo = vmlal_u16(vmull_u16(vget_low_u16(a), w0),
+                                      vget_low_u16(b), w1);
+            uint32x4_t hi = vmlal_u16(vmull_u16(vget_high_u16(a), w0),
+                                      vget_high_u16(b), w1);
+            uint16x8_t res = vcombine_u16(vrshrn_n_u32(lo, 2 * LINEAR_BITS),
+                                          vrshrn_n_u32(hi, 2 * LINEAR_BITS));
+            if (out8) {
+                vst1_u8(out8 + i, vmovn_u16(res));
+            } else {
+                vst1q_u16(out + i, res);
+            }
+        }
+    }
+#endif
+    for (; i < n; ++i) {
+        const int v = (row0[i] * (LINEAR_ONE - frac) + row1[i] * frac +
+                       LINEAR_ROUND) >> (2 * LINEAR_BITS);
+        if (out8) {
+            out8[i] = (Uint8) v;
+        } else {
+            out[i] = (Uint16) v;
+        }
+    }
+}
+
+/* LinearRow4 filters the four bytes of a pixel on their own, so 32-bit
+   formats need every channel to be a whole byte.  LinearRow2 unpacks the
+   channels, which have to fit the 16-bit lanes.
+*/
+static SDL_bool
+LinearChannelSupported(Uint32 mask, Uint8 shift, int bpp)
+{
+    if (!mask) {
+        return SDL_TRUE;
+    }
+    if (bpp == 4) {
+        return ((shift % 8) == 0 && (mask >> shift) == 0xFF);
+    }
+    return ((mask >> shift) <= 0xFF);
+}
+
+SDL_bool
+SDL_SoftStretchLinearSupported(const SDL_PixelFormat * fmt)
+{
+    const int bpp = fmt->BytesPerPixel;
+
+    if ((bpp != 2 && bpp != 4) || SDL_ISPIXELFORMAT_INDEXED(fmt->format) ||
+        SDL_ISPIXELFORMAT_FOURCC(fmt->format)) {
+        return SDL_FALSE;
+    }
+    return (LinearChannelSupported(fmt->Rmask, fmt->Rshift, bpp) &&
+            LinearChannelSupported(fmt->Gmask, fmt->Gshift, bpp) &&
+            LinearChannelSupported(fmt->Bmask, fmt->Bshift, bpp) &&
+            LinearChannelSupported(fmt->Amask, fmt->Ashift, bpp));
+}
+
+/* Scratch space for linear stretches, kept on the source's blit map so
+   repeated blits don't allocate.  The buffer only grows.
+*/
+struct SDL_StretchCache
+{
+    void *buffer;
+    size_t size;
+    int src_w, src_h;           /* the sample tables are for these sizes */
+    int dst_w, dst_h;
+    LinearSample *xsamples, *ysamples;
+    Uint16 *rows[2], *out;
+    SDL_Surface *row;           /* one filtered line in the source format */
+};
+
+void
+SDL_FreeStretchCache(SDL_StretchCache * cache)
+{
+    if (cache) {
+        SDL_FreeSurface(cache->row);
+        SDL_free(cache->buffer);
+        SDL_free(cache);
+    }
+}
+
+/* Make room for the sample tables, the filtered rows and, when 'need_row'
+   is set, a one line surface in the source format to blit from */
+static SDL_StretchCache *
+GetStretchCache(SDL_Surface * src, const SDL_Rect * srcrect,
+                const SDL_Rect * dstrect, SDL_bool need_row)
+{
+    SDL_StretchCache *cache = src->map->stretch;
+    const int w = dstrect->w;
+    const int h = dstrect->h;
+    const size_t size = (w + h) * sizeof(LinearSample) +
+        3 * w * 4 * sizeof(Uint16);
+
+    if (!cache) {
+        cache = (SDL_StretchCache *) SDL_calloc(1, sizeof(*cache));
+        if (!cache) {
+            SDL_OutOfMemory();
+            return NULL;
+        }
+        src->map->stretch = cache;
+    }
+    if (size > cache->size) {
+        void *buffer = SDL_malloc(size);
+        if (!buffer) {
+            SDL_OutOfMemory();
+            return NULL;
+        }
+        SDL_free(cache->buffer);
+        cache->buffer = buffer;
+        cache->size = size;
+        cache->dst_w = cache->dst_h = 0;
+    }
+    if (cache->src_w != srcrect->w || cache->src_h != srcrect->h ||
+        cache->dst_w != w || cache->dst_h != h) {
+        cache->rows[0] = (Uint16 *) cache->buffer;
+        cache->rows[1] = cache->rows[0] + w * 4;
+        cache->out = cache->rows[1] + w * 4;
+        cache->xsamples = (LinearSample *) (cache->out + w * 4);
+        cache->ysamples = cache->xsamples + w;
+        ComputeLinearSamples(srcrect->w, w, cache->xsamples);
+        ComputeLinearSamples(srcrect->h, h, cache->ysamples);
+        cache->src_w = srcrect->w;
+        cache->src_h = srcrect->h;
+        cache->dst_w = w;
+        cache->dst_h = h;
+    }
+    if (need_row && (!cache->row || cache->row->w < w)) {
+        const SDL_PixelFormat *fmt = src->format;
+        SDL_FreeSurface(cache->row);
+        cache->row = SDL_CreateRGBSurface(0, w, 1, fmt->BitsPerPixel,
+                                          fmt->Rmask, fmt->Gmask,
+                                          fmt->Bmask, fmt->Amask);
+        if (!cache->row) {
+            return NULL;
+        }
+    }
+    return cache;
+}
+
+/* Filter each output line of 'srcrect' and either store it in 'dst' or,
+   when 'row' is set, blit it to 'dst' through that one line surface */
+static void
+LinearStretch(SDL_Surface * src, const SDL_Rect * srcrect,
+              SDL_Surface * dst, const SDL_Rect * dstrect,
+              SDL_StretchCache * cache, SDL_Surface * row)
+{
+    const SDL_PixelFormat *fmt = src->format;
+    const int bpp = fmt->BytesPerPixel;
+    Uint16 *rows[2];
+    int cached[2];
+    int i, x, y;
+    SDL_Rect linerect;
+    SDL_Rect rowrect;
+
+    rows[0] = cache->rows[0];
+    rows[1] = cache->rows[1];
+    cached[0] = cached[1] = -1;
+    rowrect.x = 0;
+    rowrect.y = 0;
+    rowrect.w = dstrect->w;
+    rowrect.h = 1;
+    linerect = *dstrect;
+    linerect.h = 1;
+
+    for (y = 0; y < dstrect->h; ++y) {
+        const LinearSample *ys = &cache->ysamples[y];
+        Uint8 *dstp;
+
+        if (row) {
+            dstp = (Uint8 *) row->pixels;
+        } else {
+            dstp = (Uint8 *) dst->pixels + (dstrect->y + y) * dst->pitch +
+                dstrect->x * bpp;
+        }
+
+        /* Filter the source rows, reusing the ones from the last line */
+        if (cached[0] != ys->p0 && cached[1] == ys->p0) {
+            Uint16 *tmp = rows[0];
+            rows[0] = rows[1];
+            rows[1] = tmp;
+            cached[0] = cached[1];
+            cached[1] = -1;
+        }
+        for (i = 0; i < 2; ++i) {
+            const int line = i ? ys->p1 : ys->p0;
+            const Uint8 *srcp;
+            if (cached[i] == line) {
+                continue;
+            }
+            srcp = (const Uint8 *) src->pixels +
+                (srcrect->y + line) * src->pitch + srcrect->x * bpp;
+            if (bpp == 4) {
+                LinearRow4(srcp, cache->xsamples, dstrect->w, rows[i]);
+            } else {
+                LinearRow2((const Uint16 *) srcp, cache->xsamples, dstrect->w,
+                           fmt, rows[i]);
+            }
+            cached[i] = line;
+        }
+
+        if (bpp == 4) {
+            LinearBlendRows(rows[0], rows[1], ys->frac, NULL, dstp,
+                            dstrect->w * 4);
+        } else {
+            Uint16 *dst16 = (Uint16 *) dstp;
+            const Uint16 *out = cache->out;
+            const int Rshift = fmt->Rshift, Gshift = fmt->Gshift;
+            const int Bshift = fmt->Bshift, Ashift = fmt->Ashift;
+            LinearBlendRows(rows[0], rows[1], ys->frac, cache->out, NULL,
+                            dstrect->w * 4);
+            for (x = 0; x < dstrect->w; ++x) {
+                const Uint16 *c = out + x * 4;
+                dst16[x] = (Uint16) ((c[0] << Rshift) | (c[1] << Gshift) |
+                                     (c[2] << Bshift) | (c[3] << Ashift));
+            }
+        }
+
+        if (row) {
+            linerect.y = dstrect->y + y;
+            row->map->blit(row, &rowrect, dst, &linerect);
+        }
+    }
+}
+
+/* Perform a bilinear filtered stretch blit between two surfaces of the same
+   format, see SDL_SoftStretchLinearSupported() for the formats supported.
+*/
+int
+SDL_SoftStretchLinear(SDL_Surface * src, const SDL_Rect * srcrect,
+                      SDL_Surface * dst, const SDL_Rect * dstrect)
+{
+    int src_locked;
+    int dst_locked;
+    SDL_Rect full_src;
+    SDL_Rect full_dst;
+    SDL_StretchCache *cache;
+    int retval = 0;
+
+    if (!SDL_SoftStretchLinearSupported(dst->format)) {
+        return SDL_SetError("Linear stretching needs a 16 or 32 bpp RGB format with 8-bit channels or less");
+    }
+    if (SetupStretch(src, &srcrect, &full_src, dst, &dstrect, &full_dst,
+                     &src_locked, &dst_locked) < 0) {
+        return -1;
+    }
+    if (srcrect->w > 0 && srcrect->h > 0 &&
+        dstrect->w > 0 && dstrect->h > 0) {
+        cache = GetStretchCache(src, srcrect, dstrect, SDL_FALSE);
+        if (cache) {
+            LinearStretch(src, srcrect, dst, dstrect, cache, NULL);
+        } else {
+            retval = -1;
+        }
+    }
+
+    /* We need to unlock the surfaces if they're locked */
+    if (dst_locked) {
+        SDL_UnlockSurface(dst);
+    }
+    if (src_locked) {
+        SDL_UnlockSurface(src);
+    }
+    return retval;
+}
+
+/* Filter 'src' one line at a time and blit each line to 'dst' with the
+   source's blend mode and color and alpha modulation.  The formats may
+   differ, the rectangles must already be clipped.
+*/
+int
+SDL_SoftStretchLinearBlit(SDL_Surface * src, const SDL_Rect * srcrect,
+                          SDL_Surface * dst, const SDL_Rect * dstrect)
+{
+    SDL_StretchCache *cache;
+    SDL_Surface *row;
+    SDL_BlendMode blendMode;
+    Uint8 r, g, b, a;
+    int src_locked = 0;
+
+    if (!SDL_SoftStretchLinearSupported(src->format)) {
+        return SDL_SetError("Linear stretching needs a 16 or 32 bpp RGB format with 8-bit channels or less");
+    }
+    if (srcrect->w <= 0 || srcrect->h <= 0 ||
+        dstrect->w <= 0 || dstrect->h <= 0) {
+        return 0;
+    }
+    cache = GetStretchCache(src, srcrect, dstrect, SDL_TRUE);
+    if (!cache) {
+        return -1;
+    }
+    row = cache->row;
+
+    /* The line is blitted the way the source would be */
+    SDL_GetSurfaceBlendMode(src, &blendMode);
+    SDL_GetSurfaceColorMod(src, &r, &g, &b);
+    SDL_GetSurfaceAlphaMod(src, &a);
+    SDL_SetSurfaceBlendMode(row, blendMode);
+    SDL_SetSurfaceColorMod(row, r, g, b);
+    SDL_SetSurfaceAlphaMod(row, a);
+    if (SDL_ValidateBlitMap(row, dst) < 0) {
+        return -1;
+    }
+
+    if (SDL_MUSTLOCK(src)) {
+        if (SDL_LockSurface(src) < 0) {
+            return SDL_SetError("Unable to lock source surface");
+        }
+        src_locked = 1;
+    }
+    LinearStretch(src, srcrect, dst, dstrect, cache, row);
+    if (src_locked) {
+        SDL_UnlockSurface(src);
+    }
+    return 0;
+}
+
 /* vi: set ts=4 sw=4 expandtab: */
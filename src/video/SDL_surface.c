@@ -38,9 +38,7 @@ SDL_CreateRGBSurface(Uint32 flags,
 {
     SDL_Surface *surface;
     Uint32 format;
-
-    /* The flags are no longer used, make the compiler happy */
-    (void)flags;
+    int align;
 
     /* Get the pixel format */
     format = SDL_MasksToPixelFormatEnum(depth, Rmask, Gmask, Bmask, Amask);
@@ -64,6 +62,11 @@ SDL_CreateRGBSurface(Uint32 flags,
     surface->w = width;
     surface->h = height;
     surface->pitch = SDL_CalculatePitch(surface);
+    align = SDL_GetSurfaceAlignment(flags);
+    if (align && surface->w && surface->h) {
+        surface->flags |= SDL_SIMD_ALIGNED;
+        surface->pitch = (surface->pitch + align - 1) & ~(align - 1);
+    }
     SDL_SetClipRect(surface, NULL);
 
     if (SDL_ISPIXELFORMAT_INDEXED(surface->format->format)) {
@@ -88,7 +91,7 @@ SDL_CreateRGBSurface(Uint32 flags,
 
     /* Get the pixels */
     if (surface->w && surface->h) {
-        surface->pixels = SDL_malloc(surface->h * surface->pitch);
+        surface->pixels = SDL_AllocSurfacePixels(surface);
         if (!surface->pixels) {
             SDL_FreeSurface(surface);
             SDL_OutOfMemory();
@@ -395,7 +398,8 @@ SDL_SetSurfaceBlendMode(SDL_Surface * surface, SDL_BlendMode blendMode)
     status = 0;
     flags = surface->map->info.flags;
     surface->map->info.flags &=
-        ~(SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD);
+        ~(SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD |
+          SDL_COPY_PREMULTIPLIED);
     switch (blendMode) {
     case SDL_BLENDMODE_NONE:
         break;
@@ -408,6 +412,9 @@ SDL_SetSurfaceBlendMode(SDL_Surface * surface, SDL_BlendMode blendMode)
     case SDL_BLENDMODE_MOD:
         surface->map->info.flags |= SDL_COPY_MOD;
         break;
+    case SDL_BLENDMODE_PREMULTIPLIED:
+        surface->map->info.flags |= SDL_COPY_PREMULTIPLIED;
+        break;
     default:
         status = SDL_Unsupported();
         break;
@@ -432,7 +439,8 @@ SDL_GetSurfaceBlendMode(SDL_Surface * surface, SDL_BlendMode *blendMode)
     }
 
     switch (surface->map->
-            info.flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD)) {
+            info.flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD |
+                          SDL_COPY_PREMULTIPLIED)) {
     case SDL_COPY_BLEND:
         *blendMode = SDL_BLENDMODE_BLEND;
         break;
@@ -442,6 +450,9 @@ SDL_GetSurfaceBlendMode(SDL_Surface * surface, SDL_BlendMode *blendMode)
     case SDL_COPY_MOD:
         *blendMode = SDL_BLENDMODE_MOD;
         break;
+    case SDL_COPY_PREMULTIPLIED:
+        *blendMode = SDL_BLENDMODE_PREMULTIPLIED;
+        break;
     default:
         *blendMode = SDL_BLENDMODE_NONE;
         break;
@@ -493,8 +504,7 @@ SDL_GetClipRect(SDL_Surface * surface, SDL_Rect * rect)
  * by calling the one(s) you need.
  */
 int
-SDL_LowerBlit(SDL_Surface * src, SDL_Rect * srcrect,
-              SDL_Surface * dst, SDL_Rect * dstrect)
+SDL_ValidateBlitMap(SDL_Surface * src, SDL_Surface * dst)
 {
     /* Check to make sure the blit mapping is valid */
     if ((src->map->dst != dst) ||
@@ -511,9 +521,35 @@ SDL_LowerBlit(SDL_Surface * src, SDL_Rect * srcrect,
 /*              src, dst->flags, src->map->info.flags, dst, dst->flags, */
 /*              dst->map->info.flags, src->map->blit); */
     }
+    return 0;
+}
+
+int
+SDL_LowerBlit(SDL_Surface * src, SDL_Rect * srcrect,
+              SDL_Surface * dst, SDL_Rect * dstrect)
+{
+    if (SDL_ValidateBlitMap(src, dst) < 0) {
+        return (-1);
+    }
+    SDL_DAMAGE_RECT(dst, dstrect);
     return (src->map->blit(src, srcrect, dst, dstrect));
 }
 
+/*
+ * Like SDL_LowerBlit(), but large conversions may be split across threads,
+ * see SDL_HINT_SOFTWARE_THREADS.
+ */
+static int
+SDL_LowerBlitBands(SDL_Surface * src, SDL_Rect * srcrect,
+                   SDL_Surface * dst, SDL_Rect * dstrect)
+{
+    if (SDL_ValidateBlitMap(src, dst) < 0) {
+        return (-1);
+    }
+    SDL_DAMAGE_RECT(dst, dstrect);
+    return SDL_SoftBlitBands(src, srcrect, dst, dstrect);
+}
+
 
 int
 SDL_UpperBlit(SDL_Surface * src, const SDL_Rect * srcrect,
@@ -617,6 +653,13 @@ SDL_UpperBlit(SDL_Surface * src, const SDL_Rect * srcrect,
 int
 SDL_UpperBlitScaled(SDL_Surface * src, const SDL_Rect * srcrect,
               SDL_Surface * dst, SDL_Rect * dstrect)
+{
+    return SDL_PrivateUpperBlitScaled(src, srcrect, dst, dstrect, SDL_FALSE);
+}
+
+int
+SDL_PrivateUpperBlitScaled(SDL_Surface * src, const SDL_Rect * srcrect,
+              SDL_Surface * dst, SDL_Rect * dstrect, SDL_bool linear)
 {
     SDL_Rect final_src, final_dst, fulldst;
 
@@ -696,7 +739,7 @@ SDL_UpperBlitScaled(SDL_Surface * src, const SDL_Rect * srcrect,
     }
 
     if (final_dst.w > 0 && final_dst.h > 0) {
-        return SDL_LowerBlitScaled(src, &final_src, dst, &final_dst);
+        return SDL_PrivateLowerBlitScaled(src, &final_src, dst, &final_dst, linear);
     }
 
     return 0;
@@ -709,11 +752,37 @@ SDL_UpperBlitScaled(SDL_Surface * src, const SDL_Rect * srcrect,
 int
 SDL_LowerBlitScaled(SDL_Surface * src, SDL_Rect * srcrect,
                 SDL_Surface * dst, SDL_Rect * dstrect)
+{
+    return SDL_PrivateLowerBlitScaled(src, srcrect, dst, dstrect, SDL_FALSE);
+}
+
+/*
+ * Filter the source straight into the destination when nothing else needs
+ * doing, otherwise filter it a line at a time and blit each line with the
+ * source's blend mode and modulation.
+ */
+static int
+SDL_LowerBlitScaledLinear(SDL_Surface * src, SDL_Rect * srcrect,
+                          SDL_Surface * dst, SDL_Rect * dstrect)
+{
+    if (src->format->format == dst->format->format &&
+        !(src->map->info.flags & (SDL_COPY_MODULATE_COLOR |
+                                  SDL_COPY_MODULATE_ALPHA |
+                                  SDL_COPY_BLEND | SDL_COPY_ADD |
+                                  SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED))) {
+        return SDL_SoftStretchLinear(src, srcrect, dst, dstrect);
+    }
+    return SDL_SoftStretchLinearBlit(src, srcrect, dst, dstrect);
+}
+
+int
+SDL_PrivateLowerBlitScaled(SDL_Surface * src, SDL_Rect * srcrect,
+                SDL_Surface * dst, SDL_Rect * dstrect, SDL_bool linear)
 {
     static const Uint32 complex_copy_flags = (
         SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA |
         SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD |
-        SDL_COPY_COLORKEY
+        SDL_COPY_PREMULTIPLIED | SDL_COPY_COLORKEY
     );
 
     /* Save off the original dst width, height */
@@ -731,6 +800,7 @@ SDL_LowerBlitScaled(SDL_Surface * src, SDL_Rect * srcrect,
     if (!SDL_IntersectRect(&final_dst, &full_rect, &final_dst)) {
         return 0;
     }
+    SDL_DAMAGE_RECT(dst, &final_dst);
 
     /* Did the dst width change? */
     if ( dstW != final_dst.w ) {
@@ -753,6 +823,13 @@ SDL_LowerBlitScaled(SDL_Surface * src, SDL_Rect * srcrect,
         return 0;
     }
 
+    /* Colorkeyed pixels can't be filtered, they stay nearest neighbour, and
+       so do formats the filter can't unpack */
+    if (linear && !(src->map->info.flags & SDL_COPY_COLORKEY) &&
+        SDL_SoftStretchLinearSupported(src->format)) {
+        return SDL_LowerBlitScaledLinear(src, &final_src, dst, &final_dst);
+    }
+
     if (!(src->map->info.flags & SDL_COPY_NEAREST)) {
         src->map->info.flags |= SDL_COPY_NEAREST;
         SDL_InvalidateMap(src->map);
@@ -773,6 +850,8 @@ SDL_LowerBlitScaled(SDL_Surface * src, SDL_Rect * srcrect,
 int
 SDL_LockSurface(SDL_Surface * surface)
 {
+    SDL_Rect bounds;
+
     if (!surface->locked) {
         /* Perform the lock */
         if (surface->flags & SDL_RLEACCEL) {
@@ -781,6 +860,16 @@ SDL_LockSurface(SDL_Surface * surface)
         }
     }
 
+    /* The pixels may be written to in any way while it's locked,
+       the clip rectangle doesn't apply to direct access */
+    if (!surface->locked) {
+        bounds.x = 0;
+        bounds.y = 0;
+        bounds.w = surface->w;
+        bounds.h = surface->h;
+        SDL_DAMAGE_RECT(surface, &bounds);
+    }
+
     /* Increment the surface lock count, for recursive locks */
     ++surface->locked;
 
@@ -834,7 +923,8 @@ SDL_ConvertSurface(SDL_Surface * surface, const SDL_PixelFormat * format,
     }
 
     /* Create a new surface with the desired format */
-    convert = SDL_CreateRGBSurface(flags, surface->w, surface->h,
+    convert = SDL_CreateRGBSurface(flags | (surface->flags & SDL_SIMD_ALIGNED),
+                                   surface->w, surface->h,
                                    format->BitsPerPixel, format->Rmask,
                                    format->Gmask, format->Bmask,
                                    format->Amask);
@@ -868,7 +958,7 @@ SDL_ConvertSurface(SDL_Surface * surface, const SDL_PixelFormat * format,
     bounds.y = 0;
     bounds.w = surface->w;
     bounds.h = surface->h;
-    SDL_LowerBlit(surface, &bounds, convert, &bounds);
+    SDL_LowerBlitBands(surface, &bounds, convert, &bounds);
 
     /* Clean up the original surface, and update converted surface */
     convert->map->info.r = copy_color.r;
@@ -877,7 +967,7 @@ SDL_ConvertSurface(SDL_Surface * surface, const SDL_PixelFormat * format,
     convert->map->info.a = copy_color.a;
     convert->map->info.flags =
         (copy_flags &
-         ~(SDL_COPY_COLORKEY | SDL_COPY_BLEND
+         ~(SDL_COPY_COLORKEY | SDL_COPY_BLEND | SDL_COPY_PREMULTIPLIED
            | SDL_COPY_RLE_DESIRED | SDL_COPY_RLE_COLORKEY |
            SDL_COPY_RLE_ALPHAKEY));
     surface->map->info.r = copy_color.r;
@@ -920,8 +1010,11 @@ SDL_ConvertSurface(SDL_Surface * surface, const SDL_PixelFormat * format,
     SDL_SetClipRect(convert, &surface->clip_rect);
 
     /* Enable alpha blending by default if the new surface has an
-     * alpha channel or alpha modulation */
-    if ((surface->format->Amask && format->Amask) ||
+     * alpha channel or alpha modulation, keeping premultiplied alpha
+     * when the new surface can still carry it */
+    if ((copy_flags & SDL_COPY_PREMULTIPLIED) && format->Amask) {
+        SDL_SetSurfaceBlendMode(convert, SDL_BLENDMODE_PREMULTIPLIED);
+    } else if ((surface->format->Amask && format->Amask) ||
         (copy_flags & (SDL_COPY_COLORKEY|SDL_COPY_MODULATE_ALPHA))) {
         SDL_SetSurfaceBlendMode(convert, SDL_BLENDMODE_BLEND);
     }
@@ -1052,7 +1145,7 @@ int SDL_ConvertPixels(int width, int height,
     rect.y = 0;
     rect.w = width;
     rect.h = height;
-    return SDL_LowerBlit(&src_surface, &rect, &dst_surface, &rect);
+    return SDL_LowerBlitBands(&src_surface, &rect, &dst_surface, &rect);
 }
 
 /*
@@ -1086,7 +1179,7 @@ SDL_FreeSurface(SDL_Surface * surface)
         surface->map = NULL;
     }
     if (!(surface->flags & SDL_PREALLOC)) {
-        SDL_free(surface->pixels);
+        SDL_FreeSurfacePixels(surface);
     }
     SDL_free(surface);
 }
@@ -92,6 +92,8 @@ struct SDL_Window
 
     SDL_Surface *surface;
     SDL_bool surface_valid;
+    struct SDL_DamageRegion *damage;
+    struct SDL_FrameCapture *capture;
 
     SDL_bool is_destroying;
 
@@ -398,6 +400,7 @@ extern void SDL_VideoQuitCompat(void);
 extern void SDL_OnWindowShown(SDL_Window * window);
 extern void SDL_OnWindowHidden(SDL_Window * window);
 extern void SDL_OnWindowResized(SDL_Window * window);
+extern void SDL_OnWindowExposed(SDL_Window * window);
 extern void SDL_OnWindowMinimized(SDL_Window * window);
 extern void SDL_OnWindowRestored(SDL_Window * window);
 extern void SDL_OnWindowEnter(SDL_Window * window);
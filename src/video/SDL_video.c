@@ -28,6 +28,8 @@
 #include "SDL_blit.h"
 #include "SDL_pixels_c.h"
 #include "SDL_rect_c.h"
+#include "SDL_capture_c.h"
+#include "../render/SDL_sysrender.h"
 #include "../events/SDL_events_c.h"
 #include "../timer/SDL_timer_c.h"
 
@@ -143,6 +145,25 @@ typedef struct {
     void *pixels;
     int pitch;
     int bytes_per_pixel;
+
+    /* With SDL_HINT_FRAMEBUFFER_THREAD the renderer belongs to a presenter
+       thread.  Updates copy their rects out of 'pixels' into whichever of
+       the two frames it isn't uploading from, and hand that frame over.
+     */
+    SDL_Window *window;
+    SDL_Thread *thread;
+    SDL_mutex *lock;
+    SDL_cond *cond;
+    SDL_GLContext context;
+    void *frames[2];
+    int pending;                /* frame waiting to be presented, or -1 */
+    int reading;                /* frame being uploaded from, or -1 */
+    SDL_DamageRegion update;    /* what changed in the pending frame */
+    Uint32 format;
+    SDL_bool recreate;
+    SDL_bool quit;
+    int status;
+    char error[256];
 } SDL_WindowTextureData;
 
 static SDL_bool
@@ -230,6 +251,197 @@ ShouldUseTextureFramebuffer()
 #endif
 }
 
+/* Uploads the rects out of 'pixels' into the window texture.  Returns 1 if
+   there's something to present, 0 if the rects were all outside the window,
+   or -1 on error.
+ */
+static int
+SDL_UploadWindowTexture(SDL_WindowTextureData *data, void *pixels, int w, int h,
+                        const SDL_Rect * rects, int numrects)
+{
+    SDL_Rect rect, clipped;
+    void *src;
+    int i, area;
+
+    if (!SDL_GetSpanEnclosingRect(w, h, numrects, rects, &rect)) {
+        return 0;
+    }
+
+    /* Update a single rect that contains subrects for best DMA performance,
+       unless the subrects are a lot smaller, like tracked damage usually is */
+    area = 0;
+    for (i = 0; i < numrects; ++i) {
+        area += rects[i].w * rects[i].h;
+    }
+    if (area * 2 < rect.w * rect.h) {
+        for (i = 0; i < numrects; ++i) {
+            if (!SDL_IntersectRect(&rects[i], &rect, &clipped)) {
+                continue;
+            }
+            src = (void *)((Uint8 *)pixels +
+                            clipped.y * data->pitch +
+                            clipped.x * data->bytes_per_pixel);
+            if (SDL_UpdateTexture(data->texture, &clipped, src, data->pitch) < 0) {
+                return -1;
+            }
+        }
+    } else {
+        src = (void *)((Uint8 *)pixels +
+                        rect.y * data->pitch +
+                        rect.x * data->bytes_per_pixel);
+        if (SDL_UpdateTexture(data->texture, &rect, src, data->pitch) < 0) {
+            return -1;
+        }
+    }
+    return 1;
+}
+
+static void
+SDL_SetWindowTextureError(SDL_WindowTextureData *data)
+{
+    data->status = -1;
+    SDL_strlcpy(data->error, SDL_GetError(), sizeof(data->error));
+}
+
+/* Recreates the texture at the size of the update region */
+static void
+SDL_RecreateWindowTexture(SDL_WindowTextureData *data)
+{
+    SDL_WindowEvent event;
+
+    /* The renderer is detached from the window events, catch it up */
+    SDL_zero(event);
+    event.type = SDL_WINDOWEVENT;
+    event.windowID = data->window->id;
+    event.event = SDL_WINDOWEVENT_SIZE_CHANGED;
+    event.data1 = data->update.w;
+    event.data2 = data->update.h;
+    SDL_RenderWindowEvent(data->renderer, &event);
+
+    if (data->texture) {
+        SDL_DestroyTexture(data->texture);
+    }
+    data->texture = SDL_CreateTexture(data->renderer, data->format,
+                                      SDL_TEXTUREACCESS_STREAMING,
+                                      data->update.w, data->update.h);
+    if (!data->texture) {
+        SDL_SetWindowTextureError(data);
+        return;
+    }
+
+    /* Make sure we're not double-scaling the viewport */
+    SDL_RenderSetViewport(data->renderer, NULL);
+}
+
+static int
+SDL_WindowTextureThread(void *userdata)
+{
+    SDL_WindowTextureData *data = (SDL_WindowTextureData *) userdata;
+    SDL_DamageRegion update;
+    int frame, status;
+
+    /* Take the renderer's context over from the thread that created it */
+    if (data->context) {
+        SDL_GL_MakeCurrent(data->window, data->context);
+    }
+
+    SDL_LockMutex(data->lock);
+    for ( ; ; ) {
+        while (!data->quit && !data->recreate && data->pending < 0) {
+            SDL_CondWait(data->cond, data->lock);
+        }
+        if (data->quit) {
+            break;
+        }
+        if (data->recreate) {
+            SDL_RecreateWindowTexture(data);
+            data->recreate = SDL_FALSE;
+            SDL_CondSignal(data->cond);
+            continue;
+        }
+
+        frame = data->pending;
+        update = data->update;
+        data->update.numrects = 0;
+        data->pending = -1;
+        data->reading = frame;
+        SDL_UnlockMutex(data->lock);
+
+        status = SDL_UploadWindowTexture(data, data->frames[frame],
+                                         update.w, update.h,
+                                         update.rects, update.numrects);
+
+        SDL_LockMutex(data->lock);
+        data->reading = -1;
+        SDL_UnlockMutex(data->lock);
+
+        /* The app thread only waits on this if it's resizing or quitting */
+        if (status > 0) {
+            status = SDL_RenderCopy(data->renderer, data->texture, NULL, NULL);
+            if (status == 0) {
+                SDL_RenderPresent(data->renderer);
+            }
+        }
+
+        SDL_LockMutex(data->lock);
+        if (status < 0) {
+            SDL_SetWindowTextureError(data);
+        }
+    }
+    SDL_UnlockMutex(data->lock);
+
+    if (data->texture) {
+        SDL_DestroyTexture(data->texture);
+        data->texture = NULL;
+    }
+    SDL_DestroyRenderer(data->renderer);
+    data->renderer = NULL;
+    return 0;
+}
+
+static void
+SDL_StartWindowTextureThread(SDL_Window * window, SDL_WindowTextureData *data)
+{
+    data->window = window;
+    data->pending = -1;
+    data->reading = -1;
+    data->lock = SDL_CreateMutex();
+    data->cond = SDL_CreateCond();
+    if (!data->lock || !data->cond) {
+        goto fallback;
+    }
+
+    /* A context can only be current on one thread, hand it over */
+    if (SDL_GL_GetCurrentWindow() == window) {
+        data->context = SDL_GL_GetCurrentContext();
+        SDL_GL_MakeCurrent(window, NULL);
+    }
+
+    data->thread = SDL_CreateThread(SDL_WindowTextureThread, "SDLPresenter", data);
+    if (!data->thread) {
+        if (data->context) {
+            SDL_GL_MakeCurrent(window, data->context);
+            data->context = NULL;
+        }
+        goto fallback;
+    }
+
+    /* Window events are passed on with the texture size from now on */
+    SDL_DetachRendererEvents(data->renderer);
+    return;
+
+fallback:
+    /* Present on the app thread then */
+    if (data->cond) {
+        SDL_DestroyCond(data->cond);
+        data->cond = NULL;
+    }
+    if (data->lock) {
+        SDL_DestroyMutex(data->lock);
+        data->lock = NULL;
+    }
+}
+
 static int
 SDL_CreateWindowTexture(_THIS, SDL_Window * window, Uint32 * format, void ** pixels, int *pitch)
 {
@@ -280,10 +492,15 @@ SDL_CreateWindowTexture(_THIS, SDL_Window * window, Uint32 * format, void ** pix
         SDL_SetWindowData(window, SDL_WINDOWTEXTUREDATA, data);
 
         data->renderer = renderer;
+
+        hint = SDL_GetHint(SDL_HINT_FRAMEBUFFER_THREAD);
+        if (hint && *hint != '0') {
+            SDL_StartWindowTextureThread(window, data);
+        }
     }
 
-    /* Free any old texture and pixel data */
-    if (data->texture) {
+    /* Free any old texture and pixel data, the presenter has the texture */
+    if (data->texture && !data->thread) {
         SDL_DestroyTexture(data->texture);
         data->texture = NULL;
     }
@@ -304,16 +521,51 @@ SDL_CreateWindowTexture(_THIS, SDL_Window * window, Uint32 * format, void ** pix
         }
     }
 
-    data->texture = SDL_CreateTexture(data->renderer, *format,
-                                      SDL_TEXTUREACCESS_STREAMING,
-                                      window->w, window->h);
-    if (!data->texture) {
-        return -1;
-    }
-
     /* Create framebuffer data */
     data->bytes_per_pixel = SDL_BYTESPERPIXEL(*format);
     data->pitch = (((window->w * data->bytes_per_pixel) + 3) & ~3);
+
+    if (data->thread) {
+        SDL_LockMutex(data->lock);
+        data->format = *format;
+        data->update.w = window->w;
+        data->update.h = window->h;
+        data->update.numrects = 0;
+        data->pending = -1;
+        data->recreate = SDL_TRUE;
+        SDL_CondSignal(data->cond);
+        while (data->recreate) {
+            SDL_CondWait(data->cond, data->lock);
+        }
+
+        if (data->status < 0) {
+            data->status = 0;
+            SDL_UnlockMutex(data->lock);
+            return SDL_SetError("%s", data->error);
+        }
+
+        /* The presenter is idle until the next update */
+        for (i = 0; i < SDL_arraysize(data->frames); ++i) {
+            SDL_free(data->frames[i]);
+            data->frames[i] = SDL_malloc(window->h * data->pitch);
+            if (!data->frames[i]) {
+                SDL_UnlockMutex(data->lock);
+                return SDL_OutOfMemory();
+            }
+        }
+        SDL_UnlockMutex(data->lock);
+    } else {
+        data->texture = SDL_CreateTexture(data->renderer, *format,
+                                          SDL_TEXTUREACCESS_STREAMING,
+                                          window->w, window->h);
+        if (!data->texture) {
+            return -1;
+        }
+
+        /* Make sure we're not double-scaling the viewport */
+        SDL_RenderSetViewport(data->renderer, NULL);
+    }
+
     data->pixels = SDL_malloc(window->h * data->pitch);
     if (!data->pixels) {
         return SDL_OutOfMemory();
@@ -322,9 +574,62 @@ SDL_CreateWindowTexture(_THIS, SDL_Window * window, Uint32 * format, void ** pix
     *pixels = data->pixels;
     *pitch = data->pitch;
 
-    /* Make sure we're not double-scaling the viewport */
-    SDL_RenderSetViewport(data->renderer, NULL);
+    return 0;
+}
 
+/* Hands the rects over to the presenter thread, along with any that it
+   hasn't presented yet.  The surface has those too, so they're copied again.
+ */
+static int
+SDL_QueueWindowTexture(SDL_WindowTextureData *data, const SDL_Rect * rects, int numrects)
+{
+    SDL_DamageRegion update;
+    const Uint8 *src;
+    Uint8 *dst;
+    int frame, i, y, length;
+
+    SDL_LockMutex(data->lock);
+    if (data->status < 0) {
+        data->status = 0;
+        SDL_UnlockMutex(data->lock);
+        return SDL_SetError("%s", data->error);
+    }
+    if (data->pending >= 0) {
+        frame = data->pending;
+        data->pending = -1;
+    } else {
+        frame = (data->reading == 0) ? 1 : 0;
+    }
+    update = data->update;
+    SDL_UnlockMutex(data->lock);
+
+    for (i = 0; i < numrects; ++i) {
+        SDL_AddDamageRect(&update, &rects[i]);
+    }
+    if (update.numrects == 0) {
+        return 0;
+    }
+
+    for (i = 0; i < update.numrects; ++i) {
+        length = update.rects[i].w * data->bytes_per_pixel;
+        src = (const Uint8 *)data->pixels +
+              update.rects[i].y * data->pitch +
+              update.rects[i].x * data->bytes_per_pixel;
+        dst = (Uint8 *)data->frames[frame] +
+              update.rects[i].y * data->pitch +
+              update.rects[i].x * data->bytes_per_pixel;
+        for (y = update.rects[i].h; y--; ) {
+            SDL_memcpy(dst, src, length);
+            src += data->pitch;
+            dst += data->pitch;
+        }
+    }
+
+    SDL_LockMutex(data->lock);
+    data->update = update;
+    data->pending = frame;
+    SDL_CondSignal(data->cond);
+    SDL_UnlockMutex(data->lock);
     return 0;
 }
 
@@ -332,41 +637,52 @@ static int
 SDL_UpdateWindowTexture(_THIS, SDL_Window * window, const SDL_Rect * rects, int numrects)
 {
     SDL_WindowTextureData *data;
-    SDL_Rect rect;
-    void *src;
+    int status;
 
     data = SDL_GetWindowData(window, SDL_WINDOWTEXTUREDATA);
-    if (!data || !data->texture) {
+    if (!data || !data->pixels) {
         return SDL_SetError("No window texture data");
     }
 
-    /* Update a single rect that contains subrects for best DMA performance */
-    if (SDL_GetSpanEnclosingRect(window->w, window->h, numrects, rects, &rect)) {
-        src = (void *)((Uint8 *)data->pixels +
-                        rect.y * data->pitch +
-                        rect.x * data->bytes_per_pixel);
-        if (SDL_UpdateTexture(data->texture, &rect, src, data->pitch) < 0) {
-            return -1;
-        }
+    if (data->thread) {
+        return SDL_QueueWindowTexture(data, rects, numrects);
+    }
 
+    status = SDL_UploadWindowTexture(data, data->pixels, window->w, window->h,
+                                     rects, numrects);
+    if (status > 0) {
         if (SDL_RenderCopy(data->renderer, data->texture, NULL, NULL) < 0) {
             return -1;
         }
 
         SDL_RenderPresent(data->renderer);
     }
-    return 0;
+    return (status < 0) ? -1 : 0;
 }
 
 static void
 SDL_DestroyWindowTexture(_THIS, SDL_Window * window)
 {
     SDL_WindowTextureData *data;
+    int i;
 
     data = SDL_SetWindowData(window, SDL_WINDOWTEXTUREDATA, NULL);
     if (!data) {
         return;
     }
+    if (data->thread) {
+        /* The presenter destroys the texture and renderer on its way out */
+        SDL_LockMutex(data->lock);
+        data->quit = SDL_TRUE;
+        SDL_CondSignal(data->cond);
+        SDL_UnlockMutex(data->lock);
+        SDL_WaitThread(data->thread, NULL);
+        SDL_DestroyCond(data->cond);
+        SDL_DestroyMutex(data->lock);
+        for (i = 0; i < SDL_arraysize(data->frames); ++i) {
+            SDL_free(data->frames[i]);
+        }
+    }
     if (data->texture) {
         SDL_DestroyTexture(data->texture);
     }
@@ -1912,6 +2228,44 @@ SDL_CreateWindowFramebuffer(SDL_Window * window)
     return SDL_CreateRGBSurfaceFrom(pixels, window->w, window->h, bpp, pitch, Rmask, Gmask, Bmask, Amask);
 }
 
+/* Marks the whole window surface as needing to be presented */
+static void
+SDL_DamageWindowSurface(SDL_Window * window)
+{
+    SDL_DamageRegion *damage = window->damage;
+
+    damage->numrects = 1;
+    damage->rects[0].x = 0;
+    damage->rects[0].y = 0;
+    damage->rects[0].w = damage->w;
+    damage->rects[0].h = damage->h;
+}
+
+static void
+SDL_SetupWindowSurfaceDamage(SDL_Window * window)
+{
+    SDL_Surface *surface = window->surface;
+    const char *hint = SDL_GetHint(SDL_HINT_WINDOW_SURFACE_DAMAGE);
+
+    if (!hint || *hint == '0') {
+        SDL_free(window->damage);
+        window->damage = NULL;
+        return;
+    }
+
+    if (!window->damage) {
+        window->damage = (SDL_DamageRegion *) SDL_calloc(1, sizeof(*window->damage));
+        if (!window->damage) {
+            /* Not fatal, every update will present the whole surface */
+            return;
+        }
+    }
+    window->damage->w = surface->w;
+    window->damage->h = surface->h;
+    SDL_DamageWindowSurface(window);
+    surface->map->damage = window->damage;
+}
+
 SDL_Surface *
 SDL_GetWindowSurface(SDL_Window * window)
 {
@@ -1926,6 +2280,7 @@ SDL_GetWindowSurface(SDL_Window * window)
         if (window->surface) {
             window->surface_valid = SDL_TRUE;
             window->surface->flags |= SDL_DONTFREE;
+            SDL_SetupWindowSurfaceDamage(window);
         }
     }
     return window->surface;
@@ -1938,6 +2293,22 @@ SDL_UpdateWindowSurface(SDL_Window * window)
 
     CHECK_WINDOW_MAGIC(window, -1);
 
+    if (window->damage && window->surface_valid) {
+        SDL_DamageRegion *damage = window->damage;
+
+        if (damage->numrects > 0) {
+            if (_this->UpdateWindowFramebuffer(_this, window, damage->rects, damage->numrects) < 0) {
+                return -1;
+            }
+            damage->numrects = 0;
+        }
+        /* An unchanged frame is still recorded, Y4M streams have a fixed rate */
+        if (window->capture) {
+            SDL_CaptureSurface(window->capture, window->surface);
+        }
+        return 0;
+    }
+
     full_rect.x = 0;
     full_rect.y = 0;
     full_rect.w = window->w;
@@ -1955,7 +2326,22 @@ SDL_UpdateWindowSurfaceRects(SDL_Window * window, const SDL_Rect * rects,
         return SDL_SetError("Window surface is invalid, please call SDL_GetWindowSurface() to get a new surface");
     }
 
-    return _this->UpdateWindowFramebuffer(_this, window, rects, numrects);
+    if (_this->UpdateWindowFramebuffer(_this, window, rects, numrects) < 0) {
+        return -1;
+    }
+    if (window->capture) {
+        SDL_CaptureSurface(window->capture, window->surface);
+    }
+    return 0;
+}
+
+int
+SDL_SetWindowCapture(SDL_Window * window, SDL_FrameCapture * capture)
+{
+    CHECK_WINDOW_MAGIC(window, -1);
+
+    SDL_AttachFrameCapture(&window->capture, capture);
+    return 0;
 }
 
 int
@@ -2118,6 +2504,15 @@ SDL_OnWindowResized(SDL_Window * window)
     SDL_SendWindowEvent(window, SDL_WINDOWEVENT_SIZE_CHANGED, window->w, window->h);
 }
 
+void
+SDL_OnWindowExposed(SDL_Window * window)
+{
+    /* The contents are gone, the next update has to redraw everything */
+    if (window->damage && window->surface_valid) {
+        SDL_DamageWindowSurface(window);
+    }
+}
+
 void
 SDL_OnWindowMinimized(SDL_Window * window)
 {
@@ -2252,6 +2647,8 @@ SDL_DestroyWindow(SDL_Window * window)
         window->surface->flags &= ~SDL_DONTFREE;
         SDL_FreeSurface(window->surface);
     }
+    SDL_free(window->damage);
+    SDL_AttachFrameCapture(&window->capture, NULL);
     if (_this->DestroyWindowFramebuffer) {
         _this->DestroyWindowFramebuffer(_this, window);
     }
@@ -75,6 +75,16 @@ my %set_rgba_string = (
     "BGRA8888" => "_pixel = ((Uint32)_B << 24) | ((Uint32)_G << 16) | ((Uint32)_R << 8) | _A;",
 );
 
+# Bit offset / 8 of each channel, used to lay out the SIMD blitters
+my %format_lanes = (
+    "RGB888" => { "R" => 2, "G" => 1, "B" => 0 },
+    "BGR888" => { "B" => 2, "G" => 1, "R" => 0 },
+    "ARGB8888" => { "A" => 3, "R" => 2, "G" => 1, "B" => 0 },
+    "RGBA8888" => { "R" => 3, "G" => 2, "B" => 1, "A" => 0 },
+    "ABGR8888" => { "A" => 3, "B" => 2, "G" => 1, "R" => 0 },
+    "BGRA8888" => { "B" => 3, "G" => 2, "R" => 1, "A" => 0 },
+);
+
 sub open_file {
     my $name = shift;
     open(FILE, ">$name.new") || die "Cant' open $name.new: $!";
@@ -139,6 +149,7 @@ sub output_copyfuncname
     my $scale = shift;
     my $args = shift;
     my $suffix = shift;
+    my $variant = shift;
 
     print FILE "$prefix SDL_Blit_${src}_${dst}";
     if ( $modulate ) {
@@ -150,6 +161,9 @@ sub output_copyfuncname
     if ( $scale ) {
         print FILE "_Scale";
     }
+    if ( $variant ) {
+        print FILE "_$variant";
+    }
     if ( $args ) {
         print FILE "(SDL_BlitInfo *info)";
     }
@@ -225,6 +239,16 @@ __EOF__
                 ${s}A = (${s}A * modulateA) / 255;
             }
 __EOF__
+        if ( $blend ) {
+            print FILE <<__EOF__;
+            if ((flags & (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) == (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) {
+                /* Premultiplied color fades along with its alpha */
+                ${s}R = (${s}R * modulateA) / 255;
+                ${s}G = (${s}G * modulateA) / 255;
+                ${s}B = (${s}B * modulateA) / 255;
+            }
+__EOF__
+        }
     }
     if ( $blend ) {
         print FILE <<__EOF__;
@@ -236,13 +260,19 @@ __EOF__
                     ${s}B = (${s}B * ${s}A) / 255;
                 }
             }
-            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
             case SDL_COPY_BLEND:
                 ${d}R = ${s}R + ((255 - ${s}A) * ${d}R) / 255;
                 ${d}G = ${s}G + ((255 - ${s}A) * ${d}G) / 255;
                 ${d}B = ${s}B + ((255 - ${s}A) * ${d}B) / 255;
                 ${d}A = ${s}A + ((255 - ${s}A) * ${d}A) / 255;
                 break;
+            case SDL_COPY_PREMULTIPLIED:
+                ${d}R = ${s}R + ((255 - ${s}A) * ${d}R) / 255; if (${d}R > 255) ${d}R = 255;
+                ${d}G = ${s}G + ((255 - ${s}A) * ${d}G) / 255; if (${d}G > 255) ${d}G = 255;
+                ${d}B = ${s}B + ((255 - ${s}A) * ${d}B) / 255; if (${d}B > 255) ${d}B = 255;
+                ${d}A = ${s}A + ((255 - ${s}A) * ${d}A) / 255;
+                break;
             case SDL_COPY_ADD:
                 ${d}R = ${s}R + ${d}R; if (${d}R > 255) ${d}R = 255;
                 ${d}G = ${s}G + ${d}G; if (${d}G > 255) ${d}G = 255;
@@ -367,6 +397,278 @@ __EOF__
 __EOF__
 }
 
+sub output_simdfunc
+{
+    my $src = shift;
+    my $dst = shift;
+    my $modulate = shift;
+    my $blend = shift;
+    my $scale = shift;
+    my %src_lanes = %{$format_lanes{$src}};
+    my %dst_lanes = %{$format_lanes{$dst}};
+    my $src_has_alpha = exists $src_lanes{"A"};
+    my $dst_has_alpha = exists $dst_lanes{"A"};
+    my @channel;
+    my @perm;
+    my $alpha = 3;
+    my $identity = 1;
+
+    # Work in the destination layout, with alpha in the otherwise unused lane
+    for (my $lane = 0; $lane < 4; ++$lane) {
+        $channel[$lane] = "A";
+        foreach my $c ( "R", "G", "B", "A" ) {
+            if ( exists $dst_lanes{$c} && $dst_lanes{$c} == $lane ) {
+                $channel[$lane] = $c;
+            }
+        }
+        if ( $channel[$lane] eq "A" ) {
+            $alpha = $lane;
+        }
+        if ( exists $src_lanes{$channel[$lane]} ) {
+            $perm[$lane] = $src_lanes{$channel[$lane]};
+        } else {
+            $perm[$lane] = $lane;
+        }
+        if ( $perm[$lane] != $lane ) {
+            $identity = 0;
+        }
+    }
+    my $perm = join(", ", @perm);
+    my $alphamask = join(", ", map { $_ == $alpha ? "0xFFFF" : "0" } (0..3));
+    my $opaque = join(", ", map { $_ == $alpha ? "0xFF" : "0" } (0..3));
+    my $splat = join(", ", ($alpha) x 4);
+
+    output_copyfuncname("static void", $src, $dst, $modulate, $blend, $scale, 1, "\n", "SIMD");
+    print FILE <<__EOF__;
+{
+__EOF__
+    if ( $modulate || $blend ) {
+        print FILE <<__EOF__;
+    const int flags = info->flags;
+__EOF__
+    }
+    print FILE <<__EOF__;
+    const SIMD_Vec alphamask = SIMD_SET($alphamask);
+__EOF__
+    if ( !$src_has_alpha ) {
+        print FILE <<__EOF__;
+    const SIMD_Vec opaque = SIMD_SET($opaque);
+__EOF__
+    }
+    if ( $blend ) {
+        print FILE <<__EOF__;
+    const SIMD_Vec v255 = SIMD_SET(0xFF, 0xFF, 0xFF, 0xFF);
+__EOF__
+    }
+    if ( $modulate ) {
+        my %modulate_lane = (
+            "R" => "modulateR", "G" => "modulateG", "B" => "modulateB", "A" => "modulateA"
+        );
+        my $modulate_vec = join(", ", map { $modulate_lane{$_} } @channel);
+        print FILE <<__EOF__;
+    const Uint16 modulateR = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF;
+    const Uint16 modulateG = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF;
+    const Uint16 modulateB = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF;
+    const Uint16 modulateA = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF;
+    const SIMD_Vec modulate = SIMD_SET($modulate_vec);
+__EOF__
+        if ( $blend ) {
+            print FILE <<__EOF__;
+    const SIMD_Vec modulateAlpha = SIMD_SET(modulateA, modulateA, modulateA, modulateA);
+__EOF__
+        }
+    }
+    print FILE <<__EOF__;
+    SIMD_Vec srcpixel;
+__EOF__
+    if ( $blend ) {
+        print FILE <<__EOF__;
+    SIMD_Vec srcA, dstpixel;
+__EOF__
+    }
+    if ( $scale ) {
+        print FILE <<__EOF__;
+    int srcy, srcx;
+    int posy, posx;
+    int incy, incx;
+
+    srcy = 0;
+    posy = 0;
+    incy = (info->src_h << 16) / info->dst_h;
+    incx = (info->src_w << 16) / info->dst_w;
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        srcx = -1;
+        posx = 0x10000L;
+        while (posy >= 0x10000L) {
+            ++srcy;
+            posy -= 0x10000L;
+        }
+        srcrow = info->src + (srcy * info->src_pitch);
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = pixels;
+            Uint32 *d = (n == 1) ? &pixels[2] : dst;
+            int i;
+            for (i = 0; i < 2; ++i) {
+                while (posx >= 0x10000L) {
+                    ++srcx;
+                    posx -= 0x10000L;
+                }
+                pixels[i] = *(const Uint32 *)(srcrow + (srcx * 4));
+                if (n == 1) {
+                    break;
+                }
+                posx += incx;
+            }
+            if (n == 1) {
+                pixels[1] = pixels[0];
+__EOF__
+        if ( $blend ) {
+            print FILE <<__EOF__;
+                pixels[2] = pixels[3] = *dst;
+__EOF__
+        }
+        print FILE <<__EOF__;
+            }
+__EOF__
+    } else {
+        print FILE <<__EOF__;
+
+    while (info->dst_h--) {
+        const Uint32 *srcrow = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        while (n > 0) {
+            Uint32 pixels[4];
+            const Uint32 *src = srcrow;
+            Uint32 *d = dst;
+            if (n == 1) {
+                pixels[0] = pixels[1] = *srcrow;
+__EOF__
+        if ( $blend ) {
+            print FILE <<__EOF__;
+                pixels[2] = pixels[3] = *dst;
+__EOF__
+        }
+        print FILE <<__EOF__;
+                src = &pixels[0];
+                d = &pixels[2];
+            }
+__EOF__
+    }
+
+    # The per-pixel core, shared by the scaled and unscaled loops
+    print FILE <<__EOF__;
+            srcpixel = SIMD_LOAD(src);
+__EOF__
+    if ( !$identity ) {
+        print FILE <<__EOF__;
+            srcpixel = SIMD_PERM(srcpixel, $perm);
+__EOF__
+    }
+    if ( !$src_has_alpha ) {
+        print FILE <<__EOF__;
+            srcpixel = SIMD_OR(srcpixel, opaque);
+__EOF__
+    }
+    if ( $modulate ) {
+        print FILE <<__EOF__;
+            srcpixel = SIMD_Div255(SIMD_MUL(srcpixel, modulate));
+__EOF__
+        if ( $blend ) {
+            print FILE <<__EOF__;
+            if ((flags & (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) == (SDL_COPY_MODULATE_ALPHA|SDL_COPY_PREMULTIPLIED)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, modulateAlpha)));
+            }
+__EOF__
+        }
+    }
+    if ( $blend ) {
+        print FILE <<__EOF__;
+            srcA = SIMD_PERM(srcpixel, $splat);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                srcpixel = SIMD_SELECT(alphamask, srcpixel, SIMD_Div255(SIMD_MUL(srcpixel, srcA)));
+            }
+            dstpixel = SIMD_LOAD(d);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_PREMULTIPLIED)) {
+            case SDL_COPY_BLEND:
+            case SDL_COPY_PREMULTIPLIED:
+                /* Premultiplied overflow saturates in SIMD_STORE */
+                dstpixel = SIMD_ADD(srcpixel, SIMD_Div255(SIMD_MUL(SIMD_SUB(v255, srcA), dstpixel)));
+                break;
+            case SDL_COPY_ADD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_MIN(SIMD_ADD(srcpixel, dstpixel), v255));
+                break;
+            case SDL_COPY_MOD:
+                dstpixel = SIMD_SELECT(alphamask, dstpixel, SIMD_Div255(SIMD_MUL(srcpixel, dstpixel)));
+                break;
+            }
+__EOF__
+    }
+    my $result = $blend ? "dstpixel" : "srcpixel";
+    if ( !$dst_has_alpha ) {
+        print FILE <<__EOF__;
+            $result = SIMD_ANDNOT(alphamask, $result);
+__EOF__
+    }
+    print FILE <<__EOF__;
+            SIMD_STORE(d, $result);
+__EOF__
+    print FILE <<__EOF__;
+            if (n == 1) {
+                *dst = pixels[2];
+                break;
+            }
+__EOF__
+    if ( !$scale ) {
+        print FILE <<__EOF__;
+            srcrow += 2;
+__EOF__
+    }
+    print FILE <<__EOF__;
+            dst += 2;
+            n -= 2;
+        }
+__EOF__
+    if ( $scale ) {
+        print FILE <<__EOF__;
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+__EOF__
+    } else {
+        print FILE <<__EOF__;
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+__EOF__
+    }
+}
+
+sub output_simdfunc_c
+{
+    my $src = shift;
+    my $dst = shift;
+
+    for (my $modulate = 0; $modulate <= 1; ++$modulate) {
+        for (my $blend = 0; $blend <= 1; ++$blend) {
+            for (my $scale = 0; $scale <= 1; ++$scale) {
+                if ( $modulate || $blend || $scale ) {
+                    output_simdfunc($src, $dst, $modulate, $blend, $scale);
+                }
+            }
+        }
+    }
+}
+
 sub output_copyfunc_h
 {
 }
@@ -381,11 +683,176 @@ sub output_copyinc
 __EOF__
 }
 
+sub output_simdinc
+{
+    print FILE <<__EOF__;
+/* The SIMD blitters work on two pixels at a time, widened to 16 bits per
+   channel and laid out like the destination format. Lanes are numbered by
+   bit offset / 8 within a pixel, so lane 3 is the top byte. Every result
+   is bit-exact with the scalar blitters above, x / 255 is computed as
+   (x + 1 + (x >> 8)) >> 8, which is exact for 0 <= x <= 255 * 255.
+ */
+#if defined(__SSE2__)
+#define SDL_BLIT_AUTO_SIMD      1
+#define SDL_BLIT_AUTO_SIMD_CPU  SDL_CPU_SSE2
+
+typedef __m128i SIMD_Vec;
+
+#define SIMD_SET(l0, l1, l2, l3) \\
+    _mm_set_epi16((short)(l3), (short)(l2), (short)(l1), (short)(l0), \\
+                  (short)(l3), (short)(l2), (short)(l1), (short)(l0))
+#define SIMD_LOAD(p) \\
+    _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *)(p)), _mm_setzero_si128())
+#define SIMD_STORE(p, v) \\
+    _mm_storel_epi64((__m128i *)(p), _mm_packus_epi16((v), (v)))
+#define SIMD_PERM(v, l0, l1, l2, l3) \\
+    _mm_shufflehi_epi16(_mm_shufflelo_epi16((v), _MM_SHUFFLE(l3, l2, l1, l0)), \\
+                        _MM_SHUFFLE(l3, l2, l1, l0))
+#define SIMD_ADD(a, b)      _mm_add_epi16((a), (b))
+#define SIMD_SUB(a, b)      _mm_sub_epi16((a), (b))
+#define SIMD_MUL(a, b)      _mm_mullo_epi16((a), (b))
+#define SIMD_MIN(a, b)      _mm_min_epi16((a), (b))
+#define SIMD_AND(a, b)      _mm_and_si128((a), (b))
+#define SIMD_OR(a, b)       _mm_or_si128((a), (b))
+#define SIMD_ANDNOT(m, v)   _mm_andnot_si128((m), (v))
+#define SIMD_SHR8(v)        _mm_srli_epi16((v), 8)
+
+#elif (defined(__ARM_NEON__) || defined(__ARM_NEON)) && SDL_BYTEORDER == SDL_LIL_ENDIAN
+#include <arm_neon.h>
+#define SDL_BLIT_AUTO_SIMD      1
+#define SDL_BLIT_AUTO_SIMD_CPU  SDL_CPU_NEON
+
+typedef uint16x8_t SIMD_Vec;
+
+static SDL_INLINE SIMD_Vec
+SIMD_Set(Uint16 l0, Uint16 l1, Uint16 l2, Uint16 l3)
+{
+    const Uint16 lanes[8] = { l0, l1, l2, l3, l0, l1, l2, l3 };
+    return vld1q_u16(lanes);
+}
+
+static SDL_INLINE SIMD_Vec
+SIMD_Perm(SIMD_Vec v, uint8x8_t index)
+{
+    const uint8x16_t bytes = vreinterpretq_u8_u16(v);
+    return vreinterpretq_u16_u8(vcombine_u8(vtbl1_u8(vget_low_u8(bytes), index),
+                                            vtbl1_u8(vget_high_u8(bytes), index)));
+}
+
+#define SIMD_SET(l0, l1, l2, l3) SIMD_Set((l0), (l1), (l2), (l3))
+#define SIMD_LOAD(p)        vmovl_u8(vld1_u8((const uint8_t *)(p)))
+#define SIMD_STORE(p, v)    vst1_u8((uint8_t *)(p), vqmovn_u16(v))
+#define SIMD_PERM_BYTE(l, i) ((Uint64)(2 * (l) + ((i) & 1)) << (8 * (i)))
+#define SIMD_PERM(v, l0, l1, l2, l3) \\
+    SIMD_Perm((v), vcreate_u8(SIMD_PERM_BYTE(l0, 0) | SIMD_PERM_BYTE(l0, 1) | \\
+                              SIMD_PERM_BYTE(l1, 2) | SIMD_PERM_BYTE(l1, 3) | \\
+                              SIMD_PERM_BYTE(l2, 4) | SIMD_PERM_BYTE(l2, 5) | \\
+                              SIMD_PERM_BYTE(l3, 6) | SIMD_PERM_BYTE(l3, 7)))
+#define SIMD_ADD(a, b)      vaddq_u16((a), (b))
+#define SIMD_SUB(a, b)      vsubq_u16((a), (b))
+#define SIMD_MUL(a, b)      vmulq_u16((a), (b))
+#define SIMD_MIN(a, b)      vminq_u16((a), (b))
+#define SIMD_AND(a, b)      vandq_u16((a), (b))
+#define SIMD_OR(a, b)       vorrq_u16((a), (b))
+#define SIMD_ANDNOT(m, v)   vbicq_u16((v), (m))
+#define SIMD_SHR8(v)        vshrq_n_u16((v), 8)
+
+#elif SDL_ALTIVEC_BLITTERS && SDL_BYTEORDER == SDL_BIG_ENDIAN
+#ifdef HAVE_ALTIVEC_H
+#include <altivec.h>
+#endif
+#define SDL_BLIT_AUTO_SIMD      1
+#define SDL_BLIT_AUTO_SIMD_CPU  SDL_CPU_ALTIVEC
+
+typedef vector unsigned short SIMD_Vec;
+
+/* On big-endian machines lane l of a pixel is vector element 3 - l */
+static SDL_INLINE SIMD_Vec
+SIMD_Set(Uint16 l0, Uint16 l1, Uint16 l2, Uint16 l3)
+{
+    DECLARE_ALIGNED(Uint16, lanes[8], 16);
+    lanes[0] = lanes[4] = l3;
+    lanes[1] = lanes[5] = l2;
+    lanes[2] = lanes[6] = l1;
+    lanes[3] = lanes[7] = l0;
+    return vec_ld(0, lanes);
+}
+
+static SDL_INLINE SIMD_Vec
+SIMD_Load(const Uint32 *p)
+{
+    DECLARE_ALIGNED(Uint32, pixels[4], 16);
+    pixels[0] = p[0];
+    pixels[1] = p[1];
+    return (SIMD_Vec) vec_mergeh(vec_splat_u8(0), vec_ld(0, (const Uint8 *) pixels));
+}
+
+static SDL_INLINE void
+SIMD_Store(Uint32 *p, SIMD_Vec v)
+{
+    DECLARE_ALIGNED(Uint32, pixels[4], 16);
+    vec_st(vec_packsu(v, v), 0, (Uint8 *) pixels);
+    p[0] = pixels[0];
+    p[1] = pixels[1];
+}
+
+#define SIMD_SET(l0, l1, l2, l3) SIMD_Set((l0), (l1), (l2), (l3))
+#define SIMD_LOAD(p)        SIMD_Load(p)
+#define SIMD_STORE(p, v)    SIMD_Store((p), (v))
+#define SIMD_PERM_INDEX(l0, l1, l2, l3, o) \\
+    2 * (3 - (l3)) + (o), 2 * (3 - (l3)) + 1 + (o), \\
+    2 * (3 - (l2)) + (o), 2 * (3 - (l2)) + 1 + (o), \\
+    2 * (3 - (l1)) + (o), 2 * (3 - (l1)) + 1 + (o), \\
+    2 * (3 - (l0)) + (o), 2 * (3 - (l0)) + 1 + (o)
+#define SIMD_PERM(v, l0, l1, l2, l3) \\
+    vec_perm((v), (v), (vector unsigned char) { SIMD_PERM_INDEX(l0, l1, l2, l3, 0), \\
+                                                SIMD_PERM_INDEX(l0, l1, l2, l3, 8) })
+#define SIMD_ADD(a, b)      vec_add((a), (b))
+#define SIMD_SUB(a, b)      vec_sub((a), (b))
+#define SIMD_MUL(a, b)      vec_mladd((a), (b), vec_splat_u16(0))
+#define SIMD_MIN(a, b)      vec_min((a), (b))
+#define SIMD_AND(a, b)      vec_and((a), (b))
+#define SIMD_OR(a, b)       vec_or((a), (b))
+#define SIMD_ANDNOT(m, v)   vec_andc((v), (m))
+#define SIMD_SHR8(v)        vec_sr((v), vec_splat_u16(8))
+#endif
+
+#if SDL_BLIT_AUTO_SIMD
+static SDL_INLINE SIMD_Vec
+SIMD_Div255(SIMD_Vec v)
+{
+    return SIMD_SHR8(SIMD_ADD(SIMD_ADD(v, SIMD_SET(1, 1, 1, 1)), SIMD_SHR8(v)));
+}
+
+/* Take the lanes in (mask) from (a) and the others from (b) */
+#define SIMD_SELECT(mask, a, b) SIMD_OR(SIMD_AND((mask), (a)), SIMD_ANDNOT((mask), (b)))
+
+__EOF__
+}
+
 sub output_copyfunctable
 {
     print FILE <<__EOF__;
 SDL_BlitFuncEntry SDL_GeneratedBlitFuncTable[] = {
+#if SDL_BLIT_AUTO_SIMD
+__EOF__
+    output_copyfunctable_entries("SIMD", "SDL_BLIT_AUTO_SIMD_CPU");
+    print FILE <<__EOF__;
+#endif
+__EOF__
+    output_copyfunctable_entries("", "SDL_CPU_ANY");
+    print FILE <<__EOF__;
+    { 0, 0, 0, 0, NULL }
+};
+
 __EOF__
+}
+
+sub output_copyfunctable_entries
+{
+    my $variant = shift;
+    my $cpu = shift;
+
     for (my $i = 0; $i <= $#src_formats; ++$i) {
         my $src = $src_formats[$i];
         for (my $j = 0; $j <= $#dst_formats; ++$j) {
@@ -406,7 +873,7 @@ __EOF__
                                 }
                             }
                             if ( $blend ) {
-                                $flag = "SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD";
+                                $flag = "SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_PREMULTIPLIED";
                                 if ( $flags eq "" ) {
                                     $flags = $flag;
                                 } else {
@@ -424,19 +891,14 @@ __EOF__
                             if ( $flags eq "" ) {
                                 $flags = "0";
                             }
-                            print FILE "($flags), SDL_CPU_ANY,";
-                            output_copyfuncname("", $src_formats[$i], $dst_formats[$j], $modulate, $blend, $scale, 0, " },\n");
+                            print FILE "($flags), $cpu,";
+                            output_copyfuncname("", $src_formats[$i], $dst_formats[$j], $modulate, $blend, $scale, 0, " },\n", $variant);
                         }
                     }
                 }
             }
         }
     }
-    print FILE <<__EOF__;
-    { 0, 0, 0, 0, NULL }
-};
-
-__EOF__
 }
 
 sub output_copyfunc_c
@@ -472,5 +934,12 @@ for (my $i = 0; $i <= $#src_formats; ++$i) {
         output_copyfunc_c($src_formats[$i], $dst_formats[$j]);
     }
 }
+output_simdinc();
+for (my $i = 0; $i <= $#src_formats; ++$i) {
+    for (my $j = 0; $j <= $#dst_formats; ++$j) {
+        output_simdfunc_c($src_formats[$i], $dst_formats[$j]);
+    }
+}
+print FILE "#endif /* SDL_BLIT_AUTO_SIMD */\n\n";
 output_copyfunctable();
 close_file("SDL_blit_auto.c");
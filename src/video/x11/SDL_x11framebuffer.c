@@ -24,6 +24,7 @@
 
 #include "SDL_x11video.h"
 #include "SDL_x11framebuffer.h"
+#include "../SDL_rect_c.h"
 
 
 #ifndef NO_SHARED_MEMORY
@@ -50,6 +51,102 @@ static SDL_bool have_mitshm(void)
     return SDL_FALSE;
 }
 
+static SDL_bool
+X11_CreateShmImage(Display * display, SDL_WindowData * data,
+                   const XVisualInfo * vinfo, int w, int h, int pitch, int i)
+{
+    XShmSegmentInfo *shminfo = &data->shminfo[i];
+
+    shminfo->shmid = shmget(IPC_PRIVATE, h*pitch, IPC_CREAT | 0777);
+    if ( shminfo->shmid >= 0 ) {
+        shminfo->shmaddr = (char *)shmat(shminfo->shmid, 0, 0);
+        shminfo->readOnly = False;
+        if ( shminfo->shmaddr != (char *)-1 ) {
+            shm_error = False;
+            X_handler = X11_XSetErrorHandler(shm_errhandler);
+            X11_XShmAttach(display, shminfo);
+            X11_XSync(display, True);
+            X11_XSetErrorHandler(X_handler);
+            if ( shm_error )
+                shmdt(shminfo->shmaddr);
+        } else {
+            shm_error = True;
+        }
+        shmctl(shminfo->shmid, IPC_RMID, NULL);
+    } else {
+        shm_error = True;
+    }
+    if (shm_error) {
+        return SDL_FALSE;
+    }
+
+    data->shmimage[i] = X11_XShmCreateImage(display, data->visual,
+                          vinfo->depth, ZPixmap,
+                          shminfo->shmaddr, shminfo, w, h);
+    if (!data->shmimage[i]) {
+        X11_XShmDetach(display, shminfo);
+        X11_XSync(display, False);
+        shmdt(shminfo->shmaddr);
+        return SDL_FALSE;
+    }
+    data->shm_busy[i] = SDL_FALSE;
+    return SDL_TRUE;
+}
+
+static void
+X11_DestroyShmImage(Display * display, SDL_WindowData * data, int i)
+{
+    if (data->shmimage[i]) {
+        XDestroyImage(data->shmimage[i]);
+        X11_XShmDetach(display, &data->shminfo[i]);
+        X11_XSync(display, False);
+        shmdt(data->shminfo[i].shmaddr);
+        data->shmimage[i] = NULL;
+    }
+}
+
+static Bool
+X11_IsShmCompletion(Display * display, XEvent * event, XPointer arg)
+{
+    SDL_WindowData *data = (SDL_WindowData *) arg;
+
+    return (event->type == data->videodata->shm_completion &&
+            event->xany.window == data->xwindow);
+}
+
+void
+X11_HandleShmCompletion(SDL_WindowData * data, const XShmCompletionEvent * event)
+{
+    int i;
+
+    for (i = 0; i < SDL_arraysize(data->shmimage); ++i) {
+        if (data->shmimage[i] && event->shmseg == data->shminfo[i].shmseg) {
+            data->shm_busy[i] = SDL_FALSE;
+        }
+    }
+}
+
+/* Wait until the server is done reading a shared image */
+static void
+X11_WaitForShmImage(Display * display, SDL_WindowData * data, int i)
+{
+    XEvent event;
+
+    while (data->shm_busy[i] &&
+           X11_XCheckIfEvent(display, &event, X11_IsShmCompletion, (XPointer) data)) {
+        X11_HandleShmCompletion(data, (XShmCompletionEvent *) &event);
+    }
+    if (data->shm_busy[i]) {
+        /* After a round trip every completion asked for so far is queued,
+           if there is none the put failed and the image is free anyway */
+        X11_XSync(display, False);
+        while (X11_XCheckIfEvent(display, &event, X11_IsShmCompletion, (XPointer) data)) {
+            X11_HandleShmCompletion(data, (XShmCompletionEvent *) &event);
+        }
+        data->shm_busy[i] = SDL_FALSE;
+    }
+}
+
 #endif /* !NO_SHARED_MEMORY */
 
 int
@@ -84,45 +181,21 @@ X11_CreateWindowFramebuffer(_THIS, SDL_Window * window, Uint32 * format,
     /* Calculate pitch */
     *pitch = (((window->w * SDL_BYTESPERPIXEL(*format)) + 3) & ~3);
 
-    /* Create the actual image */
+    /* Create the shared images the surface is presented through.  The
+       surface itself stays in private memory, so the application can draw
+       the next frame while the server is still reading the last one. */
 #ifndef NO_SHARED_MEMORY
     if (have_mitshm()) {
-        XShmSegmentInfo *shminfo = &data->shminfo;
-
-        shminfo->shmid = shmget(IPC_PRIVATE, window->h*(*pitch), IPC_CREAT | 0777);
-        if ( shminfo->shmid >= 0 ) {
-            shminfo->shmaddr = (char *)shmat(shminfo->shmid, 0, 0);
-            shminfo->readOnly = False;
-            if ( shminfo->shmaddr != (char *)-1 ) {
-                shm_error = False;
-                X_handler = X11_XSetErrorHandler(shm_errhandler);
-                X11_XShmAttach(display, shminfo);
-                X11_XSync(display, True);
-                X11_XSetErrorHandler(X_handler);
-                if ( shm_error )
-                    shmdt(shminfo->shmaddr);
-            } else {
-                shm_error = True;
+        if (X11_CreateShmImage(display, data, &vinfo, window->w, window->h, *pitch, 0) &&
+            X11_CreateShmImage(display, data, &vinfo, window->w, window->h, *pitch, 1)) {
+            data->use_mitshm = SDL_TRUE;
+            data->shm_next = 0;
+            if (!data->videodata->shm_completion) {
+                data->videodata->shm_completion = X11_XShmGetEventBase(display) + ShmCompletion;
             }
-            shmctl(shminfo->shmid, IPC_RMID, NULL);
         } else {
-            shm_error = True;
-        }
-        if (!shm_error) {
-            data->ximage = X11_XShmCreateImage(display, data->visual,
-                             vinfo.depth, ZPixmap,
-                             shminfo->shmaddr, shminfo,
-                             window->w, window->h);
-            if (!data->ximage) {
-                X11_XShmDetach(display, shminfo);
-                X11_XSync(display, False);
-                shmdt(shminfo->shmaddr);
-            } else {
-                /* Done! */
-                data->use_mitshm = SDL_TRUE;
-                *pixels = shminfo->shmaddr;
-                return 0;
-            }
+            X11_DestroyShmImage(display, data, 0);
+            X11_DestroyShmImage(display, data, 1);
         }
     }
 #endif /* not NO_SHARED_MEMORY */
@@ -148,70 +221,68 @@ X11_UpdateWindowFramebuffer(_THIS, SDL_Window * window, const SDL_Rect * rects,
 {
     SDL_WindowData *data = (SDL_WindowData *) window->driverdata;
     Display *display = data->videodata->display;
+    SDL_DamageRegion region;
+    const SDL_Rect *rect;
     int i;
-    int x, y, w ,h;
+
+    /* Clip the rectangles to the window and merge the ones that overlap or
+       nearly touch, every one of them is a separate request */
+    region.w = window->w;
+    region.h = window->h;
+    region.numrects = 0;
+    for (i = 0; i < numrects; ++i) {
+        SDL_AddDamageRect(&region, &rects[i]);
+    }
+
 #ifndef NO_SHARED_MEMORY
     if (data->use_mitshm) {
-        for (i = 0; i < numrects; ++i) {
-            x = rects[i].x;
-            y = rects[i].y;
-            w = rects[i].w;
-            h = rects[i].h;
-
-            if (w <= 0 || h <= 0 || (x + w) <= 0 || (y + h) <= 0) {
-                /* Clipped? */
-                continue;
-            }
-            if (x < 0)
-            {
-                x += w;
-                w += rects[i].x;
-            }
-            if (y < 0)
-            {
-                y += h;
-                h += rects[i].y;
+        const int next = data->shm_next;
+        XImage *image = data->shmimage[next];
+        const int bpp = data->ximage->bits_per_pixel / 8;
+        const Uint8 *src;
+        Uint8 *dst;
+        int y;
+
+        if (region.numrects == 0) {
+            return 0;
+        }
+
+        /* This image was sent two updates ago, the last one is still free
+           to be read by the server while this one is filled */
+        X11_WaitForShmImage(display, data, next);
+
+        for (i = 0; i < region.numrects; ++i) {
+            rect = &region.rects[i];
+            src = (const Uint8 *)data->ximage->data +
+                  rect->y * data->ximage->bytes_per_line + rect->x * bpp;
+            dst = (Uint8 *)image->data +
+                  rect->y * image->bytes_per_line + rect->x * bpp;
+            for (y = 0; y < rect->h; ++y) {
+                SDL_memcpy(dst, src, rect->w * bpp);
+                src += data->ximage->bytes_per_line;
+                dst += image->bytes_per_line;
             }
-            if (x + w > window->w)
-                w = window->w - x;
-            if (y + h > window->h)
-                h = window->h - y;
+        }
 
-            X11_XShmPutImage(display, data->xwindow, data->gc, data->ximage,
-                x, y, x, y, w, h, False);
+        /* Only the last request needs to report its completion */
+        for (i = 0; i < region.numrects; ++i) {
+            rect = &region.rects[i];
+            X11_XShmPutImage(display, data->xwindow, data->gc, image,
+                rect->x, rect->y, rect->x, rect->y, rect->w, rect->h,
+                (i == region.numrects - 1) ? True : False);
         }
+        data->shm_busy[next] = SDL_TRUE;
+        data->shm_next = !next;
+
+        X11_XFlush(display);
+        return 0;
     }
-    else
 #endif /* !NO_SHARED_MEMORY */
-    {
-        for (i = 0; i < numrects; ++i) {
-            x = rects[i].x;
-            y = rects[i].y;
-            w = rects[i].w;
-            h = rects[i].h;
-
-            if (w <= 0 || h <= 0 || (x + w) <= 0 || (y + h) <= 0) {
-                /* Clipped? */
-                continue;
-            }
-            if (x < 0)
-            {
-                x += w;
-                w += rects[i].x;
-            }
-            if (y < 0)
-            {
-                y += h;
-                h += rects[i].y;
-            }
-            if (x + w > window->w)
-                w = window->w - x;
-            if (y + h > window->h)
-                h = window->h - y;
 
-            X11_XPutImage(display, data->xwindow, data->gc, data->ximage,
-                x, y, x, y, w, h);
-        }
+    for (i = 0; i < region.numrects; ++i) {
+        rect = &region.rects[i];
+        X11_XPutImage(display, data->xwindow, data->gc, data->ximage,
+            rect->x, rect->y, rect->x, rect->y, rect->w, rect->h);
     }
 
     X11_XSync(display, False);
@@ -232,18 +303,18 @@ X11_DestroyWindowFramebuffer(_THIS, SDL_Window * window)
 
     display = data->videodata->display;
 
-    if (data->ximage) {
-        XDestroyImage(data->ximage);
-
 #ifndef NO_SHARED_MEMORY
-        if (data->use_mitshm) {
-            X11_XShmDetach(display, &data->shminfo);
-            X11_XSync(display, False);
-            shmdt(data->shminfo.shmaddr);
-            data->use_mitshm = SDL_FALSE;
-        }
+    if (data->use_mitshm) {
+        X11_WaitForShmImage(display, data, 0);
+        X11_WaitForShmImage(display, data, 1);
+        X11_DestroyShmImage(display, data, 0);
+        X11_DestroyShmImage(display, data, 1);
+        data->use_mitshm = SDL_FALSE;
+    }
 #endif /* !NO_SHARED_MEMORY */
 
+    if (data->ximage) {
+        XDestroyImage(data->ximage);
         data->ximage = NULL;
     }
     if (data->gc) {
@@ -27,5 +27,9 @@ extern int X11_CreateWindowFramebuffer(_THIS, SDL_Window * window,
 extern int X11_UpdateWindowFramebuffer(_THIS, SDL_Window * window,
                                        const SDL_Rect * rects, int numrects);
 extern void X11_DestroyWindowFramebuffer(_THIS, SDL_Window * window);
+#ifndef NO_SHARED_MEMORY
+extern void X11_HandleShmCompletion(SDL_WindowData * data,
+                                    const XShmCompletionEvent * event);
+#endif
 
 /* vi: set ts=4 sw=4 expandtab: */
@@ -114,6 +114,11 @@ typedef struct SDL_VideoData
     SDL_Scancode key_layout[256];
     SDL_bool selection_waiting;
 
+#ifndef NO_SHARED_MEMORY
+    /* Event type of XShm completion events, 0 until the first is requested */
+    int shm_completion;
+#endif
+
 #if SDL_USE_LIBDBUS
     DBusConnection *dbus;
 #endif
@@ -49,9 +49,13 @@ typedef struct
     Visual *visual;
     Colormap colormap;
 #ifndef NO_SHARED_MEMORY
-    /* MIT shared memory extension information */
+    /* MIT shared memory extension information, the window surface is
+       copied into one image while the server reads from the other */
     SDL_bool use_mitshm;
-    XShmSegmentInfo shminfo;
+    XShmSegmentInfo shminfo[2];
+    XImage *shmimage[2];
+    SDL_bool shm_busy[2];
+    int shm_next;
 #endif
     XImage *ximage;
     GC gc;
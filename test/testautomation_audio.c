@@ -759,6 +759,106 @@ int audio_convertAudio()
 }
 
 
+/* Scalar reference for audio_convertAudioToFloatBitExact, same math as SDL_audiotypecvt.c */
+static float
+_audioReferenceSampleToFloat(const Uint8 *src, SDL_AudioFormat format)
+{
+  Uint32 raw;
+  float result;
+
+  if (SDL_AUDIO_BITSIZE(format) == 16) {
+    Uint16 raw16;
+    SDL_memcpy(&raw16, src, sizeof (raw16));
+    raw16 = SDL_AUDIO_ISBIGENDIAN(format) ? SDL_SwapBE16(raw16) : SDL_SwapLE16(raw16);
+    return ((float) ((Sint16) raw16)) * 3.05185094759972e-05f;
+  }
+
+  SDL_memcpy(&raw, src, sizeof (raw));
+  raw = SDL_AUDIO_ISBIGENDIAN(format) ? SDL_SwapBE32(raw) : SDL_SwapLE32(raw);
+  if (SDL_AUDIO_ISFLOAT(format)) {
+    SDL_memcpy(&result, &raw, sizeof (result));
+    return result;
+  }
+  return ((float) ((Sint32) raw)) * 4.6566128752458e-10f;
+}
+
+/**
+ * \brief Checks that integer and float to float conversions are bit-exact for all lengths
+ *
+ * \sa http://wiki.libsdl.org/moin.cgi/SDL_ConvertAudio
+ */
+int audio_convertAudioToFloatBitExact()
+{
+  const SDL_AudioFormat srcFormats[] = { AUDIO_S16LSB, AUDIO_S16MSB, AUDIO_S32LSB, AUDIO_S32MSB, AUDIO_F32LSB, AUDIO_F32MSB };
+  const SDL_AudioFormat dstFormats[] = { AUDIO_F32LSB, AUDIO_F32MSB };
+  const int lengths[] = { 1, 7, 8, 9, 31, 64, 1023 };
+  int i, j, k, n;
+  int result;
+  SDL_AudioCVT cvt;
+
+  for (i = 0; i < SDL_arraysize(srcFormats); i++) {
+    for (j = 0; j < SDL_arraysize(dstFormats); j++) {
+      if (srcFormats[i] == dstFormats[j]) {
+        continue;
+      }
+      for (k = 0; k < SDL_arraysize(lengths); k++) {
+        const int samples = lengths[k];
+        const int srcSize = SDL_AUDIO_BITSIZE(srcFormats[i]) / 8;
+        Uint8 *reference;
+        int mismatches = 0;
+
+        result = SDL_BuildAudioCVT(&cvt, srcFormats[i], 2, 48000, dstFormats[j], 2, 48000);
+        SDLTest_AssertCheck(result == 1, "Verify SDL_BuildAudioCVT(0x%04x ==> 0x%04x) result; expected: 1, got: %i", srcFormats[i], dstFormats[j], result);
+        if (result != 1) return TEST_ABORTED;
+
+        cvt.len = samples * srcSize;
+        cvt.buf = (Uint8 *)SDL_malloc(cvt.len * cvt.len_mult);
+        reference = (Uint8 *)SDL_malloc(cvt.len);
+        SDLTest_AssertCheck(cvt.buf != NULL && reference != NULL, "Check conversion buffers are not NULL");
+        if (cvt.buf == NULL || reference == NULL) {
+          SDL_free(cvt.buf);
+          SDL_free(reference);
+          return TEST_ABORTED;
+        }
+
+        /* Random bits, but keep float input finite so NaN payloads don't matter */
+        for (n = 0; n < cvt.len; n++) {
+          cvt.buf[n] = (Uint8)SDLTest_RandomUint8();
+        }
+        if (SDL_AUDIO_ISFLOAT(srcFormats[i])) {
+          for (n = 0; n < samples; n++) {
+            cvt.buf[n * 4 + (SDL_AUDIO_ISBIGENDIAN(srcFormats[i]) ? 0 : 3)] &= 0x3F;
+          }
+        }
+        SDL_memcpy(reference, cvt.buf, cvt.len);
+
+        result = SDL_ConvertAudio(&cvt);
+        SDLTest_AssertCheck(result == 0, "Verify SDL_ConvertAudio() result; expected: 0, got: %i", result);
+        SDLTest_AssertCheck(cvt.len_cvt == samples * 4, "Verify converted length; expected: %i, got: %i", samples * 4, cvt.len_cvt);
+
+        for (n = 0; n < samples; n++) {
+          float expected = _audioReferenceSampleToFloat(reference + n * srcSize, srcFormats[i]);
+          float actual;
+          Uint32 raw;
+          SDL_memcpy(&raw, cvt.buf + n * 4, sizeof (raw));
+          raw = SDL_AUDIO_ISBIGENDIAN(dstFormats[j]) ? SDL_SwapBE32(raw) : SDL_SwapLE32(raw);
+          SDL_memcpy(&actual, &raw, sizeof (actual));
+          if (SDL_memcmp(&expected, &actual, sizeof (float)) != 0) {
+            mismatches++;
+          }
+        }
+        SDLTest_AssertCheck(mismatches == 0, "Verify %i samples 0x%04x ==> 0x%04x are bit-exact; mismatches: %i", samples, srcFormats[i], dstFormats[j], mismatches);
+
+        SDL_free(reference);
+        SDL_free(cvt.buf);
+      }
+    }
+  }
+
+  return TEST_COMPLETED;
+}
+
+
 /**
  * \brief Opens, checks current connected status, and closes a device.
  *
@@ -877,11 +977,14 @@ static const SDLTest_TestCaseReference audioTest13 =
 static const SDLTest_TestCaseReference audioTest14 =
         { (SDLTest_TestCaseFp)audio_initOpenCloseQuitAudio, "audio_initOpenCloseQuitAudio", "Cycle through init, open, close and quit with various audio specs.", TEST_DISABLED };
 
+static const SDLTest_TestCaseReference audioTest15 =
+        { (SDLTest_TestCaseFp)audio_convertAudioToFloatBitExact, "audio_convertAudioToFloatBitExact", "Checks integer and float to float conversions are bit-exact.", TEST_ENABLED };
+
 /* Sequence of Audio test cases */
 static const SDLTest_TestCaseReference *audioTests[] =  {
     &audioTest1, &audioTest2, &audioTest3, &audioTest4, &audioTest5, &audioTest6,
     &audioTest7, &audioTest8, &audioTest9, &audioTest10, &audioTest11,
-    &audioTest12, &audioTest13, &audioTest14, NULL
+    &audioTest12, &audioTest13, &audioTest14, &audioTest15, NULL
 };
 
 /* Audio test suite (global) */
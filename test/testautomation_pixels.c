@@ -79,14 +79,16 @@ char* _RGBPixelFormatsVerbose[] =
   };
 
 /* Definition of all Non-RGB formats used to test pixel conversions */
-const int _numNonRGBPixelFormats = 5;
+const int _numNonRGBPixelFormats = 7;
 Uint32 _nonRGBPixelFormats[] =
   {
     SDL_PIXELFORMAT_YV12,
     SDL_PIXELFORMAT_IYUV,
     SDL_PIXELFORMAT_YUY2,
     SDL_PIXELFORMAT_UYVY,
-    SDL_PIXELFORMAT_YVYU
+    SDL_PIXELFORMAT_YVYU,
+    SDL_PIXELFORMAT_NV12,
+    SDL_PIXELFORMAT_NV21
   };
 char* _nonRGBPixelFormatsVerbose[] =
   {
@@ -94,7 +96,9 @@ char* _nonRGBPixelFormatsVerbose[] =
     "SDL_PIXELFORMAT_IYUV",
     "SDL_PIXELFORMAT_YUY2",
     "SDL_PIXELFORMAT_UYVY",
-    "SDL_PIXELFORMAT_YVYU"
+    "SDL_PIXELFORMAT_YVYU",
+    "SDL_PIXELFORMAT_NV12",
+    "SDL_PIXELFORMAT_NV21"
   };
 
 /* Definition of some invalid formats for negative tests */
@@ -393,6 +397,152 @@ pixels_allocFreePalette(void *arg)
   return TEST_COMPLETED;
 }
 
+/* Reference nearest color search, as SDL_MapRGBA did it with a full scan */
+static Uint32
+_findColorLinear(const SDL_Palette *palette, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+  unsigned int smallest = ~0;
+  unsigned int distance;
+  int rd, gd, bd, ad;
+  int i;
+  Uint32 pixel = 0;
+
+  for (i = 0; i < palette->ncolors; i++) {
+    rd = palette->colors[i].r - r;
+    gd = palette->colors[i].g - g;
+    bd = palette->colors[i].b - b;
+    ad = palette->colors[i].a - a;
+    distance = (rd * rd) + (gd * gd) + (bd * bd) + (ad * ad);
+    if (distance < smallest) {
+      pixel = i;
+      smallest = distance;
+    }
+  }
+  return pixel;
+}
+
+/**
+ * @brief Call to SDL_MapRGB and SDL_MapRGBA with an 8-bit palette
+ *
+ * @sa http://wiki.libsdl.org/moin.fcg/SDL_MapRGB
+ * @sa http://wiki.libsdl.org/moin.fcg/SDL_MapRGBA
+ */
+int
+pixels_mapPalette(void *arg)
+{
+  SDL_PixelFormat *format;
+  SDL_Palette *palette;
+  SDL_Color colors[256];
+  SDL_Color *replaced;
+  int variation;
+  int i, mismatches;
+  Uint8 r, g, b, a;
+  Uint32 result, expected;
+
+  format = SDL_AllocFormat(SDL_PIXELFORMAT_INDEX8);
+  SDLTest_AssertPass("Call to SDL_AllocFormat(SDL_PIXELFORMAT_INDEX8)");
+  SDLTest_AssertCheck(format != NULL, "Verify format is not NULL");
+  if (format == NULL) {
+    return TEST_ABORTED;
+  }
+  palette = SDL_AllocPalette(256);
+  SDLTest_AssertPass("Call to SDL_AllocPalette(256)");
+  SDLTest_AssertCheck(palette != NULL, "Verify palette is not NULL");
+  if (palette == NULL) {
+    SDL_FreeFormat(format);
+    return TEST_ABORTED;
+  }
+  SDL_SetPixelFormatPalette(format, palette);
+  SDLTest_AssertPass("Call to SDL_SetPixelFormatPalette()");
+
+  for (variation = 1; variation <= 4; variation++) {
+    for (i = 0; i < 256; i++) {
+      colors[i].r = SDLTest_RandomUint8();
+      colors[i].g = SDLTest_RandomUint8();
+      colors[i].b = SDLTest_RandomUint8();
+      colors[i].a = SDL_ALPHA_OPAQUE;
+    }
+    switch (variation) {
+      /* Clustered colors with duplicates, so ties must go to the lowest index */
+      case 2:
+        for (i = 0; i < 256; i++) {
+          colors[i].r = 96 + (colors[i].r & 0x1f);
+          colors[i].g = 96 + (colors[i].g & 0x1f);
+          colors[i].b &= 0xe0;
+        }
+        break;
+      /* A color key made one entry transparent */
+      case 3:
+        colors[SDLTest_RandomIntegerInRange(0, 255)].a = SDL_ALPHA_TRANSPARENT;
+        break;
+      /* Translucent, but all the same */
+      case 4:
+        for (i = 0; i < 256; i++) {
+          colors[i].a = 0x80;
+        }
+        break;
+    }
+    SDL_SetPaletteColors(palette, colors, 0, 256);
+    SDLTest_AssertPass("Call to SDL_SetPaletteColors() (variation %d)", variation);
+
+    mismatches = 0;
+    for (i = 0; i < 20000; i++) {
+      r = SDLTest_RandomUint8();
+      g = SDLTest_RandomUint8();
+      b = SDLTest_RandomUint8();
+      a = (i & 1) ? SDL_ALPHA_OPAQUE : SDLTest_RandomUint8();
+      result = (i & 1) ? SDL_MapRGB(format, r, g, b) : SDL_MapRGBA(format, r, g, b, a);
+      expected = _findColorLinear(palette, r, g, b, a);
+      if (result != expected) {
+        if (mismatches++ == 0) {
+          SDLTest_AssertCheck(result == expected, "Verify mapping of (%u,%u,%u,%u); expected: %u, got: %u", r, g, b, a, expected, result);
+        }
+      }
+    }
+    SDLTest_AssertCheck(mismatches == 0, "Verify all mapped colors match a full search (variation %d); mismatches: %d", variation, mismatches);
+
+    /* Change a single color after mapping, the next lookup must see it */
+    colors[0].r = 0x11;
+    colors[0].g = 0x22;
+    colors[0].b = 0x33;
+    SDL_SetPaletteColors(palette, colors, 0, 1);
+    result = SDL_MapRGBA(format, 0x11, 0x22, 0x33, colors[0].a);
+    SDLTest_AssertPass("Call to SDL_MapRGBA() after SDL_SetPaletteColors()");
+    SDLTest_AssertCheck(result == 0, "Verify changed color is found; expected: 0, got: %u", result);
+  }
+
+  /* The application may replace the colors, they are freed with the palette */
+  SDL_FreePalette(palette);
+  SDLTest_AssertPass("Call to SDL_FreePalette()");
+  palette = SDL_AllocPalette(256);
+  replaced = (SDL_Color *)SDL_malloc(256 * sizeof(SDL_Color));
+  SDLTest_AssertCheck(palette != NULL && replaced != NULL, "Verify palette and replacement colors were allocated");
+  if (palette == NULL || replaced == NULL) {
+    SDL_free(replaced);
+    SDL_FreePalette(palette);
+    SDL_FreeFormat(format);
+    return TEST_ABORTED;
+  }
+  SDL_memcpy(replaced, colors, sizeof(colors));
+  replaced[7].r = 0x44;
+  replaced[7].g = 0x55;
+  replaced[7].b = 0x66;
+  replaced[7].a = SDL_ALPHA_OPAQUE;
+  palette->colors = replaced;
+  SDL_SetPixelFormatPalette(format, palette);
+  result = SDL_MapRGB(format, 0x44, 0x55, 0x66);
+  SDLTest_AssertPass("Call to SDL_MapRGB() with replaced colors");
+  expected = _findColorLinear(palette, 0x44, 0x55, 0x66, SDL_ALPHA_OPAQUE);
+  SDLTest_AssertCheck(result == expected, "Verify mapping with replaced colors; expected: %u, got: %u", expected, result);
+
+  SDL_FreePalette(palette);
+  SDLTest_AssertPass("Call to SDL_FreePalette()");
+  SDL_FreeFormat(format);
+  SDLTest_AssertPass("Call to SDL_FreeFormat()");
+
+  return TEST_COMPLETED;
+}
+
 /**
  * @brief Call to SDL_CalculateGammaRamp
  *
@@ -511,9 +661,12 @@ static const SDLTest_TestCaseReference pixelsTest3 =
 static const SDLTest_TestCaseReference pixelsTest4 =
         { (SDLTest_TestCaseFp)pixels_getPixelFormatName, "pixels_getPixelFormatName", "Call to SDL_GetPixelFormatName", TEST_ENABLED };
 
+static const SDLTest_TestCaseReference pixelsTest5 =
+        { (SDLTest_TestCaseFp)pixels_mapPalette, "pixels_mapPalette", "Call to SDL_MapRGB and SDL_MapRGBA with an 8-bit palette", TEST_ENABLED };
+
 /* Sequence of Pixels test cases */
 static const SDLTest_TestCaseReference *pixelsTests[] =  {
-    &pixelsTest1, &pixelsTest2, &pixelsTest3, &pixelsTest4, NULL
+    &pixelsTest1, &pixelsTest2, &pixelsTest3, &pixelsTest4, &pixelsTest5, NULL
 };
 
 /* Pixels test suite (global) */
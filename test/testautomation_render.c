@@ -722,6 +722,103 @@ render_testBlitBlend (void *arg)
 }
 
 
+/**
+ * @brief Tests uploading the parts of a streaming texture marked dirty.
+ *
+ * \sa
+ * http://wiki.libsdl.org/moin.cgi/SDL_LockTexture
+ * http://wiki.libsdl.org/moin.cgi/SDL_MarkTextureDirty
+ * http://wiki.libsdl.org/moin.cgi/SDL_UnlockTexture
+ */
+int
+render_testMarkTextureDirty (void *arg)
+{
+   int ret;
+   SDL_Texture *texture;
+   SDL_Rect rect;
+   void *pixels;
+   int pitch;
+   int i, j;
+   static Uint32 readback[64 * 64];
+   int checkFailCount1;
+
+   texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888,
+                               SDL_TEXTUREACCESS_STREAMING, 64, 64);
+   SDLTest_AssertCheck(texture != NULL, "Verify SDL_CreateTexture() result");
+   if (texture == NULL) {
+       return TEST_ABORTED;
+   }
+
+   /* Marking needs the texture to be locked. */
+   ret = SDL_MarkTextureDirty(texture, NULL);
+   SDLTest_AssertCheck(ret == -1, "Validate result from SDL_MarkTextureDirty on unlocked texture, expected: -1, got: %i", ret);
+
+   /* Upload the whole texture in one color. */
+   ret = SDL_LockTexture(texture, NULL, &pixels, &pitch);
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_LockTexture, expected: 0, got: %i", ret);
+   if (ret != 0) {
+       SDL_DestroyTexture(texture);
+       return TEST_ABORTED;
+   }
+   for (j = 0; j < 64; j++) {
+      for (i = 0; i < 64; i++) {
+         ((Uint32 *)((Uint8 *)pixels + j * pitch))[i] = 0xFF0000FF;
+      }
+   }
+   ret = SDL_MarkTextureDirty(texture, NULL);
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_MarkTextureDirty, expected: 0, got: %i", ret);
+   SDL_UnlockTexture(texture);
+
+   /* Change a part of it, and mark it in two overlapping pieces. */
+   ret = SDL_LockTexture(texture, NULL, &pixels, &pitch);
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_LockTexture, expected: 0, got: %i", ret);
+   if (ret != 0) {
+       SDL_DestroyTexture(texture);
+       return TEST_ABORTED;
+   }
+   for (j = 10; j < 30; j++) {
+      for (i = 12; i < 40; i++) {
+         ((Uint32 *)((Uint8 *)pixels + j * pitch))[i] = 0xFFFF0000;
+      }
+   }
+   rect.x = 12;
+   rect.y = 10;
+   rect.w = 20;
+   rect.h = 20;
+   ret = SDL_MarkTextureDirty(texture, &rect);
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_MarkTextureDirty, expected: 0, got: %i", ret);
+   rect.x = 24;
+   rect.w = 16;
+   ret = SDL_MarkTextureDirty(texture, &rect);
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_MarkTextureDirty, expected: 0, got: %i", ret);
+   SDL_UnlockTexture(texture);
+
+   /* The marked area has the new color, the rest the old one. */
+   _clearScreen();
+   rect.x = 0;
+   rect.y = 0;
+   rect.w = 64;
+   rect.h = 64;
+   ret = SDL_RenderCopy(renderer, texture, NULL, &rect);
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderCopy, expected: 0, got: %i", ret);
+   ret = SDL_RenderReadPixels(renderer, &rect, SDL_PIXELFORMAT_ARGB8888, readback, 64 * sizeof(Uint32));
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderReadPixels, expected: 0, got: %i", ret);
+   checkFailCount1 = 0;
+   for (j = 0; j < 64; j++) {
+      for (i = 0; i < 64; i++) {
+         Uint32 expected = (j >= 10 && j < 30 && i >= 12 && i < 40) ? 0xFFFF0000 : 0xFF0000FF;
+         if (readback[j * 64 + i] != expected) checkFailCount1++;
+      }
+   }
+   SDLTest_AssertCheck(checkFailCount1 == 0, "Validate rendered texture pixels, expected: 0 mismatches, got: %i", checkFailCount1);
+
+   /* Clean up. */
+   SDL_DestroyTexture(texture);
+
+   return TEST_COMPLETED;
+}
+
+
 /**
  * @brief Checks to see if functionality is supported. Helper function.
  */
@@ -1037,9 +1134,12 @@ static const SDLTest_TestCaseReference renderTest6 =
 static const SDLTest_TestCaseReference renderTest7 =
         {  (SDLTest_TestCaseFp)render_testBlitBlend, "render_testBlitBlend", "Tests blitting with blending", TEST_DISABLED };
 
+static const SDLTest_TestCaseReference renderTest8 =
+        { (SDLTest_TestCaseFp)render_testMarkTextureDirty, "render_testMarkTextureDirty", "Tests uploading the parts of a texture marked dirty", TEST_ENABLED };
+
 /* Sequence of Render test cases */
 static const SDLTest_TestCaseReference *renderTests[] =  {
-    &renderTest1, &renderTest2, &renderTest3, &renderTest4, &renderTest5, &renderTest6, &renderTest7, NULL
+    &renderTest1, &renderTest2, &renderTest3, &renderTest4, &renderTest5, &renderTest6, &renderTest7, &renderTest8, NULL
 };
 
 /* Render test suite (global) */
@@ -581,6 +581,2168 @@ surface_testBlitBlendLoop(void *arg) {
 
 }
 
+/* Helper that creates a surface of the given pixel format */
+static SDL_Surface *
+_createSurfaceWithFormat(int w, int h, Uint32 format)
+{
+    int bpp;
+    Uint32 rmask, gmask, bmask, amask;
+
+    if (!SDL_PixelFormatEnumToMasks(format, &bpp, &rmask, &gmask, &bmask, &amask)) {
+        return NULL;
+    }
+    return SDL_CreateRGBSurface(0, w, h, bpp, rmask, gmask, bmask, amask);
+}
+
+/* Per-pixel reference for surface_testBlitGeneratedBlitters, mirrors the scalar code generated by sdlgenblit.pl */
+static Uint32
+_referenceBlitPixel(Uint32 srcpixel, SDL_PixelFormat *srcfmt, Uint32 dstpixel, SDL_PixelFormat *dstfmt,
+                    SDL_BlendMode mode, Uint8 modR, Uint8 modG, Uint8 modB, Uint8 modA)
+{
+    Uint8 r8, g8, b8, a8;
+    Uint32 sR, sG, sB, sA, dR, dG, dB, dA;
+
+    SDL_GetRGBA(srcpixel, srcfmt, &r8, &g8, &b8, &a8);
+    sR = (r8 * modR) / 255;
+    sG = (g8 * modG) / 255;
+    sB = (b8 * modB) / 255;
+    sA = (a8 * modA) / 255;
+    if (mode == SDL_BLENDMODE_NONE) {
+        return SDL_MapRGBA(dstfmt, (Uint8)sR, (Uint8)sG, (Uint8)sB, (Uint8)sA);
+    }
+
+    SDL_GetRGBA(dstpixel, dstfmt, &r8, &g8, &b8, &a8);
+    dR = r8;
+    dG = g8;
+    dB = b8;
+    dA = a8;
+    if (mode == SDL_BLENDMODE_BLEND || mode == SDL_BLENDMODE_ADD) {
+        sR = (sR * sA) / 255;
+        sG = (sG * sA) / 255;
+        sB = (sB * sA) / 255;
+    }
+    switch (mode) {
+    case SDL_BLENDMODE_BLEND:
+        dR = sR + ((255 - sA) * dR) / 255;
+        dG = sG + ((255 - sA) * dG) / 255;
+        dB = sB + ((255 - sA) * dB) / 255;
+        dA = sA + ((255 - sA) * dA) / 255;
+        break;
+    case SDL_BLENDMODE_ADD:
+        dR = SDL_min(sR + dR, 255);
+        dG = SDL_min(sG + dG, 255);
+        dB = SDL_min(sB + dB, 255);
+        break;
+    case SDL_BLENDMODE_MOD:
+        dR = (sR * dR) / 255;
+        dG = (sG * dG) / 255;
+        dB = (sB * dB) / 255;
+        break;
+    default:
+        break;
+    }
+    return SDL_MapRGBA(dstfmt, (Uint8)dR, (Uint8)dG, (Uint8)dB, (Uint8)dA);
+}
+
+/**
+ * @brief Checks the (possibly vectorized) generated blitters against a scalar reference.
+ */
+int
+surface_testBlitGeneratedBlitters(void *arg)
+{
+    const Uint32 srcFormats[] = {
+        SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888,
+        SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGRA8888
+    };
+    const Uint32 dstFormats[] = {
+        SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888
+    };
+    const SDL_BlendMode modes[] = {
+        SDL_BLENDMODE_NONE, SDL_BLENDMODE_BLEND, SDL_BLENDMODE_ADD, SDL_BLENDMODE_MOD
+    };
+    const int srcW = 37, srcH = 5;
+    int i, j, k, scaled, x, y;
+    int ret;
+
+    for (i = 0; i < SDL_arraysize(srcFormats); i++) {
+      for (j = 0; j < SDL_arraysize(dstFormats); j++) {
+        for (k = 0; k < SDL_arraysize(modes); k++) {
+          for (scaled = 0; scaled <= 1; scaled++) {
+            const int dstW = scaled ? 53 : srcW;
+            const int dstH = scaled ? 3 : srcH;
+            const Uint8 modR = SDLTest_RandomIntegerInRange(0, 254);
+            const Uint8 modG = SDLTest_RandomUint8();
+            const Uint8 modB = SDLTest_RandomUint8();
+            const Uint8 modA = SDLTest_RandomUint8();
+            SDL_Surface *src, *dst, *orig;
+            int mismatches = 0;
+
+            src = _createSurfaceWithFormat(srcW, srcH, srcFormats[i]);
+            dst = _createSurfaceWithFormat(dstW, dstH, dstFormats[j]);
+            orig = _createSurfaceWithFormat(dstW, dstH, dstFormats[j]);
+            SDLTest_AssertCheck(src != NULL && dst != NULL && orig != NULL, "Verify test surfaces are not NULL");
+            if (src == NULL || dst == NULL || orig == NULL) {
+                SDL_FreeSurface(src);
+                SDL_FreeSurface(dst);
+                SDL_FreeSurface(orig);
+                return TEST_ABORTED;
+            }
+
+            for (y = 0; y < srcH; y++) {
+                for (x = 0; x < srcW; x++) {
+                    ((Uint32 *)((Uint8 *)src->pixels + y * src->pitch))[x] = SDLTest_RandomUint32();
+                }
+            }
+            for (y = 0; y < dstH; y++) {
+                for (x = 0; x < dstW; x++) {
+                    ((Uint32 *)((Uint8 *)dst->pixels + y * dst->pitch))[x] = SDLTest_RandomUint32();
+                }
+            }
+            SDL_memcpy(orig->pixels, dst->pixels, dst->h * dst->pitch);
+
+            /* Color modulation keeps the blit off the hand-written SDL_blit_A/N paths */
+            SDL_SetSurfaceColorMod(src, modR, modG, modB);
+            SDL_SetSurfaceAlphaMod(src, modA);
+            SDL_SetSurfaceBlendMode(src, modes[k]);
+
+            if (scaled) {
+                ret = SDL_BlitScaled(src, NULL, dst, NULL);
+            } else {
+                ret = SDL_BlitSurface(src, NULL, dst, NULL);
+            }
+            SDLTest_AssertCheck(ret == 0, "Verify result from blit, expected: 0, got: %i", ret);
+
+            for (y = 0; y < dstH; y++) {
+                const int sy = (int)(((Sint64)y * ((srcH << 16) / dstH)) >> 16);
+                for (x = 0; x < dstW; x++) {
+                    const int sx = (int)(((Sint64)x * ((srcW << 16) / dstW)) >> 16);
+                    Uint32 srcpixel = ((Uint32 *)((Uint8 *)src->pixels + sy * src->pitch))[sx];
+                    Uint32 origpixel = ((Uint32 *)((Uint8 *)orig->pixels + y * orig->pitch))[x];
+                    Uint32 actual = ((Uint32 *)((Uint8 *)dst->pixels + y * dst->pitch))[x];
+                    Uint32 expected = _referenceBlitPixel(srcpixel, src->format, origpixel, dst->format,
+                                                          modes[k], modR, modG, modB, modA);
+                    if (actual != expected) {
+                        mismatches++;
+                    }
+                }
+            }
+            SDLTest_AssertCheck(mismatches == 0, "Verify %s => %s, blend mode %i, scaled %i matches reference; mismatches: %i",
+                                SDL_GetPixelFormatName(srcFormats[i]), SDL_GetPixelFormatName(dstFormats[j]),
+                                modes[k], scaled, mismatches);
+
+            SDL_FreeSurface(src);
+            SDL_FreeSurface(dst);
+            SDL_FreeSurface(orig);
+          }
+        }
+      }
+    }
+
+    return TEST_COMPLETED;
+}
+
+/* Per-pixel reference for surface_testBlitAlphaBlitters, mirrors the scalar blitters in SDL_blit_A.c */
+static Uint32
+_referenceAlphaBlitPixel(Uint32 srcpixel, SDL_PixelFormat *srcfmt, Uint32 dstpixel, SDL_PixelFormat *dstfmt, int alpha)
+{
+    Uint32 result = 0;
+    Uint32 a, s, d;
+    int i;
+
+    if (dstfmt->BytesPerPixel == 4) {
+        if (alpha < 0) {
+            /* ARGB8888 per-pixel alpha: exact for transparent and opaque pixels */
+            a = srcpixel >> 24;
+            if (a == 0) {
+                return dstpixel;
+            } else if (a == 255) {
+                return srcpixel;
+            }
+            for (i = 0; i < 24; i += 8) {
+                s = (srcpixel >> i) & 0xff;
+                d = (dstpixel >> i) & 0xff;
+                result |= ((s * a + d * (256 - a)) >> 8) << i;
+            }
+            return result | ((a + (((dstpixel >> 24) * (255 - a)) >> 8)) << 24);
+        }
+        for (i = 0; i < 24; i += 8) {
+            s = (srcpixel >> i) & 0xff;
+            d = (dstpixel >> i) & 0xff;
+            result |= ((s * alpha + d * (256 - alpha)) >> 8) << i;
+        }
+        return result | 0xff000000;
+    } else {
+        /* RGB565/RGB555 fields are blended with a 5-bit alpha */
+        const int rshift = (dstfmt->Gmask == 0x7e0) ? 11 : 10;
+        const Uint32 gmask = dstfmt->Gmask >> 5;
+        Uint32 sR, sG, sB;
+
+        if (alpha < 0) {
+            a = srcpixel >> 27;
+            if (a == 0) {
+                return dstpixel;
+            }
+            sR = (srcpixel >> 19) & 0x1f;
+            sG = (srcpixel >> ((gmask == 0x3f) ? 10 : 11)) & gmask;
+            sB = (srcpixel >> 3) & 0x1f;
+            if (a == 31) {
+                return (sR << rshift) | (sG << 5) | sB;
+            }
+        } else {
+            a = alpha >> 3;
+            sR = (srcpixel >> rshift) & 0x1f;
+            sG = (srcpixel >> 5) & gmask;
+            sB = srcpixel & 0x1f;
+        }
+        result |= ((sR * a + ((dstpixel >> rshift) & 0x1f) * (32 - a)) >> 5) << rshift;
+        result |= ((sG * a + ((dstpixel >> 5) & gmask) * (32 - a)) >> 5) << 5;
+        result |= (sB * a + (dstpixel & 0x1f) * (32 - a)) >> 5;
+        return result;
+    }
+}
+
+static Uint32
+_getSurfacePixel(SDL_Surface *surface, int x, int y)
+{
+    Uint8 *row = (Uint8 *)surface->pixels + y * surface->pitch;
+    if (surface->format->BytesPerPixel == 2) {
+        return ((Uint16 *)row)[x];
+    }
+    if (surface->format->BytesPerPixel == 3) {
+        /* Same byte order as the blitters use for 24-bit pixels */
+        row += x * 3;
+        if (SDL_BYTEORDER == SDL_LIL_ENDIAN) {
+            return row[0] | (row[1] << 8) | (row[2] << 16);
+        }
+        return (row[0] << 16) | (row[1] << 8) | row[2];
+    }
+    return ((Uint32 *)row)[x];
+}
+
+static void
+_setSurfacePixel(SDL_Surface *surface, int x, int y, Uint32 pixel)
+{
+    Uint8 *row = (Uint8 *)surface->pixels + y * surface->pitch;
+    if (surface->format->BytesPerPixel == 2) {
+        ((Uint16 *)row)[x] = (Uint16)pixel;
+    } else {
+        ((Uint32 *)row)[x] = pixel;
+    }
+}
+
+/**
+ * @brief Checks the (possibly vectorized) per-pixel and per-surface alpha blitters against a scalar reference.
+ */
+int
+surface_testBlitAlphaBlitters(void *arg)
+{
+    const struct {
+        Uint32 srcFormat;
+        Uint32 dstFormat;
+        SDL_bool surfaceAlpha;
+    } cases[] = {
+        { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, SDL_FALSE },
+        { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, SDL_FALSE },
+        { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ABGR8888, SDL_FALSE },
+        { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB565, SDL_FALSE },
+        { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB555, SDL_FALSE },
+        { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR565, SDL_FALSE },
+        { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, SDL_TRUE },
+        { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, SDL_TRUE },
+        { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, SDL_TRUE },
+        { SDL_PIXELFORMAT_RGB565, SDL_PIXELFORMAT_RGB565, SDL_TRUE },
+        { SDL_PIXELFORMAT_RGB555, SDL_PIXELFORMAT_RGB555, SDL_TRUE }
+    };
+    const int alphas[] = { 1, 64, 127, 128, 129, 254, -1 };
+    const int w = 37, h = 5;
+    int i, j, x, y;
+    int ret;
+
+    for (i = 0; i < SDL_arraysize(cases); i++) {
+        const int numAlphas = cases[i].surfaceAlpha ? SDL_arraysize(alphas) : 1;
+        for (j = 0; j < numAlphas; j++) {
+            int alpha = -1;
+            SDL_Surface *src, *dst, *orig;
+            Uint32 mask;
+            int mismatches = 0;
+
+            if (cases[i].surfaceAlpha) {
+                alpha = alphas[j] < 0 ? SDLTest_RandomIntegerInRange(1, 254) : alphas[j];
+            }
+
+            src = _createSurfaceWithFormat(w, h, cases[i].srcFormat);
+            dst = _createSurfaceWithFormat(w, h, cases[i].dstFormat);
+            orig = _createSurfaceWithFormat(w, h, cases[i].dstFormat);
+            SDLTest_AssertCheck(src != NULL && dst != NULL && orig != NULL, "Verify test surfaces are not NULL");
+            if (src == NULL || dst == NULL || orig == NULL) {
+                SDL_FreeSurface(src);
+                SDL_FreeSurface(dst);
+                SDL_FreeSurface(orig);
+                return TEST_ABORTED;
+            }
+
+            /* Keep the unused top bit of 16-bit pixels clear; the 50% special case carries into it */
+            mask = (src->format->BytesPerPixel == 2) ? 0x7fff : 0xffffffff;
+            for (y = 0; y < h; y++) {
+                for (x = 0; x < w; x++) {
+                    Uint32 pixel = SDLTest_RandomUint32();
+                    /* Make sure the transparent and opaque special cases are hit */
+                    switch (SDLTest_RandomIntegerInRange(0, 3)) {
+                    case 0:
+                        pixel &= 0x00ffffff;
+                        break;
+                    case 1:
+                        pixel |= 0xff000000;
+                        break;
+                    default:
+                        break;
+                    }
+                    _setSurfacePixel(src, x, y, pixel & mask);
+                }
+            }
+            mask = (dst->format->BytesPerPixel == 2) ? 0x7fff : 0xffffffff;
+            for (y = 0; y < h; y++) {
+                for (x = 0; x < w; x++) {
+                    _setSurfacePixel(dst, x, y, SDLTest_RandomUint32() & mask);
+                }
+            }
+            SDL_memcpy(orig->pixels, dst->pixels, dst->h * dst->pitch);
+
+            SDL_SetSurfaceBlendMode(src, SDL_BLENDMODE_BLEND);
+            if (cases[i].surfaceAlpha) {
+                SDL_SetSurfaceAlphaMod(src, (Uint8)alpha);
+            }
+            ret = SDL_BlitSurface(src, NULL, dst, NULL);
+            SDLTest_AssertCheck(ret == 0, "Verify result from blit, expected: 0, got: %i", ret);
+
+            for (y = 0; y < h; y++) {
+                for (x = 0; x < w; x++) {
+                    Uint32 expected = _referenceAlphaBlitPixel(_getSurfacePixel(src, x, y), src->format,
+                                                               _getSurfacePixel(orig, x, y), dst->format, alpha);
+                    if (_getSurfacePixel(dst, x, y) != expected) {
+                        mismatches++;
+                    }
+                }
+            }
+            SDLTest_AssertCheck(mismatches == 0, "Verify %s => %s, surface alpha %i matches reference; mismatches: %i",
+                                SDL_GetPixelFormatName(cases[i].srcFormat), SDL_GetPixelFormatName(cases[i].dstFormat),
+                                alpha, mismatches);
+
+            SDL_FreeSurface(src);
+            SDL_FreeSurface(dst);
+            SDL_FreeSurface(orig);
+        }
+    }
+
+    return TEST_COMPLETED;
+}
+
+/* Maps a destination pixel onto its two source samples like SDL_SoftStretchLinear, weights have 7 bits */
+static void
+_referenceLinearSample(int srcLen, int dstLen, int i, int *p0, int *p1, int *frac)
+{
+    const int inc = (srcLen << 16) / dstLen;
+    const int pos = (inc >> 1) - 0x8000 + i * inc;
+
+    if (pos <= 0) {
+        *p0 = *p1 = 0;
+        *frac = 0;
+    } else if ((pos >> 16) >= srcLen - 1) {
+        *p0 = *p1 = srcLen - 1;
+        *frac = 0;
+    } else {
+        *p0 = pos >> 16;
+        *p1 = *p0 + 1;
+        *frac = (pos >> 9) & 127;
+    }
+}
+
+/* Bilinear reference for surface_testBlitScaledLinear, interpolates each channel of a packed pixel */
+static Uint32
+_referenceLinearPixel(SDL_Surface *src, int dstW, int dstH, int x, int y)
+{
+    const Uint32 masks[4] = { src->format->Rmask, src->format->Gmask, src->format->Bmask, src->format->Amask };
+    const Uint8 shifts[4] = { src->format->Rshift, src->format->Gshift, src->format->Bshift, src->format->Ashift };
+    int x0, x1, fx, y0, y1, fy, c;
+    Uint32 p00, p01, p10, p11, result = 0;
+
+    _referenceLinearSample(src->w, dstW, x, &x0, &x1, &fx);
+    _referenceLinearSample(src->h, dstH, y, &y0, &y1, &fy);
+    p00 = _getSurfacePixel(src, x0, y0);
+    p01 = _getSurfacePixel(src, x1, y0);
+    p10 = _getSurfacePixel(src, x0, y1);
+    p11 = _getSurfacePixel(src, x1, y1);
+    for (c = 0; c < 4; c++) {
+        Uint32 h0 = ((p00 & masks[c]) >> shifts[c]) * (128 - fx) + ((p01 & masks[c]) >> shifts[c]) * fx;
+        Uint32 h1 = ((p10 & masks[c]) >> shifts[c]) * (128 - fx) + ((p11 & masks[c]) >> shifts[c]) * fx;
+        result |= ((h0 * (128 - fy) + h1 * fy + 8192) >> 14) << shifts[c];
+    }
+    return result;
+}
+
+/**
+ * @brief Checks that the software renderer scales with bilinear filtering when asked to.
+ */
+int
+surface_testBlitScaledLinear(void *arg)
+{
+    const Uint32 formats[] = { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB565 };
+    const struct { int srcW, srcH, dstW, dstH; } sizes[] = {
+        { 7, 5, 17, 11 }, { 23, 13, 9, 6 }, { 31, 4, 31, 4 }, { 1, 3, 5, 8 }
+    };
+    const char *oldHint = SDL_GetHint(SDL_HINT_RENDER_SCALE_QUALITY);
+    char *savedHint = oldHint ? SDL_strdup(oldHint) : NULL;
+    int i, j, x, y;
+    int ret;
+
+    SDL_SetHint(SDL_HINT_RENDER_SCALE_QUALITY, "linear");
+
+    for (i = 0; i < SDL_arraysize(formats); i++) {
+        for (j = 0; j < SDL_arraysize(sizes); j++) {
+            SDL_Surface *src, *dst, *filtered, *expected;
+            SDL_Renderer *renderer;
+            SDL_Texture *texture;
+            SDL_Rect dstrect;
+            Uint32 mask;
+            int mismatches = 0;
+
+            src = _createSurfaceWithFormat(sizes[j].srcW, sizes[j].srcH, formats[i]);
+            dst = _createSurfaceWithFormat(sizes[j].dstW + 4, sizes[j].dstH + 4, formats[i]);
+            SDLTest_AssertCheck(src != NULL && dst != NULL, "Verify test surfaces are not NULL");
+            if (src == NULL || dst == NULL) {
+                SDL_FreeSurface(src);
+                SDL_FreeSurface(dst);
+                return TEST_ABORTED;
+            }
+            mask = (src->format->BytesPerPixel == 2) ? 0xffff : 0xffffffff;
+            for (y = 0; y < src->h; y++) {
+                for (x = 0; x < src->w; x++) {
+                    _setSurfacePixel(src, x, y, SDLTest_RandomUint32() & mask);
+                }
+            }
+
+            renderer = SDL_CreateSoftwareRenderer(dst);
+            SDLTest_AssertCheck(renderer != NULL, "Verify software renderer is not NULL");
+            if (renderer == NULL) {
+                SDL_FreeSurface(src);
+                SDL_FreeSurface(dst);
+                return TEST_ABORTED;
+            }
+            texture = SDL_CreateTexture(renderer, formats[i], SDL_TEXTUREACCESS_STATIC, src->w, src->h);
+            SDLTest_AssertCheck(texture != NULL, "Verify texture is not NULL");
+            if (texture != NULL) {
+                SDL_UpdateTexture(texture, NULL, src->pixels, src->pitch);
+                SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_NONE);
+                dstrect.x = 2;
+                dstrect.y = 2;
+                dstrect.w = sizes[j].dstW;
+                dstrect.h = sizes[j].dstH;
+                ret = SDL_RenderCopy(renderer, texture, NULL, &dstrect);
+                SDLTest_AssertCheck(ret == 0, "Verify result from SDL_RenderCopy, expected: 0, got: %i", ret);
+
+                for (y = 0; y < dstrect.h; y++) {
+                    for (x = 0; x < dstrect.w; x++) {
+                        if (_getSurfacePixel(dst, dstrect.x + x, dstrect.y + y) !=
+                            _referenceLinearPixel(src, dstrect.w, dstrect.h, x, y)) {
+                            mismatches++;
+                        }
+                    }
+                }
+                SDLTest_AssertCheck(mismatches == 0, "Verify %s %ix%i => %ix%i matches bilinear reference; mismatches: %i",
+                                    SDL_GetPixelFormatName(formats[i]), sizes[j].srcW, sizes[j].srcH,
+                                    sizes[j].dstW, sizes[j].dstH, mismatches);
+
+                /* Blended and modulated copies blit the filtered pixels the way the texture would be blitted */
+                filtered = _createSurfaceWithFormat(dstrect.w, dstrect.h, formats[i]);
+                expected = _createSurfaceWithFormat(dst->w, dst->h, formats[i]);
+                SDLTest_AssertCheck(filtered != NULL && expected != NULL, "Verify reference surfaces are not NULL");
+                if (filtered != NULL && expected != NULL) {
+                    SDL_SetSurfaceBlendMode(dst, SDL_BLENDMODE_NONE);
+                    SDL_BlitSurface(dst, &dstrect, filtered, NULL);
+                    SDL_SetSurfaceBlendMode(filtered, SDL_BLENDMODE_BLEND);
+                    SDL_SetSurfaceColorMod(filtered, 200, 120, 60);
+                    SDL_SetSurfaceAlphaMod(filtered, 160);
+                    SDL_FillRect(expected, NULL, 0x5a3c96 & mask);
+                    SDL_BlitSurface(filtered, NULL, expected, &dstrect);
+
+                    SDL_FillRect(dst, NULL, 0x5a3c96 & mask);
+                    SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+                    SDL_SetTextureColorMod(texture, 200, 120, 60);
+                    SDL_SetTextureAlphaMod(texture, 160);
+                    ret = SDL_RenderCopy(renderer, texture, NULL, &dstrect);
+                    SDLTest_AssertCheck(ret == 0, "Verify result from SDL_RenderCopy, expected: 0, got: %i", ret);
+
+                    mismatches = 0;
+                    for (y = 0; y < dst->h; y++) {
+                        for (x = 0; x < dst->w; x++) {
+                            if (_getSurfacePixel(dst, x, y) != _getSurfacePixel(expected, x, y)) {
+                                mismatches++;
+                            }
+                        }
+                    }
+                    SDLTest_AssertCheck(mismatches == 0, "Verify blended %s %ix%i => %ix%i matches blitting the filtered pixels; mismatches: %i",
+                                        SDL_GetPixelFormatName(formats[i]), sizes[j].srcW, sizes[j].srcH,
+                                        sizes[j].dstW, sizes[j].dstH, mismatches);
+                }
+                SDL_FreeSurface(filtered);
+                SDL_FreeSurface(expected);
+                SDL_DestroyTexture(texture);
+            }
+
+            SDL_DestroyRenderer(renderer);
+            SDL_FreeSurface(src);
+            SDL_FreeSurface(dst);
+        }
+    }
+
+    SDL_SetHint(SDL_HINT_RENDER_SCALE_QUALITY, savedHint ? savedHint : "0");
+    SDL_free(savedHint);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * @brief Tests that converting large images on several threads matches single threaded conversion.
+ *
+ * @sa http://wiki.libsdl.org/moin.cgi/SDL_ConvertPixels
+ * @sa http://wiki.libsdl.org/moin.cgi/SDL_ConvertSurface
+ */
+int
+surface_testThreadedConversion(void *arg)
+{
+    const struct { Uint32 src, dst; } pairs[] = {
+        { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ABGR8888 },
+        { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB565 },
+        { SDL_PIXELFORMAT_RGB565, SDL_PIXELFORMAT_ARGB8888 },
+        { SDL_PIXELFORMAT_RGB24, SDL_PIXELFORMAT_BGRA8888 },
+        { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB24 }
+    };
+    const int w = 1024, h = 301;
+    const char *oldHint = SDL_GetHint(SDL_HINT_SOFTWARE_THREADS);
+    char *savedHint = oldHint ? SDL_strdup(oldHint) : NULL;
+    int i, y, ret;
+
+    for (i = 0; i < SDL_arraysize(pairs); i++) {
+        SDL_Surface *src = _createSurfaceWithFormat(w, h, pairs[i].src);
+        SDL_Surface *single = _createSurfaceWithFormat(w, h, pairs[i].dst);
+        SDL_Surface *threaded = _createSurfaceWithFormat(w, h, pairs[i].dst);
+        SDL_Surface *convertedSingle, *convertedThreaded;
+        int mismatches = 0;
+
+        SDLTest_AssertCheck(src && single && threaded, "Verify surfaces were created");
+        if (!src || !single || !threaded) {
+            SDL_FreeSurface(src);
+            SDL_FreeSurface(single);
+            SDL_FreeSurface(threaded);
+            continue;
+        }
+        for (y = 0; y < h * src->pitch; y++) {
+            ((Uint8 *)src->pixels)[y] = SDLTest_RandomUint8();
+        }
+
+        SDL_SetHint(SDL_HINT_SOFTWARE_THREADS, "1");
+        ret = SDL_ConvertPixels(w, h, pairs[i].src, src->pixels, src->pitch,
+                                pairs[i].dst, single->pixels, single->pitch);
+        SDLTest_AssertCheck(ret == 0, "Verify single threaded SDL_ConvertPixels result, expected: 0, got: %i", ret);
+        convertedSingle = SDL_ConvertSurface(src, single->format, 0);
+
+        SDL_SetHint(SDL_HINT_SOFTWARE_THREADS, "4");
+        ret = SDL_ConvertPixels(w, h, pairs[i].src, src->pixels, src->pitch,
+                                pairs[i].dst, threaded->pixels, threaded->pitch);
+        SDLTest_AssertCheck(ret == 0, "Verify threaded SDL_ConvertPixels result, expected: 0, got: %i", ret);
+        convertedThreaded = SDL_ConvertSurface(src, threaded->format, 0);
+
+        SDLTest_AssertCheck(convertedSingle && convertedThreaded, "Verify SDL_ConvertSurface results are not NULL");
+        for (y = 0; y < h; y++) {
+            const int len = w * single->format->BytesPerPixel;
+            if (SDL_memcmp((Uint8 *)single->pixels + y * single->pitch,
+                           (Uint8 *)threaded->pixels + y * threaded->pitch, len) != 0) {
+                mismatches++;
+            }
+            if (convertedSingle && convertedThreaded &&
+                SDL_memcmp((Uint8 *)convertedSingle->pixels + y * convertedSingle->pitch,
+                           (Uint8 *)convertedThreaded->pixels + y * convertedThreaded->pitch, len) != 0) {
+                mismatches++;
+            }
+        }
+        SDLTest_AssertCheck(mismatches == 0, "Verify %s => %s threaded conversion matches; mismatched rows: %i",
+                            SDL_GetPixelFormatName(pairs[i].src), SDL_GetPixelFormatName(pairs[i].dst), mismatches);
+
+        SDL_FreeSurface(convertedSingle);
+        SDL_FreeSurface(convertedThreaded);
+        SDL_FreeSurface(src);
+        SDL_FreeSurface(single);
+        SDL_FreeSurface(threaded);
+    }
+
+    SDL_SetHint(SDL_HINT_SOFTWARE_THREADS, savedHint ? savedHint : "1");
+    SDL_free(savedHint);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * @brief Checks the (possibly vectorized) 8-bit and 1-bit palette expansion blitters against a per-pixel reference.
+ */
+int
+surface_testBlitIndexedExpansion(void *arg)
+{
+    const Uint32 srcFormats[] = { SDL_PIXELFORMAT_INDEX8, SDL_PIXELFORMAT_INDEX1MSB };
+    const Uint32 dstFormats[] = { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB565 };
+    const int widths[] = { 1, 7, 8, 15, 16, 17, 40, 67 };
+    const int h = 3;
+    int i, j, k, key, x, y;
+
+    for (i = 0; i < SDL_arraysize(srcFormats); i++) {
+        for (j = 0; j < SDL_arraysize(dstFormats); j++) {
+            for (k = 0; k < SDL_arraysize(widths); k++) {
+                for (key = 0; key < 2; key++) {
+                    const int w = widths[k];
+                    const int srcX = (srcFormats[i] == SDL_PIXELFORMAT_INDEX8) ? 3 : 0;
+                    SDL_Surface *src = _createSurfaceWithFormat(w + srcX, h, srcFormats[i]);
+                    SDL_Surface *dst = _createSurfaceWithFormat(w + 2, h, dstFormats[j]);
+                    SDL_Surface *orig = _createSurfaceWithFormat(w + 2, h, dstFormats[j]);
+                    SDL_Rect srcRect, dstRect;
+                    Uint32 colorKey = 0;
+                    int mismatches = 0;
+                    int ret;
+
+                    SDLTest_AssertCheck(src != NULL && dst != NULL && orig != NULL, "Verify surfaces were created");
+                    if (src == NULL || dst == NULL || orig == NULL) {
+                        SDL_FreeSurface(src);
+                        SDL_FreeSurface(dst);
+                        SDL_FreeSurface(orig);
+                        continue;
+                    }
+
+                    for (x = 0; x < src->format->palette->ncolors; x++) {
+                        src->format->palette->colors[x].r = SDLTest_RandomUint8();
+                        src->format->palette->colors[x].g = SDLTest_RandomUint8();
+                        src->format->palette->colors[x].b = SDLTest_RandomUint8();
+                        src->format->palette->colors[x].a = 255;
+                    }
+                    for (y = 0; y < h * src->pitch; y++) {
+                        ((Uint8 *)src->pixels)[y] = SDLTest_RandomUint8();
+                    }
+                    if (srcFormats[i] == SDL_PIXELFORMAT_INDEX8) {
+                        /* Make runs of colorkey pixels, so whole groups get skipped too */
+                        colorKey = 5;
+                        for (y = 0; y < h * src->pitch; y++) {
+                            if ((y / 16) % 3 == 1 || (((Uint8 *)src->pixels)[y] & 3) == 0) {
+                                ((Uint8 *)src->pixels)[y] = (Uint8)colorKey;
+                            }
+                        }
+                    } else {
+                        colorKey = 1;
+                    }
+                    if (key) {
+                        SDL_SetColorKey(src, SDL_TRUE, colorKey);
+                    }
+                    for (y = 0; y < h * dst->pitch; y++) {
+                        ((Uint8 *)dst->pixels)[y] = SDLTest_RandomUint8();
+                    }
+                    SDL_memcpy(orig->pixels, dst->pixels, h * dst->pitch);
+
+                    srcRect.x = srcX;
+                    srcRect.y = 0;
+                    srcRect.w = w;
+                    srcRect.h = h;
+                    dstRect.x = 2;
+                    dstRect.y = 0;
+                    ret = SDL_BlitSurface(src, &srcRect, dst, &dstRect);
+                    SDLTest_AssertCheck(ret == 0, "Verify result from SDL_BlitSurface, expected: 0, got: %i", ret);
+
+                    for (y = 0; y < h; y++) {
+                        for (x = 0; x < w + 2; x++) {
+                            const Uint8 *row = (const Uint8 *)src->pixels + y * src->pitch;
+                            Uint32 expected, index;
+                            SDL_Color color;
+
+                            if (x < 2) {
+                                /* Pixels left of the destination rectangle are never touched */
+                                expected = _getSurfacePixel(orig, x, y);
+                            } else {
+                                if (srcFormats[i] == SDL_PIXELFORMAT_INDEX8) {
+                                    index = row[srcX + x - 2];
+                                } else {
+                                    index = (row[(x - 2) / 8] >> (7 - ((x - 2) & 7))) & 1;
+                                }
+                                if (key && index == colorKey) {
+                                    expected = _getSurfacePixel(orig, x, y);
+                                } else {
+                                    color = src->format->palette->colors[index];
+                                    expected = SDL_MapRGBA(dst->format, color.r, color.g, color.b, color.a);
+                                }
+                            }
+                            if (_getSurfacePixel(dst, x, y) != expected) {
+                                mismatches++;
+                            }
+                        }
+                    }
+                    SDLTest_AssertCheck(mismatches == 0, "Verify %s => %s width %i%s matches reference; mismatches: %i",
+                                        SDL_GetPixelFormatName(srcFormats[i]), SDL_GetPixelFormatName(dstFormats[j]),
+                                        w, key ? " with colorkey" : "", mismatches);
+
+                    SDL_FreeSurface(src);
+                    SDL_FreeSurface(dst);
+                    SDL_FreeSurface(orig);
+                }
+            }
+        }
+    }
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * @brief Checks the (possibly vectorized) blitters between 24 and 32-bit formats, with and without colorkey, against a per-pixel reference.
+ */
+int
+surface_testBlitByteFormats(void *arg)
+{
+    const Uint32 formats[] = {
+        SDL_PIXELFORMAT_RGB24, SDL_PIXELFORMAT_BGR24, SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888,
+        SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGRA8888
+    };
+    const int widths[] = { 1, 3, 4, 5, 16, 17, 38 };
+    const int h = 2;
+    int i, j, k, key, x, y;
+
+    for (i = 0; i < SDL_arraysize(formats); i++) {
+        for (j = 0; j < SDL_arraysize(formats); j++) {
+            for (key = 0; key < 2; key++) {
+                int mismatches = 0;
+
+                for (k = 0; k < SDL_arraysize(widths); k++) {
+                    const int w = widths[k];
+                    SDL_Surface *src = _createSurfaceWithFormat(w + 3, h, formats[i]);
+                    SDL_Surface *dst = _createSurfaceWithFormat(w + 2, h, formats[j]);
+                    SDL_Surface *orig = _createSurfaceWithFormat(w + 2, h, formats[j]);
+                    const int bpp = src ? src->format->BytesPerPixel : 0;
+                    SDL_Rect srcRect, dstRect;
+                    Uint32 colorKey, rgbMask;
+                    int ret;
+
+                    SDLTest_AssertCheck(src != NULL && dst != NULL && orig != NULL, "Verify surfaces were created");
+                    if (src == NULL || dst == NULL || orig == NULL) {
+                        SDL_FreeSurface(src);
+                        SDL_FreeSurface(dst);
+                        SDL_FreeSurface(orig);
+                        continue;
+                    }
+
+                    for (y = 0; y < h * src->pitch; y++) {
+                        ((Uint8 *)src->pixels)[y] = SDLTest_RandomUint8();
+                    }
+                    /* Copy the first pixel around, so some pixels match the colorkey */
+                    for (y = 0; y < h; y++) {
+                        for (x = 1; x < w + 3; x++) {
+                            if ((SDLTest_RandomUint8() & 3) == 0) {
+                                SDL_memcpy((Uint8 *)src->pixels + y * src->pitch + x * bpp, src->pixels, bpp);
+                            }
+                        }
+                    }
+                    colorKey = _getSurfacePixel(src, 0, 0);
+                    rgbMask = ~src->format->Amask;
+                    SDL_SetSurfaceBlendMode(src, SDL_BLENDMODE_NONE);
+                    if (key) {
+                        SDL_SetColorKey(src, SDL_TRUE, colorKey);
+                    }
+                    for (y = 0; y < h * dst->pitch; y++) {
+                        ((Uint8 *)dst->pixels)[y] = SDLTest_RandomUint8();
+                    }
+                    SDL_memcpy(orig->pixels, dst->pixels, h * dst->pitch);
+
+                    srcRect.x = 3;
+                    srcRect.y = 0;
+                    srcRect.w = w;
+                    srcRect.h = h;
+                    dstRect.x = 1;
+                    dstRect.y = 0;
+                    ret = SDL_BlitSurface(src, &srcRect, dst, &dstRect);
+                    SDLTest_AssertCheck(ret == 0, "Verify result from SDL_BlitSurface, expected: 0, got: %i", ret);
+
+                    for (y = 0; y < h; y++) {
+                        for (x = 0; x < w + 2; x++) {
+                            /* Only compare the channels, a plain copy keeps the unused bits */
+                            const Uint32 channels = dst->format->Rmask | dst->format->Gmask | dst->format->Bmask | dst->format->Amask;
+                            Uint32 expected;
+
+                            if (x < 1 || x > w) {
+                                /* Pixels outside of the destination rectangle are never touched */
+                                expected = _getSurfacePixel(orig, x, y);
+                            } else {
+                                const Uint32 pixel = _getSurfacePixel(src, x + 2, y);
+                                if (key && (pixel & rgbMask) == (colorKey & rgbMask)) {
+                                    expected = _getSurfacePixel(orig, x, y);
+                                } else {
+                                    Uint8 r, g, b, a;
+                                    SDL_GetRGBA(pixel, src->format, &r, &g, &b, &a);
+                                    expected = SDL_MapRGBA(dst->format, r, g, b, a);
+                                }
+                            }
+                            if ((_getSurfacePixel(dst, x, y) & channels) != (expected & channels)) {
+                                mismatches++;
+                            }
+                        }
+                    }
+
+                    SDL_FreeSurface(src);
+                    SDL_FreeSurface(dst);
+                    SDL_FreeSurface(orig);
+                }
+                SDLTest_AssertCheck(mismatches == 0, "Verify %s => %s%s matches reference; mismatches: %i",
+                                    SDL_GetPixelFormatName(formats[i]), SDL_GetPixelFormatName(formats[j]),
+                                    key ? " with colorkey" : "", mismatches);
+            }
+        }
+    }
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * @brief Checks premultiplied alpha blits and fills against the reference formula.
+ *
+ * dstRGB = srcRGB + dstRGB * (1 - srcA), dstA = srcA + dstA * (1 - srcA),
+ * with alpha modulation scaling the whole premultiplied source.
+ *
+ * @sa http://wiki.libsdl.org/moin.cgi/SDL_SetSurfaceBlendMode
+ */
+int
+surface_testBlitPremultiplied(void *arg)
+{
+    const Uint32 srcFormats[] = {
+        SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888
+    };
+    const Uint32 dstFormats[] = {
+        SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB565
+    };
+    const Uint8 alphaMods[] = { 255, 128 };
+    const int w = 37, h = 3;
+    SDL_BlendMode blendMode;
+    SDL_Renderer *renderer;
+    SDL_Rect rect;
+    int i, j, k, x, y, ret;
+
+    for (i = 0; i < SDL_arraysize(srcFormats); i++) {
+        for (j = 0; j < SDL_arraysize(dstFormats); j++) {
+            for (k = 0; k < SDL_arraysize(alphaMods); k++) {
+                SDL_Surface *src = _createSurfaceWithFormat(w, h, srcFormats[i]);
+                SDL_Surface *dst = _createSurfaceWithFormat(w, h, dstFormats[j]);
+                SDL_Surface *orig = _createSurfaceWithFormat(w, h, dstFormats[j]);
+                const Uint32 mod = alphaMods[k];
+                int mismatches = 0;
+
+                SDLTest_AssertCheck(src != NULL && dst != NULL && orig != NULL, "Verify surfaces were created");
+                if (src == NULL || dst == NULL || orig == NULL) {
+                    SDL_FreeSurface(src);
+                    SDL_FreeSurface(dst);
+                    SDL_FreeSurface(orig);
+                    continue;
+                }
+
+                /* Valid premultiplied pixels, including fully opaque and transparent ones */
+                for (y = 0; y < h; y++) {
+                    for (x = 0; x < w; x++) {
+                        Uint8 a = SDLTest_RandomUint8();
+                        if (x % 7 == 0) {
+                            a = 0;
+                        } else if (x % 7 == 1) {
+                            a = 255;
+                        }
+                        _setSurfacePixel(src, x, y, SDL_MapRGBA(src->format, (Uint8)(SDLTest_RandomUint8() % (a + 1)),
+                                                                (Uint8)(SDLTest_RandomUint8() % (a + 1)),
+                                                                (Uint8)(SDLTest_RandomUint8() % (a + 1)), a));
+                        _setSurfacePixel(dst, x, y, SDLTest_RandomUint32());
+                    }
+                }
+                SDL_memcpy(orig->pixels, dst->pixels, h * dst->pitch);
+
+                ret = SDL_SetSurfaceBlendMode(src, SDL_BLENDMODE_PREMULTIPLIED);
+                SDLTest_AssertCheck(ret == 0, "Verify result from SDL_SetSurfaceBlendMode, expected: 0, got: %i", ret);
+                SDL_GetSurfaceBlendMode(src, &blendMode);
+                SDLTest_AssertCheck(blendMode == SDL_BLENDMODE_PREMULTIPLIED, "Verify blend mode, expected: %i, got: %i",
+                                    SDL_BLENDMODE_PREMULTIPLIED, blendMode);
+                SDL_SetSurfaceAlphaMod(src, (Uint8)mod);
+                ret = SDL_BlitSurface(src, NULL, dst, NULL);
+                SDLTest_AssertCheck(ret == 0, "Verify result from SDL_BlitSurface, expected: 0, got: %i", ret);
+
+                for (y = 0; y < h; y++) {
+                    for (x = 0; x < w; x++) {
+                        const Uint32 channels = dst->format->Rmask | dst->format->Gmask | dst->format->Bmask | dst->format->Amask;
+                        Uint8 sr, sg, sb, sa, dr, dg, db, da;
+                        Uint32 r, g, b, a, expected;
+
+                        SDL_GetRGBA(_getSurfacePixel(src, x, y), src->format, &sr, &sg, &sb, &sa);
+                        SDL_GetRGBA(_getSurfacePixel(orig, x, y), dst->format, &dr, &dg, &db, &da);
+                        if (mod != 255) {
+                            sr = (Uint8)((sr * mod) / 255);
+                            sg = (Uint8)((sg * mod) / 255);
+                            sb = (Uint8)((sb * mod) / 255);
+                            sa = (Uint8)((sa * mod) / 255);
+                        }
+                        r = SDL_min(sr + ((255 - sa) * dr) / 255, 255);
+                        g = SDL_min(sg + ((255 - sa) * dg) / 255, 255);
+                        b = SDL_min(sb + ((255 - sa) * db) / 255, 255);
+                        a = sa + ((255 - sa) * da) / 255;
+                        expected = SDL_MapRGBA(dst->format, (Uint8)r, (Uint8)g, (Uint8)b, (Uint8)a);
+                        if ((_getSurfacePixel(dst, x, y) & channels) != (expected & channels)) {
+                            mismatches++;
+                        }
+                    }
+                }
+                SDLTest_AssertCheck(mismatches == 0, "Verify %s => %s with alpha mod %i matches reference; mismatches: %i",
+                                    SDL_GetPixelFormatName(srcFormats[i]), SDL_GetPixelFormatName(dstFormats[j]),
+                                    (int)mod, mismatches);
+
+                SDL_FreeSurface(src);
+                SDL_FreeSurface(dst);
+                SDL_FreeSurface(orig);
+            }
+        }
+    }
+
+    /* Premultiplied fills use the draw color as is */
+    {
+        SDL_Surface *dst = _createSurfaceWithFormat(4, 1, SDL_PIXELFORMAT_RGB888);
+        Uint32 pixel;
+
+        SDLTest_AssertCheck(dst != NULL, "Verify surface was created");
+        if (dst == NULL) {
+            return TEST_ABORTED;
+        }
+        renderer = SDL_CreateSoftwareRenderer(dst);
+        SDLTest_AssertCheck(renderer != NULL, "Verify software renderer was created");
+        if (renderer == NULL) {
+            SDL_FreeSurface(dst);
+            return TEST_ABORTED;
+        }
+        SDL_FillRect(dst, NULL, 0x00C8C8C8);
+        ret = SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_PREMULTIPLIED);
+        SDLTest_AssertCheck(ret == 0, "Verify result from SDL_SetRenderDrawBlendMode, expected: 0, got: %i", ret);
+        SDL_SetRenderDrawColor(renderer, 0x40, 0x20, 0x00, 0x80);
+        rect.x = 0;
+        rect.y = 0;
+        rect.w = 2;
+        rect.h = 1;
+        ret = SDL_RenderFillRect(renderer, &rect);
+        SDLTest_AssertCheck(ret == 0, "Verify result from SDL_RenderFillRect, expected: 0, got: %i", ret);
+        pixel = _getSurfacePixel(dst, 0, 0) & 0x00FFFFFF;
+        /* 0x40 + 0xC8 * 0x7F / 255 = 0xA3, 0x20 + 0x63 = 0x83, 0x00 + 0x63 = 0x63 */
+        SDLTest_AssertCheck(pixel == 0x00A38363, "Verify filled pixel, expected: 0xa38363, got: 0x%.6x", pixel);
+        pixel = _getSurfacePixel(dst, 2, 0) & 0x00FFFFFF;
+        SDLTest_AssertCheck(pixel == 0x00C8C8C8, "Verify pixel outside the fill, expected: 0xc8c8c8, got: 0x%.6x", pixel);
+        SDL_DestroyRenderer(renderer);
+        SDL_FreeSurface(dst);
+    }
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * @brief Tests that blits stay correct while the blit mode of a surface changes.
+ *
+ * Changing the blend mode, alpha modulation or palette of a surface picks a
+ * new blit function, make sure the right one is used every time.
+ *
+ * @sa http://wiki.libsdl.org/moin.cgi/SDL_SetSurfaceAlphaMod
+ * @sa http://wiki.libsdl.org/moin.cgi/SDL_SetPaletteColors
+ */
+int
+surface_testBlitModeChanges(void *arg)
+{
+    SDL_Surface *src, *dst, *src8, *dst8;
+    SDL_Color colors[2];
+    Uint32 pixel;
+    int i, ret;
+
+    src = _createSurfaceWithFormat(4, 4, SDL_PIXELFORMAT_ARGB8888);
+    dst = _createSurfaceWithFormat(4, 4, SDL_PIXELFORMAT_RGB888);
+    src8 = _createSurfaceWithFormat(4, 4, SDL_PIXELFORMAT_INDEX8);
+    dst8 = _createSurfaceWithFormat(4, 4, SDL_PIXELFORMAT_INDEX8);
+    SDLTest_AssertCheck(src && dst && src8 && dst8, "Verify surfaces were created");
+    if (!src || !dst || !src8 || !dst8) {
+        SDL_FreeSurface(src);
+        SDL_FreeSurface(dst);
+        SDL_FreeSurface(src8);
+        SDL_FreeSurface(dst8);
+        return TEST_ABORTED;
+    }
+
+    /* Fade an opaque white surface over black, then switch blending on and off */
+    SDL_FillRect(src, NULL, 0xFFFFFFFF);
+    for (i = 0; i <= 255; i += 51) {
+        SDL_FillRect(dst, NULL, 0);
+        SDL_SetSurfaceBlendMode(src, SDL_BLENDMODE_BLEND);
+        SDL_SetSurfaceAlphaMod(src, (Uint8)i);
+        ret = SDL_BlitSurface(src, NULL, dst, NULL);
+        SDLTest_AssertCheck(ret == 0, "Verify result from SDL_BlitSurface, expected: 0, got: %i", ret);
+        pixel = *(Uint32 *)dst->pixels & 0x00FFFFFF;
+        SDLTest_AssertCheck((pixel & 0xFF) >= (Uint32)SDL_max(i - 1, 0) && (pixel & 0xFF) <= (Uint32)SDL_min(i + 1, 255),
+                            "Verify blended pixel at alpha %i, got: 0x%.6x", i, pixel);
+
+        SDL_SetSurfaceBlendMode(src, SDL_BLENDMODE_NONE);
+        ret = SDL_BlitSurface(src, NULL, dst, NULL);
+        SDLTest_AssertCheck(ret == 0, "Verify result from SDL_BlitSurface, expected: 0, got: %i", ret);
+        pixel = *(Uint32 *)dst->pixels & 0x00FFFFFF;
+        SDLTest_AssertCheck(pixel == 0x00FFFFFF, "Verify copied pixel, expected: 0xffffff, got: 0x%.6x", pixel);
+    }
+
+    /* Same palette is a plain copy, a reordered palette has to remap */
+    colors[0].r = colors[0].g = colors[0].b = 0;
+    colors[1].r = colors[1].g = colors[1].b = 255;
+    colors[0].a = colors[1].a = 255;
+    SDL_SetPaletteColors(src8->format->palette, colors, 0, 2);
+    SDL_SetPaletteColors(dst8->format->palette, colors, 0, 2);
+    SDL_FillRect(src8, NULL, 1);
+    SDL_FillRect(dst8, NULL, 0);
+    ret = SDL_BlitSurface(src8, NULL, dst8, NULL);
+    SDLTest_AssertCheck(ret == 0, "Verify result from SDL_BlitSurface, expected: 0, got: %i", ret);
+    SDLTest_AssertCheck(*(Uint8 *)dst8->pixels == 1, "Verify identity blit, expected: 1, got: %i", *(Uint8 *)dst8->pixels);
+
+    SDL_SetPaletteColors(dst8->format->palette, &colors[1], 0, 1);
+    SDL_SetPaletteColors(dst8->format->palette, &colors[0], 1, 1);
+    SDL_FillRect(dst8, NULL, 1);
+    ret = SDL_BlitSurface(src8, NULL, dst8, NULL);
+    SDLTest_AssertCheck(ret == 0, "Verify result from SDL_BlitSurface, expected: 0, got: %i", ret);
+    SDLTest_AssertCheck(*(Uint8 *)dst8->pixels == 0, "Verify remapped blit, expected: 0, got: %i", *(Uint8 *)dst8->pixels);
+
+    SDL_FreeSurface(src);
+    SDL_FreeSurface(dst);
+    SDL_FreeSurface(src8);
+    SDL_FreeSurface(dst8);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * @brief Tests surfaces allocated with SDL_SIMD_ALIGNED and SDL_HINT_SURFACE_ALIGNMENT.
+ *
+ * @sa http://wiki.libsdl.org/moin.cgi/SDL_CreateRGBSurface
+ * @sa http://wiki.libsdl.org/moin.cgi/SDL_FillRect
+ */
+int
+surface_testAlignedSurfaces(void *arg)
+{
+    const int widths[] = { 1, 61, 64, 1366 };
+    const int h = 5;
+    SDL_Surface *src, *dst, *convert;
+    SDL_Rect rect;
+    Uint32 pixel;
+    int i, x, y, mismatches, ret;
+
+    for (i = 0; i < SDL_arraysize(widths); i++) {
+        const int w = widths[i];
+
+        src = SDL_CreateRGBSurface(SDL_SIMD_ALIGNED, w, h, 32, 0x00FF0000, 0x0000FF00, 0x000000FF, 0xFF000000);
+        dst = SDL_CreateRGBSurface(SDL_SIMD_ALIGNED, w, h, 32, 0x00FF0000, 0x0000FF00, 0x000000FF, 0xFF000000);
+        SDLTest_AssertCheck(src != NULL && dst != NULL, "Verify aligned surfaces were created");
+        if (src == NULL || dst == NULL) {
+            SDL_FreeSurface(src);
+            SDL_FreeSurface(dst);
+            continue;
+        }
+        SDLTest_AssertCheck(src->flags & SDL_SIMD_ALIGNED, "Verify SDL_SIMD_ALIGNED is set, got flags: 0x%x", src->flags);
+        SDLTest_AssertCheck(((uintptr_t)src->pixels & 63) == 0 && ((uintptr_t)dst->pixels & 63) == 0,
+                            "Verify pixels are aligned to 64 bytes");
+        SDLTest_AssertCheck((src->pitch & 15) == 0 && src->pitch >= w * 4,
+                            "Verify pitch is aligned to 16 bytes, got: %i", src->pitch);
+
+        /* A full width fill may run through the row padding, a partial one must not */
+        ret = SDL_FillRect(dst, NULL, 0x00123456);
+        SDLTest_AssertCheck(ret == 0, "Verify result from SDL_FillRect, expected: 0, got: %i", ret);
+        rect.x = w / 2;
+        rect.y = 1;
+        rect.w = 1;
+        rect.h = h - 2;
+        SDL_FillRect(dst, &rect, 0x00ABCDEF);
+        mismatches = 0;
+        for (y = 0; y < h; y++) {
+            for (x = 0; x < w; x++) {
+                const Uint32 expected = (x == rect.x && y >= rect.y && y < rect.y + rect.h) ? 0x00ABCDEF : 0x00123456;
+                if (_getSurfacePixel(dst, x, y) != expected) {
+                    mismatches++;
+                }
+            }
+        }
+        SDLTest_AssertCheck(mismatches == 0, "Verify fill of %ix%i aligned surface, expected: 0 mismatches, got: %i", w, h, mismatches);
+
+        /* Copy and colorkey RLE blits between aligned surfaces */
+        for (y = 0; y < h; y++) {
+            for (x = 0; x < w; x++) {
+                _setSurfacePixel(src, x, y, (x + y) & 1 ? 0xFF000000 : (SDLTest_RandomUint32() | 0xFF000000));
+            }
+        }
+        SDL_SetSurfaceBlendMode(src, SDL_BLENDMODE_NONE);
+        ret = SDL_BlitSurface(src, NULL, dst, NULL);
+        SDLTest_AssertCheck(ret == 0, "Verify result from SDL_BlitSurface, expected: 0, got: %i", ret);
+        mismatches = 0;
+        for (y = 0; y < h; y++) {
+            for (x = 0; x < w; x++) {
+                if (_getSurfacePixel(dst, x, y) != _getSurfacePixel(src, x, y)) {
+                    mismatches++;
+                }
+            }
+        }
+        SDLTest_AssertCheck(mismatches == 0, "Verify copy of %ix%i aligned surface, expected: 0 mismatches, got: %i", w, h, mismatches);
+
+        SDL_SetColorKey(src, SDL_TRUE, 0xFF000000);
+        SDL_SetSurfaceRLE(src, 1);
+        SDL_FillRect(dst, NULL, 0x00123456);
+        ret = SDL_BlitSurface(src, NULL, dst, NULL);
+        SDLTest_AssertCheck(ret == 0, "Verify result from SDL_BlitSurface, expected: 0, got: %i", ret);
+        SDLTest_AssertCheck(src->flags & SDL_RLEACCEL, "Verify source surface is RLE encoded");
+        SDL_LockSurface(src);
+        mismatches = 0;
+        for (y = 0; y < h; y++) {
+            for (x = 0; x < w; x++) {
+                pixel = _getSurfacePixel(src, x, y);
+                if (_getSurfacePixel(dst, x, y) != (pixel == 0xFF000000 ? 0x00123456 : pixel)) {
+                    mismatches++;
+                }
+            }
+        }
+        SDL_UnlockSurface(src);
+        SDLTest_AssertCheck(mismatches == 0, "Verify RLE blit of %ix%i aligned surface, expected: 0 mismatches, got: %i", w, h, mismatches);
+
+        /* Conversion keeps the alignment */
+        convert = SDL_ConvertSurfaceFormat(dst, SDL_PIXELFORMAT_RGB565, 0);
+        SDLTest_AssertCheck(convert != NULL, "Verify converted surface was created");
+        if (convert != NULL) {
+            SDLTest_AssertCheck((convert->flags & SDL_SIMD_ALIGNED) && ((uintptr_t)convert->pixels & 63) == 0 && (convert->pitch & 15) == 0,
+                                "Verify converted surface is aligned, got pitch: %i", convert->pitch);
+            SDL_FreeSurface(convert);
+        }
+
+        SDL_FreeSurface(src);
+        SDL_FreeSurface(dst);
+    }
+
+    /* The hint aligns every new surface */
+    SDL_SetHint(SDL_HINT_SURFACE_ALIGNMENT, "64");
+    src = _createSurfaceWithFormat(3, 3, SDL_PIXELFORMAT_RGB24);
+    SDLTest_AssertCheck(src != NULL, "Verify surface was created");
+    if (src != NULL) {
+        SDLTest_AssertCheck((src->flags & SDL_SIMD_ALIGNED) && ((uintptr_t)src->pixels & 63) == 0 && src->pitch == 64,
+                            "Verify surface is aligned by the hint, expected pitch: 64, got: %i", src->pitch);
+        SDL_FreeSurface(src);
+    }
+    SDL_SetHint(SDL_HINT_SURFACE_ALIGNMENT, "0");
+    src = _createSurfaceWithFormat(3, 3, SDL_PIXELFORMAT_RGB24);
+    SDLTest_AssertCheck(src != NULL, "Verify surface was created");
+    if (src != NULL) {
+        SDLTest_AssertCheck(!(src->flags & SDL_SIMD_ALIGNED) && src->pitch == 12,
+                            "Verify surface is not aligned, expected pitch: 12, got: %i", src->pitch);
+        SDL_FreeSurface(src);
+    }
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * @brief Tests SDL_FillRects with overlapping, adjacent and clipped rects in every pixel size.
+ *
+ * @sa http://wiki.libsdl.org/moin.cgi/SDL_FillRects
+ * @sa http://wiki.libsdl.org/moin.cgi/SDL_FillRect
+ */
+int
+surface_testFillRects(void *arg)
+{
+    const Uint32 formats[] = {
+        SDL_PIXELFORMAT_INDEX8, SDL_PIXELFORMAT_RGB565, SDL_PIXELFORMAT_RGB24, SDL_PIXELFORMAT_BGR24, SDL_PIXELFORMAT_ARGB8888
+    };
+    const int w = 301, h = 40;
+    SDL_Rect rects[100], pixel;
+    SDL_Surface *dst, *ref;
+    Uint32 color;
+    Uint8 r, g, b;
+    int i, j, x, y, mismatches, ret;
+
+    for (i = 0; i < SDL_arraysize(formats); i++) {
+        dst = _createSurfaceWithFormat(w, h, formats[i]);
+        ref = _createSurfaceWithFormat(w, h, formats[i]);
+        SDLTest_AssertCheck(dst != NULL && ref != NULL, "Verify surfaces were created");
+        if (dst == NULL || ref == NULL) {
+            SDL_FreeSurface(dst);
+            SDL_FreeSurface(ref);
+            continue;
+        }
+        SDL_memset(dst->pixels, 0x5A, h * dst->pitch);
+        SDL_memset(ref->pixels, 0x5A, h * ref->pitch);
+
+        /* Random rects, some reaching past the edges, plus a row of adjacent ones */
+        for (j = 0; j < SDL_arraysize(rects); j++) {
+            if (j < 10) {
+                rects[j].x = j * 30;
+                rects[j].y = 5;
+                rects[j].w = 30;
+                rects[j].h = 3;
+            } else {
+                rects[j].x = SDLTest_RandomIntegerInRange(-20, w);
+                rects[j].y = SDLTest_RandomIntegerInRange(-5, h);
+                rects[j].w = SDLTest_RandomIntegerInRange(0, 120);
+                rects[j].h = SDLTest_RandomIntegerInRange(0, 12);
+            }
+        }
+        color = SDL_MapRGB(dst->format, 0x12, 0x9A, 0xFE);
+        ret = SDL_FillRects(dst, rects, SDL_arraysize(rects), color);
+        SDLTest_AssertCheck(ret == 0, "Verify result from SDL_FillRects, expected: 0, got: %i", ret);
+
+        /* The reference is filled a pixel at a time */
+        pixel.w = pixel.h = 1;
+        for (y = 0; y < h; y++) {
+            for (x = 0; x < w; x++) {
+                pixel.x = x;
+                pixel.y = y;
+                for (j = 0; j < SDL_arraysize(rects); j++) {
+                    if (x >= rects[j].x && x < rects[j].x + rects[j].w &&
+                        y >= rects[j].y && y < rects[j].y + rects[j].h) {
+                        SDL_FillRect(ref, &pixel, color);
+                        break;
+                    }
+                }
+            }
+        }
+        mismatches = 0;
+        for (y = 0; y < h; y++) {
+            if (SDL_memcmp((Uint8 *)dst->pixels + y * dst->pitch, (Uint8 *)ref->pixels + y * ref->pitch,
+                           w * dst->format->BytesPerPixel) != 0) {
+                mismatches++;
+            }
+        }
+        SDLTest_AssertCheck(mismatches == 0, "Verify %s rect fill, expected: 0 mismatched rows, got: %i",
+                            SDL_GetPixelFormatName(formats[i]), mismatches);
+
+        /* A whole surface fill, and the byte order of 24-bit pixels */
+        ret = SDL_FillRect(dst, NULL, color);
+        SDLTest_AssertCheck(ret == 0, "Verify result from SDL_FillRect, expected: 0, got: %i", ret);
+        if (dst->format->BytesPerPixel > 1) {
+            const Uint32 mask = dst->format->BytesPerPixel == 4 ? 0xFFFFFFFF :
+                                dst->format->BytesPerPixel == 3 ? 0x00FFFFFF : 0x0000FFFF;
+            mismatches = 0;
+            for (y = 0; y < h; y++) {
+                for (x = 0; x < w; x++) {
+                    if ((_getSurfacePixel(dst, x, y) & mask) != color) {
+                        mismatches++;
+                    }
+                }
+            }
+            SDLTest_AssertCheck(mismatches == 0, "Verify %s surface fill, expected: 0 mismatches, got: %i",
+                                SDL_GetPixelFormatName(formats[i]), mismatches);
+        }
+        if (dst->format->BytesPerPixel == 3) {
+            SDL_GetRGB(_getSurfacePixel(dst, w - 1, h - 1) & 0x00FFFFFF, dst->format, &r, &g, &b);
+            SDLTest_AssertCheck(r == 0x12 && g == 0x9A && b == 0xFE, "Verify %s pixel color, expected: 12 9a fe, got: %.2x %.2x %.2x",
+                                SDL_GetPixelFormatName(formats[i]), r, g, b);
+        }
+
+        SDL_FreeSurface(dst);
+        SDL_FreeSurface(ref);
+    }
+
+    return TEST_COMPLETED;
+}
+
+/*
+ * The render tests below cover the software renderer, so they create it with
+ * SDL_CreateSoftwareRenderer() on a surface instead of using the render suite,
+ * which asks for an accelerated window renderer.  That renderer is another
+ * backend, or missing with the dummy video driver, and its output isn't exact
+ * enough for the pixel checks here.
+ */
+
+/* Helper that renders a texture onto 'dst', after restoring its pixels from 'background' */
+static int
+_renderCopyExOnto(SDL_Renderer *renderer, SDL_Texture *texture, SDL_Surface *dst, SDL_Surface *background,
+                  const SDL_Rect *dstrect, double angle, SDL_RendererFlip flip)
+{
+    SDL_memcpy(dst->pixels, background->pixels, dst->h * dst->pitch);
+    if (angle == 0.0 && flip == SDL_FLIP_NONE) {
+        return SDL_RenderCopy(renderer, texture, NULL, dstrect);
+    }
+    return SDL_RenderCopyEx(renderer, texture, NULL, dstrect, angle, NULL, flip);
+}
+
+/**
+ * @brief Tests rotated, flipped and scaled software rendering against the expected pixel mapping.
+ *
+ * @sa http://wiki.libsdl.org/moin.cgi/SDL_RenderCopyEx
+ */
+int
+surface_testRenderCopyEx(void *arg)
+{
+    const int n = 16;
+    SDL_Surface *src, *dst, *background, *expected;
+    SDL_Renderer *renderer;
+    SDL_Texture *texture;
+    SDL_Rect dstrect;
+    char *savedHint;
+    int x, y, mismatches, ret;
+
+    src = _createSurfaceWithFormat(n, n, SDL_PIXELFORMAT_ARGB8888);
+    dst = _createSurfaceWithFormat(2 * n + 8, 2 * n + 8, SDL_PIXELFORMAT_ARGB8888);
+    background = _createSurfaceWithFormat(dst->w, dst->h, SDL_PIXELFORMAT_ARGB8888);
+    expected = _createSurfaceWithFormat(dst->w, dst->h, SDL_PIXELFORMAT_ARGB8888);
+    SDLTest_AssertCheck(src && dst && background && expected, "Verify surfaces were created");
+    if (!src || !dst || !background || !expected) {
+        SDL_FreeSurface(src);
+        SDL_FreeSurface(dst);
+        SDL_FreeSurface(background);
+        SDL_FreeSurface(expected);
+        return TEST_ABORTED;
+    }
+    for (y = 0; y < n; y++) {
+        for (x = 0; x < n; x++) {
+            _setSurfacePixel(src, x, y, SDLTest_RandomUint32());
+        }
+    }
+    for (y = 0; y < dst->h; y++) {
+        for (x = 0; x < dst->w; x++) {
+            _setSurfacePixel(background, x, y, SDLTest_RandomUint32());
+        }
+    }
+
+    savedHint = SDL_GetHint(SDL_HINT_RENDER_SCALE_QUALITY) ? SDL_strdup(SDL_GetHint(SDL_HINT_RENDER_SCALE_QUALITY)) : NULL;
+    SDL_SetHint(SDL_HINT_RENDER_SCALE_QUALITY, "0");
+    renderer = SDL_CreateSoftwareRenderer(dst);
+    SDLTest_AssertCheck(renderer != NULL, "Verify software renderer is not NULL");
+    texture = renderer ? SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STATIC, n, n) : NULL;
+    SDLTest_AssertCheck(texture != NULL, "Verify texture is not NULL");
+    if (texture != NULL) {
+        SDL_UpdateTexture(texture, NULL, src->pixels, src->pitch);
+
+        /* No rotation matches a plain blit, also once the texture was RLE encoded */
+        SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+        SDL_SetTextureColorMod(texture, 200, 100, 255);
+        SDL_SetTextureAlphaMod(texture, 180);
+        dstrect.x = 5;
+        dstrect.y = 7;
+        dstrect.w = n;
+        dstrect.h = n;
+        _renderCopyExOnto(renderer, texture, dst, background, &dstrect, 0.0, SDL_FLIP_NONE);
+        SDL_memcpy(expected->pixels, dst->pixels, dst->h * dst->pitch);
+        SDL_memcpy(dst->pixels, background->pixels, dst->h * dst->pitch);
+        ret = SDL_RenderCopyEx(renderer, texture, NULL, &dstrect, 360.0, NULL, SDL_FLIP_NONE);
+        SDLTest_AssertCheck(ret == 0, "Verify result from SDL_RenderCopyEx, expected: 0, got: %i", ret);
+        SDLTest_AssertCheck(SDL_memcmp(dst->pixels, expected->pixels, dst->h * dst->pitch) == 0,
+                            "Verify full turn with blending and modulation matches SDL_RenderCopy");
+        _renderCopyExOnto(renderer, texture, dst, background, &dstrect, 0.0, SDL_FLIP_NONE);
+        SDLTest_AssertCheck(SDL_memcmp(dst->pixels, expected->pixels, dst->h * dst->pitch) == 0,
+                            "Verify SDL_RenderCopy after SDL_RenderCopyEx is unchanged");
+
+        /* Quarter turn clockwise around the center */
+        SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_NONE);
+        SDL_SetTextureColorMod(texture, 255, 255, 255);
+        SDL_SetTextureAlphaMod(texture, 255);
+        dstrect.x = 0;
+        dstrect.y = 0;
+        ret = _renderCopyExOnto(renderer, texture, dst, background, &dstrect, 90.0, SDL_FLIP_NONE);
+        SDLTest_AssertCheck(ret == 0, "Verify result from SDL_RenderCopyEx, expected: 0, got: %i", ret);
+        mismatches = 0;
+        for (y = 0; y < n; y++) {
+            for (x = 0; x < n; x++) {
+                if (_getSurfacePixel(dst, x, y) != _getSurfacePixel(src, y, n - 1 - x)) {
+                    mismatches++;
+                }
+            }
+        }
+        SDLTest_AssertCheck(mismatches == 0, "Verify 90 degree rotation, expected: 0 mismatches, got: %i", mismatches);
+        SDLTest_AssertCheck(_getSurfacePixel(dst, n, 0) == _getSurfacePixel(background, n, 0) &&
+                            _getSurfacePixel(dst, 0, n) == _getSurfacePixel(background, 0, n),
+                            "Verify pixels outside the rotated rectangle are untouched");
+
+        /* Half turn is the same as flipping both ways */
+        _renderCopyExOnto(renderer, texture, dst, background, &dstrect, 0.0, SDL_FLIP_HORIZONTAL | SDL_FLIP_VERTICAL);
+        SDL_memcpy(expected->pixels, dst->pixels, dst->h * dst->pitch);
+        _renderCopyExOnto(renderer, texture, dst, background, &dstrect, 180.0, SDL_FLIP_NONE);
+        SDLTest_AssertCheck(SDL_memcmp(dst->pixels, expected->pixels, dst->h * dst->pitch) == 0,
+                            "Verify 180 degree rotation matches flipping both ways");
+
+        /* Scaled up twice and flipped horizontally */
+        dstrect.w = 2 * n;
+        dstrect.h = 2 * n;
+        ret = _renderCopyExOnto(renderer, texture, dst, background, &dstrect, 0.0, SDL_FLIP_HORIZONTAL);
+        SDLTest_AssertCheck(ret == 0, "Verify result from SDL_RenderCopyEx, expected: 0, got: %i", ret);
+        mismatches = 0;
+        for (y = 0; y < 2 * n; y++) {
+            for (x = 0; x < 2 * n; x++) {
+                if (_getSurfacePixel(dst, x, y) != _getSurfacePixel(src, n - 1 - x / 2, y / 2)) {
+                    mismatches++;
+                }
+            }
+        }
+        SDLTest_AssertCheck(mismatches == 0, "Verify scaled horizontal flip, expected: 0 mismatches, got: %i", mismatches);
+
+        /* Bilinear filtering of a single color stays that color, and a rect reaching off the target is clipped */
+        SDL_DestroyTexture(texture);
+        SDL_SetHint(SDL_HINT_RENDER_SCALE_QUALITY, "1");
+        texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STATIC, n, n);
+        SDLTest_AssertCheck(texture != NULL, "Verify texture is not NULL");
+        if (texture != NULL) {
+            SDL_FillRect(src, NULL, 0xFF336699);
+            SDL_UpdateTexture(texture, NULL, src->pixels, src->pitch);
+            dstrect.x = -n;
+            dstrect.y = n / 2;
+            ret = _renderCopyExOnto(renderer, texture, dst, background, &dstrect, 33.0, SDL_FLIP_NONE);
+            SDLTest_AssertCheck(ret == 0, "Verify result from SDL_RenderCopyEx, expected: 0, got: %i", ret);
+            mismatches = 0;
+            for (y = 0; y < dst->h; y++) {
+                for (x = 0; x < dst->w; x++) {
+                    const Uint32 pixel = _getSurfacePixel(dst, x, y);
+                    if (pixel != 0xFF336699 && pixel != _getSurfacePixel(background, x, y)) {
+                        mismatches++;
+                    }
+                }
+            }
+            SDLTest_AssertCheck(mismatches == 0, "Verify smooth rotation of a solid color, expected: 0 mismatches, got: %i", mismatches);
+        }
+    }
+
+    if (texture != NULL) {
+        SDL_DestroyTexture(texture);
+    }
+    if (renderer != NULL) {
+        SDL_DestroyRenderer(renderer);
+    }
+    SDL_SetHint(SDL_HINT_RENDER_SCALE_QUALITY, savedHint ? savedHint : "0");
+    SDL_free(savedHint);
+    SDL_FreeSurface(src);
+    SDL_FreeSurface(dst);
+    SDL_FreeSurface(background);
+    SDL_FreeSurface(expected);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * @brief Tests drawing point clouds too big for the stack with the software renderer.
+ *
+ * @sa http://wiki.libsdl.org/moin.cgi/SDL_RenderDrawPoints
+ */
+int
+surface_testRenderLargePointCloud(void *arg)
+{
+    const int size = 256;
+    const int count = 2000000;
+    SDL_Surface *dst;
+    SDL_Renderer *renderer;
+    SDL_Point *points;
+    int i, x, y, mismatches, ret;
+
+    dst = _createSurfaceWithFormat(size, size, SDL_PIXELFORMAT_ARGB8888);
+    points = (SDL_Point *)SDL_malloc(count * sizeof(*points));
+    SDLTest_AssertCheck(dst != NULL && points != NULL, "Verify surface and points were created");
+    if (dst == NULL || points == NULL) {
+        SDL_FreeSurface(dst);
+        SDL_free(points);
+        return TEST_ABORTED;
+    }
+    renderer = SDL_CreateSoftwareRenderer(dst);
+    SDLTest_AssertCheck(renderer != NULL, "Verify software renderer is not NULL");
+    if (renderer != NULL) {
+        /* Every pixel is hit many times, with a few points outside the surface */
+        for (i = 0; i < count; i++) {
+            points[i].x = (i % (size + 2)) - 1;
+            points[i].y = ((i / (size + 2)) % (size + 2)) - 1;
+        }
+        SDL_SetRenderDrawColor(renderer, 0x12, 0x34, 0x56, 0xFF);
+        SDL_RenderClear(renderer);
+        SDL_SetRenderDrawColor(renderer, 0xAB, 0xCD, 0xEF, 0xFF);
+        ret = SDL_RenderDrawPoints(renderer, points, count);
+        SDLTest_AssertCheck(ret == 0, "Verify result from SDL_RenderDrawPoints, expected: 0, got: %i", ret);
+        mismatches = 0;
+        for (y = 0; y < size; y++) {
+            for (x = 0; x < size; x++) {
+                if (_getSurfacePixel(dst, x, y) != 0xFFABCDEF) {
+                    mismatches++;
+                }
+            }
+        }
+        SDLTest_AssertCheck(mismatches == 0, "Verify all points were drawn, expected: 0 mismatches, got: %i", mismatches);
+
+        /* Scaled points are converted to rects, connected points to lines */
+        SDL_RenderSetScale(renderer, 2.0f, 2.0f);
+        SDL_SetRenderDrawColor(renderer, 0x12, 0x34, 0x56, 0xFF);
+        SDL_RenderClear(renderer);
+        SDL_SetRenderDrawColor(renderer, 0xAB, 0xCD, 0xEF, 0xFF);
+        ret = SDL_RenderDrawPoints(renderer, points, count);
+        SDLTest_AssertCheck(ret == 0, "Verify result from scaled SDL_RenderDrawPoints, expected: 0, got: %i", ret);
+        SDLTest_AssertCheck(_getSurfacePixel(dst, 0, 0) == 0xFFABCDEF && _getSurfacePixel(dst, size - 1, size - 1) == 0xFFABCDEF,
+                            "Verify scaled points cover the surface");
+        SDL_RenderSetScale(renderer, 1.0f, 1.0f);
+        ret = SDL_RenderDrawLines(renderer, points, count);
+        SDLTest_AssertCheck(ret == 0, "Verify result from SDL_RenderDrawLines, expected: 0, got: %i", ret);
+        SDL_DestroyRenderer(renderer);
+    }
+
+    SDL_free(points);
+    SDL_FreeSurface(dst);
+
+    return TEST_COMPLETED;
+}
+
+/* Helper that checks every pixel of 'big' is the pixel of 'small' it is scaled up from */
+static int
+_countScaledMismatches(SDL_Surface *big, SDL_Surface *small, int scale)
+{
+    int x, y, mismatches = 0;
+
+    for (y = 0; y < small->h * scale; y++) {
+        for (x = 0; x < small->w * scale; x++) {
+            if (_getSurfacePixel(big, x, y) != _getSurfacePixel(small, x / scale, y / scale)) {
+                mismatches++;
+            }
+        }
+    }
+    return mismatches;
+}
+
+/**
+ * @brief Tests that scaled points and horizontal and vertical lines look like unscaled ones scaled up,
+ * and other lines like thin lines between the scaled end points, in every blend mode.
+ *
+ * @sa http://wiki.libsdl.org/moin.cgi/SDL_RenderSetScale
+ */
+int
+surface_testRenderScaledLines(void *arg)
+{
+    const int size = 16;
+    const int scale = 3;
+    const SDL_Point lines[] = {
+        { 1, 1 }, { 12, 1 }, { 12, 12 }, { 1, 12 }, { 1, 3 }, { 14, 3 }, { 14, 20 }, { 30, 20 }
+    };
+    const SDL_Point diagonals[] = { { 1, 1 }, { 12, 12 }, { 14, 2 }, { 30, 18 } };
+    const SDL_Point points[] = { { 0, 0 }, { 5, 3 }, { 5, 3 }, { 15, 15 }, { -1, 4 }, { 16, 2 } };
+    SDL_Point thin[SDL_arraysize(diagonals)];
+    SDL_Surface *small, *big, *ref;
+    SDL_Renderer *smallRenderer, *bigRenderer;
+    SDL_BlendMode mode;
+    int i, mismatches, ret;
+
+    for (i = 0; i < SDL_arraysize(diagonals); i++) {
+        thin[i].x = diagonals[i].x * scale;
+        thin[i].y = diagonals[i].y * scale;
+    }
+
+    small = _createSurfaceWithFormat(size, size, SDL_PIXELFORMAT_ARGB8888);
+    big = _createSurfaceWithFormat(size * scale, size * scale, SDL_PIXELFORMAT_ARGB8888);
+    SDLTest_AssertCheck(small != NULL && big != NULL, "Verify surfaces were created");
+    if (small == NULL || big == NULL) {
+        SDL_FreeSurface(small);
+        SDL_FreeSurface(big);
+        return TEST_ABORTED;
+    }
+    smallRenderer = SDL_CreateSoftwareRenderer(small);
+    bigRenderer = SDL_CreateSoftwareRenderer(big);
+    SDLTest_AssertCheck(smallRenderer != NULL && bigRenderer != NULL, "Verify software renderers are not NULL");
+    if (smallRenderer != NULL && bigRenderer != NULL) {
+        ret = SDL_RenderSetScale(bigRenderer, (float)scale, (float)scale);
+        SDLTest_AssertCheck(ret == 0, "Verify result from SDL_RenderSetScale, expected: 0, got: %i", ret);
+
+        for (mode = SDL_BLENDMODE_NONE; mode <= SDL_BLENDMODE_ADD; mode = (SDL_BlendMode)(mode ? mode << 1 : 1)) {
+            SDL_SetRenderDrawColor(smallRenderer, 0x20, 0x40, 0x60, 0xFF);
+            SDL_SetRenderDrawColor(bigRenderer, 0x20, 0x40, 0x60, 0xFF);
+            SDL_RenderClear(smallRenderer);
+            SDL_RenderClear(bigRenderer);
+            SDL_SetRenderDrawBlendMode(smallRenderer, mode);
+            SDL_SetRenderDrawBlendMode(bigRenderer, mode);
+            SDL_SetRenderDrawColor(smallRenderer, 0xF0, 0xC0, 0x80, 0x80);
+            SDL_SetRenderDrawColor(bigRenderer, 0xF0, 0xC0, 0x80, 0x80);
+
+            ret = SDL_RenderDrawLines(smallRenderer, lines, SDL_arraysize(lines));
+            SDLTest_AssertCheck(ret == 0, "Verify result from SDL_RenderDrawLines, expected: 0, got: %i", ret);
+            ret = SDL_RenderDrawLines(bigRenderer, lines, SDL_arraysize(lines));
+            SDLTest_AssertCheck(ret == 0, "Verify result from scaled SDL_RenderDrawLines, expected: 0, got: %i", ret);
+            mismatches = _countScaledMismatches(big, small, scale);
+            SDLTest_AssertCheck(mismatches == 0, "Verify scaled lines with blend mode %i, expected: 0 mismatches, got: %i", mode, mismatches);
+
+            /* Diagonal lines, against the same thin lines drawn without scaling */
+            SDL_SetRenderDrawColor(bigRenderer, 0x20, 0x40, 0x60, 0xFF);
+            SDL_RenderClear(bigRenderer);
+            SDL_SetRenderDrawColor(bigRenderer, 0xF0, 0xC0, 0x80, 0x80);
+            ret = SDL_RenderDrawLines(bigRenderer, diagonals, SDL_arraysize(diagonals));
+            SDLTest_AssertCheck(ret == 0, "Verify result from scaled diagonal SDL_RenderDrawLines, expected: 0, got: %i", ret);
+            ref = SDL_ConvertSurface(big, big->format, 0);
+            SDLTest_AssertCheck(ref != NULL, "Verify copy of the scaled lines is not NULL");
+            if (ref != NULL) {
+                SDL_RenderSetScale(bigRenderer, 1.0f, 1.0f);
+                SDL_SetRenderDrawColor(bigRenderer, 0x20, 0x40, 0x60, 0xFF);
+                SDL_RenderClear(bigRenderer);
+                SDL_SetRenderDrawColor(bigRenderer, 0xF0, 0xC0, 0x80, 0x80);
+                SDL_RenderDrawLines(bigRenderer, thin, SDL_arraysize(thin));
+                SDL_RenderSetScale(bigRenderer, (float)scale, (float)scale);
+                mismatches = _countScaledMismatches(big, ref, 1);
+                SDLTest_AssertCheck(mismatches == 0, "Verify scaled diagonal lines with blend mode %i, expected: 0 mismatches, got: %i", mode, mismatches);
+                SDL_FreeSurface(ref);
+            }
+
+            SDL_SetRenderDrawColor(smallRenderer, 0x20, 0x40, 0x60, 0xFF);
+            SDL_SetRenderDrawColor(bigRenderer, 0x20, 0x40, 0x60, 0xFF);
+            SDL_RenderClear(smallRenderer);
+            SDL_RenderClear(bigRenderer);
+            SDL_SetRenderDrawColor(smallRenderer, 0xF0, 0xC0, 0x80, 0x80);
+            SDL_SetRenderDrawColor(bigRenderer, 0xF0, 0xC0, 0x80, 0x80);
+            ret = SDL_RenderDrawPoints(smallRenderer, points, SDL_arraysize(points));
+            SDLTest_AssertCheck(ret == 0, "Verify result from SDL_RenderDrawPoints, expected: 0, got: %i", ret);
+            ret = SDL_RenderDrawPoints(bigRenderer, points, SDL_arraysize(points));
+            SDLTest_AssertCheck(ret == 0, "Verify result from scaled SDL_RenderDrawPoints, expected: 0, got: %i", ret);
+            mismatches = _countScaledMismatches(big, small, scale);
+            SDLTest_AssertCheck(mismatches == 0, "Verify scaled points with blend mode %i, expected: 0 mismatches, got: %i", mode, mismatches);
+        }
+    }
+
+    if (smallRenderer != NULL) {
+        SDL_DestroyRenderer(smallRenderer);
+    }
+    if (bigRenderer != NULL) {
+        SDL_DestroyRenderer(bigRenderer);
+    }
+    SDL_FreeSurface(small);
+    SDL_FreeSurface(big);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * @brief Tests that culling against the viewport and clip rect keeps everything that is visible,
+ * and counts what it drops.
+ *
+ * @sa http://wiki.libsdl.org/moin.cgi/SDL_RenderSetClipRect
+ * @sa http://wiki.libsdl.org/moin.cgi/SDL_GetRenderStats
+ */
+int
+surface_testRenderCulling(void *arg)
+{
+    const SDL_Point lines[] = { { 2, 2 }, { 200, 2 }, { 200, 200 }, { 2, 20 } };
+    const SDL_Point points[] = { { -5, 3 }, { 3, 3 }, { 1000, 3 }, { 30, 31 }, { 3, -1000 } };
+    const SDL_Rect rects[] = { { -40, 0, 30, 30 }, { 28, 28, 10, 10 }, { 64, 0, 8, 8 } };
+    const SDL_Rect clip = { 0, 0, 32, 32 };
+    SDL_Surface *dst;
+    SDL_Renderer *renderer;
+    SDL_Texture *texture;
+    SDL_Rect rect;
+    SDL_RenderStats stats;
+    Uint32 white = 0xFFFFFFFF, black = 0xFF000000;
+    int ret;
+
+    dst = _createSurfaceWithFormat(64, 64, SDL_PIXELFORMAT_ARGB8888);
+    SDLTest_AssertCheck(dst != NULL, "Verify surface is not NULL");
+    if (dst == NULL) {
+        return TEST_ABORTED;
+    }
+    renderer = SDL_CreateSoftwareRenderer(dst);
+    SDLTest_AssertCheck(renderer != NULL, "Verify software renderer is not NULL");
+    if (renderer == NULL) {
+        SDL_FreeSurface(dst);
+        return TEST_ABORTED;
+    }
+
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0xFF);
+    SDL_RenderClear(renderer);
+    SDL_RenderSetClipRect(renderer, &clip);
+    SDL_SetRenderDrawColor(renderer, 0xFF, 0xFF, 0xFF, 0xFF);
+    ret = SDL_GetRenderStats(renderer, &stats);
+    SDLTest_AssertCheck(ret == 0, "Verify result from SDL_GetRenderStats, expected: 0, got: %i", ret);
+    SDLTest_AssertCheck(stats.culled_lines == 0 && stats.culled_points == 0 &&
+                        stats.culled_rects == 0 && stats.culled_copies == 0,
+                        "Verify a new renderer hasn't culled anything");
+
+    /* A polyline leaving the clip rect and coming back */
+    ret = SDL_RenderDrawLines(renderer, lines, SDL_arraysize(lines));
+    SDLTest_AssertCheck(ret == 0, "Verify result from SDL_RenderDrawLines, expected: 0, got: %i", ret);
+    SDLTest_AssertCheck(_getSurfacePixel(dst, 10, 2) == white && _getSurfacePixel(dst, 2, 20) == white,
+                        "Verify visible parts of the polyline were drawn");
+    SDL_GetRenderStats(renderer, &stats);
+    SDLTest_AssertCheck(stats.culled_lines == 1, "Verify culled line segments, expected: 1, got: %u", stats.culled_lines);
+
+    /* Points and rects, some of them far outside */
+    ret = SDL_RenderDrawPoints(renderer, points, SDL_arraysize(points));
+    SDLTest_AssertCheck(ret == 0, "Verify result from SDL_RenderDrawPoints, expected: 0, got: %i", ret);
+    SDLTest_AssertCheck(_getSurfacePixel(dst, 3, 3) == white && _getSurfacePixel(dst, 30, 31) == white,
+                        "Verify visible points were drawn");
+    SDL_GetRenderStats(renderer, &stats);
+    SDLTest_AssertCheck(stats.culled_points == 3, "Verify culled points, expected: 3, got: %u", stats.culled_points);
+    ret = SDL_RenderFillRects(renderer, rects, SDL_arraysize(rects));
+    SDLTest_AssertCheck(ret == 0, "Verify result from SDL_RenderFillRects, expected: 0, got: %i", ret);
+    SDLTest_AssertCheck(_getSurfacePixel(dst, 31, 29) == white && _getSurfacePixel(dst, 33, 33) == black,
+                        "Verify the visible part of a rect was drawn and clipped");
+    SDL_GetRenderStats(renderer, &stats);
+    SDLTest_AssertCheck(stats.culled_rects == 2, "Verify culled rects, expected: 2, got: %u", stats.culled_rects);
+
+    /* A copy that is only visible once rotated */
+    texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STATIC, 24, 4);
+    SDLTest_AssertCheck(texture != NULL, "Verify texture is not NULL");
+    if (texture != NULL) {
+        Uint32 pixels[24 * 4];
+        int i;
+
+        for (i = 0; i < SDL_arraysize(pixels); ++i) {
+            pixels[i] = 0xFF00FF00;
+        }
+        SDL_UpdateTexture(texture, NULL, pixels, 24 * sizeof(Uint32));
+        rect.x = 20;
+        rect.y = 34;
+        rect.w = 24;
+        rect.h = 4;
+        ret = SDL_RenderCopy(renderer, texture, NULL, &rect);
+        SDLTest_AssertCheck(ret == 0, "Verify result from SDL_RenderCopy, expected: 0, got: %i", ret);
+        SDLTest_AssertCheck(_getSurfacePixel(dst, 31, 25) == black, "Verify the unrotated copy is clipped");
+        ret = SDL_RenderCopyEx(renderer, texture, NULL, &rect, 90.0, NULL, SDL_FLIP_NONE);
+        SDLTest_AssertCheck(ret == 0, "Verify result from SDL_RenderCopyEx, expected: 0, got: %i", ret);
+        SDLTest_AssertCheck(_getSurfacePixel(dst, 31, 25) == 0xFF00FF00, "Verify the rotated copy was drawn");
+        SDL_GetRenderStats(renderer, &stats);
+        SDLTest_AssertCheck(stats.culled_copies == 1, "Verify only the unrotated copy was culled, got: %u", stats.culled_copies);
+        SDL_DestroyTexture(texture);
+    }
+
+    /* The clip rect limits drawing inside the viewport */
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0xFF);
+    SDL_RenderSetClipRect(renderer, NULL);
+    SDL_RenderClear(renderer);
+    rect.x = 8;
+    rect.y = 8;
+    rect.w = 48;
+    rect.h = 48;
+    SDL_RenderSetViewport(renderer, &rect);
+    rect.x = 0;
+    rect.y = 0;
+    rect.w = 16;
+    rect.h = 16;
+    SDL_RenderSetClipRect(renderer, &rect);
+    SDL_SetRenderDrawColor(renderer, 0xFF, 0xFF, 0xFF, 0xFF);
+    rect.x = -8;
+    rect.y = -8;
+    rect.w = 64;
+    rect.h = 64;
+    ret = SDL_RenderFillRect(renderer, &rect);
+    SDLTest_AssertCheck(ret == 0, "Verify result from SDL_RenderFillRect, expected: 0, got: %i", ret);
+    SDLTest_AssertCheck(_getSurfacePixel(dst, 4, 4) == black && _getSurfacePixel(dst, 10, 10) == white &&
+                        _getSurfacePixel(dst, 20, 20) == black,
+                        "Verify drawing is limited to the viewport and clip rect");
+
+    /* Inside the viewport but outside the clip rect */
+    rect.x = 20;
+    rect.y = 20;
+    rect.w = 4;
+    rect.h = 4;
+    ret = SDL_RenderFillRect(renderer, &rect);
+    SDLTest_AssertCheck(ret == 0, "Verify result from SDL_RenderFillRect, expected: 0, got: %i", ret);
+    SDL_GetRenderStats(renderer, &stats);
+    SDLTest_AssertCheck(stats.culled_rects == 3, "Verify culled rects, expected: 3, got: %u", stats.culled_rects);
+
+    SDL_DestroyRenderer(renderer);
+    SDL_FreeSurface(dst);
+
+    return TEST_COMPLETED;
+}
+
+/* Per-pixel reference for surface_testYUVTextures, mirrors the table driven converters in SDL_yuv_sw.c */
+static int
+_yuvClamp(int value)
+{
+    return (value < 0) ? 0 : (value > 255) ? 255 : value;
+}
+
+static Uint16
+_yuvToRGB555(int L, int cr, int cb)
+{
+    const int v = cr - 128;
+    const int u = cb - 128;
+    const int r = _yuvClamp(L + (int) ((0.419 / 0.299) * v));
+    const int g = _yuvClamp(L + (int) (-(0.299 / 0.419) * v) + (int) (-(0.114 / 0.331) * u));
+    const int b = _yuvClamp(L + (int) ((0.587 / 0.331) * u));
+
+    return (Uint16) (((r >> 3) << 10) | ((g >> 3) << 5) | (b >> 3));
+}
+
+static Uint16
+_yuvReferencePixel(Uint32 format, const Uint8 *frame, int w, int h, int x, int y)
+{
+    const Uint8 *plane1 = frame + w * h;
+    const Uint8 *plane2 = plane1 + (w / 2) * (h / 2);
+    const Uint8 *chroma = plane1 + (y / 2) * (w / 2) + x / 2;
+    const Uint8 *uv = plane1 + (y / 2) * w + (x / 2) * 2;
+    const Uint8 *pair = frame + y * w * 2 + (x / 2) * 4;
+
+    switch (format) {
+    case SDL_PIXELFORMAT_YV12:
+        return _yuvToRGB555(frame[y * w + x], chroma[0], chroma[plane2 - plane1]);
+    case SDL_PIXELFORMAT_IYUV:
+        return _yuvToRGB555(frame[y * w + x], chroma[plane2 - plane1], chroma[0]);
+    case SDL_PIXELFORMAT_NV12:
+        return _yuvToRGB555(frame[y * w + x], uv[1], uv[0]);
+    case SDL_PIXELFORMAT_NV21:
+        return _yuvToRGB555(frame[y * w + x], uv[0], uv[1]);
+    case SDL_PIXELFORMAT_YUY2:
+        return _yuvToRGB555(pair[(x & 1) * 2], pair[3], pair[1]);
+    case SDL_PIXELFORMAT_UYVY:
+        return _yuvToRGB555(pair[(x & 1) * 2 + 1], pair[2], pair[0]);
+    case SDL_PIXELFORMAT_YVYU:
+        return _yuvToRGB555(pair[(x & 1) * 2], pair[1], pair[3]);
+    default:
+        return 0;
+    }
+}
+
+/**
+ * @brief Tests the software YUV to RGB conversion against a per-pixel reference.
+ */
+int
+surface_testYUVTextures(void *arg)
+{
+    const Uint32 formats[] = {
+        SDL_PIXELFORMAT_YV12, SDL_PIXELFORMAT_IYUV, SDL_PIXELFORMAT_YUY2,
+        SDL_PIXELFORMAT_UYVY, SDL_PIXELFORMAT_YVYU, SDL_PIXELFORMAT_NV12,
+        SDL_PIXELFORMAT_NV21
+    };
+    /* The second size leaves a partial block at the end of each row */
+    const int sizes[][2] = { { 64, 32 }, { 70, 38 } };
+    SDL_Surface *dst;
+    SDL_Renderer *renderer;
+    SDL_Texture *texture;
+    Uint8 *frame;
+    int f, i, x, y;
+
+    dst = _createSurfaceWithFormat(70, 38, SDL_PIXELFORMAT_RGB555);
+    SDLTest_AssertCheck(dst != NULL, "Verify surface is not NULL");
+    if (dst == NULL) {
+        return TEST_ABORTED;
+    }
+    renderer = SDL_CreateSoftwareRenderer(dst);
+    SDLTest_AssertCheck(renderer != NULL, "Verify software renderer is not NULL");
+    frame = (Uint8 *) SDL_malloc(70 * 38 * 2);
+    SDLTest_AssertCheck(frame != NULL, "Verify frame buffer is not NULL");
+    if (renderer == NULL || frame == NULL) {
+        if (renderer) {
+            SDL_DestroyRenderer(renderer);
+        }
+        SDL_free(frame);
+        SDL_FreeSurface(dst);
+        return TEST_ABORTED;
+    }
+
+    for (f = 0; f < SDL_arraysize(formats); ++f) {
+        for (i = 0; i < SDL_arraysize(sizes); ++i) {
+            const int w = sizes[i][0];
+            const int h = sizes[i][1];
+            const int planar = (formats[f] == SDL_PIXELFORMAT_YV12 || formats[f] == SDL_PIXELFORMAT_IYUV ||
+                                formats[f] == SDL_PIXELFORMAT_NV12 || formats[f] == SDL_PIXELFORMAT_NV21);
+            SDL_Rect rect;
+            int mismatches = 0;
+            int ret;
+
+            for (x = 0; x < w * h * 2; ++x) {
+                frame[x] = SDLTest_RandomUint8();
+            }
+            texture = SDL_CreateTexture(renderer, formats[f], SDL_TEXTUREACCESS_STREAMING, w, h);
+            SDLTest_AssertCheck(texture != NULL, "Verify %s texture is not NULL", SDL_GetPixelFormatName(formats[f]));
+            if (texture == NULL) {
+                continue;
+            }
+            ret = SDL_UpdateTexture(texture, NULL, frame, planar ? w : w * 2);
+            SDLTest_AssertCheck(ret == 0, "Verify result from SDL_UpdateTexture, expected: 0, got: %i", ret);
+            rect.x = 0;
+            rect.y = 0;
+            rect.w = w;
+            rect.h = h;
+            SDL_RenderCopy(renderer, texture, NULL, &rect);
+            SDL_DestroyTexture(texture);
+
+            for (y = 0; y < h; ++y) {
+                for (x = 0; x < w; ++x) {
+                    if (_getSurfacePixel(dst, x, y) != _yuvReferencePixel(formats[f], frame, w, h, x, y)) {
+                        ++mismatches;
+                    }
+                }
+            }
+            SDLTest_AssertCheck(mismatches == 0, "Verify %s %dx%d matches the reference, mismatched pixels: %i",
+                                SDL_GetPixelFormatName(formats[f]), w, h, mismatches);
+        }
+    }
+
+    SDL_free(frame);
+    SDL_DestroyRenderer(renderer);
+    SDL_FreeSurface(dst);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * @brief Checks that converting YUV textures on several threads gives the single threaded result.
+ */
+int
+surface_testThreadedYUVTextures(void *arg)
+{
+    const Uint32 formats[] = {
+        SDL_PIXELFORMAT_YV12, SDL_PIXELFORMAT_NV12, SDL_PIXELFORMAT_YUY2
+    };
+    /* Big enough to be split into bands, the odd height leaves a last band with a single row */
+    const int w = 1024, h = 601;
+    const char *oldHint = SDL_GetHint(SDL_HINT_SOFTWARE_THREADS);
+    char *savedHint = oldHint ? SDL_strdup(oldHint) : NULL;
+    SDL_Surface *dst, *single;
+    SDL_Renderer *renderer;
+    Uint8 *frame;
+    int f, i, y;
+
+    dst = _createSurfaceWithFormat(w, h, SDL_PIXELFORMAT_RGB555);
+    single = _createSurfaceWithFormat(w, h, SDL_PIXELFORMAT_RGB555);
+    renderer = dst ? SDL_CreateSoftwareRenderer(dst) : NULL;
+    frame = (Uint8 *)SDL_malloc(w * h * 2);
+    SDLTest_AssertCheck(dst && single && renderer && frame, "Verify surfaces, renderer and frame were created");
+    if (!dst || !single || !renderer || !frame) {
+        if (renderer) {
+            SDL_DestroyRenderer(renderer);
+        }
+        SDL_free(frame);
+        SDL_FreeSurface(dst);
+        SDL_FreeSurface(single);
+        SDL_free(savedHint);
+        return TEST_ABORTED;
+    }
+    for (i = 0; i < w * h * 2; ++i) {
+        frame[i] = SDLTest_RandomUint8();
+    }
+
+    for (f = 0; f < SDL_arraysize(formats); ++f) {
+        const int pitch = (formats[f] == SDL_PIXELFORMAT_YUY2) ? w * 2 : w;
+        int mismatches = 0;
+
+        for (i = 0; i < 2; ++i) {
+            SDL_Texture *texture;
+            int ret;
+
+            SDL_SetHint(SDL_HINT_SOFTWARE_THREADS, i ? "4" : "1");
+            texture = SDL_CreateTexture(renderer, formats[f], SDL_TEXTUREACCESS_STREAMING, w, h);
+            SDLTest_AssertCheck(texture != NULL, "Verify %s texture is not NULL", SDL_GetPixelFormatName(formats[f]));
+            if (texture == NULL) {
+                break;
+            }
+            ret = SDL_UpdateTexture(texture, NULL, frame, pitch);
+            SDLTest_AssertCheck(ret == 0, "Verify result from SDL_UpdateTexture, expected: 0, got: %i", ret);
+            SDL_RenderCopy(renderer, texture, NULL, NULL);
+            SDL_DestroyTexture(texture);
+            if (i == 0) {
+                SDL_BlitSurface(dst, NULL, single, NULL);
+            }
+        }
+        for (y = 0; y < h; ++y) {
+            if (SDL_memcmp((Uint8 *)single->pixels + y * single->pitch,
+                           (Uint8 *)dst->pixels + y * dst->pitch, w * 2) != 0) {
+                mismatches++;
+            }
+        }
+        SDLTest_AssertCheck(mismatches == 0, "Verify threaded %s conversion matches; mismatched rows: %i",
+                            SDL_GetPixelFormatName(formats[f]), mismatches);
+    }
+
+    SDL_SetHint(SDL_HINT_SOFTWARE_THREADS, savedHint ? savedHint : "1");
+    SDL_free(savedHint);
+    SDL_free(frame);
+    SDL_DestroyRenderer(renderer);
+    SDL_FreeSurface(dst);
+    SDL_FreeSurface(single);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * @brief Checks that RLE encoded blits of sprite sheet frames match blits of the frames encoded alone, and that decoding keeps the pixels.
+ */
+int
+surface_testRLESheetBlits(void *arg)
+{
+    const Uint32 dstFormats[] = { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB565 };
+    /* Odd sizes and positions, so runs are clipped on every side */
+    const int w = 67, h = 23, frames = 3;
+    const SDL_Rect positions[] = { { 0, 0, 0, 0 }, { -5, -3, 0, 0 }, { 9, 4, 0, 0 } };
+    SDL_Surface *src, *copy, *frame, *expected, *rle;
+    int f, n, p, x, y, mismatches, ret;
+
+    src = _createSurfaceWithFormat(w, h * frames, SDL_PIXELFORMAT_ARGB8888);
+    SDLTest_AssertCheck(src != NULL, "Verify source surface is not NULL");
+    if (src == NULL) {
+        return TEST_ABORTED;
+    }
+    /* Frames with transparent, opaque and translucent runs, and blank lines */
+    for (y = 0; y < src->h; y++) {
+        for (x = 0; x < w; x++) {
+            Uint32 alpha;
+            switch ((y % h) < 2 ? 0 : SDLTest_RandomIntegerInRange(0, 3)) {
+            case 0: alpha = 0; break;
+            case 1: alpha = 0xFF; break;
+            default: alpha = SDLTest_RandomUint8(); break;
+            }
+            _setSurfacePixel(src, x, y, (alpha << 24) | (SDLTest_RandomUint32() & 0x00FFFFFF));
+        }
+    }
+    copy = SDL_ConvertSurface(src, src->format, 0);
+    SDLTest_AssertCheck(copy != NULL, "Verify copy of the source surface is not NULL");
+    if (copy == NULL) {
+        SDL_FreeSurface(src);
+        return TEST_ABORTED;
+    }
+    SDL_SetSurfaceBlendMode(src, SDL_BLENDMODE_BLEND);
+    SDL_SetSurfaceBlendMode(copy, SDL_BLENDMODE_NONE);
+    SDL_SetSurfaceRLE(src, 1);
+
+    for (f = 0; f < SDL_arraysize(dstFormats); f++) {
+        for (n = 0; n < frames; n++) {
+            for (p = 0; p < SDL_arraysize(positions); p++) {
+                SDL_Rect srcrect, dstrect;
+
+                frame = _createSurfaceWithFormat(w, h, SDL_PIXELFORMAT_ARGB8888);
+                expected = _createSurfaceWithFormat(w, h, dstFormats[f]);
+                rle = _createSurfaceWithFormat(w, h, dstFormats[f]);
+                SDLTest_AssertCheck(frame && expected && rle, "Verify frame and destination surfaces were created");
+                if (!frame || !expected || !rle) {
+                    SDL_FreeSurface(frame);
+                    SDL_FreeSurface(expected);
+                    SDL_FreeSurface(rle);
+                    SDL_FreeSurface(copy);
+                    SDL_FreeSurface(src);
+                    return TEST_ABORTED;
+                }
+                for (y = 0; y < h; y++) {
+                    for (x = 0; x < w; x++) {
+                        _setSurfacePixel(expected, x, y, SDLTest_RandomUint32());
+                    }
+                }
+                SDL_SetSurfaceBlendMode(expected, SDL_BLENDMODE_NONE);
+                SDL_BlitSurface(expected, NULL, rle, NULL);
+
+                srcrect.x = 0;
+                srcrect.y = n * h;
+                srcrect.w = w;
+                srcrect.h = h;
+                SDL_BlitSurface(copy, &srcrect, frame, NULL);
+                SDL_SetSurfaceBlendMode(frame, SDL_BLENDMODE_BLEND);
+                SDL_SetSurfaceRLE(frame, 1);
+                dstrect = positions[p];
+                SDL_BlitSurface(frame, NULL, expected, &dstrect);
+                dstrect = positions[p];
+                ret = SDL_BlitSurface(src, &srcrect, rle, &dstrect);
+                SDLTest_AssertCheck(ret == 0, "Verify result from SDL_BlitSurface, expected: 0, got: %i", ret);
+                SDLTest_AssertCheck(src->flags & SDL_RLEACCEL, "Verify source surface is RLE encoded");
+
+                mismatches = 0;
+                for (y = 0; y < h; y++) {
+                    for (x = 0; x < w; x++) {
+                        if (_getSurfacePixel(expected, x, y) != _getSurfacePixel(rle, x, y)) {
+                            mismatches++;
+                        }
+                    }
+                }
+                SDLTest_AssertCheck(mismatches == 0, "Verify RLE blit of frame %i to %s, position %i, expected: 0 mismatches, got: %i",
+                                    n, SDL_GetPixelFormatName(dstFormats[f]), p, mismatches);
+
+                SDL_FreeSurface(frame);
+                SDL_FreeSurface(expected);
+                SDL_FreeSurface(rle);
+            }
+        }
+
+        /* Decoding gives back every pixel that isn't fully transparent */
+        if (SDL_BYTESPERPIXEL(dstFormats[f]) == 4) {
+            ret = SDL_LockSurface(src);
+            SDLTest_AssertCheck(ret == 0, "Verify result from SDL_LockSurface, expected: 0, got: %i", ret);
+            mismatches = 0;
+            for (y = 0; y < src->h; y++) {
+                for (x = 0; x < w; x++) {
+                    Uint32 pixel = _getSurfacePixel(copy, x, y);
+                    if ((pixel >> 24) != 0 && _getSurfacePixel(src, x, y) != pixel) {
+                        mismatches++;
+                    }
+                }
+            }
+            SDL_UnlockSurface(src);
+            SDLTest_AssertCheck(mismatches == 0, "Verify pixels decoded from the encoding for %s, expected: 0 mismatches, got: %i",
+                                SDL_GetPixelFormatName(dstFormats[f]), mismatches);
+        }
+    }
+
+    SDL_FreeSurface(copy);
+    SDL_FreeSurface(src);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * @brief Tests that unlocking a converted texture only uploads the parts marked dirty.
+ *
+ * @sa http://wiki.libsdl.org/moin.cgi/SDL_MarkTextureDirty
+ * @sa http://wiki.libsdl.org/moin.cgi/SDL_GetRenderStats
+ */
+int
+surface_testRenderUploadStats(void *arg)
+{
+    const SDL_Rect dirty = { 8, 4, 12, 6 };
+    SDL_Surface *dst;
+    SDL_Renderer *renderer;
+    SDL_Texture *texture;
+    SDL_RenderStats before, after;
+    void *pixels;
+    int pitch;
+    int ret;
+
+    dst = _createSurfaceWithFormat(64, 64, SDL_PIXELFORMAT_ARGB8888);
+    SDLTest_AssertCheck(dst != NULL, "Verify surface is not NULL");
+    if (dst == NULL) {
+        return TEST_ABORTED;
+    }
+    renderer = SDL_CreateSoftwareRenderer(dst);
+    SDLTest_AssertCheck(renderer != NULL, "Verify software renderer is not NULL");
+    if (renderer == NULL) {
+        SDL_FreeSurface(dst);
+        return TEST_ABORTED;
+    }
+
+    ret = SDL_GetRenderStats(NULL, &before);
+    SDLTest_AssertCheck(ret == -1, "Verify result from SDL_GetRenderStats with no renderer, expected: -1, got: %i", ret);
+
+    /* The software renderer doesn't support ARGB4444, so the texture is converted when it's unlocked */
+    texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB4444, SDL_TEXTUREACCESS_STREAMING, 32, 16);
+    SDLTest_AssertCheck(texture != NULL, "Verify texture is not NULL");
+    if (texture != NULL) {
+        ret = SDL_GetRenderStats(renderer, &before);
+        SDLTest_AssertCheck(ret == 0, "Verify result from SDL_GetRenderStats, expected: 0, got: %i", ret);
+        ret = SDL_LockTexture(texture, NULL, &pixels, &pitch);
+        SDLTest_AssertCheck(ret == 0, "Verify result from SDL_LockTexture, expected: 0, got: %i", ret);
+        if (ret == 0) {
+            SDL_UnlockTexture(texture);
+        }
+        SDL_GetRenderStats(renderer, &after);
+        SDLTest_AssertCheck(after.unlocked_bytes - before.unlocked_bytes == 32 * 16 * 2 &&
+                            after.uploaded_bytes - before.uploaded_bytes == 32 * 16 * 2,
+                            "Verify an unmarked unlock uploads the whole texture, unlocked: %i, uploaded: %i",
+                            (int) (after.unlocked_bytes - before.unlocked_bytes),
+                            (int) (after.uploaded_bytes - before.uploaded_bytes));
+
+        before = after;
+        ret = SDL_LockTexture(texture, NULL, &pixels, &pitch);
+        SDLTest_AssertCheck(ret == 0, "Verify result from SDL_LockTexture, expected: 0, got: %i", ret);
+        if (ret == 0) {
+            ret = SDL_MarkTextureDirty(texture, &dirty);
+            SDLTest_AssertCheck(ret == 0, "Verify result from SDL_MarkTextureDirty, expected: 0, got: %i", ret);
+            SDL_UnlockTexture(texture);
+        }
+        SDL_GetRenderStats(renderer, &after);
+        SDLTest_AssertCheck(after.unlocked_bytes - before.unlocked_bytes == 32 * 16 * 2 &&
+                            after.uploaded_bytes - before.uploaded_bytes == dirty.w * dirty.h * 2,
+                            "Verify a marked unlock only uploads the marked rect, unlocked: %i, uploaded: %i",
+                            (int) (after.unlocked_bytes - before.unlocked_bytes),
+                            (int) (after.uploaded_bytes - before.uploaded_bytes));
+        SDLTest_AssertCheck(after.uploaded_bytes < after.unlocked_bytes, "Verify fewer bytes were uploaded than unlocked");
+        SDL_DestroyTexture(texture);
+    }
+
+    SDL_DestroyRenderer(renderer);
+    SDL_FreeSurface(dst);
+
+    return TEST_COMPLETED;
+}
+
 /* ================= Test References ================== */
 
 /* Surface test cases */
@@ -623,11 +2785,70 @@ static const SDLTest_TestCaseReference surfaceTest11 =
 static const SDLTest_TestCaseReference surfaceTest12 =
         { (SDLTest_TestCaseFp)surface_testBlitBlendMod, "surface_testBlitBlendMod", "Tests blitting routines with mod blending mode.", TEST_ENABLED};
 
+static const SDLTest_TestCaseReference surfaceTest13 =
+        { (SDLTest_TestCaseFp)surface_testBlitGeneratedBlitters, "surface_testBlitGeneratedBlitters", "Tests the generated blitters against a scalar reference.", TEST_ENABLED};
+
+static const SDLTest_TestCaseReference surfaceTest14 =
+        { (SDLTest_TestCaseFp)surface_testBlitAlphaBlitters, "surface_testBlitAlphaBlitters", "Tests the alpha blitters against a scalar reference.", TEST_ENABLED};
+
+static const SDLTest_TestCaseReference surfaceTest15 =
+        { (SDLTest_TestCaseFp)surface_testBlitScaledLinear, "surface_testBlitScaledLinear", "Tests bilinear scaling in the software renderer.", TEST_ENABLED};
+
+static const SDLTest_TestCaseReference surfaceTest16 =
+        { (SDLTest_TestCaseFp)surface_testThreadedConversion, "surface_testThreadedConversion", "Tests that threaded conversion matches single threaded conversion.", TEST_ENABLED};
+
+static const SDLTest_TestCaseReference surfaceTest17 =
+        { (SDLTest_TestCaseFp)surface_testBlitModeChanges, "surface_testBlitModeChanges", "Tests blitting while the blend mode, alpha modulation and palette change.", TEST_ENABLED};
+
+static const SDLTest_TestCaseReference surfaceTest18 =
+        { (SDLTest_TestCaseFp)surface_testBlitIndexedExpansion, "surface_testBlitIndexedExpansion", "Tests the palette expansion blitters against a per-pixel reference.", TEST_ENABLED};
+
+static const SDLTest_TestCaseReference surfaceTest19 =
+        { (SDLTest_TestCaseFp)surface_testBlitByteFormats, "surface_testBlitByteFormats", "Tests the 24 and 32-bit blitters against a per-pixel reference.", TEST_ENABLED};
+
+static const SDLTest_TestCaseReference surfaceTest20 =
+        { (SDLTest_TestCaseFp)surface_testBlitPremultiplied, "surface_testBlitPremultiplied", "Tests premultiplied alpha blits and fills against the reference formula.", TEST_ENABLED};
+
+static const SDLTest_TestCaseReference surfaceTest21 =
+        { (SDLTest_TestCaseFp)surface_testAlignedSurfaces, "surface_testAlignedSurfaces", "Tests allocation, fills and blits of SIMD aligned surfaces.", TEST_ENABLED};
+
+static const SDLTest_TestCaseReference surfaceTest22 =
+        { (SDLTest_TestCaseFp)surface_testFillRects, "surface_testFillRects", "Tests merged, clipped and 24-bit rect fills.", TEST_ENABLED};
+
+static const SDLTest_TestCaseReference surfaceTest23 =
+        { (SDLTest_TestCaseFp)surface_testRenderCopyEx, "surface_testRenderCopyEx", "Tests rotated, flipped and scaled software rendering.", TEST_ENABLED};
+
+static const SDLTest_TestCaseReference surfaceTest24 =
+        { (SDLTest_TestCaseFp)surface_testRenderLargePointCloud, "surface_testRenderLargePointCloud", "Tests drawing point clouds too big for the stack.", TEST_ENABLED};
+
+static const SDLTest_TestCaseReference surfaceTest25 =
+        { (SDLTest_TestCaseFp)surface_testRenderScaledLines, "surface_testRenderScaledLines", "Tests scaled points and lines against unscaled ones.", TEST_ENABLED};
+
+static const SDLTest_TestCaseReference surfaceTest26 =
+        { (SDLTest_TestCaseFp)surface_testRenderCulling, "surface_testRenderCulling", "Tests that culling keeps everything visible and counts the rest.", TEST_ENABLED};
+
+static const SDLTest_TestCaseReference surfaceTest27 =
+        { (SDLTest_TestCaseFp)surface_testYUVTextures, "surface_testYUVTextures", "Tests YUV texture conversion against a reference.", TEST_ENABLED};
+
+static const SDLTest_TestCaseReference surfaceTest28 =
+        { (SDLTest_TestCaseFp)surface_testThreadedYUVTextures, "surface_testThreadedYUVTextures", "Tests that threaded YUV texture conversion matches the single threaded result.", TEST_ENABLED};
+
+static const SDLTest_TestCaseReference surfaceTest29 =
+        { (SDLTest_TestCaseFp)surface_testRLESheetBlits, "surface_testRLESheetBlits", "Tests RLE blits of sprite sheet frames and decoding.", TEST_ENABLED};
+
+static const SDLTest_TestCaseReference surfaceTest30 =
+        { (SDLTest_TestCaseFp)surface_testRenderUploadStats, "surface_testRenderUploadStats", "Tests that unlocking a converted texture only uploads the marked parts.", TEST_ENABLED};
+
 /* Sequence of Surface test cases */
 static const SDLTest_TestCaseReference *surfaceTests[] =  {
     &surfaceTest1, &surfaceTest2, &surfaceTest3, &surfaceTest4, &surfaceTest5,
     &surfaceTest6, &surfaceTest7, &surfaceTest8, &surfaceTest9, &surfaceTest10,
-    &surfaceTest11, &surfaceTest12, NULL
+    &surfaceTest11, &surfaceTest12, &surfaceTest13, &surfaceTest14, &surfaceTest15,
+    &surfaceTest16, &surfaceTest17, &surfaceTest18, &surfaceTest19,
+    &surfaceTest20, &surfaceTest21, &surfaceTest22,
+    &surfaceTest23, &surfaceTest24,
+    &surfaceTest25, &surfaceTest26, &surfaceTest27, &surfaceTest28,
+    &surfaceTest29, &surfaceTest30, NULL
 };
 
 /* Surface test suite (global) */
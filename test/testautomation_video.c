@@ -1723,6 +1723,350 @@ video_getSetWindowData(void *arg)
 }
 
 
+/**
+ * @brief Tests SDL_UpdateWindowSurface with SDL_HINT_WINDOW_SURFACE_DAMAGE set
+ *
+ * @sa http://wiki.libsdl.org/moin.fcg/SDL_GetWindowSurface
+ * @sa http://wiki.libsdl.org/moin.fcg/SDL_UpdateWindowSurface
+ */
+int
+video_updateWindowSurfaceDamage(void *arg)
+{
+  const char* title = "video_updateWindowSurfaceDamage Test Window";
+  const char *savedHint = SDL_GetHint(SDL_HINT_WINDOW_SURFACE_DAMAGE);
+  SDL_Window* window;
+  SDL_Surface *surface, *sprite;
+  SDL_FrameCapture *capture;
+  SDL_Rect rect;
+  Uint32 red, blue, *pixel;
+  Uint8 *buffer;
+  size_t frame_size;
+  int result;
+
+  SDL_SetHint(SDL_HINT_WINDOW_SURFACE_DAMAGE, "1");
+
+  window = _createVideoSuiteTestWindow(title);
+  if (window == NULL) {
+     goto cleanup;
+  }
+
+  surface = SDL_GetWindowSurface(window);
+  SDLTest_AssertPass("Call to SDL_GetWindowSurface()");
+  if (surface == NULL || surface->format->BytesPerPixel != 4) {
+     SDLTest_Log("Window surface not available, skipping test");
+     _destroyVideoSuiteTestWindow(window);
+     goto cleanup;
+  }
+  red = SDL_MapRGB(surface->format, 255, 0, 0);
+  blue = SDL_MapRGB(surface->format, 0, 0, 255);
+
+  /* A new surface is presented in full, then there's nothing to present */
+  result = SDL_UpdateWindowSurface(window);
+  SDLTest_AssertPass("Call to SDL_UpdateWindowSurface() [new surface]");
+  SDLTest_AssertCheck(result == 0, "Verify result value; expected: 0, got: %d", result);
+  result = SDL_UpdateWindowSurface(window);
+  SDLTest_AssertPass("Call to SDL_UpdateWindowSurface() [no changes]");
+  SDLTest_AssertCheck(result == 0, "Verify result value; expected: 0, got: %d", result);
+
+  /* Frames without changes are still captured */
+  frame_size = (size_t)surface->w * surface->h * 3;
+  buffer = (Uint8 *)SDL_calloc(2, frame_size);
+  SDLTest_AssertCheck(buffer != NULL, "Verify buffer is not NULL");
+  if (buffer != NULL) {
+     capture = SDL_CreateFrameCapture(SDL_RWFromMem(buffer, (int)(2 * frame_size)), 1, SDL_CAPTURE_RAW, 0, 2, SDL_CAPTURE_WAIT);
+     SDLTest_AssertCheck(capture != NULL, "Verify capture is not NULL");
+     if (capture != NULL) {
+        SDL_SetWindowCapture(window, capture);
+        SDL_FillRect(surface, NULL, red);
+        result = SDL_UpdateWindowSurface(window);
+        SDLTest_AssertPass("Call to SDL_UpdateWindowSurface() [captured]");
+        SDLTest_AssertCheck(result == 0, "Verify result value; expected: 0, got: %d", result);
+        result = SDL_UpdateWindowSurface(window);
+        SDLTest_AssertPass("Call to SDL_UpdateWindowSurface() [captured, no changes]");
+        SDLTest_AssertCheck(result == 0, "Verify result value; expected: 0, got: %d", result);
+        result = SDL_CloseFrameCapture(capture);
+        SDLTest_AssertCheck(result == 0, "Verify SDL_CloseFrameCapture() result; expected: 0, got: %d", result);
+        SDLTest_AssertCheck(buffer[frame_size] == 255 && buffer[2 * frame_size - 1] == 0,
+           "Verify second frame was written; expected: ff..00, got: %.2x..%.2x", buffer[frame_size], buffer[2 * frame_size - 1]);
+     }
+     SDL_free(buffer);
+  }
+
+  /* Fill */
+  rect.x = 10;
+  rect.y = 20;
+  rect.w = 30;
+  rect.h = 40;
+  result = SDL_FillRect(surface, &rect, red);
+  SDLTest_AssertCheck(result == 0, "Verify SDL_FillRect() result; expected: 0, got: %d", result);
+  result = SDL_UpdateWindowSurface(window);
+  SDLTest_AssertPass("Call to SDL_UpdateWindowSurface() [after fill]");
+  SDLTest_AssertCheck(result == 0, "Verify result value; expected: 0, got: %d", result);
+  pixel = (Uint32 *)((Uint8 *)surface->pixels + 25 * surface->pitch) + 15;
+  SDLTest_AssertCheck(*pixel == red, "Verify filled pixel; expected: 0x%.8x, got: 0x%.8x", red, *pixel);
+
+  /* Blit, partly outside of the surface */
+  sprite = SDL_CreateRGBSurface(0, 16, 16, 32, surface->format->Rmask,
+                                surface->format->Gmask, surface->format->Bmask, 0);
+  SDLTest_AssertCheck(sprite != NULL, "Verify sprite surface is not NULL");
+  if (sprite != NULL) {
+     SDL_FillRect(sprite, NULL, blue);
+     rect.x = surface->w - 8;
+     rect.y = -8;
+     result = SDL_BlitSurface(sprite, NULL, surface, &rect);
+     SDLTest_AssertCheck(result == 0, "Verify SDL_BlitSurface() result; expected: 0, got: %d", result);
+     result = SDL_UpdateWindowSurface(window);
+     SDLTest_AssertPass("Call to SDL_UpdateWindowSurface() [after blit]");
+     SDLTest_AssertCheck(result == 0, "Verify result value; expected: 0, got: %d", result);
+     pixel = (Uint32 *)surface->pixels + surface->w - 1;
+     SDLTest_AssertCheck(*pixel == blue, "Verify blitted pixel; expected: 0x%.8x, got: 0x%.8x", blue, *pixel);
+     SDL_FreeSurface(sprite);
+  }
+
+  /* Direct access, outside of the clip rectangle */
+  rect.x = 10;
+  rect.y = 10;
+  rect.w = 10;
+  rect.h = 10;
+  SDL_SetClipRect(surface, &rect);
+  result = SDL_LockSurface(surface);
+  SDLTest_AssertCheck(result == 0, "Verify SDL_LockSurface() result; expected: 0, got: %d", result);
+  *(Uint32 *)surface->pixels = red;
+  SDL_UnlockSurface(surface);
+  SDL_SetClipRect(surface, NULL);
+  result = SDL_UpdateWindowSurface(window);
+  SDLTest_AssertPass("Call to SDL_UpdateWindowSurface() [after lock]");
+  SDLTest_AssertCheck(result == 0, "Verify result value; expected: 0, got: %d", result);
+
+  /* Explicit rectangles are still presented */
+  rect.x = 0;
+  rect.y = 0;
+  rect.w = 1;
+  rect.h = 1;
+  result = SDL_UpdateWindowSurfaceRects(window, &rect, 1);
+  SDLTest_AssertPass("Call to SDL_UpdateWindowSurfaceRects()");
+  SDLTest_AssertCheck(result == 0, "Verify result value; expected: 0, got: %d", result);
+
+  /* Resizing invalidates the surface, as without damage tracking */
+  SDL_SetWindowSize(window, surface->w + 10, surface->h + 10);
+  result = SDL_UpdateWindowSurface(window);
+  SDLTest_AssertPass("Call to SDL_UpdateWindowSurface() [after resize]");
+  SDLTest_AssertCheck(result == -1, "Verify result value; expected: -1, got: %d", result);
+  surface = SDL_GetWindowSurface(window);
+  SDLTest_AssertCheck(surface != NULL, "Verify new window surface is not NULL");
+  result = SDL_UpdateWindowSurface(window);
+  SDLTest_AssertPass("Call to SDL_UpdateWindowSurface() [new surface after resize]");
+  SDLTest_AssertCheck(result == 0, "Verify result value; expected: 0, got: %d", result);
+
+  _destroyVideoSuiteTestWindow(window);
+
+  cleanup:
+  SDL_SetHint(SDL_HINT_WINDOW_SURFACE_DAMAGE, savedHint ? savedHint : "0");
+
+  return TEST_COMPLETED;
+}
+
+
+/**
+ * @brief Records window surface frames as raw RGB
+ *
+ * @sa http://wiki.libsdl.org/moin.cgi/SDL_CreateFrameCapture
+ * @sa http://wiki.libsdl.org/moin.cgi/SDL_SetWindowCapture
+ */
+int
+video_frameCaptureRaw(void *arg)
+{
+  const char* title = "video_frameCaptureRaw Test Window";
+  SDL_Window* window;
+  SDL_Surface *surface;
+  SDL_FrameCapture *capture;
+  SDL_RWops *rw;
+  Uint8 *buffer, *pixel;
+  size_t frame_size;
+  Uint32 written, dropped;
+  int result;
+
+  /* Negative cases */
+  capture = SDL_CreateFrameCapture(NULL, 0, SDL_CAPTURE_RAW, 0, 2, SDL_CAPTURE_WAIT);
+  SDLTest_AssertPass("Call to SDL_CreateFrameCapture(NULL,...)");
+  SDLTest_AssertCheck(capture == NULL, "Verify capture is NULL");
+  result = SDL_SetWindowCapture(NULL, NULL);
+  SDLTest_AssertPass("Call to SDL_SetWindowCapture(NULL,NULL)");
+  SDLTest_AssertCheck(result == -1, "Verify result value; expected: -1, got: %d", result);
+
+  window = _createVideoSuiteTestWindow(title);
+  if (window == NULL) {
+     return TEST_ABORTED;
+  }
+  surface = SDL_GetWindowSurface(window);
+  SDLTest_AssertPass("Call to SDL_GetWindowSurface()");
+  if (surface == NULL) {
+     SDLTest_Log("Window surface not available, skipping test");
+     _destroyVideoSuiteTestWindow(window);
+     return TEST_SKIPPED;
+  }
+
+  frame_size = (size_t)surface->w * surface->h * 3;
+  buffer = (Uint8 *)SDL_calloc(2, frame_size);
+  SDLTest_AssertCheck(buffer != NULL, "Verify buffer is not NULL");
+  if (buffer == NULL) {
+     _destroyVideoSuiteTestWindow(window);
+     return TEST_ABORTED;
+  }
+  rw = SDL_RWFromMem(buffer, (int)(2 * frame_size));
+  SDLTest_AssertCheck(rw != NULL, "Verify RWops is not NULL");
+
+  capture = SDL_CreateFrameCapture(rw, 0, SDL_CAPTURE_RAW, 0, 0, SDL_CAPTURE_WAIT);
+  SDLTest_AssertPass("Call to SDL_CreateFrameCapture(...,queue_length=0,...)");
+  SDLTest_AssertCheck(capture == NULL, "Verify capture is NULL");
+  capture = SDL_CreateFrameCapture(rw, 0, SDL_CAPTURE_RAW, 0, 2, SDL_CAPTURE_WAIT);
+  SDLTest_AssertPass("Call to SDL_CreateFrameCapture()");
+  SDLTest_AssertCheck(capture != NULL, "Verify capture is not NULL");
+  if (capture != NULL) {
+     result = SDL_SetWindowCapture(window, capture);
+     SDLTest_AssertPass("Call to SDL_SetWindowCapture()");
+     SDLTest_AssertCheck(result == 0, "Verify result value; expected: 0, got: %d", result);
+
+     SDL_FillRect(surface, NULL, SDL_MapRGB(surface->format, 255, 0, 0));
+     result = SDL_UpdateWindowSurface(window);
+     SDLTest_AssertCheck(result == 0, "Verify SDL_UpdateWindowSurface() result; expected: 0, got: %d", result);
+     SDL_FillRect(surface, NULL, SDL_MapRGB(surface->format, 0, 0, 255));
+     result = SDL_UpdateWindowSurface(window);
+     SDLTest_AssertCheck(result == 0, "Verify SDL_UpdateWindowSurface() result; expected: 0, got: %d", result);
+
+     /* Frames of another size don't fit the stream */
+     SDL_SetWindowSize(window, surface->w + 10, surface->h + 10);
+     surface = SDL_GetWindowSurface(window);
+     SDLTest_AssertCheck(surface != NULL, "Verify new window surface is not NULL");
+     result = SDL_UpdateWindowSurface(window);
+     SDLTest_AssertCheck(result == 0, "Verify SDL_UpdateWindowSurface() result; expected: 0, got: %d", result);
+     SDL_GetFrameCaptureStats(capture, &written, &dropped);
+     SDLTest_AssertPass("Call to SDL_GetFrameCaptureStats()");
+     SDLTest_AssertCheck(dropped == 1, "Verify dropped frames; expected: 1, got: %d", (int)dropped);
+     SDLTest_AssertCheck(written <= 2, "Verify written frames; expected: <= 2, got: %d", (int)written);
+
+     result = SDL_CloseFrameCapture(capture);
+     SDLTest_AssertPass("Call to SDL_CloseFrameCapture()");
+     SDLTest_AssertCheck(result == 0, "Verify result value; expected: 0, got: %d", result);
+
+     pixel = buffer + frame_size - 3;
+     SDLTest_AssertCheck(pixel[0] == 255 && pixel[1] == 0 && pixel[2] == 0,
+        "Verify last pixel of first frame; expected: ff0000, got: %.2x%.2x%.2x", pixel[0], pixel[1], pixel[2]);
+     pixel = buffer + frame_size;
+     SDLTest_AssertCheck(pixel[0] == 0 && pixel[1] == 0 && pixel[2] == 255,
+        "Verify first pixel of second frame; expected: 0000ff, got: %.2x%.2x%.2x", pixel[0], pixel[1], pixel[2]);
+  }
+
+  SDL_RWclose(rw);
+  SDL_free(buffer);
+  _destroyVideoSuiteTestWindow(window);
+
+  return TEST_COMPLETED;
+}
+
+/**
+ * @brief Records window surface frames as Y4M and BMP
+ *
+ * @sa http://wiki.libsdl.org/moin.cgi/SDL_CreateFrameCapture
+ * @sa http://wiki.libsdl.org/moin.cgi/SDL_CloseFrameCapture
+ */
+int
+video_frameCaptureY4MBMP(void *arg)
+{
+  const char* title = "video_frameCaptureY4MBMP Test Window";
+  SDL_Window* window;
+  SDL_Surface *surface, *bmp, *rgb;
+  SDL_FrameCapture *capture;
+  Uint8 *buffer, *pixel;
+  char header[64];
+  size_t size, header_length;
+  int result, w, h;
+
+  window = _createVideoSuiteTestWindow(title);
+  if (window == NULL) {
+     return TEST_ABORTED;
+  }
+  surface = SDL_GetWindowSurface(window);
+  SDLTest_AssertPass("Call to SDL_GetWindowSurface()");
+  if (surface == NULL) {
+     SDLTest_Log("Window surface not available, skipping test");
+     _destroyVideoSuiteTestWindow(window);
+     return TEST_SKIPPED;
+  }
+  w = surface->w;
+  h = surface->h;
+  size = (size_t)w * h * 4 + 1024;
+  buffer = (Uint8 *)SDL_calloc(1, size);
+  SDLTest_AssertCheck(buffer != NULL, "Verify buffer is not NULL");
+  if (buffer == NULL) {
+     _destroyVideoSuiteTestWindow(window);
+     return TEST_ABORTED;
+  }
+  SDL_FillRect(surface, NULL, SDL_MapRGB(surface->format, 255, 255, 255));
+
+  /* Y4M */
+  capture = SDL_CreateFrameCapture(SDL_RWFromMem(buffer, (int)size), 1, SDL_CAPTURE_Y4M, 0, 1, SDL_CAPTURE_WAIT);
+  SDLTest_AssertPass("Call to SDL_CreateFrameCapture(...,SDL_CAPTURE_Y4M,fps=0,...)");
+  SDLTest_AssertCheck(capture == NULL, "Verify capture is NULL");
+  capture = SDL_CreateFrameCapture(SDL_RWFromMem(buffer, (int)size), 1, SDL_CAPTURE_Y4M, 30, 1, SDL_CAPTURE_WAIT);
+  SDLTest_AssertPass("Call to SDL_CreateFrameCapture(...,SDL_CAPTURE_Y4M,...)");
+  SDLTest_AssertCheck(capture != NULL, "Verify capture is not NULL");
+  if (capture != NULL) {
+     SDL_SetWindowCapture(window, capture);
+     result = SDL_UpdateWindowSurface(window);
+     SDLTest_AssertCheck(result == 0, "Verify SDL_UpdateWindowSurface() result; expected: 0, got: %d", result);
+     result = SDL_CloseFrameCapture(capture);
+     SDLTest_AssertPass("Call to SDL_CloseFrameCapture()");
+     SDLTest_AssertCheck(result == 0, "Verify result value; expected: 0, got: %d", result);
+
+     SDL_snprintf(header, sizeof(header), "YUV4MPEG2 W%d H%d F30:1 Ip A1:1 C420jpeg\nFRAME\n", w, h);
+     header_length = SDL_strlen(header);
+     SDLTest_AssertCheck(SDL_memcmp(buffer, header, header_length) == 0, "Verify Y4M header");
+     pixel = buffer + header_length;
+     SDLTest_AssertCheck(pixel[0] == 235, "Verify white luma; expected: 235, got: %d", pixel[0]);
+     pixel += w * h;
+     SDLTest_AssertCheck(pixel[0] == 128, "Verify white Cb; expected: 128, got: %d", pixel[0]);
+     pixel += ((w + 1) / 2) * ((h + 1) / 2);
+     SDLTest_AssertCheck(pixel[0] == 128, "Verify white Cr; expected: 128, got: %d", pixel[0]);
+  }
+
+  /* BMP, closed after the window is gone */
+  capture = SDL_CreateFrameCapture(SDL_RWFromMem(buffer, (int)size), 1, SDL_CAPTURE_BMP, 0, 1, SDL_CAPTURE_WAIT);
+  SDLTest_AssertPass("Call to SDL_CreateFrameCapture(...,SDL_CAPTURE_BMP,...)");
+  SDLTest_AssertCheck(capture != NULL, "Verify capture is not NULL");
+  if (capture != NULL) {
+     SDL_SetWindowCapture(window, capture);
+     SDL_FillRect(surface, NULL, SDL_MapRGB(surface->format, 0, 255, 0));
+     result = SDL_UpdateWindowSurface(window);
+     SDLTest_AssertCheck(result == 0, "Verify SDL_UpdateWindowSurface() result; expected: 0, got: %d", result);
+     _destroyVideoSuiteTestWindow(window);
+     window = NULL;
+     result = SDL_CloseFrameCapture(capture);
+     SDLTest_AssertPass("Call to SDL_CloseFrameCapture()");
+     SDLTest_AssertCheck(result == 0, "Verify result value; expected: 0, got: %d", result);
+
+     bmp = SDL_LoadBMP_RW(SDL_RWFromMem(buffer, (int)size), 1);
+     SDLTest_AssertCheck(bmp != NULL, "Verify BMP loaded");
+     if (bmp != NULL) {
+        SDLTest_AssertCheck(bmp->w == w && bmp->h == h,
+           "Verify BMP size; expected: %dx%d, got: %dx%d", w, h, bmp->w, bmp->h);
+        rgb = SDL_ConvertSurfaceFormat(bmp, SDL_PIXELFORMAT_RGB888, 0);
+        SDLTest_AssertCheck(rgb != NULL, "Verify BMP converted");
+        if (rgb != NULL) {
+           result = (int)(*(Uint32 *)rgb->pixels & 0x00ffffff);
+           SDLTest_AssertCheck(result == 0x00ff00, "Verify BMP pixel; expected: 0x00ff00, got: 0x%.6x", result);
+           SDL_FreeSurface(rgb);
+        }
+        SDL_FreeSurface(bmp);
+     }
+  }
+
+  SDL_free(buffer);
+  _destroyVideoSuiteTestWindow(window);
+
+  return TEST_COMPLETED;
+}
+
 /* ================= Test References ================== */
 
 /* Video test cases */
@@ -1795,13 +2139,22 @@ static const SDLTest_TestCaseReference videoTest22 =
 static const SDLTest_TestCaseReference videoTest23 =
         { (SDLTest_TestCaseFp)video_getSetWindowData, "video_getSetWindowData",  "Checks SDL_SetWindowData and SDL_GetWindowData positive and negative cases", TEST_ENABLED };
 
+static const SDLTest_TestCaseReference videoTest24 =
+        { (SDLTest_TestCaseFp)video_updateWindowSurfaceDamage, "video_updateWindowSurfaceDamage",  "Checks SDL_UpdateWindowSurface with damage tracking", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference videoTest25 =
+        { (SDLTest_TestCaseFp)video_frameCaptureRaw, "video_frameCaptureRaw",  "Checks recording window surface frames as raw RGB", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference videoTest26 =
+        { (SDLTest_TestCaseFp)video_frameCaptureY4MBMP, "video_frameCaptureY4MBMP",  "Checks recording window surface frames as Y4M and BMP", TEST_ENABLED };
+
 /* Sequence of Video test cases */
 static const SDLTest_TestCaseReference *videoTests[] =  {
     &videoTest1, &videoTest2, &videoTest3, &videoTest4, &videoTest5, &videoTest6,
     &videoTest7, &videoTest8, &videoTest9, &videoTest10, &videoTest11, &videoTest12,
     &videoTest13, &videoTest14, &videoTest15, &videoTest16, &videoTest17,
     &videoTest18, &videoTest19, &videoTest20, &videoTest21, &videoTest22,
-    &videoTest23, NULL
+    &videoTest23, &videoTest24, &videoTest25, &videoTest26, NULL
 };
 
 /* Video test suite (global) */
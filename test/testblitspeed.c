@@ -0,0 +1,698 @@
+/*
+  Copyright (C) 1997-2014 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Test program to measure the speed of the software blitters:
+   testblitspeed [--iterations N] [--size WxH] [--sweep] [--threads N] [--scaling N] [--align N] [filter]
+   Only cases whose name contains 'filter' are run.  --sweep runs every
+   case at several sizes from 320x240 up to 1920x1080.  --threads sets
+   SDL_HINT_SOFTWARE_THREADS, which the conversion and yuv cases use.
+   --scaling N runs every case once with each thread count from 1 to N.  --align
+   sets SDL_HINT_SURFACE_ALIGNMENT, so every surface is allocated with an
+   aligned pitch (16, 32 or 64).  The yuv cases time SDL_UpdateTexture()
+   on a YUV texture of the software renderer, which converts the frame to
+   the renderer's RGB texture.  "yuv update NV12 as YV12" times the old
+   way of showing an NV12 frame: de-interleave the chroma, then call
+   SDL_UpdateYUVTexture() on a YV12 texture.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "SDL.h"
+
+#define DEFAULT_WIDTH       1024
+#define DEFAULT_HEIGHT      768
+#define DEFAULT_ITERATIONS  100
+
+typedef struct
+{
+    const char *name;
+    Uint32 src_format;
+    Uint32 dst_format;
+    SDL_BlendMode blend;
+    Uint8 alpha;
+    const char *scale_quality;  /* if set, a half size source is scaled up by the software renderer */
+    SDL_bool colorkey;          /* if set, a quarter of the source pixels are transparent */
+    double angle;               /* if set with scale_quality, the scaled source is also rotated */
+} BlitCase;
+
+static const BlitCase blit_cases[] = {
+    { "copy ARGB8888->ARGB8888", SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, SDL_BLENDMODE_NONE, 255, NULL },
+    { "pixel alpha ARGB8888->ARGB8888", SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, SDL_BLENDMODE_BLEND, 255, NULL },
+    { "pixel alpha ARGB8888->RGB888", SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, SDL_BLENDMODE_BLEND, 255, NULL },
+    { "pixel alpha ARGB8888->RGB565", SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB565, SDL_BLENDMODE_BLEND, 255, NULL },
+    { "pixel alpha ARGB8888->RGB555", SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB555, SDL_BLENDMODE_BLEND, 255, NULL },
+    { "premultiplied ARGB8888->ARGB8888", SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, SDL_BLENDMODE_PREMULTIPLIED, 255, NULL },
+    { "premultiplied ARGB8888->RGB888", SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, SDL_BLENDMODE_PREMULTIPLIED, 255, NULL },
+    { "premultiplied 50% ARGB8888->RGB888", SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, SDL_BLENDMODE_PREMULTIPLIED, 128, NULL },
+    { "surface alpha RGB888->RGB888", SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, SDL_BLENDMODE_BLEND, 100, NULL },
+    { "surface alpha RGB565->RGB565", SDL_PIXELFORMAT_RGB565, SDL_PIXELFORMAT_RGB565, SDL_BLENDMODE_BLEND, 100, NULL },
+    { "surface alpha RGB555->RGB555", SDL_PIXELFORMAT_RGB555, SDL_PIXELFORMAT_RGB555, SDL_BLENDMODE_BLEND, 100, NULL },
+    { "surface alpha 50% RGB565->RGB565", SDL_PIXELFORMAT_RGB565, SDL_PIXELFORMAT_RGB565, SDL_BLENDMODE_BLEND, 128, NULL },
+    { "render scaled nearest ARGB8888", SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, SDL_BLENDMODE_NONE, 255, "nearest" },
+    { "render scaled linear ARGB8888", SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, SDL_BLENDMODE_NONE, 255, "linear" },
+    { "render scaled linear blend ARGB8888", SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, SDL_BLENDMODE_BLEND, 255, "linear" },
+    { "render scaled nearest RGB565", SDL_PIXELFORMAT_RGB565, SDL_PIXELFORMAT_RGB565, SDL_BLENDMODE_NONE, 255, "nearest" },
+    { "render scaled linear RGB565", SDL_PIXELFORMAT_RGB565, SDL_PIXELFORMAT_RGB565, SDL_BLENDMODE_NONE, 255, "linear" },
+    { "render rotated nearest ARGB8888", SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, SDL_BLENDMODE_NONE, 255, "nearest", SDL_FALSE, 30.0 },
+    { "render rotated linear ARGB8888", SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, SDL_BLENDMODE_NONE, 255, "linear", SDL_FALSE, 30.0 },
+    { "render rotated linear blend ARGB8888", SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, SDL_BLENDMODE_BLEND, 255, "linear", SDL_FALSE, 30.0 },
+    { "render rotated nearest RGB565", SDL_PIXELFORMAT_RGB565, SDL_PIXELFORMAT_RGB565, SDL_BLENDMODE_NONE, 255, "nearest", SDL_FALSE, 30.0 },
+    { "copy INDEX8->ARGB8888", SDL_PIXELFORMAT_INDEX8, SDL_PIXELFORMAT_ARGB8888, SDL_BLENDMODE_NONE, 255, NULL },
+    { "copy INDEX8->RGB565", SDL_PIXELFORMAT_INDEX8, SDL_PIXELFORMAT_RGB565, SDL_BLENDMODE_NONE, 255, NULL },
+    { "colorkey INDEX8->ARGB8888", SDL_PIXELFORMAT_INDEX8, SDL_PIXELFORMAT_ARGB8888, SDL_BLENDMODE_NONE, 255, NULL, SDL_TRUE },
+    { "colorkey INDEX8->RGB565", SDL_PIXELFORMAT_INDEX8, SDL_PIXELFORMAT_RGB565, SDL_BLENDMODE_NONE, 255, NULL, SDL_TRUE },
+    { "copy INDEX1MSB->ARGB8888", SDL_PIXELFORMAT_INDEX1MSB, SDL_PIXELFORMAT_ARGB8888, SDL_BLENDMODE_NONE, 255, NULL },
+    { "colorkey INDEX1MSB->ARGB8888", SDL_PIXELFORMAT_INDEX1MSB, SDL_PIXELFORMAT_ARGB8888, SDL_BLENDMODE_NONE, 255, NULL, SDL_TRUE },
+    { "copy RGB24->ARGB8888", SDL_PIXELFORMAT_RGB24, SDL_PIXELFORMAT_ARGB8888, SDL_BLENDMODE_NONE, 255, NULL },
+    { "copy BGR24->ABGR8888", SDL_PIXELFORMAT_BGR24, SDL_PIXELFORMAT_ABGR8888, SDL_BLENDMODE_NONE, 255, NULL },
+    { "copy ARGB8888->RGB24", SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB24, SDL_BLENDMODE_NONE, 255, NULL },
+    { "copy ARGB8888->BGR24", SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR24, SDL_BLENDMODE_NONE, 255, NULL },
+    { "copy ARGB8888->ABGR8888", SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ABGR8888, SDL_BLENDMODE_NONE, 255, NULL },
+    { "colorkey RGB888->RGB888", SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, SDL_BLENDMODE_NONE, 255, NULL, SDL_TRUE },
+    { "colorkey ARGB8888->ARGB8888", SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, SDL_BLENDMODE_NONE, 255, NULL, SDL_TRUE },
+    { "colorkey RGB24->ARGB8888", SDL_PIXELFORMAT_RGB24, SDL_PIXELFORMAT_ARGB8888, SDL_BLENDMODE_NONE, 255, NULL, SDL_TRUE },
+    { "colorkey ARGB8888->RGB24", SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB24, SDL_BLENDMODE_NONE, 255, NULL, SDL_TRUE },
+    { "colorkey RGB565->RGB565", SDL_PIXELFORMAT_RGB565, SDL_PIXELFORMAT_RGB565, SDL_BLENDMODE_NONE, 255, NULL, SDL_TRUE },
+};
+
+static const struct
+{
+    int w, h;
+} sweep_sizes[] = {
+    { 320, 240 }, { 640, 480 }, { 1280, 720 }, { 1366, 768 }, { 1920, 1080 }
+};
+
+typedef struct
+{
+    const char *name;
+    Uint32 format;
+    int count;                  /* 0 fills the whole surface, 1 a rect inset by one pixel, more are overlapping rects */
+} FillCase;
+
+static const FillCase fill_cases[] = {
+    { "fill ARGB8888", SDL_PIXELFORMAT_ARGB8888, 0 },
+    { "fill rect ARGB8888", SDL_PIXELFORMAT_ARGB8888, 1 },
+    { "fill 16 overlapping rects ARGB8888", SDL_PIXELFORMAT_ARGB8888, 16 },
+    { "fill RGB24", SDL_PIXELFORMAT_RGB24, 0 },
+    { "fill 16 overlapping rects RGB24", SDL_PIXELFORMAT_RGB24, 16 },
+    { "fill RGB565", SDL_PIXELFORMAT_RGB565, 0 },
+    { "fill INDEX8", SDL_PIXELFORMAT_INDEX8, 0 },
+};
+
+typedef struct
+{
+    const char *name;
+    Uint32 src_format;
+    Uint32 dst_format;
+} ConvertCase;
+
+static const ConvertCase convert_cases[] = {
+    { "convert ARGB8888->ABGR8888", SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ABGR8888 },
+    { "convert ARGB8888->RGB565", SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB565 },
+    { "convert RGB565->ARGB8888", SDL_PIXELFORMAT_RGB565, SDL_PIXELFORMAT_ARGB8888 },
+    { "convert RGB24->ARGB8888", SDL_PIXELFORMAT_RGB24, SDL_PIXELFORMAT_ARGB8888 },
+};
+
+typedef struct
+{
+    const char *name;
+    Uint32 dst_format;
+    SDL_BlendMode blend;
+    SDL_bool modulate;          /* if set, the sprites are tinted and fade in and out */
+    SDL_bool rle;
+} SpriteCase;
+
+#define SPRITE_SIZE     64
+#define SPRITE_COLUMNS  8
+
+static const SpriteCase sprite_cases[] = {
+    { "sprites ARGB8888->RGB888", SDL_PIXELFORMAT_RGB888, SDL_BLENDMODE_BLEND, SDL_FALSE, SDL_FALSE },
+    { "sprites RLE ARGB8888->RGB888", SDL_PIXELFORMAT_RGB888, SDL_BLENDMODE_BLEND, SDL_FALSE, SDL_TRUE },
+    { "sprites tint+fade ARGB8888->RGB888", SDL_PIXELFORMAT_RGB888, SDL_BLENDMODE_BLEND, SDL_TRUE, SDL_FALSE },
+    { "sprites add ARGB8888->RGB888", SDL_PIXELFORMAT_RGB888, SDL_BLENDMODE_ADD, SDL_TRUE, SDL_FALSE },
+    { "sprites tint+fade ARGB8888->ARGB8888", SDL_PIXELFORMAT_ARGB8888, SDL_BLENDMODE_BLEND, SDL_TRUE, SDL_FALSE },
+};
+
+typedef struct
+{
+    const char *name;
+    Uint32 src_format;          /* each source pixel is mapped to a random 256 color palette */
+} MapCase;
+
+static const MapCase map_cases[] = {
+    { "map ARGB8888->INDEX8", SDL_PIXELFORMAT_ARGB8888 },
+    { "map RGB565->INDEX8", SDL_PIXELFORMAT_RGB565 },
+};
+
+typedef struct
+{
+    const char *name;
+    Uint32 format;
+    SDL_bool from_nv12;         /* if set, an NV12 frame is split into U and V planes first */
+} YUVCase;
+
+static const YUVCase yuv_cases[] = {
+    { "yuv update YV12", SDL_PIXELFORMAT_YV12 },
+    { "yuv update IYUV", SDL_PIXELFORMAT_IYUV },
+    { "yuv update YUY2", SDL_PIXELFORMAT_YUY2 },
+    { "yuv update UYVY", SDL_PIXELFORMAT_UYVY },
+    { "yuv update YVYU", SDL_PIXELFORMAT_YVYU },
+    { "yuv update NV12", SDL_PIXELFORMAT_NV12 },
+    { "yuv update NV21", SDL_PIXELFORMAT_NV21 },
+    { "yuv update NV12 as YV12", SDL_PIXELFORMAT_YV12, SDL_TRUE },
+};
+
+static SDL_Surface *
+CreateSurface(Uint32 format, int w, int h)
+{
+    SDL_Surface *surface;
+    int bpp, x, y;
+    Uint32 Rmask, Gmask, Bmask, Amask;
+
+    if (!SDL_PixelFormatEnumToMasks(format, &bpp, &Rmask, &Gmask, &Bmask, &Amask)) {
+        return NULL;
+    }
+    surface = SDL_CreateRGBSurface(0, w, h, bpp, Rmask, Gmask, Bmask, Amask);
+    if (!surface) {
+        return NULL;
+    }
+
+    /* Fill with noise, so the blitters can't take shortcuts */
+    for (y = 0; y < h; ++y) {
+        Uint8 *row = (Uint8 *) surface->pixels + y * surface->pitch;
+        for (x = 0; x < surface->pitch; ++x) {
+            row[x] = (Uint8) rand();
+        }
+    }
+    if (surface->format->palette) {
+        SDL_Palette *palette = surface->format->palette;
+        for (x = 0; x < palette->ncolors; ++x) {
+            palette->colors[x].r = (Uint8) rand();
+            palette->colors[x].g = (Uint8) rand();
+            palette->colors[x].b = (Uint8) rand();
+        }
+    }
+    return surface;
+}
+
+static int
+RenderScaled(SDL_Surface *src, SDL_Surface *dst, const BlitCase *bc, int iterations)
+{
+    SDL_Renderer *renderer;
+    SDL_Texture *texture;
+    int i;
+
+    SDL_SetHint(SDL_HINT_RENDER_SCALE_QUALITY, bc->scale_quality);
+    renderer = SDL_CreateSoftwareRenderer(dst);
+    if (!renderer) {
+        return -1;
+    }
+    texture = SDL_CreateTexture(renderer, bc->src_format, SDL_TEXTUREACCESS_STATIC, src->w, src->h);
+    if (!texture) {
+        SDL_DestroyRenderer(renderer);
+        return -1;
+    }
+    SDL_UpdateTexture(texture, NULL, src->pixels, src->pitch);
+    SDL_SetTextureBlendMode(texture, bc->blend);
+    for (i = 0; i < iterations; ++i) {
+        if (bc->angle != 0.0) {
+            SDL_RenderCopyEx(renderer, texture, NULL, NULL, bc->angle, NULL, SDL_FLIP_NONE);
+        } else {
+            SDL_RenderCopy(renderer, texture, NULL, NULL);
+        }
+    }
+    SDL_DestroyTexture(texture);
+    SDL_DestroyRenderer(renderer);
+    return 0;
+}
+
+static void
+RunBlitCase(const BlitCase *bc, int w, int h, int iterations)
+{
+    SDL_Surface *src = bc->scale_quality ? CreateSurface(bc->src_format, w / 2, h / 2)
+                                         : CreateSurface(bc->src_format, w, h);
+    SDL_Surface *dst = CreateSurface(bc->dst_format, w, h);
+    Uint64 start, elapsed;
+    double ms;
+    int i;
+
+    if (!src || !dst) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create surfaces for '%s': %s\n", bc->name, SDL_GetError());
+        SDL_FreeSurface(src);
+        SDL_FreeSurface(dst);
+        return;
+    }
+    SDL_SetSurfaceBlendMode(src, bc->blend);
+    SDL_SetSurfaceAlphaMod(src, bc->alpha);
+    if (bc->colorkey) {
+        /* Clear about a quarter of the pixels to the colorkey */
+        const int bpp = src->format->BytesPerPixel;
+        SDL_SetColorKey(src, SDL_TRUE, 0);
+        if (src->format->BitsPerPixel >= 8) {
+            for (i = 0; i + bpp <= src->h * src->pitch; i += bpp) {
+                if ((((Uint8 *) src->pixels)[i] & 3) == 0) {
+                    SDL_memset((Uint8 *) src->pixels + i, 0, bpp);
+                }
+            }
+        }
+    }
+
+    if (bc->scale_quality) {
+        start = SDL_GetPerformanceCounter();
+        if (RenderScaled(src, dst, bc, iterations) < 0) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't render '%s': %s\n", bc->name, SDL_GetError());
+        }
+        elapsed = SDL_GetPerformanceCounter() - start;
+    } else {
+        /* Warm up, this also builds the blit mapping */
+        SDL_BlitSurface(src, NULL, dst, NULL);
+
+        start = SDL_GetPerformanceCounter();
+        for (i = 0; i < iterations; ++i) {
+            SDL_BlitSurface(src, NULL, dst, NULL);
+        }
+        elapsed = SDL_GetPerformanceCounter() - start;
+    }
+
+    ms = (double) elapsed * 1000.0 / SDL_GetPerformanceFrequency() / iterations;
+    SDL_Log("%-40s %8.3f ms/blit %10.1f Mpixels/s\n", bc->name, ms,
+            (ms > 0.0) ? ((double) w * h / (ms * 1000.0)) : 0.0);
+
+    SDL_FreeSurface(src);
+    SDL_FreeSurface(dst);
+}
+
+static void
+RunFillCase(const FillCase *fc, int w, int h, int iterations)
+{
+    SDL_Surface *dst = CreateSurface(fc->format, w, h);
+    SDL_Rect rects[16];
+    Uint64 start, elapsed;
+    double ms;
+    int i;
+
+    if (!dst) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create surface for '%s': %s\n", fc->name, SDL_GetError());
+        return;
+    }
+    if (fc->count == 1) {
+        rects[0].x = rects[0].y = 1;
+        rects[0].w = SDL_max(w - 2, 0);
+        rects[0].h = SDL_max(h - 2, 0);
+    } else {
+        /* Half size rects on a 4x4 grid of eighths, so they overlap a lot */
+        for (i = 0; i < fc->count && i < SDL_arraysize(rects); ++i) {
+            rects[i].x = (i % 4) * w / 8;
+            rects[i].y = (i / 4) * h / 8;
+            rects[i].w = w / 2;
+            rects[i].h = h / 2;
+        }
+    }
+
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < iterations; ++i) {
+        if (fc->count == 0) {
+            SDL_FillRect(dst, NULL, (Uint32) i);
+        } else {
+            SDL_FillRects(dst, rects, SDL_min(fc->count, SDL_arraysize(rects)), (Uint32) i);
+        }
+    }
+    elapsed = SDL_GetPerformanceCounter() - start;
+
+    ms = (double) elapsed * 1000.0 / SDL_GetPerformanceFrequency() / iterations;
+    SDL_Log("%-40s %8.3f ms/fill %10.1f Mpixels/s\n", fc->name, ms,
+            (ms > 0.0) ? ((double) w * h / (ms * 1000.0)) : 0.0);
+
+    SDL_FreeSurface(dst);
+}
+
+static void
+RunConvertCase(const ConvertCase *cc, int w, int h, int iterations)
+{
+    SDL_Surface *src = CreateSurface(cc->src_format, w, h);
+    SDL_Surface *dst = CreateSurface(cc->dst_format, w, h);
+    Uint64 start, elapsed;
+    double ms;
+    int i;
+
+    if (!src || !dst) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create surfaces for '%s': %s\n", cc->name, SDL_GetError());
+        SDL_FreeSurface(src);
+        SDL_FreeSurface(dst);
+        return;
+    }
+
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < iterations; ++i) {
+        SDL_ConvertPixels(w, h, cc->src_format, src->pixels, src->pitch,
+                          cc->dst_format, dst->pixels, dst->pitch);
+    }
+    elapsed = SDL_GetPerformanceCounter() - start;
+
+    ms = (double) elapsed * 1000.0 / SDL_GetPerformanceFrequency() / iterations;
+    SDL_Log("%-40s %8.3f ms/blit %10.1f Mpixels/s\n", cc->name, ms,
+            (ms > 0.0) ? ((double) w * h / (ms * 1000.0)) : 0.0);
+
+    SDL_FreeSurface(src);
+    SDL_FreeSurface(dst);
+}
+
+/* A sheet of round sprites with opaque insides, antialiased edges and
+   transparent corners, the way most sprite sheets look */
+static SDL_Surface *
+CreateSpriteSheet(void)
+{
+    const int size = SPRITE_COLUMNS * SPRITE_SIZE;
+    SDL_Surface *sheet = CreateSurface(SDL_PIXELFORMAT_ARGB8888, size, size);
+    int x, y;
+
+    if (!sheet) {
+        return NULL;
+    }
+    for (y = 0; y < size; ++y) {
+        Uint32 *row = (Uint32 *) ((Uint8 *) sheet->pixels + y * sheet->pitch);
+        for (x = 0; x < size; ++x) {
+            const int frame = (y / SPRITE_SIZE) * SPRITE_COLUMNS + x / SPRITE_SIZE;
+            const int radius = SPRITE_SIZE / 4 + frame % (SPRITE_SIZE / 4);
+            const int dx = x % SPRITE_SIZE - SPRITE_SIZE / 2;
+            const int dy = y % SPRITE_SIZE - SPRITE_SIZE / 2;
+            const int edge = radius * radius - (dx * dx + dy * dy);
+            Uint32 alpha;
+
+            if (edge <= 0) {
+                alpha = 0;
+            } else if (edge >= 4 * radius) {
+                alpha = 255;
+            } else {
+                alpha = edge * 255 / (4 * radius);
+            }
+            row[x] = (alpha << 24) | (row[x] & 0x00FFFFFF);
+        }
+    }
+    return sheet;
+}
+
+static void
+RunSpriteCase(const SpriteCase *sc, int w, int h, int iterations)
+{
+    SDL_Surface *sheet = CreateSpriteSheet();
+    SDL_Surface *dst = CreateSurface(sc->dst_format, w, h);
+    Uint64 start, elapsed;
+    double ms;
+    int i, x, y, frame;
+
+    if (!sheet || !dst) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create surfaces for '%s': %s\n", sc->name, SDL_GetError());
+        SDL_FreeSurface(sheet);
+        SDL_FreeSurface(dst);
+        return;
+    }
+    SDL_SetSurfaceBlendMode(sheet, sc->blend);
+    if (sc->modulate) {
+        SDL_SetSurfaceColorMod(sheet, 255, 160, 96);
+        SDL_SetSurfaceAlphaMod(sheet, 192);
+    }
+    SDL_SetSurfaceRLE(sheet, sc->rle);
+
+    /* Warm up, this also builds the blit mapping and the RLE encoding */
+    SDL_BlitSurface(sheet, NULL, dst, NULL);
+    if (sc->rle && !(sheet->flags & SDL_RLEACCEL)) {
+        SDL_Log("%-40s not RLE encoded\n", sc->name);
+    }
+
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < iterations; ++i) {
+        if (sc->modulate) {
+            SDL_SetSurfaceAlphaMod(sheet, (Uint8) (64 + i % 128));
+        }
+        frame = i;
+        for (y = 0; y < h; y += SPRITE_SIZE) {
+            for (x = 0; x < w; x += SPRITE_SIZE) {
+                SDL_Rect srcrect, dstrect;
+                frame = (frame + 1) % (SPRITE_COLUMNS * SPRITE_COLUMNS);
+                srcrect.x = (frame % SPRITE_COLUMNS) * SPRITE_SIZE;
+                srcrect.y = (frame / SPRITE_COLUMNS) * SPRITE_SIZE;
+                srcrect.w = srcrect.h = SPRITE_SIZE;
+                dstrect.x = x;
+                dstrect.y = y;
+                SDL_BlitSurface(sheet, &srcrect, dst, &dstrect);
+            }
+        }
+    }
+    elapsed = SDL_GetPerformanceCounter() - start;
+
+    ms = (double) elapsed * 1000.0 / SDL_GetPerformanceFrequency() / iterations;
+    SDL_Log("%-40s %8.3f ms/frame %10.1f Mpixels/s\n", sc->name, ms,
+            (ms > 0.0) ? ((double) w * h / (ms * 1000.0)) : 0.0);
+
+    SDL_FreeSurface(sheet);
+    SDL_FreeSurface(dst);
+}
+
+static void
+RunMapCase(const MapCase *mc, int w, int h, int iterations)
+{
+    SDL_Surface *src = CreateSurface(mc->src_format, w, h);
+    SDL_Surface *dst = CreateSurface(SDL_PIXELFORMAT_INDEX8, w, h);
+    Uint64 start, elapsed;
+    double ms;
+    Uint8 r, g, b;
+    int i, x, y;
+
+    if (!src || !dst) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create surfaces for '%s': %s\n", mc->name, SDL_GetError());
+        SDL_FreeSurface(src);
+        SDL_FreeSurface(dst);
+        return;
+    }
+
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < iterations; ++i) {
+        /* Start from a fresh palette version, like an application that
+           loads a new palette for each image it quantizes */
+        SDL_SetPaletteColors(dst->format->palette, dst->format->palette->colors, 0, dst->format->palette->ncolors);
+        for (y = 0; y < h; ++y) {
+            const Uint8 *srcrow = (const Uint8 *) src->pixels + y * src->pitch;
+            Uint8 *dstrow = (Uint8 *) dst->pixels + y * dst->pitch;
+            for (x = 0; x < w; ++x) {
+                Uint32 pixel;
+                if (src->format->BytesPerPixel == 4) {
+                    pixel = ((const Uint32 *) srcrow)[x];
+                } else {
+                    pixel = ((const Uint16 *) srcrow)[x];
+                }
+                SDL_GetRGB(pixel, src->format, &r, &g, &b);
+                dstrow[x] = (Uint8) SDL_MapRGB(dst->format, r, g, b);
+            }
+        }
+    }
+    elapsed = SDL_GetPerformanceCounter() - start;
+
+    ms = (double) elapsed * 1000.0 / SDL_GetPerformanceFrequency() / iterations;
+    SDL_Log("%-40s %8.3f ms/blit %10.1f Mpixels/s\n", mc->name, ms,
+            (ms > 0.0) ? ((double) w * h / (ms * 1000.0)) : 0.0);
+
+    SDL_FreeSurface(src);
+    SDL_FreeSurface(dst);
+}
+
+static void
+RunYUVCase(const YUVCase *yc, int w, int h, int iterations)
+{
+    SDL_Surface *dst = CreateSurface(SDL_PIXELFORMAT_ARGB8888, w, h);
+    SDL_Renderer *renderer = NULL;
+    SDL_Texture *texture = NULL;
+    Uint8 *frame = NULL;
+    Uint8 *uplane = NULL;
+    Uint8 *vplane = NULL;
+    const int pitch = (yc->format == SDL_PIXELFORMAT_YV12 ||
+                       yc->format == SDL_PIXELFORMAT_IYUV ||
+                       yc->format == SDL_PIXELFORMAT_NV12 ||
+                       yc->format == SDL_PIXELFORMAT_NV21) ? w : w * 2;
+    Uint64 start, elapsed;
+    double ms;
+    int i, j;
+
+    w &= ~1;
+    h &= ~1;
+    if (dst) {
+        renderer = SDL_CreateSoftwareRenderer(dst);
+    }
+    if (renderer) {
+        texture = SDL_CreateTexture(renderer, yc->format, SDL_TEXTUREACCESS_STREAMING, w, h);
+    }
+    if (texture) {
+        frame = (Uint8 *) SDL_malloc(w * h * 2);
+    }
+    if (frame && yc->from_nv12) {
+        uplane = (Uint8 *) SDL_malloc((w / 2) * (h / 2));
+        vplane = (Uint8 *) SDL_malloc((w / 2) * (h / 2));
+        if (!uplane || !vplane) {
+            SDL_free(frame);
+            frame = NULL;
+        }
+    }
+    if (!frame) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create texture for '%s': %s\n", yc->name, SDL_GetError());
+        goto done;
+    }
+    for (i = 0; i < w * h * 2; ++i) {
+        frame[i] = (Uint8) rand();
+    }
+
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < iterations; ++i) {
+        if (yc->from_nv12) {
+            const Uint8 *uv = frame + w * h;
+
+            for (j = 0; j < (w / 2) * (h / 2); ++j) {
+                uplane[j] = uv[2 * j];
+                vplane[j] = uv[2 * j + 1];
+            }
+            SDL_UpdateYUVTexture(texture, NULL, frame, w, uplane, w / 2, vplane, w / 2);
+        } else {
+            SDL_UpdateTexture(texture, NULL, frame, pitch);
+        }
+    }
+    elapsed = SDL_GetPerformanceCounter() - start;
+
+    ms = (double) elapsed * 1000.0 / SDL_GetPerformanceFrequency() / iterations;
+    SDL_Log("%-40s %8.3f ms/frame %10.1f Mpixels/s\n", yc->name, ms,
+            (ms > 0.0) ? ((double) w * h / (ms * 1000.0)) : 0.0);
+
+done:
+    SDL_free(frame);
+    SDL_free(uplane);
+    SDL_free(vplane);
+    if (texture) {
+        SDL_DestroyTexture(texture);
+    }
+    if (renderer) {
+        SDL_DestroyRenderer(renderer);
+    }
+    SDL_FreeSurface(dst);
+}
+
+static void
+RunCases(int w, int h, int iterations, const char *filter)
+{
+    int i;
+
+    for (i = 0; i < SDL_arraysize(blit_cases); ++i) {
+        if (filter && !SDL_strstr(blit_cases[i].name, filter)) {
+            continue;
+        }
+        RunBlitCase(&blit_cases[i], w, h, iterations);
+    }
+    for (i = 0; i < SDL_arraysize(convert_cases); ++i) {
+        if (filter && !SDL_strstr(convert_cases[i].name, filter)) {
+            continue;
+        }
+        RunConvertCase(&convert_cases[i], w, h, iterations);
+    }
+    for (i = 0; i < SDL_arraysize(sprite_cases); ++i) {
+        if (filter && !SDL_strstr(sprite_cases[i].name, filter)) {
+            continue;
+        }
+        RunSpriteCase(&sprite_cases[i], w, h, iterations);
+    }
+    for (i = 0; i < SDL_arraysize(map_cases); ++i) {
+        if (filter && !SDL_strstr(map_cases[i].name, filter)) {
+            continue;
+        }
+        RunMapCase(&map_cases[i], w, h, iterations);
+    }
+    for (i = 0; i < SDL_arraysize(fill_cases); ++i) {
+        if (filter && !SDL_strstr(fill_cases[i].name, filter)) {
+            continue;
+        }
+        RunFillCase(&fill_cases[i], w, h, iterations);
+    }
+    for (i = 0; i < SDL_arraysize(yuv_cases); ++i) {
+        if (filter && !SDL_strstr(yuv_cases[i].name, filter)) {
+            continue;
+        }
+        RunYUVCase(&yuv_cases[i], w, h, iterations);
+    }
+}
+
+int
+main(int argc, char *argv[])
+{
+    int w = DEFAULT_WIDTH;
+    int h = DEFAULT_HEIGHT;
+    int iterations = DEFAULT_ITERATIONS;
+    SDL_bool sweep = SDL_FALSE;
+    int scaling = 0;
+    const char *filter = NULL;
+    char threads[16];
+    int i, j;
+
+    /* Enable standard application logging */
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    for (i = 1; i < argc; ++i) {
+        if (SDL_strcmp(argv[i], "--iterations") == 0 && argv[i + 1]) {
+            iterations = SDL_atoi(argv[++i]);
+            if (iterations <= 0) {
+                iterations = 1;
+            }
+        } else if (SDL_strcmp(argv[i], "--size") == 0 && argv[i + 1]) {
+            if (SDL_sscanf(argv[++i], "%dx%d", &w, &h) != 2 || w <= 0 || h <= 0) {
+                SDL_Log("Invalid size '%s'\n", argv[i]);
+                return 1;
+            }
+        } else if (SDL_strcmp(argv[i], "--sweep") == 0) {
+            sweep = SDL_TRUE;
+        } else if (SDL_strcmp(argv[i], "--threads") == 0 && argv[i + 1]) {
+            SDL_SetHint(SDL_HINT_SOFTWARE_THREADS, argv[++i]);
+        } else if (SDL_strcmp(argv[i], "--scaling") == 0 && argv[i + 1]) {
+            scaling = SDL_atoi(argv[++i]);
+        } else if (SDL_strcmp(argv[i], "--align") == 0 && argv[i + 1]) {
+            SDL_SetHint(SDL_HINT_SURFACE_ALIGNMENT, argv[++i]);
+        } else if (argv[i][0] != '-') {
+            filter = argv[i];
+        } else {
+            SDL_Log("Usage: %s [--iterations N] [--size WxH] [--sweep] [--threads N] [--scaling N] [--align N] [filter]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    if (SDL_Init(0) < 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't initialize SDL: %s\n", SDL_GetError());
+        return 1;
+    }
+
+    for (j = 0; j < (sweep ? SDL_arraysize(sweep_sizes) : 1); ++j) {
+        if (sweep) {
+            w = sweep_sizes[j].w;
+            h = sweep_sizes[j].h;
+        }
+        if (scaling <= 0) {
+            SDL_Log("Blitting %dx%d, %d iterations per case\n", w, h, iterations);
+            RunCases(w, h, iterations, filter);
+            continue;
+        }
+        for (i = 1; i <= scaling; ++i) {
+            SDL_snprintf(threads, sizeof(threads), "%d", i);
+            SDL_SetHint(SDL_HINT_SOFTWARE_THREADS, threads);
+            SDL_Log("Blitting %dx%d, %d iterations per case, %d threads\n", w, h, iterations, i);
+            RunCases(w, h, iterations, filter);
+        }
+    }
+
+    SDL_Quit();
+    return 0;
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -0,0 +1,198 @@
+/*
+  Copyright (C) 1997-2014 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Test program to measure how many frames per second the window surface
+   can be presented at:
+   testwinsurface [--frames N] [--size WxH] [--thread] [filter]
+   Only cases whose name contains 'filter' are run.  "full" redraws and
+   presents the whole surface every frame.  The "sprite" cases move a small
+   square over a static background, and present either the whole surface,
+   the rectangles passed to SDL_UpdateWindowSurfaceRects(), or the damage
+   recorded with SDL_HINT_WINDOW_SURFACE_DAMAGE set.  --thread presents an
+   accelerated surface from a separate thread, see SDL_HINT_FRAMEBUFFER_THREAD.
+   It runs under Xvfb, e.g. xvfb-run ./testwinsurface
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "SDL.h"
+
+#define DEFAULT_WIDTH       1024
+#define DEFAULT_HEIGHT      768
+#define DEFAULT_FRAMES      500
+#define SPRITE_SIZE         64
+
+typedef enum
+{
+    UPDATE_FULL,
+    UPDATE_RECTS,
+    UPDATE_DAMAGE
+} UpdateMode;
+
+typedef struct
+{
+    const char *name;
+    SDL_bool sprite;
+    UpdateMode mode;
+} UpdateCase;
+
+static const UpdateCase update_cases[] = {
+    { "full redraw, full update", SDL_FALSE, UPDATE_FULL },
+    { "full redraw, damage", SDL_FALSE, UPDATE_DAMAGE },
+    { "sprite, full update", SDL_TRUE, UPDATE_FULL },
+    { "sprite, rects", SDL_TRUE, UPDATE_RECTS },
+    { "sprite, damage", SDL_TRUE, UPDATE_DAMAGE },
+};
+
+static void
+DrawBackground(SDL_Surface *surface)
+{
+    SDL_Rect rect;
+    Uint32 colors[2];
+
+    colors[0] = SDL_MapRGB(surface->format, 0x30, 0x30, 0x40);
+    colors[1] = SDL_MapRGB(surface->format, 0x50, 0x50, 0x60);
+    rect.w = rect.h = 32;
+    for (rect.y = 0; rect.y < surface->h; rect.y += rect.h) {
+        for (rect.x = 0; rect.x < surface->w; rect.x += rect.w) {
+            SDL_FillRect(surface, &rect, colors[((rect.x ^ rect.y) / 32) & 1]);
+        }
+    }
+}
+
+static void
+MoveSprite(SDL_Rect *pos, int frame, int w, int h)
+{
+    pos->x = (frame * 7) % (w - SPRITE_SIZE);
+    pos->y = (frame * 3) % (h - SPRITE_SIZE);
+    pos->w = SPRITE_SIZE;
+    pos->h = SPRITE_SIZE;
+}
+
+static void
+RunCase(const UpdateCase *test, int w, int h, int frames)
+{
+    SDL_Window *window;
+    SDL_Surface *surface;
+    SDL_Event event;
+    SDL_Rect rects[2];
+    Uint32 color;
+    Uint64 start, end;
+    int i;
+
+    SDL_SetHint(SDL_HINT_WINDOW_SURFACE_DAMAGE, test->mode == UPDATE_DAMAGE ? "1" : "0");
+
+    window = SDL_CreateWindow(test->name, SDL_WINDOWPOS_UNDEFINED, SDL_WINDOWPOS_UNDEFINED,
+                              w, h, 0);
+    if (!window) {
+        SDL_Log("%-28s couldn't create window: %s\n", test->name, SDL_GetError());
+        return;
+    }
+    surface = SDL_GetWindowSurface(window);
+    if (!surface) {
+        SDL_Log("%-28s couldn't get window surface: %s\n", test->name, SDL_GetError());
+        SDL_DestroyWindow(window);
+        return;
+    }
+
+    DrawBackground(surface);
+    SDL_UpdateWindowSurface(window);
+    while (SDL_PollEvent(&event)) {
+    }
+
+    color = SDL_MapRGB(surface->format, 0xFF, 0xC0, 0x20);
+    MoveSprite(&rects[1], 0, w, h);
+    start = SDL_GetPerformanceCounter();
+    for (i = 1; i <= frames; ++i) {
+        if (test->sprite) {
+            /* Restore the background under the old position, then draw */
+            rects[0] = rects[1];
+            SDL_SetClipRect(surface, &rects[0]);
+            DrawBackground(surface);
+            SDL_SetClipRect(surface, NULL);
+            MoveSprite(&rects[1], i, w, h);
+            SDL_FillRect(surface, &rects[1], color);
+        } else {
+            SDL_FillRect(surface, NULL, SDL_MapRGB(surface->format, i, i * 3, i * 5));
+        }
+
+        if (test->mode == UPDATE_RECTS) {
+            SDL_UpdateWindowSurfaceRects(window, rects, 2);
+        } else {
+            SDL_UpdateWindowSurface(window);
+        }
+        while (SDL_PollEvent(&event)) {
+        }
+    }
+    end = SDL_GetPerformanceCounter();
+
+    SDL_Log("%-28s %8.1f frames/s %8.3f ms/frame\n", test->name,
+            (double)frames * SDL_GetPerformanceFrequency() / (end - start),
+            (double)(end - start) * 1000.0 / SDL_GetPerformanceFrequency() / frames);
+
+    SDL_DestroyWindow(window);
+}
+
+int
+main(int argc, char *argv[])
+{
+    int w = DEFAULT_WIDTH;
+    int h = DEFAULT_HEIGHT;
+    int frames = DEFAULT_FRAMES;
+    const char *filter = NULL;
+    int i;
+
+    /* Enable standard application logging */
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    for (i = 1; i < argc; ++i) {
+        if (SDL_strcmp(argv[i], "--frames") == 0 && argv[i + 1]) {
+            frames = SDL_atoi(argv[++i]);
+            if (frames <= 0) {
+                frames = 1;
+            }
+        } else if (SDL_strcmp(argv[i], "--size") == 0 && argv[i + 1]) {
+            if (SDL_sscanf(argv[++i], "%dx%d", &w, &h) != 2 ||
+                w <= SPRITE_SIZE || h <= SPRITE_SIZE) {
+                SDL_Log("Invalid size '%s'\n", argv[i]);
+                return 1;
+            }
+        } else if (SDL_strcmp(argv[i], "--thread") == 0) {
+            SDL_SetHint(SDL_HINT_FRAMEBUFFER_THREAD, "1");
+        } else if (argv[i][0] != '-') {
+            filter = argv[i];
+        } else {
+            SDL_Log("Usage: %s [--frames N] [--size WxH] [--thread] [filter]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    if (SDL_Init(SDL_INIT_VIDEO) < 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't initialize SDL: %s\n", SDL_GetError());
+        return 1;
+    }
+
+    SDL_Log("Presenting %dx%d on '%s', %d frames per case\n",
+            w, h, SDL_GetCurrentVideoDriver(), frames);
+    for (i = 0; i < SDL_arraysize(update_cases); ++i) {
+        if (filter && !SDL_strstr(update_cases[i].name, filter)) {
+            continue;
+        }
+        RunCase(&update_cases[i], w, h, frames);
+    }
+
+    SDL_Quit();
+    return 0;
+}
+
+/* vi: set ts=4 sw=4 expandtab: */